@@ -23,6 +23,7 @@
 #include "comms/comms.h"
 
 #include "MsgId.h"
+#include "names.h"
 
 namespace ublox
 {
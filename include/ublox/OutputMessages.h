@@ -0,0 +1,435 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::OutputMessages bundle.
+
+#pragma once
+
+#include <tuple>
+
+#include "Message.h"
+
+#include "message/NavPosecefPoll.h"
+#include "message/NavPosllhPoll.h"
+#include "message/NavStatusPoll.h"
+#include "message/NavDopPoll.h"
+#include "message/NavSolPoll.h"
+#include "message/NavPvtPoll.h"
+#include "message/NavOdoPoll.h"
+#include "message/NavResetodo.h"
+#include "message/NavVelecefPoll.h"
+#include "message/NavVelnedPoll.h"
+#include "message/NavTimegpsPoll.h"
+#include "message/NavTimeutcPoll.h"
+#include "message/NavClockPoll.h"
+#include "message/NavTimegloPoll.h"
+#include "message/NavTimebdsPoll.h"
+#include "message/NavTimegalPoll.h"
+#include "message/NavTimelsPoll.h"
+#include "message/NavSvinfoPoll.h"
+#include "message/NavDgpsPoll.h"
+#include "message/NavSbasPoll.h"
+#include "message/NavOrbPoll.h"
+#include "message/NavSatPoll.h"
+#include "message/NavGeofencePoll.h"
+#include "message/NavEkfstatusPoll.h"
+#include "message/NavAopstatusPoll.h"
+
+#include "message/RxmRawPoll.h"
+#include "message/RxmRawxPoll.h"
+#include "message/RxmSvsiPoll.h"
+#include "message/RxmAlmPoll.h"
+#include "message/RxmAlmPollSv.h"
+#include "message/RxmEphPoll.h"
+#include "message/RxmEphPollSv.h"
+#include "message/RxmPmreq.h"
+#include "message/RxmPmreqV0.h"
+#include "message/RxmImesPoll.h"
+
+#include "message/CfgPrtDdc.h"
+#include "message/CfgPrtPoll.h"
+#include "message/CfgPrtPollPort.h"
+#include "message/CfgPrtSpi.h"
+#include "message/CfgPrtUart.h"
+#include "message/CfgPrtUsb.h"
+#include "message/CfgMsg.h"
+#include "message/CfgMsgCurrent.h"
+#include "message/CfgMsgPoll.h"
+#include "message/CfgInf.h"
+#include "message/CfgInfPoll.h"
+#include "message/CfgRst.h"
+#include "message/CfgDatPoll.h"
+#include "message/CfgDatStandard.h"
+#include "message/CfgDatUser.h"
+#include "message/CfgTp.h"
+#include "message/CfgTpPoll.h"
+#include "message/CfgRate.h"
+#include "message/CfgRatePoll.h"
+#include "message/CfgCfg.h"
+#include "message/CfgFxn.h"
+#include "message/CfgFxnPoll.h"
+#include "message/CfgRxm.h"
+#include "message/CfgRxmPoll.h"
+#include "message/CfgEkf.h"
+#include "message/CfgEkfPoll.h"
+#include "message/CfgAnt.h"
+#include "message/CfgAntPoll.h"
+#include "message/CfgSbas.h"
+#include "message/CfgSbasPoll.h"
+#include "message/CfgNmea.h"
+#include "message/CfgNmeaExt.h"
+#include "message/CfgNmeaExtV1.h"
+#include "message/CfgNmeaPoll.h"
+#include "message/CfgUsb.h"
+#include "message/CfgUsbPoll.h"
+#include "message/CfgTmode.h"
+#include "message/CfgTmodePoll.h"
+#include "message/CfgOdo.h"
+#include "message/CfgOdoPoll.h"
+#include "message/CfgNvs.h"
+#include "message/CfgNavx5.h"
+#include "message/CfgNavx5Poll.h"
+#include "message/CfgNav5.h"
+#include "message/CfgNav5Poll.h"
+#include "message/CfgEsfgwt.h"
+#include "message/CfgEsfgwtPoll.h"
+#include "message/CfgTp5.h"
+#include "message/CfgTp5Poll.h"
+#include "message/CfgTp5PollSelect.h"
+#include "message/CfgPm.h"
+#include "message/CfgPmPoll.h"
+#include "message/CfgRinv.h"
+#include "message/CfgRinvPoll.h"
+#include "message/CfgItfm.h"
+#include "message/CfgItfmPoll.h"
+#include "message/CfgPm2.h"
+#include "message/CfgPm2Poll.h"
+#include "message/CfgTmode2.h"
+#include "message/CfgTmode2Poll.h"
+#include "message/CfgGnss.h"
+#include "message/CfgGnssPoll.h"
+#include "message/CfgLogfilter.h"
+#include "message/CfgLogfilterPoll.h"
+#include "message/CfgTxslot.h"
+#include "message/CfgPwr.h"
+#include "message/CfgEsrc.h"
+#include "message/CfgEsrcPoll.h"
+#include "message/CfgDosc.h"
+#include "message/CfgDoscPoll.h"
+#include "message/CfgSmgr.h"
+#include "message/CfgSmgrPoll.h"
+#include "message/CfgGeofence.h"
+#include "message/CfgGeofencePoll.h"
+#include "message/CfgFixseed.h"
+#include "message/CfgDynseed.h"
+#include "message/CfgPms.h"
+#include "message/CfgPmsPoll.h"
+
+#include "message/UpdSosClear.h"
+#include "message/UpdSosCreate.h"
+#include "message/UpdSosPoll.h"
+
+#include "message/MonIoPoll.h"
+#include "message/MonVerPoll.h"
+#include "message/MonMsgppPoll.h"
+#include "message/MonRxbufPoll.h"
+#include "message/MonTxbufPoll.h"
+#include "message/MonHwPoll.h"
+#include "message/MonHw2Poll.h"
+#include "message/MonPatchPoll.h"
+#include "message/MonGnssPoll.h"
+
+#include "message/AidIni.h"
+#include "message/AidIniPoll.h"
+#include "message/AidHui.h"
+#include "message/AidHuiPoll.h"
+#include "message/AidData.h"
+#include "message/AidAlm.h"
+#include "message/AidAlmPoll.h"
+#include "message/AidAlmPollSv.h"
+#include "message/AidEph.h"
+#include "message/AidEphPoll.h"
+#include "message/AidEphPollSv.h"
+#include "message/AidAlpsrv.h"
+#include "message/AidAlpsrvUpdate.h"
+#include "message/AidAop.h"
+#include "message/AidAopPoll.h"
+#include "message/AidAopPollSv.h"
+#include "message/AidAopU8.h"
+#include "message/AidAlpData.h"
+
+#include "message/TimTpPoll.h"
+#include "message/TimTm2Poll.h"
+#include "message/TimSvinPoll.h"
+#include "message/TimVrfyPoll.h"
+#include "message/TimVcocalExt.h"
+#include "message/TimVcocalPoll.h"
+#include "message/TimVcocalStop.h"
+#include "message/TimFchgPoll.h"
+#include "message/TimHoc.h"
+
+#include "message/EsfStatusPoll.h"
+
+#include "message/MgaGpsAlm.h"
+#include "message/MgaGpsEph.h"
+#include "message/MgaGpsHealth.h"
+#include "message/MgaGpsIono.h"
+#include "message/MgaGpsUtc.h"
+#include "message/MgaGalAlm.h"
+#include "message/MgaGalEph.h"
+#include "message/MgaGalTimeoffset.h"
+#include "message/MgaGalUtc.h"
+#include "message/MgaBdsAlm.h"
+#include "message/MgaBdsEph.h"
+#include "message/MgaBdsHealth.h"
+#include "message/MgaBdsIono.h"
+#include "message/MgaBdsUtc.h"
+#include "message/MgaQzssAlm.h"
+#include "message/MgaQzssEph.h"
+#include "message/MgaQzssHealth.h"
+#include "message/MgaGloAlm.h"
+#include "message/MgaGloEph.h"
+#include "message/MgaGloTimeoffset.h"
+#include "message/MgaAno.h"
+#include "message/MgaFlashData.h"
+#include "message/MgaFlashStop.h"
+#include "message/MgaIniClkd.h"
+#include "message/MgaIniEop.h"
+#include "message/MgaIniFreq.h"
+#include "message/MgaIniPosLlh.h"
+#include "message/MgaIniPosXyz.h"
+#include "message/MgaIniTimeGnss.h"
+#include "message/MgaIniTimeUtc.h"
+#include "message/MgaDbd.h"
+#include "message/MgaDbdPoll.h"
+
+#include "message/LogErase.h"
+#include "message/LogString.h"
+#include "message/LogCreate.h"
+#include "message/LogInfoPoll.h"
+#include "message/LogRetrieve.h"
+#include "message/LogFindtimeCmd.h"
+
+namespace ublox
+{
+
+/// @brief All output messages (the ones that can be sent by the host to
+///     u-blox receiver) are bundled in std::tuple.
+/// @details The messages appear in order of their numeric IDs, the
+///     variants sharing the same ID (polls, set messages with different
+///     payload layouts) are adjacent.
+/// @tparam TMessage Common message interface class
+template <typename TMessage = Message>
+using OutputMessages =
+    std::tuple<
+        message::NavPosecefPoll<TMessage>,
+        message::NavPosllhPoll<TMessage>,
+        message::NavStatusPoll<TMessage>,
+        message::NavDopPoll<TMessage>,
+        message::NavSolPoll<TMessage>,
+        message::NavPvtPoll<TMessage>,
+        message::NavOdoPoll<TMessage>,
+        message::NavResetodo<TMessage>,
+        message::NavVelecefPoll<TMessage>,
+        message::NavVelnedPoll<TMessage>,
+        message::NavTimegpsPoll<TMessage>,
+        message::NavTimeutcPoll<TMessage>,
+        message::NavClockPoll<TMessage>,
+        message::NavTimegloPoll<TMessage>,
+        message::NavTimebdsPoll<TMessage>,
+        message::NavTimegalPoll<TMessage>,
+        message::NavTimelsPoll<TMessage>,
+        message::NavSvinfoPoll<TMessage>,
+        message::NavDgpsPoll<TMessage>,
+        message::NavSbasPoll<TMessage>,
+        message::NavOrbPoll<TMessage>,
+        message::NavSatPoll<TMessage>,
+        message::NavGeofencePoll<TMessage>,
+        message::NavEkfstatusPoll<TMessage>,
+        message::NavAopstatusPoll<TMessage>,
+        message::RxmRawPoll<TMessage>,
+        message::RxmRawxPoll<TMessage>,
+        message::RxmSvsiPoll<TMessage>,
+        message::RxmAlmPoll<TMessage>,
+        message::RxmAlmPollSv<TMessage>,
+        message::RxmEphPoll<TMessage>,
+        message::RxmEphPollSv<TMessage>,
+        message::RxmPmreq<TMessage>,
+        message::RxmPmreqV0<TMessage>,
+        message::RxmImesPoll<TMessage>,
+        message::CfgPrtDdc<TMessage>,
+        message::CfgPrtPoll<TMessage>,
+        message::CfgPrtPollPort<TMessage>,
+        message::CfgPrtSpi<TMessage>,
+        message::CfgPrtUart<TMessage>,
+        message::CfgPrtUsb<TMessage>,
+        message::CfgMsg<TMessage>,
+        message::CfgMsgCurrent<TMessage>,
+        message::CfgMsgPoll<TMessage>,
+        message::CfgInf<TMessage>,
+        message::CfgInfPoll<TMessage>,
+        message::CfgRst<TMessage>,
+        message::CfgDatPoll<TMessage>,
+        message::CfgDatStandard<TMessage>,
+        message::CfgDatUser<TMessage>,
+        message::CfgTp<TMessage>,
+        message::CfgTpPoll<TMessage>,
+        message::CfgRate<TMessage>,
+        message::CfgRatePoll<TMessage>,
+        message::CfgCfg<TMessage>,
+        message::CfgFxn<TMessage>,
+        message::CfgFxnPoll<TMessage>,
+        message::CfgRxm<TMessage>,
+        message::CfgRxmPoll<TMessage>,
+        message::CfgEkf<TMessage>,
+        message::CfgEkfPoll<TMessage>,
+        message::CfgAnt<TMessage>,
+        message::CfgAntPoll<TMessage>,
+        message::CfgSbas<TMessage>,
+        message::CfgSbasPoll<TMessage>,
+        message::CfgNmea<TMessage>,
+        message::CfgNmeaExt<TMessage>,
+        message::CfgNmeaExtV1<TMessage>,
+        message::CfgNmeaPoll<TMessage>,
+        message::CfgUsb<TMessage>,
+        message::CfgUsbPoll<TMessage>,
+        message::CfgTmode<TMessage>,
+        message::CfgTmodePoll<TMessage>,
+        message::CfgOdo<TMessage>,
+        message::CfgOdoPoll<TMessage>,
+        message::CfgNvs<TMessage>,
+        message::CfgNavx5<TMessage>,
+        message::CfgNavx5Poll<TMessage>,
+        message::CfgNav5<TMessage>,
+        message::CfgNav5Poll<TMessage>,
+        message::CfgEsfgwt<TMessage>,
+        message::CfgEsfgwtPoll<TMessage>,
+        message::CfgTp5<TMessage>,
+        message::CfgTp5Poll<TMessage>,
+        message::CfgTp5PollSelect<TMessage>,
+        message::CfgPm<TMessage>,
+        message::CfgPmPoll<TMessage>,
+        message::CfgRinv<TMessage>,
+        message::CfgRinvPoll<TMessage>,
+        message::CfgItfm<TMessage>,
+        message::CfgItfmPoll<TMessage>,
+        message::CfgPm2<TMessage>,
+        message::CfgPm2Poll<TMessage>,
+        message::CfgTmode2<TMessage>,
+        message::CfgTmode2Poll<TMessage>,
+        message::CfgGnss<TMessage>,
+        message::CfgGnssPoll<TMessage>,
+        message::CfgLogfilter<TMessage>,
+        message::CfgLogfilterPoll<TMessage>,
+        message::CfgTxslot<TMessage>,
+        message::CfgPwr<TMessage>,
+        message::CfgEsrc<TMessage>,
+        message::CfgEsrcPoll<TMessage>,
+        message::CfgDosc<TMessage>,
+        message::CfgDoscPoll<TMessage>,
+        message::CfgSmgr<TMessage>,
+        message::CfgSmgrPoll<TMessage>,
+        message::CfgGeofence<TMessage>,
+        message::CfgGeofencePoll<TMessage>,
+        message::CfgFixseed<TMessage>,
+        message::CfgDynseed<TMessage>,
+        message::CfgPms<TMessage>,
+        message::CfgPmsPoll<TMessage>,
+        message::UpdSosClear<TMessage>,
+        message::UpdSosCreate<TMessage>,
+        message::UpdSosPoll<TMessage>,
+        message::MonIoPoll<TMessage>,
+        message::MonVerPoll<TMessage>,
+        message::MonMsgppPoll<TMessage>,
+        message::MonRxbufPoll<TMessage>,
+        message::MonTxbufPoll<TMessage>,
+        message::MonHwPoll<TMessage>,
+        message::MonHw2Poll<TMessage>,
+        message::MonPatchPoll<TMessage>,
+        message::MonGnssPoll<TMessage>,
+        message::AidIni<TMessage>,
+        message::AidIniPoll<TMessage>,
+        message::AidHui<TMessage>,
+        message::AidHuiPoll<TMessage>,
+        message::AidData<TMessage>,
+        message::AidAlm<TMessage>,
+        message::AidAlmPoll<TMessage>,
+        message::AidAlmPollSv<TMessage>,
+        message::AidEph<TMessage>,
+        message::AidEphPoll<TMessage>,
+        message::AidEphPollSv<TMessage>,
+        message::AidAlpsrv<TMessage>,
+        message::AidAlpsrvUpdate<TMessage>,
+        message::AidAop<TMessage>,
+        message::AidAopPoll<TMessage>,
+        message::AidAopPollSv<TMessage>,
+        message::AidAopU8<TMessage>,
+        message::AidAlpData<TMessage>,
+        message::TimTpPoll<TMessage>,
+        message::TimTm2Poll<TMessage>,
+        message::TimSvinPoll<TMessage>,
+        message::TimVrfyPoll<TMessage>,
+        message::TimVcocalExt<TMessage>,
+        message::TimVcocalPoll<TMessage>,
+        message::TimVcocalStop<TMessage>,
+        message::TimFchgPoll<TMessage>,
+        message::TimHoc<TMessage>,
+        message::EsfStatusPoll<TMessage>,
+        message::MgaGpsAlm<TMessage>,
+        message::MgaGpsEph<TMessage>,
+        message::MgaGpsHealth<TMessage>,
+        message::MgaGpsIono<TMessage>,
+        message::MgaGpsUtc<TMessage>,
+        message::MgaGalAlm<TMessage>,
+        message::MgaGalEph<TMessage>,
+        message::MgaGalTimeoffset<TMessage>,
+        message::MgaGalUtc<TMessage>,
+        message::MgaBdsAlm<TMessage>,
+        message::MgaBdsEph<TMessage>,
+        message::MgaBdsHealth<TMessage>,
+        message::MgaBdsIono<TMessage>,
+        message::MgaBdsUtc<TMessage>,
+        message::MgaQzssAlm<TMessage>,
+        message::MgaQzssEph<TMessage>,
+        message::MgaQzssHealth<TMessage>,
+        message::MgaGloAlm<TMessage>,
+        message::MgaGloEph<TMessage>,
+        message::MgaGloTimeoffset<TMessage>,
+        message::MgaAno<TMessage>,
+        message::MgaFlashData<TMessage>,
+        message::MgaFlashStop<TMessage>,
+        message::MgaIniClkd<TMessage>,
+        message::MgaIniEop<TMessage>,
+        message::MgaIniFreq<TMessage>,
+        message::MgaIniPosLlh<TMessage>,
+        message::MgaIniPosXyz<TMessage>,
+        message::MgaIniTimeGnss<TMessage>,
+        message::MgaIniTimeUtc<TMessage>,
+        message::MgaDbd<TMessage>,
+        message::MgaDbdPoll<TMessage>,
+        message::LogErase<TMessage>,
+        message::LogString<TMessage>,
+        message::LogCreate<TMessage>,
+        message::LogInfoPoll<TMessage>,
+        message::LogRetrieve<TMessage>,
+        message::LogFindtimeCmd<TMessage>
+    >;
+
+}  // namespace ublox
+
+
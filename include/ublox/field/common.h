@@ -21,7 +21,11 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
+#include <vector>
+#include <algorithm>
+#include <type_traits>
 
 #include "comms/comms.h"
 
@@ -388,30 +392,30 @@ using BundleT =
 struct res5 : public BundleT<std::tuple<res1, res4> >
 {
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-    ///     related to @b comms::field::Bitfield class from COMMS library
-    ///     for details.
-    COMMS_FIELD_MEMBERS_ACCESS(part1, part2);
+    /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+    ///     names of the member fields.
+    UBLOX_FIELD_MEMBERS_ACCESS(part1, part2);
 };
 
 /// @brief Common definition of reserved 6 bytes field
 struct res6 : public BundleT<std::tuple<res2, res4> >
 {
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-    ///     related to @b comms::field::Bitfield class from COMMS library
-    ///     for details.
-    COMMS_FIELD_MEMBERS_ACCESS(part1, part2);
+    /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+    ///     names of the member fields.
+    UBLOX_FIELD_MEMBERS_ACCESS(part1, part2);
 };
 
 /// @brief Common definition of reserved 7 bytes field
 struct res7 : public BundleT<std::tuple<res3, res4> >
 {
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-    ///     related to @b comms::field::Bitfield class from COMMS library
-    ///     for details.
-    COMMS_FIELD_MEMBERS_ACCESS(part1, part2);
+    /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+    ///     names of the member fields.
+    UBLOX_FIELD_MEMBERS_ACCESS(part1, part2);
 };
 
 /// @brief Definition of common @b iTOW field used in multiple messages in
@@ -494,6 +498,287 @@ using utcStandardT =
 /// @brief Definition of common "utcStandard" field.
 using utcStandard = utcStandardT<>;
 
+namespace details
+{
+
+template <bool TIsIntegral>
+struct ListElemMinLengthHelper;
+
+template <>
+struct ListElemMinLengthHelper<true>
+{
+    template <typename TElem>
+    static constexpr std::size_t get()
+    {
+        return sizeof(TElem);
+    }
+};
+
+template <>
+struct ListElemMinLengthHelper<false>
+{
+    template <typename TElem>
+    static constexpr std::size_t get()
+    {
+        return TElem::minLength();
+    }
+};
+
+template <typename TElem>
+constexpr std::size_t listElemMinLength()
+{
+    return ListElemMinLengthHelper<std::is_integral<TElem>::value>::template get<TElem>();
+}
+
+template <typename TStorage>
+void reserveListStorage(TStorage&, std::size_t, std::size_t)
+{
+    // Other storage types (static vectors, views) do not reallocate.
+}
+
+template <typename TElem, typename TAlloc>
+void reserveListStorage(std::vector<TElem, TAlloc>& storage, std::size_t count, std::size_t len)
+{
+    std::size_t elemLen = listElemMinLength<TElem>();
+    if (elemLen == 0U) {
+        elemLen = 1U;
+    }
+
+    storage.reserve(std::min(count, len / elemLen));
+}
+
+}  // namespace details
+
+/// @brief Force number of elements to read into a list field.
+/// @details Invokes @b forceReadElemCount() member function of the provided
+///     list field and reserves storage for the expected number of
+///     elements up front when the default @b std::vector storage is used,
+///     avoiding reallocations while the elements are being read. The
+///     reservation is capped by the amount of elements that can fit into
+///     the remaining @b len bytes, so corrupted count values do not cause
+///     excessive allocations.
+/// @param[in, out] field List field (@b comms::field::ArrayList).
+/// @param[in] count Number of elements to read.
+/// @param[in] len Number of remaining bytes in the input buffer.
+template <typename TField>
+void forceReadElemCount(TField& field, std::size_t count, std::size_t len)
+{
+    field.forceReadElemCount(count);
+    details::reserveListStorage(field.value(), count, len);
+}
+
+namespace details
+{
+
+#if (defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)) || \
+    defined(_MSC_VER)
+static constexpr bool IsLittleEndianHost = true;
+#else
+static constexpr bool IsLittleEndianHost = false;
+#endif
+
+template <typename TElem, bool TIsIntegral = std::is_integral<TElem>::value>
+struct BulkListElem
+{
+    typedef TElem ValueType;
+
+    static constexpr bool Supported = true;
+
+    static ValueType& valueOf(TElem& elem)
+    {
+        return elem;
+    }
+};
+
+template <typename TElem>
+struct BulkListElem<TElem, false>
+{
+    typedef typename TElem::ValueType ValueType;
+
+    static constexpr bool Supported =
+        std::is_integral<ValueType>::value &&
+        (TElem::minLength() == sizeof(ValueType)) &&
+        (TElem::maxLength() == sizeof(ValueType));
+
+    static ValueType& valueOf(TElem& elem)
+    {
+        return elem.value();
+    }
+};
+
+template <typename TIter>
+struct IsByteIter
+{
+    typedef typename std::remove_cv<typename std::remove_pointer<TIter>::type>::type ElemType;
+
+    static constexpr bool Value =
+        std::is_pointer<TIter>::value &&
+        std::is_integral<ElemType>::value &&
+        (sizeof(ElemType) == 1U);
+};
+
+template <typename TValue>
+TValue decodeLittleEndian(const std::uint8_t* bytes)
+{
+    typedef typename std::make_unsigned<TValue>::type UnsignedType;
+    UnsignedType result = 0U;
+    for (auto idx = 0U; idx < sizeof(TValue); ++idx) {
+        result |=
+            static_cast<UnsignedType>(
+                static_cast<UnsignedType>(bytes[idx]) << (idx * std::numeric_limits<std::uint8_t>::digits));
+    }
+    return static_cast<TValue>(result);
+}
+
+template <typename TElem, typename TAlloc>
+void bulkDecodeList(
+    std::vector<TElem, TAlloc>& storage,
+    const std::uint8_t* bytes,
+    std::size_t count,
+    std::true_type)
+{
+    storage.resize(count);
+    if (0U < count) {
+        std::memcpy(storage.data(), bytes, count * sizeof(TElem));
+    }
+}
+
+template <typename TElem, typename TAlloc>
+void bulkDecodeList(
+    std::vector<TElem, TAlloc>& storage,
+    const std::uint8_t* bytes,
+    std::size_t count,
+    std::false_type)
+{
+    typedef BulkListElem<TElem> ElemHelper;
+    typedef typename ElemHelper::ValueType ValueType;
+    storage.resize(count);
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        ElemHelper::valueOf(storage[idx]) =
+            decodeLittleEndian<ValueType>(bytes + (idx * sizeof(ValueType)));
+    }
+}
+
+template <typename TField, typename TStorage, typename TIter>
+comms::ErrorStatus readIntListDispatch(
+    TField& field,
+    TStorage&,
+    std::size_t,
+    TIter& iter,
+    std::size_t& len,
+    std::false_type)
+{
+    auto es = field.read(iter, len);
+    if (es == comms::ErrorStatus::Success) {
+        len -= field.length();
+    }
+    return es;
+}
+
+template <typename TField, typename TElem, typename TAlloc, typename TIter>
+comms::ErrorStatus readIntListDispatch(
+    TField&,
+    std::vector<TElem, TAlloc>& storage,
+    std::size_t count,
+    TIter& iter,
+    std::size_t& len,
+    std::true_type)
+{
+    typedef typename BulkListElem<TElem>::ValueType ValueType;
+    auto bytesCount = count * sizeof(ValueType);
+    if (len < bytesCount) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+
+    static constexpr bool MemcpyAllowed =
+        std::is_trivially_copyable<TElem>::value &&
+        (sizeof(TElem) == sizeof(ValueType)) &&
+        (IsLittleEndianHost || (sizeof(ValueType) == 1U));
+
+    auto* bytes = reinterpret_cast<const std::uint8_t*>(iter);
+    bulkDecodeList(storage, bytes, count, std::integral_constant<bool, MemcpyAllowed>());
+    iter += bytesCount;
+    len -= bytesCount;
+    return comms::ErrorStatus::Success;
+}
+
+template <typename TField, typename TStorage, typename TIter>
+comms::ErrorStatus readIntList(
+    TField& field,
+    TStorage& storage,
+    std::size_t count,
+    TIter& iter,
+    std::size_t& len)
+{
+    return readIntListDispatch(field, storage, count, iter, len, std::false_type());
+}
+
+template <typename TField, typename TElem, typename TAlloc, typename TIter>
+comms::ErrorStatus readIntList(
+    TField& field,
+    std::vector<TElem, TAlloc>& storage,
+    std::size_t count,
+    TIter& iter,
+    std::size_t& len)
+{
+    static constexpr bool BulkSupported =
+        BulkListElem<TElem>::Supported && IsByteIter<TIter>::Value;
+
+    return
+        readIntListDispatch(
+            field, storage, count, iter, len,
+            std::integral_constant<bool, BulkSupported>());
+}
+
+}  // namespace details
+
+/// @brief Read list of integral values in one go.
+/// @details When the list uses default @b std::vector storage, its elements
+///     are plain integers (raw bytes or @b comms::field::IntValue with
+///     native serialisation length), and the input iterator is a pointer
+///     to the raw bytes, the whole list is decoded with a single
+///     @b std::memcpy() on little endian hosts (or a tight byte assembly
+///     loop on big endian ones) instead of reading the elements one by one.
+///     Otherwise the read is forwarded to the field itself, which must
+///     already be configured (see @ref forceReadElemCount()) to consume
+///     @b count elements.
+/// @param[in, out] field List field (@b comms::field::ArrayList).
+/// @param[in] count Number of elements to read.
+/// @param[in, out] iter Input iterator, advanced past the read data.
+/// @param[in, out] len Number of remaining bytes, reduced by the amount
+///     of consumed ones.
+/// @return Status of the read operation.
+template <typename TField, typename TIter>
+comms::ErrorStatus readIntList(
+    TField& field,
+    std::size_t count,
+    TIter& iter,
+    std::size_t& len)
+{
+    return details::readIntList(field, field.value(), count, iter, len);
+}
+
+/// @brief Read list of integral values which occupies all the remaining
+///     input in one go.
+/// @details Similar to @ref readIntList(TField&, std::size_t, TIter&, std::size_t&),
+///     but the number of elements is determined by the remaining length.
+/// @return Status of the read operation, @b comms::ErrorStatus::NotEnoughData
+///     in case the remaining length is not a multiple of the element length.
+template <typename TField, typename TIter>
+comms::ErrorStatus readIntList(
+    TField& field,
+    TIter& iter,
+    std::size_t& len)
+{
+    typedef typename std::decay<decltype(field.value())>::type StorageType;
+    typedef typename StorageType::value_type ElemType;
+    auto elemLen = details::listElemMinLength<ElemType>();
+    if ((len % elemLen) != 0U) {
+        return comms::ErrorStatus::NotEnoughData;
+    }
+    return readIntList(field, len / elemLen, iter, len);
+}
+
 }  // namespace common
 
 }  // namespace field
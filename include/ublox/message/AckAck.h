@@ -46,7 +46,7 @@ struct AckAckFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AckAckFields for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class AckAck : public
@@ -65,13 +65,13 @@ class AckAck : public
     > Base;
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b id for @ref AckAckFields::id field
-    COMMS_MSG_FIELDS_ACCESS(id);
+    UBLOX_MSG_FIELDS_ACCESS(id);
 
     /// @brief Default constructor
     AckAck() = default;
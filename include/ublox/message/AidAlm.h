@@ -66,7 +66,7 @@ struct AidAlmFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlmFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDwrdOpt Extra option(s) for @b dwrd field
 template <typename TMsgBase = Message, typename TDwrdOpt = comms::option::EmptyOption>
@@ -88,15 +88,15 @@ class AidAlm : public
     > Base;
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b svid for @ref AidAlmFields::svid field
     ///     @li @b week for @ref AidAlmFields::week field
     ///     @li @b dwrd for @ref AidAlmFields::dwrd field
-    COMMS_MSG_FIELDS_ACCESS(svid, week, dwrd);
+    UBLOX_MSG_FIELDS_ACCESS(svid, week, dwrd);
 
     /// @brief Default constructor
     /// @details Marks "dwrd" (see @ref AidAlmFields::dwrd) to be missing.
@@ -46,7 +46,7 @@ struct AidAlmPollSvFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlmPollSvFields for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class AidAlmPollSv : public
@@ -66,13 +66,13 @@ class AidAlmPollSv : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b svid for @ref AidAlmPollSvFields::svid field
-    COMMS_MSG_FIELDS_ACCESS(svid);
+    UBLOX_MSG_FIELDS_ACCESS(svid);
 
     /// @brief Default constructor
     AidAlmPollSv() = default;
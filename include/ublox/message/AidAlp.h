@@ -84,7 +84,7 @@ struct AidAlpFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlpFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class AidAlp : public
@@ -104,9 +104,9 @@ class AidAlp : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b predTow for @ref AidAlpFields::predTow field
@@ -118,7 +118,7 @@ public:
     ///     @li @b svs for @ref AidAlpFields::svs field
     ///     @li @b reserved2 for @ref AidAlpFields::reserved2 field
     ///     @li @b reserved3 for @ref AidAlpFields::reserved3 field
-    COMMS_MSG_FIELDS_ACCESS(predTow, predDur, age, predWno, almWno, reserved1, svs, reserved2, reserved3);
+    UBLOX_MSG_FIELDS_ACCESS(predTow, predDur, age, predWno, almWno, reserved1, svs, reserved2, reserved3);
 
     /// @brief Default constructor
     AidAlp() = default;
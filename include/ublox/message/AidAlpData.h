@@ -58,7 +58,7 @@ struct AidAlpDataFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlpDataFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TAlpDataOpt Extra option(s) for @b alpData field
 template <typename TMsgBase = Message, typename TAlpDataOpt = comms::option::EmptyOption>
@@ -72,13 +72,13 @@ class AidAlpData : public
 {
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b alpData for @ref AidAlpDataFields::alpData field
-    COMMS_MSG_FIELDS_ACCESS(alpData);
+    UBLOX_MSG_FIELDS_ACCESS(alpData);
 
     /// @brief Default constructor
     AidAlpData() = default;
@@ -97,6 +97,16 @@ public:
 
     /// @brief Move assignment
     AidAlpData& operator=(AidAlpData&&) = default;
+
+    /// @brief Provides custom read functionality.
+    /// @details The @b alpData (@ref AidAlpDataFields::alpData) list occupies
+    ///     all the remaining payload and is decoded in one go
+    ///     (see @ref ublox::field::common::readIntList()).
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t len)
+    {
+        return field::common::readIntList(field_alpData(), iter, len);
+    }
 };
 
 
@@ -70,7 +70,7 @@ struct AidAlpStatusFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlpStatusFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class AidAlpStatus : public
@@ -90,13 +90,13 @@ class AidAlpStatus : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b status for @ref AidAlpStatusFields::status field
-    COMMS_MSG_FIELDS_ACCESS(status);
+    UBLOX_MSG_FIELDS_ACCESS(status);
 
     /// @brief Default constructor
     AidAlpStatus() = default;
@@ -98,7 +98,7 @@ struct AidAlpsrvFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlpsrvFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -120,9 +120,9 @@ class AidAlpsrv : public
     > Base;
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b idSize for @ref AidAlpsrvFields::idSize field
@@ -135,7 +135,7 @@ public:
     ///     @li @b id2 for @ref AidAlpsrvFields::id2 field
     ///     @li @b id3 for @ref AidAlpsrvFields::id3 field
     ///     @li @b data for @ref AidAlpsrvFields::data field
-    COMMS_MSG_FIELDS_ACCESS(idSize, type, ofs, size, fileId, dataSize, id1, id2, id3, data);
+    UBLOX_MSG_FIELDS_ACCESS(idSize, type, ofs, size, fileId, dataSize, id1, id2, id3, data);
 
     /// @brief Default constructor
     AidAlpsrv() = default;
@@ -184,7 +184,7 @@ public:
 
         auto& dataSizeField = std::get<FieldIdx_dataSize>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
-        dataField.forceReadElemCount(dataSizeField.value());
+        field::common::forceReadElemCount(dataField, dataSizeField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
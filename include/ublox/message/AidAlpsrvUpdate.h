@@ -83,7 +83,7 @@ struct AidAlpsrvUpdateFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAlpsrvUpdateFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -106,9 +106,9 @@ class AidAlpsrvUpdate : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b idSize for @ref AidAlpsrvUpdateFields::idSize field
@@ -117,7 +117,7 @@ public:
     ///     @li @b size for @ref AidAlpsrvUpdateFields::size field
     ///     @li @b fileId for @ref AidAlpsrvUpdateFields::fileId field
     ///     @li @b data for @ref AidAlpsrvUpdateFields::data field
-    COMMS_MSG_FIELDS_ACCESS(idSize, type, ofs, size, fileId, data);
+    UBLOX_MSG_FIELDS_ACCESS(idSize, type, ofs, size, fileId, data);
 
     /// @brief Default constructor
     AidAlpsrvUpdate() = default;
@@ -166,7 +166,7 @@ public:
 
         auto& sizeField = std::get<FieldIdx_size>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
-        dataField.forceReadElemCount(sizeField.value());
+        field::common::forceReadElemCount(dataField, sizeField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
@@ -76,7 +76,7 @@ struct AidAopFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAopFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 /// @tparam TOptionalOpt Extra option(s) for @b optional field
@@ -101,15 +101,15 @@ class AidAop : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b svid for @ref AidAopFields::svid field
     ///     @li @b data for @ref AidAopFields::data field
     ///     @li @b optional for @ref AidAopFields::optional field
-    COMMS_MSG_FIELDS_ACCESS(svid, data, optional);
+    UBLOX_MSG_FIELDS_ACCESS(svid, data, optional);
 
     /// @brief Default constructor
     AidAop() = default;
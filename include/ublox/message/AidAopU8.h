@@ -71,7 +71,7 @@ struct AidAopU8Fields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidAopU8Fields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <
@@ -94,16 +94,16 @@ class AidAopU8 : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b gnssId for @ref AidAopU8Fields::gnssId field
     ///     @li @b svid for @ref AidAopU8Fields::svid field
     ///     @li @b reserved1 for @ref AidAopU8Fields::reserved1 field
     ///     @li @b data for @ref AidAopU8Fields::data field
-    COMMS_MSG_FIELDS_ACCESS(gnssId, svid, reserved1, data);
+    UBLOX_MSG_FIELDS_ACCESS(gnssId, svid, reserved1, data);
 
     /// @brief Default constructor
     AidAopU8() = default;
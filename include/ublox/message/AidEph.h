@@ -39,6 +39,9 @@ struct AidEphFields
     /// @brief Definition of "how" field.
     using how = field::common::U4;
 
+    /// @brief Number of words in each of @ref sf1d, @ref sf2d, and @ref sf3d lists.
+    static const std::size_t SfWordsCount = 8;
+
     /// @brief Definition of "sf1d" field.
     /// @tparam TOpt Extra option(s)
     template <typename TOpt = comms::option::EmptyOption>
@@ -46,7 +49,7 @@ struct AidEphFields
         field::common::OptionalT<
             field::common::ListT<
                 field::common::U4,
-                comms::option::SequenceFixedSize<8>,
+                comms::option::SequenceFixedSize<SfWordsCount>,
                 TOpt
             >
         >;
@@ -78,7 +81,7 @@ struct AidEphFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidEphFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TSfOpt Extra option(s) for @b sfXd field
 template <typename TMsgBase = Message, typename TSfOpt = comms::option::EmptyOption>
@@ -100,9 +103,9 @@ class AidEph : public
     > Base;
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b svid for @ref AidEphFields::svid field
@@ -110,7 +113,7 @@ public:
     ///     @li @b sf1d for @ref AidEphFields::sf1d field
     ///     @li @b sf2d for @ref AidEphFields::sf2d field
     ///     @li @b sf3d for @ref AidEphFields::sf3d field
-    COMMS_MSG_FIELDS_ACCESS(svid, how, sf1d, sf2d, sf3d);
+    UBLOX_MSG_FIELDS_ACCESS(svid, how, sf1d, sf2d, sf3d);
 
     /// @brief Default constructor
     /// @details Marks "sf1d" (see @ref AidEphFields::sf1d),
@@ -143,7 +146,8 @@ public:
     ///     "sf2d" (see @ref AidEphFields::sf2d), and "sf3d" (see @ref AidEphFields::sf3d)
     ///     is determined by the contents of "how" (see @ref AidEphFields::how)
     ///     field. If the value of the latter is 0, the "sfXd" fields are marked to
-    ///     be missing, otherwise they exist.
+    ///     be missing, otherwise they exist and their words are decoded
+    ///     in one go (see @ref ublox::field::common::readIntList()).
     template <typename TIter>
     comms::ErrorStatus doRead(TIter& iter, std::size_t len)
     {
@@ -165,7 +169,21 @@ public:
         sf1dField.setMode(sfMode);
         sf2dField.setMode(sfMode);
         sf3dField.setMode(sfMode);
-        return Base::template readFieldsFrom<FieldIdx_sf1d>(iter, len);
+        if (sfMode == comms::field::OptionalMode::Missing) {
+            return Base::template readFieldsFrom<FieldIdx_sf1d>(iter, len);
+        }
+
+        es = field::common::readIntList(sf1dField.field(), AidEphFields::SfWordsCount, iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        es = field::common::readIntList(sf2dField.field(), AidEphFields::SfWordsCount, iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return field::common::readIntList(sf3dField.field(), AidEphFields::SfWordsCount, iter, len);
     }
 
     /// @brief Provides custom refresh functionality
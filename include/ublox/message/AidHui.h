@@ -94,10 +94,10 @@ struct AidHuiFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(healthValid, utcValid, klobValid);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(healthValid, utcValid, klobValid);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -129,7 +129,7 @@ struct AidHuiFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidHuiFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class AidHui : public
@@ -149,9 +149,9 @@ class AidHui : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b health for @ref AidHuiFields::health field
@@ -173,7 +173,7 @@ public:
     ///     @li @b klobB2 for @ref AidHuiFields::klobB2 field
     ///     @li @b klobB3 for @ref AidHuiFields::klobB3 field
     ///     @li @b flags for @ref AidHuiFields::flags field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         health,
         utcA0,
         utcA1,
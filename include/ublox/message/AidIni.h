@@ -68,10 +68,10 @@ struct AidIniFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(fEdge=1, tm1=4, f1=6);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(fEdge=1, tm1=4, f1=6);
     };
 
     /// @brief Definition of "wno" field.
@@ -98,10 +98,10 @@ struct AidIniFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(month, year);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(month, year);
     };
 
     /// @brief Definition of "date" field.
@@ -137,10 +137,10 @@ struct AidIniFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(sec, min, hour, day);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(sec, min, hour, day);
     };
 
     /// @brief Definition of "time" field.
@@ -186,10 +186,10 @@ struct AidIniFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(pos, time, clockD, tp, clockF, lla, altInv, prevTm, utc=10);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(pos, time, clockD, tp, clockF, lla, altInv, prevTm, utc=10);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -222,7 +222,7 @@ struct AidIniFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref AidIniFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 ///
 ///     @b NOTE, that Ublox binary protocol specification reinterprets value of
 ///     some fields based on the value of some bits in @b flags (see @ref AidIniFields::flags)
@@ -254,9 +254,9 @@ class AidIni : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b ecefX for @ref AidIniFields::ecefX field
@@ -279,7 +279,7 @@ public:
     ///     @li @b clkDAcc for @ref AidIniFields::clkDAcc field
     ///     @li @b freqAcc for @ref AidIniFields::freqAcc field
     ///     @li @b flags for @ref AidIniFields::flags field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         ecefX,
         lat,
         ecefY,
@@ -41,10 +41,10 @@ struct CfgAntFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(svcs, csd, ocd, pdwnOnSCD, recovery);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(svcs, csd, ocd, pdwnOnSCD, recovery);
     };
 
     /// @brief Common definition of @b pinSwitch, @b pinSCD, and @b pinOCD member
@@ -59,10 +59,10 @@ struct CfgAntFields
     struct reconfig : public field::common::X1T<comms::option::FixedBitLength<1> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(bit);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(bit);
     };
 
     /// @brief Definition of "pins" field.
@@ -77,10 +77,10 @@ struct CfgAntFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(pinSwith, pinSCD, pinOCD, reconfig);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(pinSwith, pinSCD, pinOCD, reconfig);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -95,7 +95,7 @@ struct CfgAntFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgAntFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgAnt : public
@@ -115,14 +115,14 @@ class CfgAnt : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b flags for @ref CfgAntFields::flags field
     ///     @li @b pins for @ref CfgAntFields::pins field
-    COMMS_MSG_FIELDS_ACCESS(flags, pins);
+    UBLOX_MSG_FIELDS_ACCESS(flags, pins);
 
     /// @brief Default constructor
     CfgAnt() = default;
@@ -41,10 +41,10 @@ struct CfgCfgFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(ioPort, msgConf, infMsg, navConf, rxmConf, rinvConf=9, antConf, logConf, ftsConf);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(ioPort, msgConf, infMsg, navConf, rxmConf, rinvConf=9, antConf, logConf, ftsConf);
     };
 
     /// @brief Definition of "clearMask" field.
@@ -61,10 +61,10 @@ struct CfgCfgFields
             field::common::X1T<comms::option::BitmaskReservedBits<0xe8, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(devBBR, devFlash, devEEPROM, devSpiFlash=4);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(devBBR, devFlash, devEEPROM, devSpiFlash=4);
     };
 
     /// @brief Definition of optional "deviceMask" field.
@@ -84,7 +84,7 @@ struct CfgCfgFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgCfgFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgCfg : public
@@ -104,16 +104,16 @@ class CfgCfg : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b clearMask for @ref CfgCfgFields::clearMask field
     ///     @li @b saveMask for @ref CfgCfgFields::saveMask field
     ///     @li @b loadMask for @ref CfgCfgFields::loadMask field
     ///     @li @b deviceMask for @ref CfgCfgFields::deviceMask field
-    COMMS_MSG_FIELDS_ACCESS(clearMask, saveMask, loadMask, deviceMask);
+    UBLOX_MSG_FIELDS_ACCESS(clearMask, saveMask, loadMask, deviceMask);
 
     /// @brief Default constructor
     CfgCfg()
@@ -91,7 +91,7 @@ struct CfgDatFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgDatFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDatumNameOpt Extra option(s) for @b datumName field
 template <typename TMsgBase = Message, typename TDatumNameOpt = comms::option::EmptyOption>
@@ -106,9 +106,9 @@ class CfgDat : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b datumNum for @ref CfgDatFields::datumNum field
@@ -122,7 +122,7 @@ public:
     ///     @li @b rotY for @ref CfgDatFields::rotY field
     ///     @li @b rotZ for @ref CfgDatFields::rotZ field
     ///     @li @b scale for @ref CfgDatFields::scale field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         datumNum,
         datumName,
         majA,
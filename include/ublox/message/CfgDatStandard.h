@@ -47,7 +47,7 @@ struct CfgDatStandardFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgDatStandardFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgDatStandard : public
@@ -67,13 +67,13 @@ class CfgDatStandard : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b datumNum for @ref CfgDatStandardFields::datumNum field
-    COMMS_MSG_FIELDS_ACCESS(datumNum);
+    UBLOX_MSG_FIELDS_ACCESS(datumNum);
 
     /// @brief Default constructor
     CfgDatStandard() = default;
@@ -79,7 +79,7 @@ struct CfgDatUserFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgDatUserFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgDatUser : public
@@ -99,9 +99,9 @@ class CfgDatUser : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b majA for @ref CfgDatUserFields::majA field
@@ -113,7 +113,7 @@ public:
     ///     @li @b rotY for @ref CfgDatUserFields::rotY field
     ///     @li @b rotZ for @ref CfgDatUserFields::rotZ field
     ///     @li @b scale for @ref CfgDatUserFields::scale field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         majA,
         flat,
         dX,
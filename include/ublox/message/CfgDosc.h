@@ -67,10 +67,10 @@ struct CfgDoscFields
     struct isCalibrated : public field::common::X1T<comms::option::FixedBitLength<1> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(bit);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(bit);
     };
 
 
@@ -117,10 +117,10 @@ struct CfgDoscFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(isCalibrated, controlIf, reserved);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(isCalibrated, controlIf, reserved);
     };
 
     /// @brief Definition of "freq" field.
@@ -171,10 +171,10 @@ struct CfgDoscFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(
             oscId,
             reserved2,
             flags,
@@ -215,7 +215,7 @@ struct CfgDoscFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgDoscFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -238,16 +238,16 @@ class CfgDosc : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgDoscFields::version field
     ///     @li @b numOsc for @ref CfgDoscFields::numOsc field
     ///     @li @b reserved1 for @ref CfgDoscFields::reserved1 field
     ///     @li @b data for @ref CfgDoscFields::data field
-    COMMS_MSG_FIELDS_ACCESS(version, numOsc, reserved1, data);
+    UBLOX_MSG_FIELDS_ACCESS(version, numOsc, reserved1, data);
 
     /// @brief Default constructor
     CfgDosc() = default;
@@ -279,7 +279,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numOsc().value());
+        field::common::forceReadElemCount(field_data(), field_numOsc().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -63,7 +63,7 @@ struct CfgDynseedFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgDynseedFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgDynseed : public
@@ -83,16 +83,16 @@ class CfgDynseed : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgDynseedFields::version field
     ///     @li @b reserved1 for @ref CfgDynseedFields::reserved1 field
     ///     @li @b seedHi for @ref CfgDynseedFields::seedHi field
     ///     @li @b seedLo for @ref CfgDynseedFields::seedLo field
-    COMMS_MSG_FIELDS_ACCESS(version, reserved1, seedHi, seedLo);
+    UBLOX_MSG_FIELDS_ACCESS(version, reserved1, seedHi, seedLo);
 
     /// @brief Default constructor
     CfgDynseed() = default;
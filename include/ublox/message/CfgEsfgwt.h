@@ -40,10 +40,10 @@ struct CfgEsfgwtFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(setVehicle=12, setTime, setWt);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(setVehicle=12, setTime, setWt);
     };
 
     /// @brief Definition of "id" field.
@@ -128,7 +128,7 @@ struct CfgEsfgwtFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgEsfgwtFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgEsfgwt : public
@@ -148,9 +148,9 @@ class CfgEsfgwt : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b flags for @ref CfgEsfgwtFields::flags field
@@ -168,7 +168,7 @@ public:
     ///     @li @b speedDeadBand for @ref CfgEsfgwtFields::speedDeadBand field
     ///     @li @b reserved4 for @ref CfgEsfgwtFields::reserved4 field
     ///     @li @b reserved5 for @ref CfgEsfgwtFields::reserved5 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         flags,
         id,
         wtFactor,
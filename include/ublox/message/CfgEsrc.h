@@ -136,10 +136,10 @@ struct CfgEsrcFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(polarity, gnssUtc, reserved);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(polarity, gnssUtc, reserved);
     };
 
     /// @brief Definition of "freq" field.
@@ -190,10 +190,10 @@ struct CfgEsrcFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(
             extInt,
             sourceType,
             flags,
@@ -235,7 +235,7 @@ struct CfgEsrcFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgEsrcFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -258,16 +258,16 @@ class CfgEsrc : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgEsrcFields::version field
     ///     @li @b numSources for @ref CfgEsrcFields::numSources field
     ///     @li @b reserved1 for @ref CfgEsrcFields::reserved1 field
     ///     @li @b data for @ref CfgEsrcFields::data field
-    COMMS_MSG_FIELDS_ACCESS(version, numSources, reserved1, data);
+    UBLOX_MSG_FIELDS_ACCESS(version, numSources, reserved1, data);
 
     /// @brief Default constructor
     CfgEsrc() = default;
@@ -299,7 +299,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numSources().value());
+        field::common::forceReadElemCount(field_data(), field_numSources().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -81,7 +81,7 @@ struct CfgFixseedFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgFixseedFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b list field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -104,9 +104,9 @@ class CfgFixseed : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgFixseedFields::version field
@@ -115,7 +115,7 @@ public:
     ///     @li @b seedHi for @ref CfgFixseedFields::seedHi field
     ///     @li @b seedLo for @ref CfgFixseedFields::seedLo field
     ///     @li @b list for @ref CfgFixseedFields::list field
-    COMMS_MSG_FIELDS_ACCESS(version, length, reserved1, seedHi, seedLo, list);
+    UBLOX_MSG_FIELDS_ACCESS(version, length, reserved1, seedHi, seedLo, list);
 
     /// @brief Default constructor
     CfgFixseed() = default;
@@ -147,7 +147,7 @@ public:
             return es;
         }
 
-        field_list().forceReadElemCount(field_length().value());
+        field::common::forceReadElemCount(field_list(), field_length().value(), len);
         return Base::template readFieldsFrom<FieldIdx_list>(iter, len);
     }
 
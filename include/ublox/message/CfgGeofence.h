@@ -107,10 +107,10 @@ struct CfgGeofenceFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(lat, lon, radius);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(lat, lon, radius);
     };
 
     /// @brief Definition of "data" field as list of blocks (@ref block).
@@ -144,7 +144,7 @@ struct CfgGeofenceFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgGeofenceFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -167,9 +167,9 @@ class CfgGeofence : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgGeofenceFields::version field
@@ -180,7 +180,7 @@ public:
     ///     @li @b pioPolarity for @ref CfgGeofenceFields::pioPolarity field
     ///     @li @b reserved2 for @ref CfgGeofenceFields::reserved2 field
     ///     @li @b data for @ref CfgGeofenceFields::data field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
             version,
             numFences,
             confLvl,
@@ -221,7 +221,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numFences().value());
+        field::common::forceReadElemCount(field_data(), field_numFences().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -71,10 +71,10 @@ struct CfgGnssFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(enable);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(enable);
     };
 
     /// @brief Definition of "sigCfgMask" member field of the @ref flags bitfield.
@@ -94,10 +94,10 @@ struct CfgGnssFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(flagsLow, sigCfgMask, flagsHigh);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(flagsLow, sigCfgMask, flagsHigh);
     };
 
     /// @brief Definition of a single configuration block
@@ -113,10 +113,10 @@ struct CfgGnssFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(gnssId, resTrkCh, maxTrkCh, reserved1, flags);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(gnssId, resTrkCh, maxTrkCh, reserved1, flags);
     };
 
     /// @brief Definition of the list of configuration blocks
@@ -142,7 +142,7 @@ struct CfgGnssFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgGnssFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TBlocksListOpt Extra option(s) for @b blocksList field
 template <typename TMsgBase = Message, typename TBlocksListOpt = comms::option::EmptyOption>
@@ -165,9 +165,9 @@ class CfgGnss : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b msgVer for @ref CfgGnssFields::msgVer field
@@ -175,7 +175,7 @@ public:
     ///     @li @b numTrkChUse for @ref CfgGnssFields::numTrkChUse field
     ///     @li @b numConfigBlocks for @ref CfgGnssFields::numConfigBlocks field
     ///     @li @b blocksList for @ref CfgGnssFields::blocksList field
-    COMMS_MSG_FIELDS_ACCESS(msgVer, numTrkChHw, numTrkChUse, numConfigBlocks, blocksList);
+    UBLOX_MSG_FIELDS_ACCESS(msgVer, numTrkChHw, numTrkChUse, numConfigBlocks, blocksList);
 
     /// @brief Default constructor
     CfgGnss() = default;
@@ -210,7 +210,7 @@ public:
         auto& allFields = Base::fields();
         auto& numBlocksField = std::get<FieldIdx_numConfigBlocks>(allFields);
         auto& dataField = std::get<FieldIdx_blocksList>(allFields);
-        dataField.forceReadElemCount(numBlocksField.value());
+        field::common::forceReadElemCount(dataField, numBlocksField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_blocksList>(iter, len);
     }
@@ -62,10 +62,10 @@ struct CfgInfFields
         field::common::X1T<comms::option::BitmaskReservedBits<0xe0, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(ERROR, WARNING, NOTICE, DEBUG, TEST);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(ERROR, WARNING, NOTICE, DEBUG, TEST);
     };
 
     /// @brief Definition of "infMsgMask" field.
@@ -92,10 +92,10 @@ struct CfgInfFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(protocolID, reserved0, reserved1, infMsgMask);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(protocolID, reserved0, reserved1, infMsgMask);
     };
 
     /// @brief @ref CfgInf message may contain multiple configuration elements
@@ -123,7 +123,7 @@ struct CfgInfFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgInfFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TListOpt Extra option(s) for @b list field.
 /// @tparam TInfMsgMaskOpt Extra option(s) for @b infMsgMask field.
@@ -142,13 +142,13 @@ class CfgInf : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b list for @ref CfgInfFields::list field
-    COMMS_MSG_FIELDS_ACCESS(list);
+    UBLOX_MSG_FIELDS_ACCESS(list);
 
     /// @brief Default constructor
     CfgInf() = default;
@@ -50,7 +50,7 @@ struct CfgInfPollFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgInfPollFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgInfPoll : public
@@ -70,13 +70,13 @@ class CfgInfPoll : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b protocolID for @ref CfgInfPollFields::protocolID field
-    COMMS_MSG_FIELDS_ACCESS(protocolID);
+    UBLOX_MSG_FIELDS_ACCESS(protocolID);
 
     /// @brief Default constructor
     CfgInfPoll() = default;
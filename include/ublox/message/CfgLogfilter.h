@@ -47,10 +47,10 @@ struct CfgLogfilterFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(recordEnabled, psmOncePerWakupEnabled, applyAllFilterSettings);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(recordEnabled, psmOncePerWakupEnabled, applyAllFilterSettings);
     };
 
     /// @brief Definition of "minInterval" field.
@@ -81,7 +81,7 @@ struct CfgLogfilterFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgLogfilterFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgLogfilter : public
@@ -101,9 +101,9 @@ class CfgLogfilter : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgLogfilterFields::version field
@@ -112,7 +112,7 @@ public:
     ///     @li @b timeThreshold for @ref CfgLogfilterFields::timeThreshold field
     ///     @li @b speedThreshold for @ref CfgLogfilterFields::speedThreshold field
     ///     @li @b positionThreshold for @ref CfgLogfilterFields::positionThreshold field
-    COMMS_MSG_FIELDS_ACCESS(version, flags, minInterval, timeThreshold, speedThreshold, positionThreshold);
+    UBLOX_MSG_FIELDS_ACCESS(version, flags, minInterval, timeThreshold, speedThreshold, positionThreshold);
 
     /// @brief Default constructor
     CfgLogfilter() = default;
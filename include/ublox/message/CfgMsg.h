@@ -61,7 +61,7 @@ struct CfgMsgFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgMsgFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TRateOpt Extra option(s) for @b rate field
 template <typename TMsgBase = Message, typename TRateOpt = comms::option::EmptyOption>
@@ -76,14 +76,14 @@ class CfgMsg : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b id for @ref CfgMsgFields::id field
     ///     @li @b rate for @ref CfgMsgFields::rate field
-    COMMS_MSG_FIELDS_ACCESS(id, rate);
+    UBLOX_MSG_FIELDS_ACCESS(id, rate);
 
     /// @brief Default constructor
     CfgMsg() = default;
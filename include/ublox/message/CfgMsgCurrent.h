@@ -53,7 +53,7 @@ struct CfgMsgCurrentFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgMsgCurrentFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgMsgCurrent : public
@@ -73,14 +73,14 @@ class CfgMsgCurrent : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b id for @ref CfgMsgCurrentFields::id field
     ///     @li @b rate for @ref CfgMsgCurrentFields::rate field
-    COMMS_MSG_FIELDS_ACCESS(id, rate);
+    UBLOX_MSG_FIELDS_ACCESS(id, rate);
 
     /// @brief Default constructor
     CfgMsgCurrent() = default;
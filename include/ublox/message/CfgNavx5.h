@@ -89,10 +89,10 @@ struct CfgNavx5Fields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(minMax=2, minCno, initial3dfix=6, wknRoll=9, ackAid, ppp=13, aop=14);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(minMax=2, minCno, initial3dfix=6, wknRoll=9, ackAid, ppp=13, aop=14);
     };
 
     /// @brief Definition of "mask2" field.
@@ -102,10 +102,10 @@ struct CfgNavx5Fields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(adr=6, sigAttenComp);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(adr=6, sigAttenComp);
     };
 
 
@@ -174,10 +174,10 @@ struct CfgNavx5Fields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(useAOP);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(useAOP);
     };
 
     /// @brief Definition of "reserved5" field.
@@ -239,7 +239,7 @@ struct CfgNavx5Fields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgNavx5Fields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgNavx5 : public
@@ -259,9 +259,9 @@ class CfgNavx5 : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgNavx5Fields::version field
@@ -287,7 +287,7 @@ public:
     ///     @li @b reserved8 for @ref CfgNavx5Fields::reserved8 field
     ///     @li @b reserved9 for @ref CfgNavx5Fields::reserved9 field
     ///     @li @b useAdr for @ref CfgNavx5Fields::useAdr field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         version,
         mask1,
         mask2,
@@ -59,10 +59,10 @@ struct CfgNmeaFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(posFilt, mskPosFilt, timeFilt, dateFilt, gpsOnlyFilter, trackFilt);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(posFilt, mskPosFilt, timeFilt, dateFilt, gpsOnlyFilter, trackFilt);
     };
 
     /// @brief Definition of "nmeaVersion" field.
@@ -83,10 +83,10 @@ struct CfgNmeaFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(compat, consider);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(compat, consider);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -103,7 +103,7 @@ struct CfgNmeaFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgNmeaFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgNmea : public
@@ -123,16 +123,16 @@ class CfgNmea : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b filter for @ref CfgNmeaFields::filter field
     ///     @li @b nmeaVersion for @ref CfgNmeaFields::nmeaVersion field
     ///     @li @b numSV for @ref CfgNmeaFields::numSV field
     ///     @li @b flags for @ref CfgNmeaFields::flags field
-    COMMS_MSG_FIELDS_ACCESS(filter, nmeaVersion, numSV, flags);
+    UBLOX_MSG_FIELDS_ACCESS(filter, nmeaVersion, numSV, flags);
 
     /// @brief Default constructor
     CfgNmea() = default;
@@ -69,10 +69,10 @@ struct CfgNmeaExtFields : public CfgNmeaFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(gps, sbas, qzss=4, glonass, beidou);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(gps, sbas, qzss=4, glonass, beidou);
     };
 
     /// @brief Definition of "svNumbering" field.
@@ -124,7 +124,7 @@ struct CfgNmeaExtFields : public CfgNmeaFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgNmeaExtFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgNmeaExt : public
@@ -144,9 +144,9 @@ class CfgNmeaExt : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b filter for @ref CfgNmeaFields::filter field
@@ -158,7 +158,7 @@ public:
     ///     @li @b mainTalkerId for @ref CfgNmeaExtFields::mainTalkerId field
     ///     @li @b gsvTalkerId for @ref CfgNmeaExtFields::gsvTalkerId field
     ///     @li @b version for @ref CfgNmeaExtFields::version field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         filter,
         nmeaVersion,
         numSV,
@@ -72,10 +72,10 @@ struct CfgNmeaExtV1Fields : public CfgNmeaExtFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(compat, consider, limit82);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(compat, consider, limit82);
     };
 
 
@@ -127,7 +127,7 @@ struct CfgNmeaExtV1Fields : public CfgNmeaExtFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgNmeaExtV1Fields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TBdsTalkerIdOpt Extra option(s) for @b bdsTalkerId field
 template <typename TMsgBase = Message, typename TBdsTalkerIdOpt = comms::option::EmptyOption>
@@ -142,9 +142,9 @@ class CfgNmeaExtV1 : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b filter for @ref CfgNmeaFields::filter field
@@ -159,7 +159,7 @@ public:
     ///     @li @b bdsTalkerId for @ref CfgNmeaExtV1Fields::bdsTalkerId field
     ///     @li @b reserved1 for @ref CfgNmeaExtV1Fields::reserved1 field
     ///     @li @b reserved2 for @ref CfgNmeaExtV1Fields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         filter,
         nmeaVersion,
         numSV,
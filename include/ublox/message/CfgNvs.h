@@ -51,10 +51,10 @@ struct CfgNvsFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(alm=17, aop=29);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(alm=17, aop=29);
     };
 
     /// @brief Definition of "clearMask" field.
@@ -73,10 +73,10 @@ struct CfgNvsFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(devBBR, devFlash, devEEPROM, devSpiFlash=4);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(devBBR, devFlash, devEEPROM, devSpiFlash=4);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -93,7 +93,7 @@ struct CfgNvsFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgNvsFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgNvs : public
@@ -113,16 +113,16 @@ class CfgNvs : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b clearMask for @ref CfgNvsFields::clearMask field
     ///     @li @b saveMask for @ref CfgNvsFields::saveMask field
     ///     @li @b loadMask for @ref CfgNvsFields::loadMask field
     ///     @li @b deviceMask for @ref CfgNvsFields::deviceMask field
-    COMMS_MSG_FIELDS_ACCESS(clearMask, saveMask, loadMask, deviceMask);
+    UBLOX_MSG_FIELDS_ACCESS(clearMask, saveMask, loadMask, deviceMask);
 
     /// @brief Default constructor
     CfgNvs() = default;
@@ -122,10 +122,10 @@ struct CfgPmFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(waitTimeFix, updateRTC, updateEPH);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(waitTimeFix, updateRTC, updateEPH);
     };
 
     /// @brief Definition of "flags" field.
@@ -148,10 +148,10 @@ struct CfgPmFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(invalid1, internal, extintSelect, extintWake, extintBackup, invalid2, limitPeakCurr, remainingFlags);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(invalid1, internal, extintSelect, extintWake, extintBackup, invalid2, limitPeakCurr, remainingFlags);
     };
 
     /// @brief Definition of "updatePeriod" field.
@@ -189,7 +189,7 @@ struct CfgPmFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgPmFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgPm : public
@@ -209,9 +209,9 @@ class CfgPm : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgPmFields::version field
@@ -224,7 +224,7 @@ public:
     ///     @li @b gridOffset for @ref CfgPmFields::gridOffset field
     ///     @li @b onTime for @ref CfgPmFields::onTime field
     ///     @li @b minAcqTime for @ref CfgPmFields::minAcqTime field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         version,
         reserved1,
         reserved2,
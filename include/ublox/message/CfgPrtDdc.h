@@ -74,10 +74,10 @@ struct CfgPrtDdcFields : public CfgPrtFields
     {
     public:
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(unused0, slaveAddr, unused1);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(unused0, slaveAddr, unused1);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -99,7 +99,7 @@ struct CfgPrtDdcFields : public CfgPrtFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgPrtDdcFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgPrtDdc : public
@@ -121,9 +121,9 @@ class CfgPrtDdc : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b portID for @ref CfgPrtDdcFields::portID field
@@ -135,7 +135,7 @@ public:
     ///     @li @b outProtoMask for @ref CfgPrtFields::outProtoMask field
     ///     @li @b flags for @ref CfgPrtFields::flags field
     ///     @li @b reserved5 for @ref CfgPrtDdcFields::reserved5 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         portID,
         reserved0,
         txReady,
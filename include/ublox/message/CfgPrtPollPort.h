@@ -51,7 +51,7 @@ struct CfgPrtPollPortFields : public CfgPrtFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgPrtPollPortFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgPrtPollPort : public
@@ -71,13 +71,13 @@ class CfgPrtPollPort : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b portID for @ref CfgPrtPollPortFields::portID field
-    COMMS_MSG_FIELDS_ACCESS(portID);
+    UBLOX_MSG_FIELDS_ACCESS(portID);
 
     /// @brief Default constructor
     CfgPrtPollPort() = default;
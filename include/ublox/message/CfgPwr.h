@@ -85,7 +85,7 @@ struct CfgPwrFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgPwrFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgPwr : public
@@ -99,15 +99,15 @@ class CfgPwr : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref CfgPwrFields::version field
     ///     @li @b reserved1 for @ref CfgPwrFields::reserved1 field
     ///     @li @b state for @ref CfgPwrFields::state field
-    COMMS_MSG_FIELDS_ACCESS(version, reserved1, state);
+    UBLOX_MSG_FIELDS_ACCESS(version, reserved1, state);
 
     /// @brief Default constructor
     CfgPwr() = default;
@@ -74,7 +74,7 @@ struct CfgRateFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgRateFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgRate : public
@@ -94,15 +94,15 @@ class CfgRate : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b measRate for @ref CfgRateFields::measRate field
     ///     @li @b navRate for @ref CfgRateFields::navRate field
     ///     @li @b timeRef for @ref CfgRateFields::timeRef field
-    COMMS_MSG_FIELDS_ACCESS(measRate, navRate, timeRef);
+    UBLOX_MSG_FIELDS_ACCESS(measRate, navRate, timeRef);
 
     /// @brief Default constructor
     CfgRate() = default;
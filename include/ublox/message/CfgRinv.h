@@ -40,10 +40,10 @@ struct CfgRinvFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(dump, binary);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(dump, binary);
     };
 
     /// @brief Definition of "data" field.
@@ -66,7 +66,7 @@ struct CfgRinvFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgRinvFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b bytes field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -81,14 +81,14 @@ class CfgRinv : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b flags for @ref CfgRinvFields::flags field
     ///     @li @b data for @ref CfgRinvFields::data field
-    COMMS_MSG_FIELDS_ACCESS(flags, data);
+    UBLOX_MSG_FIELDS_ACCESS(flags, data);
 
     /// @brief Default constructor
     CfgRinv() = default;
@@ -71,10 +71,10 @@ struct CfgRstFields
     struct navBbrMask : public field::common::X2
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(eph, alm, health, klob, pos, clkd, osc, utc, rtc, sfdr=11, vmon, tct, aop=15);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(eph, alm, health, klob, pos, clkd, osc, utc, rtc, sfdr=11, vmon, tct, aop=15);
     };
 
     /// @brief Definition of "resetMode" field.
@@ -101,7 +101,7 @@ struct CfgRstFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgRstFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgRst : public
@@ -121,15 +121,15 @@ class CfgRst : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b navBbrMask for @ref CfgRstFields::navBbrMask field
     ///     @li @b resetMode for @ref CfgRstFields::resetMode field
     ///     @li @b reserved1 for @ref CfgRstFields::reserved1 field
-    COMMS_MSG_FIELDS_ACCESS(navBbrMask, resetMode, reserved1);
+    UBLOX_MSG_FIELDS_ACCESS(navBbrMask, resetMode, reserved1);
 
     /// @brief Default constructor
     CfgRst() = default;
@@ -88,7 +88,7 @@ struct CfgRxmFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgRxmFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgRxm : public
@@ -108,14 +108,14 @@ class CfgRxm : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b reserved1 for @ref CfgRxmFields::reserved1 field
     ///     @li @b lpMode for @ref CfgRxmFields::lpMode field
-    COMMS_MSG_FIELDS_ACCESS(reserved1, lpMode);
+    UBLOX_MSG_FIELDS_ACCESS(reserved1, lpMode);
 
     /// @brief Default constructor
     CfgRxm() = default;
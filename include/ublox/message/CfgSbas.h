@@ -41,10 +41,10 @@ struct CfgSbasFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(enabled, test);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(enabled, test);
     };
 
     /// @brief Definition of "usage" field.
@@ -54,10 +54,10 @@ struct CfgSbasFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(range, diffCorr, integrity);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(range, diffCorr, integrity);
     };
 
     /// @brief Definition of "maxSBAS" field.
@@ -73,20 +73,20 @@ struct CfgSbasFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(PRN152, PRN153, PRN154, PRN155, PRN156, PRN157, PRN158);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(PRN152, PRN153, PRN154, PRN155, PRN156, PRN157, PRN158);
     };
 
     /// @brief Definition of "scanmode1" field.
     struct scanmode1 : public field::common::X4
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(
             PRN120,
             PRN121,
             PRN122,
@@ -137,7 +137,7 @@ struct CfgSbasFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgSbasFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgSbas : public
@@ -157,9 +157,9 @@ class CfgSbas : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b mode for @ref CfgSbasFields::mode field
@@ -167,7 +167,7 @@ public:
     ///     @li @b maxSBAS for @ref CfgSbasFields::maxSBAS field
     ///     @li @b scanmode2 for @ref CfgSbasFields::scanmode2 field
     ///     @li @b scanmode1 for @ref CfgSbasFields::scanmode1 field
-    COMMS_MSG_FIELDS_ACCESS(mode, usage, maxSBAS, scanmode2, scanmode1);
+    UBLOX_MSG_FIELDS_ACCESS(mode, usage, maxSBAS, scanmode2, scanmode1);
 
     /// @brief Default constructor
     CfgSbas() = default;
@@ -90,7 +90,7 @@ struct CfgTmodeFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgTmodeFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgTmode : public
@@ -110,9 +110,9 @@ class CfgTmode : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b timeMode for @ref CfgTmodeFields::timeMode field
@@ -122,7 +122,7 @@ public:
     ///     @li @b fixedPosVar for @ref CfgTmodeFields::fixedPosVar field
     ///     @li @b svinMinDur for @ref CfgTmodeFields::svinMinDur field
     ///     @li @b svinVarLimit for @ref CfgTmodeFields::svinVarLimit field
-    COMMS_MSG_FIELDS_ACCESS(timeMode, fixedPosX, fixedPosY, fixedPosZ, fixedPosVar, svinMinDur, svinVarLimit);
+    UBLOX_MSG_FIELDS_ACCESS(timeMode, fixedPosX, fixedPosY, fixedPosZ, fixedPosVar, svinMinDur, svinVarLimit);
 
     /// @brief Default constructor
     CfgTmode() = default;
@@ -59,10 +59,10 @@ struct CfgTmode2Fields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(lla, altInv);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(lla, altInv);
     };
 
     /// @brief Definition of "ecefX" field.
@@ -138,7 +138,7 @@ struct CfgTmode2Fields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgTmode2Fields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 ///
 ///     @b NOTE, that Ublox binary protocol specification reinterprets value of
 ///     some fields based on the value of @b lla bit in @b flags (see @ref CfgTmode2Fields::flags)
@@ -170,9 +170,9 @@ class CfgTmode2 : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b timeMode for @ref CfgTmode2Fields::timeMode field
@@ -187,7 +187,7 @@ public:
     ///     @li @b fixedPosAcc for @ref CfgTmode2Fields::fixedPosAcc field
     ///     @li @b svinMinDur for @ref CfgTmode2Fields::svinMinDur field
     ///     @li @b svinAccLimit for @ref CfgTmode2Fields::svinAccLimit field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         timeMode,
         reserved1,
         flags,
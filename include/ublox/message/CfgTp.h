@@ -74,10 +74,10 @@ struct CfgTpFields
     struct flags : public field::common::X1T<comms::option::BitmaskReservedBits<0xfe, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(syncMode);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(syncMode);
     };
 
     /// @brief Definition of "res" field.
@@ -111,7 +111,7 @@ struct CfgTpFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgTpFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgTp : public
@@ -131,9 +131,9 @@ class CfgTp : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b interval for @ref CfgTpFields::interval field
@@ -145,7 +145,7 @@ public:
     ///     @li @b antennaCableDelay for @ref CfgTpFields::antennaCableDelay field
     ///     @li @b rfGroupDelay for @ref CfgTpFields::rfGroupDelay field
     ///     @li @b userDelay for @ref CfgTpFields::userDelay field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         interval,
         length,
         status,
@@ -49,7 +49,7 @@ struct CfgTp5PollSelectFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgTp5PollSelectFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class CfgTp5PollSelect : public
@@ -68,13 +68,13 @@ class CfgTp5PollSelect : public
     > Base;
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b tpIdx for @ref CfgTp5PollSelectFields::tpIdx field
-    COMMS_MSG_FIELDS_ACCESS(tpIdx);
+    UBLOX_MSG_FIELDS_ACCESS(tpIdx);
 
     /// @brief Default constructor
     CfgTp5PollSelect() = default;
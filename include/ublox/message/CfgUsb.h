@@ -59,10 +59,10 @@ struct CfgUsbFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(reEnum, powerMode);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(reEnum, powerMode);
     };
 
     /// @brief Definition of "vendorString" field.
@@ -102,7 +102,7 @@ struct CfgUsbFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref CfgUsbFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TStrsOpt Extra option(s) for @b vendorString, @b productString
 ///     and @b serialNumber fields
@@ -118,9 +118,9 @@ class CfgUsb : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b vendorID for @ref CfgUsbFields::vendorID field
@@ -132,7 +132,7 @@ public:
     ///     @li @b vendorString for @ref CfgUsbFields::vendorString field
     ///     @li @b productString for @ref CfgUsbFields::productString field
     ///     @li @b serialNumber for @ref CfgUsbFields::serialNumber field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         vendorID,
         productID,
         reserved1,
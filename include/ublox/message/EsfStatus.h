@@ -81,10 +81,10 @@ struct EsfStatusFields
             field::common::X1T<comms::option::FixedBitLength<2> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(used, ready);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(used, ready);
     };
 
     /// @brief Definition of "sensStatus1" field.
@@ -97,14 +97,14 @@ struct EsfStatusFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
         ///
         ///     The field names are:
         ///     @li @b type for @ref EsfStatusFields::type field
         ///     @li @b flags for @ref EsfStatusFields::flagsSensStatus1 field
-        COMMS_FIELD_MEMBERS_ACCESS(type, flags);
+        UBLOX_FIELD_MEMBERS_ACCESS(type, flags);
     };
 
     /// @brief Value enumeration for @ref calibStatus field.
@@ -154,12 +154,12 @@ struct EsfStatusFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
         ///
         ///     The field names are:
-        COMMS_FIELD_MEMBERS_ACCESS(calibStatus, timeStatus, reserved);
+        UBLOX_FIELD_MEMBERS_ACCESS(calibStatus, timeStatus, reserved);
     };
 
 
@@ -173,10 +173,10 @@ struct EsfStatusFields
             >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(badMeas, badTTag, missingMeas, noisyMeas);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(badMeas, badTTag, missingMeas, noisyMeas);
     };
 
 
@@ -193,10 +193,10 @@ struct EsfStatusFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(sensStatus1, sensStatus2, freq, faults);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(sensStatus1, sensStatus2, freq, faults);
     };
 
     /// @brief Definition of "data" field as list of blocks (@ref block).
@@ -228,7 +228,7 @@ struct EsfStatusFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref EsfStatusFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -251,9 +251,9 @@ class EsfStatus : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref EsfStatusFields::iTOW field
@@ -263,7 +263,7 @@ public:
     ///     @li @b reserved2 for @ref EsfStatusFields::reserved2 field
     ///     @li @b numSens for @ref EsfStatusFields::numSens field
     ///     @li @b data for @ref EsfStatusFields::data field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         iTOW,
         version,
         reserved1,
@@ -303,7 +303,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numSens().value());
+        field::common::forceReadElemCount(field_data(), field_numSens().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -51,7 +51,7 @@ struct InfStringMsgBaseFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref InfStringMsgBaseFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TId ID of actual INF-* message
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TStrOpt Extra option(s) for @b str field
@@ -68,13 +68,13 @@ class InfStringMsgBase : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b str for InfStringMsgBaseFields::str field
-    COMMS_MSG_FIELDS_ACCESS(str);
+    UBLOX_MSG_FIELDS_ACCESS(str);
 
 
     /// @brief Default constructor
@@ -55,10 +55,10 @@ struct LogCreateFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(circular);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(circular);
     };
 
     /// @brief Definition of "reserved" field.
@@ -89,7 +89,7 @@ struct LogCreateFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogCreateFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class LogCreate : public
@@ -109,9 +109,9 @@ class LogCreate : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref LogCreateFields::version field
@@ -119,7 +119,7 @@ public:
     ///     @li @b reserved for @ref LogCreateFields::reserved field
     ///     @li @b logSize for @ref LogCreateFields::logSize field
     ///     @li @b userDefinedSize for @ref LogCreateFields::userDefinedSize field
-    COMMS_MSG_FIELDS_ACCESS(version, logCfg, reserved, logSize, userDefinedSize);
+    UBLOX_MSG_FIELDS_ACCESS(version, logCfg, reserved, logSize, userDefinedSize);
 
     /// @brief Default constructor
     LogCreate() = default;
@@ -67,7 +67,7 @@ struct LogFindtimeFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogFindtimeFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class LogFindtime : public
@@ -87,16 +87,16 @@ class LogFindtime : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref LogFindtimeFields::version field
     ///     @li @b type for @ref LogFindtimeFields::type field
     ///     @li @b reserved1 for @ref LogFindtimeFields::reserved1 field
     ///     @li @b entryNumber for @ref LogFindtimeFields::entryNumber field
-    COMMS_MSG_FIELDS_ACCESS(version, type, reserved1, entryNumber);
+    UBLOX_MSG_FIELDS_ACCESS(version, type, reserved1, entryNumber);
 
     /// @brief Default constructor
     LogFindtime() = default;
@@ -89,7 +89,7 @@ struct LogFindtimeCmdFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogFindtimeCmdFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class LogFindtimeCmd : public
@@ -109,9 +109,9 @@ class LogFindtimeCmd : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref LogFindtimeCmdFields::version field
@@ -124,7 +124,7 @@ public:
     ///     @li @b minute for @ref LogFindtimeCmdFields::minute field
     ///     @li @b second for @ref LogFindtimeCmdFields::second field
     ///     @li @b reserved2 for @ref LogFindtimeCmdFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         version,
         type,
         reserved1,
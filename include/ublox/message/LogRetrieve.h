@@ -65,7 +65,7 @@ struct LogRetrieveFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogRetrieveFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class LogRetrieve : public
@@ -85,16 +85,16 @@ class LogRetrieve : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b startNumber for @ref LogRetrieveFields::startNumber field
     ///     @li @b entryCount for @ref LogRetrieveFields::entryCount field
     ///     @li @b version for @ref LogRetrieveFields::version field
     ///     @li @b reserved for @ref LogRetrieveFields::reserved field
-    COMMS_MSG_FIELDS_ACCESS(startNumber, entryCount, version, reserved);
+    UBLOX_MSG_FIELDS_ACCESS(startNumber, entryCount, version, reserved);
 
     /// @brief Default constructor
     LogRetrieve() = default;
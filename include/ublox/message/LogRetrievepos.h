@@ -129,7 +129,7 @@ struct LogRetrieveposFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogRetrieveposFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class LogRetrievepos : public
@@ -149,9 +149,9 @@ class LogRetrievepos : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b entryIndex for @ref LogRetrieveposFields::entryIndex field
@@ -172,7 +172,7 @@ public:
     ///     @li @b reserved1 for @ref LogRetrieveposFields::reserved1 field
     ///     @li @b numSV for @ref LogRetrieveposFields::numSV field
     ///     @li @b reserved2 for @ref LogRetrieveposFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         entryIndex,
         lon,
         lat,
@@ -102,7 +102,7 @@ struct LogRetrieveposextraFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogRetrieveposextraFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class LogRetrieveposextra : public
@@ -116,9 +116,9 @@ class LogRetrieveposextra : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b entryIndex for @ref LogRetrieveposextraFields::entryIndex field
@@ -135,7 +135,7 @@ public:
     ///     @li @b reserved3 for @ref LogRetrieveposextraFields::reserved3 field
     ///     @li @b reserved4 for @ref LogRetrieveposextraFields::reserved4 field
     ///     @li @b reserved5 for @ref LogRetrieveposextraFields::reserved5 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         entryIndex,
         version,
         reserved1,
@@ -102,7 +102,7 @@ struct LogRetrievestringFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogRetrievestringFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TBytesOpt Extra option(s) for @b bytes field
 template <
@@ -127,9 +127,9 @@ class LogRetrievestring : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b entryIndex for @ref LogRetrievestringFields::entryIndex field
@@ -144,7 +144,7 @@ public:
     ///     @li @b reserved2 for @ref LogRetrievestringFields::reserved2 field
     ///     @li @b byteCount for @ref LogRetrievestringFields::byteCount field
     ///     @li @b bytes for @ref LogRetrievestringFields::bytes field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         entryIndex,
         version,
         reserved1,
@@ -192,7 +192,7 @@ public:
         auto& allFields = Base::fields();
         auto& countField = std::get<FieldIdx_byteCount>(allFields);
         auto& bytesField = std::get<FieldIdx_bytes>(allFields);
-        bytesField.forceReadElemCount(countField.value());
+        field::common::forceReadElemCount(bytesField, countField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_bytes>(iter, len);
     }
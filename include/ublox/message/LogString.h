@@ -50,7 +50,7 @@ struct LogStringFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref LogStringFields and for definition of the fields this message contains.
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TBytesOpt Extra option(s) for @b bytes field
 template <
@@ -67,13 +67,13 @@ class LogString : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b bytes for @ref LogStringFields::bytes field
-    COMMS_MSG_FIELDS_ACCESS(bytes);
+    UBLOX_MSG_FIELDS_ACCESS(bytes);
 
     /// @brief Default constructor
     LogString() = default;
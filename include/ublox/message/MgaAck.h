@@ -96,7 +96,7 @@ struct MgaAckFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaAckFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaAck : public
@@ -110,9 +110,9 @@ class MgaAck : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaAckFields::type field
@@ -120,7 +120,7 @@ public:
     ///     @li @b infoCode for @ref MgaAckFields::infoCode field
     ///     @li @b msgId for @ref MgaAckFields::msgId field
     ///     @li @b msgPayloadStart for @ref MgaAckFields::msgPayloadStart field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         infoCode,
@@ -75,13 +75,16 @@ struct MgaAnoFields
     /// @brief Definition of "reserved1" field.
     using reserved1 = field::common::res1;
 
+    /// @brief Number of bytes in @ref data list.
+    static const std::size_t DataLength = 64;
+
     /// @brief Definition of "data" field as list of bytes.
     /// @tparam TOpt Extra option(s)
     template <typename TOpt = comms::option::EmptyOption>
     using data =
         field::common::ListT<
             std::uint8_t,
-            comms::option::SequenceFixedSize<64>,
+            comms::option::SequenceFixedSize<DataLength>,
             TOpt
         >;
 
@@ -111,7 +114,7 @@ struct MgaAnoFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaAnoFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -126,9 +129,9 @@ class MgaAno : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaAnoFields::type field
@@ -141,7 +144,7 @@ public:
     ///     @li @b reserved1 for @ref MgaAnoFields::reserved1 field
     ///     @li @b data for @ref MgaAnoFields::data field
     ///     @li @b reserved2 for @ref MgaAnoFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         svId,
@@ -171,6 +174,26 @@ public:
 
     /// @brief Move assignment
     MgaAno& operator=(MgaAno&&) = default;
+
+    /// @brief Provides custom read functionality.
+    /// @details The fixed size @b data (@ref MgaAnoFields::data) list is
+    ///     copied in one go (see @ref ublox::field::common::readIntList()).
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t len)
+    {
+        typedef typename std::decay<decltype(comms::toMessageBase(*this))>::type Base;
+        auto es = Base::template readFieldsUntil<FieldIdx_data>(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        es = field::common::readIntList(field_data(), MgaAnoFields::DataLength, iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return Base::template readFieldsFrom<FieldIdx_reserved2>(iter, len);
+    }
 };
 
 }  // namespace message
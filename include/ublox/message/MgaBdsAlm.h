@@ -116,7 +116,7 @@ struct MgaBdsAlmFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaBdsAlmFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaBdsAlm : public
@@ -130,9 +130,9 @@ class MgaBdsAlm : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaBdsAlmFields::type field
@@ -151,7 +151,7 @@ public:
     ///     @li @b a0 for @ref MgaBdsAlmFields::a0 field
     ///     @li @b a1 for @ref MgaBdsAlmFields::a1 field
     ///     @li @b reserved2 for @ref MgaBdsAlmFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         svId,
@@ -172,7 +172,7 @@ struct MgaBdsEphFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaBdsEphFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaBdsEph : public
@@ -186,9 +186,9 @@ class MgaBdsEph : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaBdsEphFields::type field
@@ -221,7 +221,7 @@ public:
     ///     @li @b Cic for @ref MgaBdsEphFields::Cic field
     ///     @li @b Cis for @ref MgaBdsEphFields::Cis field
     ///     @li @b reserved2 for @ref MgaBdsEphFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         svId,
@@ -101,7 +101,7 @@ struct MgaBdsIonoFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaBdsIonoFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaBdsIono : public
@@ -115,9 +115,9 @@ class MgaBdsIono : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaBdsIonoFields::type field
@@ -132,7 +132,7 @@ public:
     ///     @li @b beta2 for @ref MgaBdsIonoFields::beta2 field
     ///     @li @b beta3 for @ref MgaBdsIonoFields::beta3 field
     ///     @li @b reserved2 for @ref MgaBdsIonoFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
@@ -100,7 +100,7 @@ struct MgaBdsUtcFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaBdsUtcFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaBdsUtc : public
@@ -114,9 +114,9 @@ class MgaBdsUtc : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaBdsUtcFields::type field
@@ -131,7 +131,7 @@ public:
     ///     @li @b dN for @ref MgaBdsUtcFields::dN field
     ///     @li @b dtLSF for @ref MgaBdsUtcFields::dtLSF field
     ///     @li @b reserved3 for @ref MgaBdsUtcFields::reserved3 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
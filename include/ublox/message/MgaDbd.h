@@ -69,7 +69,7 @@ struct MgaDbdFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaDbdFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -84,16 +84,16 @@ class MgaDbd : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b reserved1 for @ref MgaDbdFields::reserved1 field
     ///     @li @b reserved2 for @ref MgaDbdFields::reserved2 field
     ///     @li @b reserved3 for @ref MgaDbdFields::reserved3 field
     ///     @li @b data for @ref MgaDbdFields::data field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         reserved1,
         reserved2,
         reserved3,
@@ -118,6 +118,22 @@ public:
     /// @brief Move assignment
     MgaDbd& operator=(MgaDbd&&) = default;
 
+    /// @brief Provides custom read functionality.
+    /// @details The @b data (@ref MgaDbdFields::data) list occupies
+    ///     all the remaining payload and is copied in one go
+    ///     (see @ref ublox::field::common::readIntList()).
+    template <typename TIter>
+    comms::ErrorStatus doRead(TIter& iter, std::size_t len)
+    {
+        typedef typename std::decay<decltype(comms::toMessageBase(*this))>::type Base;
+        auto es = Base::template readFieldsUntil<FieldIdx_data>(iter, len);
+        if (es != comms::ErrorStatus::Success) {
+            return es;
+        }
+
+        return field::common::readIntList(field_data(), iter, len);
+    }
+
 };
 
 
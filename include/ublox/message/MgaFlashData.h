@@ -81,7 +81,7 @@ struct MgaFlashDataFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaFlashDataFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -97,9 +97,9 @@ class MgaFlashData : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaFlashDataFields::type field
@@ -107,7 +107,7 @@ public:
     ///     @li @b sequence for @ref MgaFlashDataFields::sequence field
     ///     @li @b size for @ref MgaFlashDataFields::size field
     ///     @li @b data for @ref MgaFlashDataFields::data field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         sequence,
@@ -146,7 +146,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_size().value());
+        field::common::forceReadElemCount(field_data(), field_size().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
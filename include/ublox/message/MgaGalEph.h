@@ -183,7 +183,7 @@ struct MgaGalEphFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaGalEphFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaGalEph : public
@@ -197,9 +197,9 @@ class MgaGalEph : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaGalEphFields::type field
@@ -234,7 +234,7 @@ public:
     ///     @li @b healthE5B for @ref MgaGalEphFields::healthE5B field
     ///     @li @b dataValidityE5B for @ref MgaGalEphFields::dataValidityE5B field
     ///     @li @b reserved3 for @ref MgaGalEphFields::reserved3 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         svId,
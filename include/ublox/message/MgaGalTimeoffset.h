@@ -83,7 +83,7 @@ struct MgaGalTimeoffsetFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaGalTimeoffsetFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaGalTimeoffset : public
@@ -97,9 +97,9 @@ class MgaGalTimeoffset : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaGalTimeoffsetFields::type field
@@ -110,7 +110,7 @@ public:
     ///     @li @b t0G for @ref MgaGalTimeoffsetFields::t0G field
     ///     @li @b wn0G for @ref MgaGalTimeoffsetFields::wn0G field
     ///     @li @b reserved2 for @ref MgaGalTimeoffsetFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
@@ -83,7 +83,7 @@ struct MgaGloTimeoffsetFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaGloTimeoffsetFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaGloTimeoffset : public
@@ -97,9 +97,9 @@ class MgaGloTimeoffset : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaGloTimeoffsetFields::type field
@@ -110,7 +110,7 @@ public:
     ///     @li @b B1 for @ref MgaGloTimeoffsetFields::B1 field
     ///     @li @b B2 for @ref MgaGloTimeoffsetFields::B2 field
     ///     @li @b reserved1 for @ref MgaGloTimeoffsetFields::reserved1 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         N,
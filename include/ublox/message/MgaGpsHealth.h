@@ -81,7 +81,7 @@ struct MgaGpsHealthFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaGpsHealthFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam THealthCodeOpt Extra option(s) for @b healthCode field
 template <typename TMsgBase = Message, typename THealthCodeOpt = comms::option::EmptyOption>
@@ -96,9 +96,9 @@ class MgaGpsHealth : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaGpsHealthFields::type field
@@ -106,7 +106,7 @@ public:
     ///     @li @b reserved1 for @ref MgaGpsHealthFields::reserved1 field
     ///     @li @b healthCode for @ref MgaGpsHealthFields::healthCode field
     ///     @li @b reserved2 for @ref MgaGpsHealthFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
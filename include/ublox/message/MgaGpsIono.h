@@ -99,7 +99,7 @@ struct MgaGpsIonoFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaGpsIonoFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaGpsIono : public
@@ -113,9 +113,9 @@ class MgaGpsIono : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaGpsIonoFields::type field
@@ -130,7 +130,7 @@ public:
     ///     @li @b ionoBeta2 for @ref MgaGpsIonoFields::ionoBeta2 field
     ///     @li @b ionoBeta3 for @ref MgaGpsIonoFields::ionoBeta3 field
     ///     @li @b reserved2 for @ref MgaGpsIonoFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
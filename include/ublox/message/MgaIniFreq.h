@@ -75,10 +75,10 @@ struct MgaIniFreqFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(fall);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(fall);
     };
 
     /// @brief Definition of "flags" field.
@@ -91,15 +91,15 @@ struct MgaIniFreqFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
         ///
         ///     The names are:
         ///     @li source for @ref source
         ///     @li bits for @ref flagsBits
         ///
-        COMMS_FIELD_MEMBERS_ACCESS(source, bits);
+        UBLOX_FIELD_MEMBERS_ACCESS(source, bits);
     };
 
     /// @brief Definition of "freq" field.
@@ -124,7 +124,7 @@ struct MgaIniFreqFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaIniFreqFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaIniFreq : public
@@ -138,9 +138,9 @@ class MgaIniFreq : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaIniFreqFields::type field
@@ -149,7 +149,7 @@ public:
     ///     @li @b flags for @ref MgaIniFreqFields::flags field
     ///     @li @b freq for @ref MgaIniFreqFields::freq field
     ///     @li @b freqAcc for @ref MgaIniFreqFields::freqAcc field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
@@ -79,7 +79,7 @@ struct MgaIniPosLlhFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaIniPosLlhFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaIniPosLlh : public
@@ -93,9 +93,9 @@ class MgaIniPosLlh : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaIniPosLlhFields::type field
@@ -105,7 +105,7 @@ public:
     ///     @li @b lon for @ref MgaIniPosLlhFields::lon field
     ///     @li @b alt for @ref MgaIniPosLlhFields::alt field
     ///     @li @b posAcc for @ref MgaIniPosLlhFields::posAcc field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
@@ -78,7 +78,7 @@ struct MgaIniPosXyzFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MgaIniPosXyzFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MgaIniPosXyz : public
@@ -92,9 +92,9 @@ class MgaIniPosXyz : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref MgaIniPosXyzFields::type field
@@ -104,7 +104,7 @@ public:
     ///     @li @b ecefY for @ref MgaIniPosXyzFields::ecefY field
     ///     @li @b ecefZ for @ref MgaIniPosXyzFields::ecefZ field
     ///     @li @b posAcc for @ref MgaIniPosXyzFields::posAcc field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         reserved1,
@@ -123,7 +123,7 @@ struct MonHw2Fields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MonHw2Fields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class MonHw2 : public
@@ -143,9 +143,9 @@ class MonHw2 : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b ofsI for @ref MonHw2Fields::ofsI field
@@ -158,7 +158,7 @@ public:
     ///     @li @b reserved1 for @ref MonHw2Fields::reserved1 field
     ///     @li @b postStatus for @ref MonHw2Fields::postStatus field
     ///     @li @b reserved2 for @ref MonHw2Fields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         ofsI,
         magI,
         ofsQ,
@@ -98,7 +98,7 @@ struct MonMsgppFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MonMsgppFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TMsgOpt Extra option(s) for @b msgX fields
 /// @tparam TSkippedOpt Extra option(s) for @b skipped fields
@@ -117,9 +117,9 @@ class MonMsgpp : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b msg1 for @ref MonMsgppFields::msg1 field
@@ -129,7 +129,7 @@ public:
     ///     @li @b msg5 for @ref MonMsgppFields::msg5 field
     ///     @li @b msg6 for @ref MonMsgppFields::msg6 field
     ///     @li @b skipped for @ref MonMsgppFields::skipped field
-    COMMS_MSG_FIELDS_ACCESS(msg1, msg2, msg3, msg4, msg5, msg6, skipped);
+    UBLOX_MSG_FIELDS_ACCESS(msg1, msg2, msg3, msg4, msg5, msg6, skipped);
 
     /// @brief Default constructor
     MonMsgpp() = default;
@@ -50,10 +50,10 @@ struct MonPatchFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(bit);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(bit);
     };
 
 
@@ -86,10 +86,10 @@ struct MonPatchFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(activated, location, reserved);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(activated, location, reserved);
     };
 
     /// @brief Definition of "comparatorNumber" field.
@@ -114,10 +114,10 @@ struct MonPatchFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(patchInfo, comparatorNumber, patchAddress, patchData);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(patchInfo, comparatorNumber, patchAddress, patchData);
     };
 
     /// @brief Definition of "data" field as list of blocks (@ref block).
@@ -145,7 +145,7 @@ struct MonPatchFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MonPatchFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -168,15 +168,15 @@ class MonPatch : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref MonPatchFields::version field
     ///     @li @b nEntries for @ref MonPatchFields::nEntries field
     ///     @li @b data for @ref MonPatchFields::data field
-    COMMS_MSG_FIELDS_ACCESS(version, nEntries, data);
+    UBLOX_MSG_FIELDS_ACCESS(version, nEntries, data);
 
     /// @brief Default constructor
     MonPatch() = default;
@@ -208,7 +208,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_nEntries().value());
+        field::common::forceReadElemCount(field_data(), field_nEntries().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
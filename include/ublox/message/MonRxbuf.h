@@ -73,7 +73,7 @@ struct MonRxbufFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MonRxbufFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TOpt Extra option(s) for @b pending, @b usage and @b peakUsage fields
 template <typename TMsgBase = Message, typename TOpt = comms::option::EmptyOption>
@@ -88,15 +88,15 @@ class MonRxbuf : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b pending for @ref MonRxbufFields::pending field
     ///     @li @b usage for @ref MonRxbufFields::usage field
     ///     @li @b peakUsage for @ref MonRxbufFields::peakUsage field
-    COMMS_MSG_FIELDS_ACCESS(pending, usage, peakUsage);
+    UBLOX_MSG_FIELDS_ACCESS(pending, usage, peakUsage);
 
     /// @brief Default constructor
     MonRxbuf() = default;
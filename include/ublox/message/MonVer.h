@@ -76,7 +76,7 @@ struct MonVerFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref MonVerFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TSwVerOpt Extra option(s) for @b swVersion field
 /// @tparam THwVerOpt Extra option(s) for @b hwVersion field
@@ -99,15 +99,15 @@ class MonVer : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b swVersion for @ref MonVerFields::swVersion field
     ///     @li @b hwVersion for @ref MonVerFields::hwVersion field
     ///     @li @b extensions for @ref MonVerFields::extensions field
-    COMMS_MSG_FIELDS_ACCESS(swVersion, hwVersion, extensions);
+    UBLOX_MSG_FIELDS_ACCESS(swVersion, hwVersion, extensions);
 
     /// @brief Default constructor
     MonVer() = default;
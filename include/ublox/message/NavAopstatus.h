@@ -41,10 +41,10 @@ struct NavAopstatusFields
         field::common::X1T<comms::option::BitmaskReservedBits<0xfe, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(useAOP);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(useAOP);
     };
 
     /// @brief Definition of "status" field.
@@ -83,7 +83,7 @@ struct NavAopstatusFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavAopstatusFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavAopstatus : public
@@ -103,9 +103,9 @@ class NavAopstatus : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavAopstatusFields::iTOW field
@@ -116,7 +116,7 @@ public:
     ///     @li @b availGPS for @ref NavAopstatusFields::availGPS field
     ///     @li @b reserved2 for @ref NavAopstatusFields::reserved2 field
     ///     @li @b reserved3 for @ref NavAopstatusFields::reserved3 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         iTOW,
         aopCfg,
         status,
@@ -41,10 +41,10 @@ struct NavAopstatusU8Fields
         field::common::X1T<comms::option::BitmaskReservedBits<0xfe, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(useAOP);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(useAOP);
     };
 
     /// @brief Definition of "status" field.
@@ -75,7 +75,7 @@ struct NavAopstatusU8Fields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavAopstatusU8Fields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavAopstatusU8 : public
@@ -95,9 +95,9 @@ class NavAopstatusU8 : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavAopstatusU8Fields::iTOW field
@@ -106,7 +106,7 @@ public:
     ///     @li @b reserved1 for @ref NavAopstatusU8Fields::reserved1 field
     ///     @li @b reserved2 for @ref NavAopstatusU8Fields::reserved2 field
     ///     @li @b reserved3 for @ref NavAopstatusU8Fields::reserved3 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         iTOW,
         aopCfg,
         status,
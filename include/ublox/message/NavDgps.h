@@ -84,10 +84,10 @@ struct NavDgpsFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(dgpsUsed);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(dgpsUsed);
     };
 
     /// @brief Definition of "flags" field.
@@ -100,10 +100,10 @@ struct NavDgpsFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(channel, flagsBits);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(channel, flagsBits);
     };
 
     /// @brief Definition of "agec" field.
@@ -128,10 +128,10 @@ struct NavDgpsFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(svid, flags, ageC, prc, prrc);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(svid, flags, ageC, prc, prrc);
     };
 
     /// @brief Definition of the list of repeated blocks (@ref block).
@@ -164,7 +164,7 @@ struct NavDgpsFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavDgpsFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -187,9 +187,9 @@ class NavDgps : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavDgpsFields::iTOW field
@@ -200,7 +200,7 @@ public:
     ///     @li @b status for @ref NavDgpsFields::status field
     ///     @li @b reserved1 for @ref NavDgpsFields::reserved1 field
     ///     @li @b data for @ref NavDgpsFields::data field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         iTOW,
         age,
         baseId,
@@ -244,7 +244,7 @@ public:
         auto& allFields = Base::fields();
         auto& numChField = std::get<FieldIdx_numCh>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
-        dataField.forceReadElemCount(numChField.value());
+        field::common::forceReadElemCount(dataField, numChField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
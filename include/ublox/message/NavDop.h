@@ -75,7 +75,7 @@ struct NavDopFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavDopFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavDop : public
@@ -95,9 +95,9 @@ class NavDop : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavDopFields::iTOW field
@@ -108,7 +108,7 @@ public:
     ///     @li @b hDOP for @ref NavDopFields::hDOP field
     ///     @li @b nDOP for @ref NavDopFields::nDOP field
     ///     @li @b eDOP for @ref NavDopFields::eDOP field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, gDOP, pDOP, tDOP, vDOP, hDOP, nDOP, eDOP);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, gDOP, pDOP, tDOP, vDOP, hDOP, nDOP, eDOP);
 
     /// @brief Default constructor
     NavDop() = default;
@@ -85,10 +85,10 @@ struct NavEkfstatusFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(calibTacho, calibGyro, calibGyroB, reserved);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(calibTacho, calibGyro, calibGyroB, reserved);
     };
 
     /// @brief Definition of "pulseScale" field.
@@ -113,10 +113,10 @@ struct NavEkfstatusFields
     struct measUsed : public field::common::X1
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(pulse, direction, gyro, temp, pos, vel, errGyro, errPulse);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(pulse, direction, gyro, temp, pos, vel, errGyro, errPulse);
     };
 
     /// @brief Definition of "reserved2" field.
@@ -146,7 +146,7 @@ struct NavEkfstatusFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavEkfstatusFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavEkfstatus : public
@@ -166,9 +166,9 @@ class NavEkfstatus : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b pulses for @ref NavEkfstatusFields::pulses field
@@ -185,7 +185,7 @@ public:
     ///     @li @b accGyroScale for @ref NavEkfstatusFields::accGyroScale field
     ///     @li @b measUsed for @ref NavEkfstatusFields::measUsed field
     ///     @li @b reserved2 for @ref NavEkfstatusFields::reserved2 field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         pulses,
         period,
         gyroMean,
@@ -94,10 +94,10 @@ struct NavGeofenceFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(state, reserved1);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(state, reserved1);
     };
 
     /// @brief Definition of "data" field as list of blocks (@ref block).
@@ -128,7 +128,7 @@ struct NavGeofenceFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavGeofenceFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -151,9 +151,9 @@ class NavGeofence : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavGeofenceFields::iTOW field
@@ -162,7 +162,7 @@ public:
     ///     @li @b numFences for @ref NavGeofenceFields::numFences field
     ///     @li @b combState for @ref NavGeofenceFields::combState field
     ///     @li @b data for @ref NavGeofenceFields::data field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, version, status, numFences, combState, data);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, version, status, numFences, combState, data);
 
     /// @brief Default constructor
     NavGeofence() = default;
@@ -194,7 +194,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numFences().value());
+        field::common::forceReadElemCount(field_data(), field_numFences().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -62,7 +62,7 @@ struct NavPosecefFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavPosecefFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavPosecef : public
@@ -82,9 +82,9 @@ class NavPosecef : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavPosecefFields::iTOW field
@@ -92,7 +92,7 @@ public:
     ///     @li @b ecefY for @ref NavPosecefFields::ecefY field
     ///     @li @b ecefZ for @ref NavPosecefFields::ecefZ field
     ///     @li @b pAcc for @ref NavPosecefFields::pAcc field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, ecefX, ecefY, ecefZ, pAcc);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, ecefX, ecefY, ecefZ, pAcc);
 
     /// @brief Default constructor
     NavPosecef() = default;
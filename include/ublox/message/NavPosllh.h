@@ -71,7 +71,7 @@ struct NavPosllhFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavPosllhFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavPosllh : public
@@ -91,9 +91,9 @@ class NavPosllh : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavPosllhFields::iTOW field
@@ -103,7 +103,7 @@ public:
     ///     @li @b hMSL for @ref NavPosllhFields::hMSL field
     ///     @li @b hAcc for @ref NavPosllhFields::hAcc field
     ///     @li @b vAcc for @ref NavPosllhFields::vAcc field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, lon, lat, height, hMSL, hAcc, vAcc);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, lon, lat, height, hMSL, hAcc, vAcc);
 
     /// @brief Default constructor
     NavPosllh() = default;
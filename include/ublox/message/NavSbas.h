@@ -116,10 +116,10 @@ struct NavSbasFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(Ranging, Corrections, Integrity, Testmode);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(Ranging, Corrections, Integrity, Testmode);
     };
 
     /// @brief Definition of "cnt" field.
@@ -172,10 +172,10 @@ struct NavSbasFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(svid, flags, udre, svSys, svService, reserved1, prc, reserved2, ic);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(svid, flags, udre, svSys, svService, reserved1, prc, reserved2, ic);
     };
 
     /// @brief Definition of the list of data blocks (@ref block).
@@ -208,7 +208,7 @@ struct NavSbasFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavSbasFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -231,9 +231,9 @@ class NavSbas : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavSbasFields::iTOW field
@@ -244,7 +244,7 @@ public:
     ///     @li @b cnt for @ref NavSbasFields::cnt field
     ///     @li @b reserved0 for @ref NavSbasFields::reserved0 field
     ///     @li @b data for @ref NavSbasFields::data field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, geo, mode, sys, service, cnt, reserved0, data);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, geo, mode, sys, service, cnt, reserved0, data);
 
     /// @brief Default constructor
     NavSbas() = default;
@@ -279,7 +279,7 @@ public:
         auto& allFields = Base::fields();
         auto& cntField = std::get<FieldIdx_cnt>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
-        dataField.forceReadElemCount(cntField.value());
+        field::common::forceReadElemCount(dataField, cntField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
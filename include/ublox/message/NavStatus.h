@@ -74,10 +74,10 @@ struct NavStatusFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(gpsFixOk, diffSoln, wknSet, towSet);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(gpsFixOk, diffSoln, wknSet, towSet);
     };
 
     /// @brief Definition of "dgpsIStat" member fields of @ref fixStat bitfield.
@@ -109,10 +109,10 @@ struct NavStatusFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(dgpsIStat, reserved, mapMatching);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(dgpsIStat, reserved, mapMatching);
     };
 
     /// @brief Definition of "psmState" member fields of @ref flags2 bitfield.
@@ -154,10 +154,10 @@ struct NavStatusFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(psmState, reserved1, spoofDetState, reserved2);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(psmState, reserved1, spoofDetState, reserved2);
     };
 
     /// @brief Definition of "ttff" field.
@@ -183,7 +183,7 @@ struct NavStatusFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavStatusFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavStatus : public
@@ -203,9 +203,9 @@ class NavStatus : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavStatusFields::iTOW field
@@ -215,7 +215,7 @@ public:
     ///     @li @b flags2 for @ref NavStatusFields::flags2 field
     ///     @li @b ttff for @ref NavStatusFields::ttff field
     ///     @li @b msss for @ref NavStatusFields::msss field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, gpsFix, flags, fixStat, flags2, ttff, msss);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, gpsFix, flags, fixStat, flags2, ttff, msss);
 
     /// @brief Default constructor
     NavStatus() = default;
@@ -82,10 +82,10 @@ struct NavSvinfoFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(chipGen, reserved);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(chipGen, reserved);
     };
 
     /// @brief Definition of "reserved2" field.
@@ -101,10 +101,10 @@ struct NavSvinfoFields
     struct flags : public field::common::X1
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(svUsed, diffCorr, orbitAvail, orbitEph, unhealthy, orbitAlm, orbitAop, smoothed);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(svUsed, diffCorr, orbitAvail, orbitEph, unhealthy, orbitAlm, orbitAop, smoothed);
     };
 
     /// @brief Definition of "quality" field.
@@ -143,10 +143,10 @@ struct NavSvinfoFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(chn, svid, flags, quality, cno, elev, azim, prRes);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(chn, svid, flags, quality, cno, elev, azim, prRes);
     };
 
     /// @brief Definition of "data" field as list of blocks (@ref block).
@@ -176,7 +176,7 @@ struct NavSvinfoFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavSvinfoFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -199,9 +199,9 @@ class NavSvinfo : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavSvinfoFields::iTOW field
@@ -209,7 +209,7 @@ public:
     ///     @li @b globalFlags for @ref NavSvinfoFields::globalFlags field
     ///     @li @b reserved2 for @ref NavSvinfoFields::reserved2 field
     ///     @li @b data for @ref NavSvinfoFields::data field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, numCh, globalFlags, reserved2, data);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, numCh, globalFlags, reserved2, data);
 
     /// @brief Default constructor
     NavSvinfo() = default;
@@ -241,7 +241,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numCh().value());
+        field::common::forceReadElemCount(field_data(), field_numCh().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
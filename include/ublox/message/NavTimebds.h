@@ -53,10 +53,10 @@ struct NavTimebdsFields
         field::common::X1T<comms::option::BitmaskReservedBits<0xf8, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(sowValid, weekValid, leapSValid);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(sowValid, weekValid, leapSValid);
     };
 
     /// @brief Definition of "tAcc" field.
@@ -79,7 +79,7 @@ struct NavTimebdsFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavTimebdsFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavTimebds : public
@@ -99,9 +99,9 @@ class NavTimebds : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavTimebdsFields::iTOW field
@@ -111,7 +111,7 @@ public:
     ///     @li @b leapS for @ref NavTimebdsFields::leapS field
     ///     @li @b valid for @ref NavTimebdsFields::validBits field
     ///     @li @b tAcc for @ref NavTimebdsFields::tAcc field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, SOW, fSOW, week, leapS, valid, tAcc);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, SOW, fSOW, week, leapS, valid, tAcc);
 
     /// @brief Default constructor
     NavTimebds() = default;
@@ -50,10 +50,10 @@ struct NavTimegpsFields
         field::common::X1T<comms::option::BitmaskReservedBits<0xf8, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(towValid, weekValid, leapSValid);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(towValid, weekValid, leapSValid);
     };
 
     /// @brief Definition of "tAcc" field.
@@ -75,7 +75,7 @@ struct NavTimegpsFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavTimegpsFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavTimegps : public
@@ -95,9 +95,9 @@ class NavTimegps : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavTimegpsFields::iTOW field
@@ -106,7 +106,7 @@ public:
     ///     @li @b leapS for @ref NavTimegpsFields::leapS field
     ///     @li @b valid for @ref NavTimegpsFields::validBits field
     ///     @li @b tAcc for @ref NavTimegpsFields::tAcc field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, fTOW, week, leapS, valid, tAcc);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, fTOW, week, leapS, valid, tAcc);
 
     /// @brief Default constructor
     NavTimegps() = default;
@@ -68,10 +68,10 @@ struct NavTimeutcFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(validTOW, validWKN, validUTC);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(validTOW, validWKN, validUTC);
     };
 
     /// @brief Definition of "utcStandard" member field of @ref validBitfield field.
@@ -87,10 +87,10 @@ struct NavTimeutcFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(validBits, utcStandard);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(validBits, utcStandard);
     };
 
 
@@ -114,7 +114,7 @@ struct NavTimeutcFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavTimeutcFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavTimeutc : public
@@ -134,9 +134,9 @@ class NavTimeutc : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavTimeutcFields::iTOW field
@@ -149,7 +149,7 @@ public:
     ///     @li @b min for @ref NavTimeutcFields::min field
     ///     @li @b sec for @ref NavTimeutcFields::sec field
     ///     @li @b valid for @ref NavTimeutcFields::validBitfield field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, tAcc, nano, year, month, day, hour, min, sec, valid);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, tAcc, nano, year, month, day, hour, min, sec, valid);
 
     /// @brief Default constructor
     NavTimeutc() = default;
@@ -63,7 +63,7 @@ struct NavVelecefFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavVelecefFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavVelecef : public
@@ -83,9 +83,9 @@ class NavVelecef : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavVelecefFields::iTOW field
@@ -93,7 +93,7 @@ public:
     ///     @li @b ecefVY for @ref NavVelecefFields::ecefVY field
     ///     @li @b ecefVZ for @ref NavVelecefFields::ecefVZ field
     ///     @li @b sAcc for @ref NavVelecefFields::sAcc field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, ecefVX, ecefVY, ecefVZ, sAcc);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, ecefVX, ecefVY, ecefVZ, sAcc);
 
     /// @brief Default constructor
     NavVelecef() = default;
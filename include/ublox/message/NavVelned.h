@@ -80,7 +80,7 @@ struct NavVelnedFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref NavVelnedFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class NavVelned : public
@@ -100,9 +100,9 @@ class NavVelned : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref NavVelnedFields::iTOW field
@@ -114,7 +114,7 @@ public:
     ///     @li @b heading for @ref NavVelnedFields::heading field
     ///     @li @b sAcc for @ref NavVelnedFields::sAcc field
     ///     @li @b cAcc for @ref NavVelnedFields::cAcc field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, velN, velE, velD, speed, gSpeed, heading, sAcc, cAcc);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, velN, velE, velD, speed, gSpeed, heading, sAcc, cAcc);
 
     /// @brief Default constructor
     NavVelned() = default;
@@ -78,7 +78,7 @@ struct RxmEphFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref RxmEphFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TSfOpt Extra option(s) for @b sfXd field
 template <typename TMsgBase = Message, typename TSfOpt = comms::option::EmptyOption>
@@ -100,9 +100,9 @@ class RxmEph : public
     > Base;
 public:
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b svid for @ref RxmEphFields::svid field
@@ -110,7 +110,7 @@ public:
     ///     @li @b sf1d for @ref RxmEphFields::sf1d field
     ///     @li @b sf2d for @ref RxmEphFields::sf2d field
     ///     @li @b sf3d for @ref RxmEphFields::sf3d field
-    COMMS_MSG_FIELDS_ACCESS(svid, how, sf1d, sf2d, sf3d);
+    UBLOX_MSG_FIELDS_ACCESS(svid, how, sf1d, sf2d, sf3d);
 
     /// @brief Default constructor
     /// @details Marks "sf1d" (see @ref RxmEphFields::sf1d),
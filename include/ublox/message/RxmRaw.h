@@ -81,10 +81,10 @@ struct RxmRawFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(cpMes, prMes, doMes, sv, mesQI, cno, lli);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(cpMes, prMes, doMes, sv, mesQI, cno, lli);
     };
 
     /// @brief Definition of the list of blocks (@ref block)
@@ -114,7 +114,7 @@ struct RxmRawFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref RxmRawFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -137,9 +137,9 @@ class RxmRaw : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b rcvTow for @ref RxmRawFields::rcvTow field
@@ -147,7 +147,7 @@ public:
     ///     @li @b numSV for @ref RxmRawFields::numSV field
     ///     @li @b reserved1 for @ref RxmRawFields::reserved1 field
     ///     @li @b data for @ref RxmRawFields::data field
-    COMMS_MSG_FIELDS_ACCESS(rcvTow, week, numSV, reserved1, data);
+    UBLOX_MSG_FIELDS_ACCESS(rcvTow, week, numSV, reserved1, data);
 
 
     /// @brief Default constructor
@@ -182,7 +182,7 @@ public:
         auto& allFields = Base::fields();
         auto& numSvField = std::get<FieldIdx_numSV>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
-        dataField.forceReadElemCount(numSvField.value());
+        field::common::forceReadElemCount(dataField, numSvField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
@@ -52,10 +52,10 @@ struct RxmRawxFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(leapSec, clkReset);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(leapSec, clkReset);
     };
 
     /// @brief Definition of "version" field.
@@ -117,10 +117,10 @@ struct RxmRawxFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(prValid, cpValid, halfCyc, subHalfCyc);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(prValid, cpValid, halfCyc, subHalfCyc);
     };
 
     /// @brief Definition of "reserved3" field.
@@ -149,10 +149,10 @@ struct RxmRawxFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(
             prMes,
             cpMes,
             doMes,
@@ -200,7 +200,7 @@ struct RxmRawxFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref RxmRawxFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -216,9 +216,9 @@ class RxmRawx : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b rcvTow for @ref RxmRawxFields::rcvTow field
@@ -229,7 +229,7 @@ public:
     ///     @li @b version for @ref RxmRawxFields::version field
     ///     @li @b reserved1 for @ref RxmRawxFields::reserved1 field
     ///     @li @b data for @ref RxmRawxFields::data field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         rcvTow,
         week,
         leapS,
@@ -269,7 +269,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numMeas().value());
+        field::common::forceReadElemCount(field_data(), field_numMeas().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -64,7 +64,7 @@ struct RxmSfrbFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref RxmSfrbFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDwrdOpt Extra option(s) for @b bytes field
 template <typename TMsgBase = Message, typename TDwrdOpt = comms::option::EmptyOption>
@@ -79,15 +79,15 @@ class RxmSfrb : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b chn for @ref RxmSfrbFields::chn field
     ///     @li @b svid for @ref RxmSfrbFields::svid field
     ///     @li @b dwrd for @ref RxmSfrbFields::dwrd field
-    COMMS_MSG_FIELDS_ACCESS(chn, svid, dwrd);
+    UBLOX_MSG_FIELDS_ACCESS(chn, svid, dwrd);
 
     /// @brief Default constructor
     RxmSfrb() = default;
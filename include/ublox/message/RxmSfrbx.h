@@ -91,7 +91,7 @@ struct RxmSfrbxFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref RxmSfrbxFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDwrdOpt Extra option(s) for @b bytes field
 template <typename TMsgBase = Message, typename TDwrdOpt = comms::option::EmptyOption>
@@ -107,9 +107,9 @@ class RxmSfrbx : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b gnssId for @ref RxmSfrbxFields::gnssId field
@@ -121,7 +121,7 @@ public:
     ///     @li @b version for @ref RxmSfrbxFields::version field
     ///     @li @b reserved2 for @ref RxmSfrbxFields::reserved2 field
     ///     @li @b dwrd for @ref RxmSfrbxFields::dwrd field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         gnssId,
         svId,
         reserved1,
@@ -153,7 +153,8 @@ public:
 
     /// @brief Provides custom read functionality.
     /// @details Number of elements in @ref RxmSfrbxFields::dwrd depends on
-    ///     the value in @ref RxmSfrbxFields::numWords
+    ///     the value in @ref RxmSfrbxFields::numWords. The words are decoded
+    ///     in one go (see @ref ublox::field::common::readIntList()).
     template <typename TIter>
     comms::ErrorStatus doRead(TIter& iter, std::size_t len)
     {
@@ -163,8 +164,9 @@ public:
             return es;
         }
 
-        field_dwrd().forceReadElemCount(field_numWords().value());
-        return Base::template readFieldsFrom<FieldIdx_dwrd>(iter, len);
+        std::size_t count = field_numWords().value();
+        field::common::forceReadElemCount(field_dwrd(), count, len);
+        return field::common::readIntList(field_dwrd(), count, iter, len);
     }
 
     /// @brief Provides custom refresh functionality
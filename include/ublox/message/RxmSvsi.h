@@ -63,10 +63,10 @@ struct RxmSvsiFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(healthy, ephVal, almVal, notAvail);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(healthy, ephVal, almVal, notAvail);
     };
 
     /// @brief Definition of "svFlag" field.
@@ -79,10 +79,10 @@ struct RxmSvsiFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(ura, svFlagBits);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(ura, svFlagBits);
     };
 
     /// @brief Definition of "azim" field.
@@ -111,10 +111,10 @@ struct RxmSvsiFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(almAge, ephAge);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(almAge, ephAge);
     };
 
     /// @brief Definition of a single block of @ref data list
@@ -130,10 +130,10 @@ struct RxmSvsiFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(svid, svFlag, azim, elev, age);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(svid, svFlag, azim, elev, age);
     };
 
     /// @brief Definition of the list of blocks (@ref block)
@@ -163,7 +163,7 @@ struct RxmSvsiFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref RxmSvsiFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
 class RxmSvsi : public
@@ -185,9 +185,9 @@ class RxmSvsi : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b iTOW for @ref RxmSvsiFields::iTOW field
@@ -195,7 +195,7 @@ public:
     ///     @li @b numVis for @ref RxmSvsiFields::numVis field
     ///     @li @b numSV for @ref RxmSvsiFields::numSV field
     ///     @li @b data for @ref RxmSvsiFields::data field
-    COMMS_MSG_FIELDS_ACCESS(iTOW, week, numVis, numSV, data);
+    UBLOX_MSG_FIELDS_ACCESS(iTOW, week, numVis, numSV, data);
 
     /// @brief Default constructor
     RxmSvsi() = default;
@@ -229,7 +229,7 @@ public:
         auto& allFields = Base::fields();
         auto& numSvField = std::get<FieldIdx_numSV>(allFields);
         auto& dataField = std::get<FieldIdx_data>(allFields);
-        dataField.forceReadElemCount(numSvField.value());
+        field::common::forceReadElemCount(dataField, numSvField.value(), len);
 
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
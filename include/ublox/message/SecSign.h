@@ -78,7 +78,7 @@ struct SecSignFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref SecSignFields for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam THashOpt Extra options for @b hash field.
 template <typename TMsgBase = Message, typename THashOpt = comms::option::EmptyOption>
@@ -93,9 +93,9 @@ class SecSign : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref SecSignFields::version field
@@ -103,7 +103,7 @@ public:
     ///     @li @b id for @ref SecSignFields::id field
     ///     @li @b checksum for @ref SecSignFields::checksum field
     ///     @li @b hash for @ref SecSignFields::hash field
-    COMMS_MSG_FIELDS_ACCESS(version, reserved1, id, checksum, hash);
+    UBLOX_MSG_FIELDS_ACCESS(version, reserved1, id, checksum, hash);
 
     /// @brief Default constructor
     SecSign() = default;
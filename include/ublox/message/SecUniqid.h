@@ -70,7 +70,7 @@ struct SecUniqidFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref SecUniqidFields for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TUniqueIdOpt Extra options for @b uniqueId field.
 template <typename TMsgBase = Message, typename TUniqueIdOpt = comms::option::EmptyOption>
@@ -85,15 +85,15 @@ class SecUniqid : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref SecUniqidFields::version field
     ///     @li @b reserved1 for @ref SecUniqidFields::reserved1 field
     ///     @li @b uniqueId for @ref SecUniqidFields::uniqueId field
-    COMMS_MSG_FIELDS_ACCESS(version, reserved1, uniqueId);
+    UBLOX_MSG_FIELDS_ACCESS(version, reserved1, uniqueId);
 
     /// @brief Default constructor
     SecUniqid() = default;
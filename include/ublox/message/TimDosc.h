@@ -55,7 +55,7 @@ struct TimDoscFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimDoscFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class TimDosc : public
@@ -69,15 +69,15 @@ class TimDosc : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref TimDoscFields::version field
     ///     @li @b reserved1 for @ref TimDoscFields::reserved1 field
     ///     @li @b value for @ref TimDoscFields::value field
-    COMMS_MSG_FIELDS_ACCESS(version, reserved1, value);
+    UBLOX_MSG_FIELDS_ACCESS(version, reserved1, value);
 
     /// @brief Default constructor
     TimDosc() = default;
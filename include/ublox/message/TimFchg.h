@@ -91,7 +91,7 @@ struct TimFchgFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimFchgFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class TimFchg : public
@@ -105,9 +105,9 @@ class TimFchg : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref TimFchgFields::version field
@@ -119,7 +119,7 @@ public:
     ///     @li @b extDeltaFreq for @ref TimFchgFields::extDeltaFreq field
     ///     @li @b extDeltaFreqUnc for @ref TimFchgFields::extDeltaFreqUnc field
     ///     @li @b extRaw for @ref TimFchgFields::extRaw field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         version,
         reserved1,
         iTOW,
@@ -57,10 +57,10 @@ struct TimSmeasFields
         field::common::X1T<comms::option::BitmaskReservedBits<0xfc, 0> >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(freqValid, phaseValid);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(freqValid, phaseValid);
     };
 
     /// @brief Definition of "phaseOffsetFrac" field.
@@ -114,10 +114,10 @@ struct TimSmeasFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(
             sourceId,
             flags,
             phaseOffsetFrac,
@@ -158,7 +158,7 @@ struct TimSmeasFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimSmeasFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 /// @tparam TDataOpt Extra option(s) for @b data field
 template <typename TMsgBase = Message, typename TDataOpt = comms::option::EmptyOption>
@@ -174,9 +174,9 @@ class TimSmeas : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b version for @ref TimSmeasFields::version field
@@ -185,7 +185,7 @@ public:
     ///     @li @b iTOW for @ref TimSmeasFields::iTOW field
     ///     @li @b reserved2 for @ref TimSmeasFields::reserved2 field
     ///     @li @b data for @ref TimSmeasFields::data field
-    COMMS_MSG_FIELDS_ACCESS(version, numMeas, reserved1, iTOW, reserved2, data);
+    UBLOX_MSG_FIELDS_ACCESS(version, numMeas, reserved1, iTOW, reserved2, data);
 
     /// @brief Default constructor
     TimSmeas() = default;
@@ -218,7 +218,7 @@ public:
             return es;
         }
 
-        field_data().forceReadElemCount(field_numMeas().value());
+        field::common::forceReadElemCount(field_data(), field_numMeas().value(), len);
         return Base::template readFieldsFrom<FieldIdx_data>(iter, len);
     }
 
@@ -79,7 +79,7 @@ struct TimSvinFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimSvinFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class TimSvin : public
@@ -99,9 +99,9 @@ class TimSvin : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b dur for @ref TimSvinFields::dur field
@@ -113,7 +113,7 @@ public:
     ///     @li @b valid for @ref TimSvinFields::valid field
     ///     @li @b active for @ref TimSvinFields::active field
     ///     @li @b reserved for @ref TimSvinFields::reserved field
-    COMMS_MSG_FIELDS_ACCESS(dur, meanX, meanY, meanZ, meanV, obs, valid, active, reserved);
+    UBLOX_MSG_FIELDS_ACCESS(dur, meanX, meanY, meanZ, meanV, obs, valid, active, reserved);
 
     /// @brief Default constructor
     TimSvin() = default;
@@ -54,10 +54,10 @@ struct TimTpFields
         >
     {
         /// @brief Provide names for internal bits.
-        /// @details See definition of @b COMMS_BITMASK_BITS macro
-        ///     related to @b comms::field::BitmaskValue class from COMMS library
-        ///     for details.
-        COMMS_BITMASK_BITS(timeBase, utc);
+        /// @details See definition of @b UBLOX_BITMASK_BITS macro in ublox/names.h,
+        ///     it extends @b COMMS_BITMASK_BITS from COMMS library with the
+        ///     names of the bits.
+        UBLOX_BITMASK_BITS(timeBase, utc);
     };
 
     /// @brief Enumeration value for @ref raim field
@@ -88,10 +88,10 @@ struct TimTpFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(bits, raim, reserved);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(bits, raim, reserved);
     };
 
     /// @brief Enumeration value of @ref timeRefGnss field.
@@ -142,10 +142,10 @@ struct TimTpFields
         >
     {
         /// @brief Allow access to internal fields.
-        /// @details See definition of @b COMMS_FIELD_MEMBERS_ACCESS macro
-        ///     related to @b comms::field::Bitfield class from COMMS library
-        ///     for details.
-        COMMS_FIELD_MEMBERS_ACCESS(timeRefGnss, utcStandard);
+        /// @details See definition of @b UBLOX_FIELD_MEMBERS_ACCESS macro in ublox/names.h,
+        ///     it extends @b COMMS_FIELD_MEMBERS_ACCESS from COMMS library with the
+        ///     names of the member fields.
+        UBLOX_FIELD_MEMBERS_ACCESS(timeRefGnss, utcStandard);
     };
 
     /// @brief All the fields bundled in std::tuple.
@@ -164,7 +164,7 @@ struct TimTpFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimTpFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class TimTp : public
@@ -178,9 +178,9 @@ class TimTp : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b towMS for @ref TimTpFields::towMS field
@@ -189,7 +189,7 @@ public:
     ///     @li @b week for @ref TimTpFields::week field
     ///     @li @b flags for @ref TimTpFields::flags field
     ///     @li @b refInfo for @ref TimTpFields::refInfo field
-    COMMS_MSG_FIELDS_ACCESS(towMS, towSubMS, qErr, week, flags, refInfo);
+    UBLOX_MSG_FIELDS_ACCESS(towMS, towSubMS, qErr, week, flags, refInfo);
 
     /// @brief Default constructor
     TimTp() = default;
@@ -106,7 +106,7 @@ struct TimVcocalExtFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimVcocalExtFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class TimVcocalExt : public
@@ -120,9 +120,9 @@ class TimVcocalExt : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b type for @ref TimVcocalExtFields::type field
@@ -133,7 +133,7 @@ public:
     ///     @li @b raw0 for @ref TimVcocalExtFields::raw0 field
     ///     @li @b raw1 for @ref TimVcocalExtFields::raw1 field
     ///     @li @b maxStepSize for @ref TimVcocalExtFields::maxStepSize field
-    COMMS_MSG_FIELDS_ACCESS(
+    UBLOX_MSG_FIELDS_ACCESS(
         type,
         version,
         oscId,
@@ -108,7 +108,7 @@ struct TimVrfyFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref TimVrfyFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class TimVrfy : public
@@ -128,9 +128,9 @@ class TimVrfy : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b itow for @ref TimVrfyFields::itow field
@@ -140,7 +140,7 @@ public:
     ///     @li @b wno for @ref TimVrfyFields::wno field
     ///     @li @b flags for @ref TimVrfyFields::flags field
     ///     @li @b reserved1 for @ref TimVrfyFields::reserved1 field
-    COMMS_MSG_FIELDS_ACCESS(itow, frac, deltaMS, deltaNS, wno, flags, reserved1);
+    UBLOX_MSG_FIELDS_ACCESS(itow, frac, deltaMS, deltaNS, wno, flags, reserved1);
 
     /// @brief Default constructor
     TimVrfy() = default;
@@ -57,7 +57,7 @@ struct UpdSosClearFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref UpdSosClearFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class UpdSosClear : public
@@ -71,14 +71,14 @@ class UpdSosClear : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b cmd for @ref UpdSosClearFields::cmd field
     ///     @li @b reserved1 for @ref UpdSosClearFields::reserved1 field
-    COMMS_MSG_FIELDS_ACCESS(cmd, reserved1);
+    UBLOX_MSG_FIELDS_ACCESS(cmd, reserved1);
 
     /// @brief Default constructor
     UpdSosClear() = default;
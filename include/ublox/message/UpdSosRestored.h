@@ -78,7 +78,7 @@ struct UpdSosRestoredFields
 ///     while providing @b TMsgBase as common interface class as well as
 ///     various implementation options. @n
 ///     See @ref UpdSosRestoredFields and for definition of the fields this message contains
-///         and COMMS_MSG_FIELDS_ACCESS() for fields access details.
+///         and UBLOX_MSG_FIELDS_ACCESS() for fields access details.
 /// @tparam TMsgBase Common interface class for all the messages.
 template <typename TMsgBase = Message>
 class UpdSosRestored : public
@@ -92,14 +92,14 @@ class UpdSosRestored : public
 public:
 
     /// @brief Allow access to internal fields.
-    /// @details See definition of @b COMMS_MSG_FIELDS_ACCESS macro
-    ///     related to @b comms::MessageBase class from COMMS library
-    ///     for details.
+    /// @details See definition of @b UBLOX_MSG_FIELDS_ACCESS macro in ublox/names.h,
+    ///     it extends @b COMMS_MSG_FIELDS_ACCESS from COMMS library with the
+    ///     names of the fields.
     ///
     ///     The field names are:
     ///     @li @b cmd for @ref UpdSosRestoredFields::cmd field
     ///     @li @b reserved1 for @ref UpdSosRestoredFields::reserved1 field
-    COMMS_MSG_FIELDS_ACCESS(cmd, reserved1, response, reserved2);
+    UBLOX_MSG_FIELDS_ACCESS(cmd, reserved1, response, reserved2);
 
     /// @brief Default constructor
     UpdSosRestored() = default;
@@ -0,0 +1,45 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of macros that provide access to the
+///     fields and record their names.
+
+#pragma once
+
+#include "comms/comms.h"
+
+/// @brief Same as @b COMMS_MSG_FIELDS_ACCESS() from @b COMMS library, but
+///     also defines static @b fieldsNames() member function, which returns
+///     comma separated names of the fields as single string literal.
+#define UBLOX_MSG_FIELDS_ACCESS(...) \
+    COMMS_MSG_FIELDS_ACCESS(__VA_ARGS__); \
+    static const char* fieldsNames() { return #__VA_ARGS__; }
+
+/// @brief Same as @b COMMS_FIELD_MEMBERS_ACCESS() from @b COMMS library, but
+///     also defines static @b membersNames() member function, which returns
+///     comma separated names of the member fields as single string literal.
+#define UBLOX_FIELD_MEMBERS_ACCESS(...) \
+    COMMS_FIELD_MEMBERS_ACCESS(__VA_ARGS__); \
+    static const char* membersNames() { return #__VA_ARGS__; }
+
+/// @brief Same as @b COMMS_BITMASK_BITS() from @b COMMS library, but
+///     also defines static @b bitsNames() member function, which returns
+///     comma separated names of the bits as single string literal.
+#define UBLOX_BITMASK_BITS(...) \
+    COMMS_BITMASK_BITS(__VA_ARGS__); \
+    static const char* bitsNames() { return #__VA_ARGS__; }
@@ -0,0 +1,286 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of payload change detection facilities.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <algorithm>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "Frame.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+/// @brief Detector of repeated identical payloads of the same message.
+/// @details Keeps a copy of the last accepted payload together with its
+///     64 bit hash (FNV-1a) for every tracked message ID. The hash is used
+///     to quickly reject the changed payloads, while the final decision is
+///     always made by comparing the bytes. The payloads longer than
+///     @b TMaxLen bytes are not recorded and always reported as changed.
+///     The tracked IDs are kept sorted, the lookup is a binary search.
+///     Used by @ref readIfChanged() to skip decoding of messages which
+///     didn't change since the last time. Doesn't use dynamic memory allocation.
+/// @tparam TCapacity Maximal number of tracked message IDs.
+/// @tparam TMaxLen Maximal length of the recorded payload.
+template <std::size_t TCapacity = 32, std::size_t TMaxLen = 256>
+class PayloadChangeDetector
+{
+    static_assert(0U < TCapacity, "Capacity must not be 0");
+
+public:
+    /// @brief Start tracking changes of the message with specified ID.
+    /// @return @b true on success, @b false when the capacity is exhausted.
+    bool track(MsgId id)
+    {
+        auto* slotsEnd = m_slots.data() + m_count;
+        auto* slot = lowerBound(id);
+        if ((slot != slotsEnd) && (slot->m_id == id)) {
+            return true;
+        }
+
+        if (TCapacity <= m_count) {
+            return false;
+        }
+
+        std::move_backward(slot, slotsEnd, slotsEnd + 1);
+        *slot = Slot();
+        slot->m_id = id;
+        ++m_count;
+        return true;
+    }
+
+    /// @brief Check whether message with specified ID is tracked.
+    bool isTracked(MsgId id) const
+    {
+        return find(id) != nullptr;
+    }
+
+    /// @brief Compute hash of the payload.
+    static std::uint64_t hash(const std::uint8_t* payload, std::size_t len)
+    {
+        std::uint64_t result = 14695981039346656037ULL;
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            result ^= payload[idx];
+            result *= 1099511628211ULL;
+        }
+        return result;
+    }
+
+    /// @brief Check whether the payload is the same as the last recorded
+    ///     one for the same message ID.
+    /// @details Always reports @b false for untracked IDs and for payloads
+    ///     longer than @b TMaxLen.
+    bool isUnchanged(
+        MsgId id,
+        const std::uint8_t* payload,
+        std::size_t len,
+        std::uint64_t payloadHash) const
+    {
+        auto* slot = find(id);
+        if ((slot == nullptr) ||
+            (!slot->m_valid) ||
+            (slot->m_len != len) ||
+            (slot->m_hash != payloadHash)) {
+            return false;
+        }
+
+        return std::equal(payload, payload + len, slot->m_data.begin());
+    }
+
+    /// @brief Record the payload as the last one for the message ID.
+    /// @details Ignored for untracked IDs. Payload longer than @b TMaxLen
+    ///     invalidates the previous record.
+    void record(
+        MsgId id,
+        const std::uint8_t* payload,
+        std::size_t len,
+        std::uint64_t payloadHash)
+    {
+        auto* slot = find(id);
+        if (slot == nullptr) {
+            return;
+        }
+
+        slot->m_valid = (len <= TMaxLen);
+        if (!slot->m_valid) {
+            return;
+        }
+
+        slot->m_len = len;
+        slot->m_hash = payloadHash;
+        std::copy_n(payload, len, slot->m_data.begin());
+    }
+
+    /// @brief Forget the recorded payload of the message, the next one
+    ///     will be reported as changed.
+    void invalidate(MsgId id)
+    {
+        auto* slot = find(id);
+        if (slot != nullptr) {
+            slot->m_valid = false;
+        }
+    }
+
+    /// @brief Forget all the recorded payloads.
+    void invalidateAll()
+    {
+        for (std::size_t idx = 0U; idx < m_count; ++idx) {
+            m_slots[idx].m_valid = false;
+        }
+    }
+
+private:
+    struct Slot
+    {
+        MsgId m_id = static_cast<MsgId>(0);
+        bool m_valid = false;
+        std::size_t m_len = 0U;
+        std::uint64_t m_hash = 0U;
+        std::array<std::uint8_t, TMaxLen> m_data;
+    };
+
+    const Slot* lowerBound(MsgId id) const
+    {
+        return std::lower_bound(
+            m_slots.data(), m_slots.data() + m_count, id,
+            [](const Slot& slot, MsgId val) -> bool
+            {
+                return slot.m_id < val;
+            });
+    }
+
+    Slot* lowerBound(MsgId id)
+    {
+        return const_cast<Slot*>(static_cast<const PayloadChangeDetector*>(this)->lowerBound(id));
+    }
+
+    const Slot* find(MsgId id) const
+    {
+        auto* slot = lowerBound(id);
+        if ((slot == m_slots.data() + m_count) || (slot->m_id != id)) {
+            return nullptr;
+        }
+        return slot;
+    }
+
+    Slot* find(MsgId id)
+    {
+        return const_cast<Slot*>(static_cast<const PayloadChangeDetector*>(this)->find(id));
+    }
+
+    std::array<Slot, TCapacity> m_slots;
+    std::size_t m_count = 0U;
+};
+
+/// @brief Read message using protocol stack unless its payload didn't change.
+/// @details Inspects the frame at the current read position. If the whole
+///     frame is available, its checksum is valid, its message ID is tracked
+///     by the @b detector, and its payload is identical to the one recorded
+///     the last time, the frame is skipped without any decoding:
+///     the iterator is advanced past it, @b msgPtr is left empty,
+///     @b unchanged is set to @b true, and @b comms::ErrorStatus::Success
+///     is returned. Otherwise the message is read using @b read() member
+///     function of the protocol stack (see @ref ublox::Stack), and on
+///     success the payload is recorded for the subsequent checks.
+/// @param[in] stack Protocol stack object.
+/// @param[in, out] detector Change detector object (see @ref PayloadChangeDetector).
+/// @param[out] msgPtr Smart pointer to the read message object.
+/// @param[in, out] iter Read iterator, advanced past the consumed data.
+/// @param[in] len Number of bytes available for reading.
+/// @param[out] unchanged Indication whether the frame was skipped because
+///     its payload didn't change.
+/// @param[out] missingSize Number of missing bytes in case of
+///     @b comms::ErrorStatus::NotEnoughData error.
+/// @return Status of the read operation.
+template <
+    typename TStack,
+    typename TDetector,
+    typename TMsgPtr,
+    typename TIter>
+comms::ErrorStatus readIfChanged(
+    TStack& stack,
+    TDetector& detector,
+    TMsgPtr& msgPtr,
+    TIter& iter,
+    std::size_t len,
+    bool& unchanged,
+    std::size_t* missingSize = nullptr)
+{
+    static_assert(std::is_pointer<TIter>::value,
+        "Change detection requires reading from contiguous buffer");
+
+    unchanged = false;
+    auto* frame = reinterpret_cast<const std::uint8_t*>(iter);
+    auto* payload = frame + FrameHeaderLen;
+    std::size_t payloadLen = 0U;
+    auto id = static_cast<MsgId>(0);
+    std::uint64_t payloadHash = 0U;
+    bool recordable = false;
+
+    do {
+        if ((len < FrameHeaderLen) ||
+            (frame[0] != FrameSyncChar1) ||
+            (frame[1] != FrameSyncChar2)) {
+            break;
+        }
+
+        id = frameMsgId(frame);
+        if (!detector.isTracked(id)) {
+            break;
+        }
+
+        payloadLen = framePayloadLength(frame);
+        auto frameLen = frameLength(payloadLen);
+        if ((len < frameLen) || (!frameChecksumValid(frame, payloadLen))) {
+            break;
+        }
+
+        payloadHash = TDetector::hash(payload, payloadLen);
+        if (detector.isUnchanged(id, payload, payloadLen, payloadHash)) {
+            unchanged = true;
+            msgPtr.reset();
+            iter += frameLen;
+            return comms::ErrorStatus::Success;
+        }
+
+        recordable = true;
+    } while (false);
+
+    auto es = stack.read(msgPtr, iter, len, missingSize);
+    if ((es == comms::ErrorStatus::Success) && recordable) {
+        detector.record(id, payload, payloadLen, payloadHash);
+    }
+    return es;
+}
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
@@ -0,0 +1,275 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of the frames of fixed contents messages
+///     serialised at compile time.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "Frame.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+constexpr std::uint16_t constFrameChecksum(std::uint16_t state)
+{
+    return state;
+}
+
+template <typename... TRest>
+constexpr std::uint16_t constFrameChecksum(std::uint16_t state, std::uint8_t byte, TRest... rest)
+{
+    return
+        constFrameChecksum(
+            static_cast<std::uint16_t>(
+                (((((state >> 8) + (state & 0xffU) + byte) & 0xffU) << 8)) |
+                (((state & 0xffU) + byte) & 0xffU)),
+            rest...);
+}
+
+}  // namespace details
+
+/// @brief Complete UBX frame of the message with fixed contents,
+///     serialised at compile time.
+/// @details The frame (sync characters, class and ID, length, payload,
+///     and checksum) is a @b constexpr byte array, sending the message
+///     is copying of the array into the output buffer.
+///     The checksum is the same as computed by @ref ChecksumCalc,
+///     use @ref matchesStackWrite() to verify the frame against the
+///     output of the protocol stack.
+/// @tparam TId ID of the message.
+/// @tparam TPayload Bytes of the payload.
+template <MsgId TId, std::uint8_t... TPayload>
+struct ConstFrame
+{
+    /// @brief ID of the message.
+    static constexpr MsgId Id = TId;
+
+    /// @brief Length of the payload.
+    static constexpr std::size_t PayloadLen = sizeof...(TPayload);
+
+    /// @brief Length of the whole frame.
+    static constexpr std::size_t Size = frameLength(PayloadLen);
+
+    /// @brief Checksum, first byte in the low and second byte in the high bits.
+    static constexpr std::uint16_t Checksum =
+        details::constFrameChecksum(
+            0U,
+            frameClassOf(TId),
+            frameIdOf(TId),
+            static_cast<std::uint8_t>(PayloadLen & 0xffU),
+            static_cast<std::uint8_t>((PayloadLen >> 8) & 0xffU),
+            TPayload...);
+
+    /// @brief Bytes of the frame.
+    static constexpr std::uint8_t Data[Size] = {
+        FrameSyncChar1,
+        FrameSyncChar2,
+        frameClassOf(TId),
+        frameIdOf(TId),
+        static_cast<std::uint8_t>(PayloadLen & 0xffU),
+        static_cast<std::uint8_t>((PayloadLen >> 8) & 0xffU),
+        TPayload...,
+        static_cast<std::uint8_t>(Checksum & 0xffU),
+        static_cast<std::uint8_t>(Checksum >> 8)
+    };
+
+    static_assert(PayloadLen <= 0xffffU, "Payload is too long");
+
+    /// @brief Pointer to the first byte of the frame.
+    static const std::uint8_t* data()
+    {
+        return &Data[0];
+    }
+
+    /// @brief Length of the frame.
+    static constexpr std::size_t size()
+    {
+        return Size;
+    }
+
+    /// @brief Copy the frame into the buffer.
+    /// @return Number of copied bytes.
+    static std::size_t copyTo(std::uint8_t* buf)
+    {
+        std::memcpy(buf, &Data[0], Size);
+        return Size;
+    }
+};
+
+template <MsgId TId, std::uint8_t... TPayload>
+constexpr MsgId ConstFrame<TId, TPayload...>::Id;
+
+template <MsgId TId, std::uint8_t... TPayload>
+constexpr std::size_t ConstFrame<TId, TPayload...>::PayloadLen;
+
+template <MsgId TId, std::uint8_t... TPayload>
+constexpr std::size_t ConstFrame<TId, TPayload...>::Size;
+
+template <MsgId TId, std::uint8_t... TPayload>
+constexpr std::uint16_t ConstFrame<TId, TPayload...>::Checksum;
+
+template <MsgId TId, std::uint8_t... TPayload>
+constexpr std::uint8_t ConstFrame<TId, TPayload...>::Data[ConstFrame<TId, TPayload...>::Size];
+
+/// @brief Verify the constant frame against the output of the protocol stack.
+/// @details The message interface class is expected to use
+///     @b std::uint8_t* as the write iterator.
+/// @param[in] stack Protocol stack object (see @ref ublox::Stack).
+/// @param[in] msg Message object with the contents of the constant frame.
+/// @return @b true if the protocol stack writes exactly the same bytes.
+template <typename TFrame, typename TStack, typename TMsg>
+bool matchesStackWrite(const TStack& stack, const TMsg& msg)
+{
+    std::uint8_t buf[TFrame::Size + 1U] = {0};
+    std::uint8_t* iter = &buf[0];
+    auto es = stack.write(msg, iter, sizeof(buf));
+    return
+        (es == comms::ErrorStatus::Success) &&
+        (static_cast<std::size_t>(iter - &buf[0]) == TFrame::Size) &&
+        (std::memcmp(&buf[0], TFrame::data(), TFrame::Size) == 0);
+}
+
+/// @brief Frames of the polls with empty payload
+/// @{
+using AidAlmPollFrame = ConstFrame<MsgId_AID_ALM>;
+using AidAopPollFrame = ConstFrame<MsgId_AID_AOP>;
+using AidEphPollFrame = ConstFrame<MsgId_AID_EPH>;
+using AidHuiPollFrame = ConstFrame<MsgId_AID_HUI>;
+using AidIniPollFrame = ConstFrame<MsgId_AID_INI>;
+using CfgAntPollFrame = ConstFrame<MsgId_CFG_ANT>;
+using CfgDatPollFrame = ConstFrame<MsgId_CFG_DAT>;
+using CfgDoscPollFrame = ConstFrame<MsgId_CFG_DOSC>;
+using CfgEkfPollFrame = ConstFrame<MsgId_CFG_EKF>;
+using CfgEsfgwtPollFrame = ConstFrame<MsgId_CFG_ESFGWT>;
+using CfgEsrcPollFrame = ConstFrame<MsgId_CFG_ESRC>;
+using CfgFxnPollFrame = ConstFrame<MsgId_CFG_FXN>;
+using CfgGeofencePollFrame = ConstFrame<MsgId_CFG_GEOFENCE>;
+using CfgGnssPollFrame = ConstFrame<MsgId_CFG_GNSS>;
+using CfgItfmPollFrame = ConstFrame<MsgId_CFG_ITFM>;
+using CfgLogfilterPollFrame = ConstFrame<MsgId_CFG_LOGFILTER>;
+using CfgNav5PollFrame = ConstFrame<MsgId_CFG_NAV5>;
+using CfgNavx5PollFrame = ConstFrame<MsgId_CFG_NAVX5>;
+using CfgNmeaPollFrame = ConstFrame<MsgId_CFG_NMEA>;
+using CfgOdoPollFrame = ConstFrame<MsgId_CFG_ODO>;
+using CfgPm2PollFrame = ConstFrame<MsgId_CFG_PM2>;
+using CfgPmPollFrame = ConstFrame<MsgId_CFG_PM>;
+using CfgPmsPollFrame = ConstFrame<MsgId_CFG_PMS>;
+using CfgPrtPollFrame = ConstFrame<MsgId_CFG_PRT>;
+using CfgRatePollFrame = ConstFrame<MsgId_CFG_RATE>;
+using CfgRinvPollFrame = ConstFrame<MsgId_CFG_RINV>;
+using CfgRxmPollFrame = ConstFrame<MsgId_CFG_RXM>;
+using CfgSbasPollFrame = ConstFrame<MsgId_CFG_SBAS>;
+using CfgSmgrPollFrame = ConstFrame<MsgId_CFG_SMGR>;
+using CfgTmode2PollFrame = ConstFrame<MsgId_CFG_TMODE2>;
+using CfgTmodePollFrame = ConstFrame<MsgId_CFG_TMODE>;
+using CfgTp5PollFrame = ConstFrame<MsgId_CFG_TP5>;
+using CfgTpPollFrame = ConstFrame<MsgId_CFG_TP>;
+using CfgUsbPollFrame = ConstFrame<MsgId_CFG_USB>;
+using EsfStatusPollFrame = ConstFrame<MsgId_ESF_STATUS>;
+using LogInfoPollFrame = ConstFrame<MsgId_LOG_INFO>;
+using MgaDbdPollFrame = ConstFrame<MsgId_MGA_DBD>;
+using MonGnssPollFrame = ConstFrame<MsgId_MON_GNSS>;
+using MonHw2PollFrame = ConstFrame<MsgId_MON_HW2>;
+using MonHwPollFrame = ConstFrame<MsgId_MON_HW>;
+using MonIoPollFrame = ConstFrame<MsgId_MON_IO>;
+using MonMsgppPollFrame = ConstFrame<MsgId_MON_MSGPP>;
+using MonPatchPollFrame = ConstFrame<MsgId_MON_PATCH>;
+using MonRxbufPollFrame = ConstFrame<MsgId_MON_RXBUF>;
+using MonTxbufPollFrame = ConstFrame<MsgId_MON_TXBUF>;
+using MonVerPollFrame = ConstFrame<MsgId_MON_VER>;
+using NavAopstatusPollFrame = ConstFrame<MsgId_NAV_AOPSTATUS>;
+using NavClockPollFrame = ConstFrame<MsgId_NAV_CLOCK>;
+using NavDgpsPollFrame = ConstFrame<MsgId_NAV_DGPS>;
+using NavDopPollFrame = ConstFrame<MsgId_NAV_DOP>;
+using NavEkfstatusPollFrame = ConstFrame<MsgId_NAV_EKFSTATUS>;
+using NavGeofencePollFrame = ConstFrame<MsgId_NAV_GEOFENCE>;
+using NavOdoPollFrame = ConstFrame<MsgId_NAV_ODO>;
+using NavOrbPollFrame = ConstFrame<MsgId_NAV_ORB>;
+using NavPosecefPollFrame = ConstFrame<MsgId_NAV_POSECEF>;
+using NavPosllhPollFrame = ConstFrame<MsgId_NAV_POSLLH>;
+using NavPvtPollFrame = ConstFrame<MsgId_NAV_PVT>;
+using NavSatPollFrame = ConstFrame<MsgId_NAV_SAT>;
+using NavSbasPollFrame = ConstFrame<MsgId_NAV_SBAS>;
+using NavSolPollFrame = ConstFrame<MsgId_NAV_SOL>;
+using NavStatusPollFrame = ConstFrame<MsgId_NAV_STATUS>;
+using NavSvinfoPollFrame = ConstFrame<MsgId_NAV_SVINFO>;
+using NavTimebdsPollFrame = ConstFrame<MsgId_NAV_TIMEBDS>;
+using NavTimegalPollFrame = ConstFrame<MsgId_NAV_TIMEGAL>;
+using NavTimegloPollFrame = ConstFrame<MsgId_NAV_TIMEGLO>;
+using NavTimegpsPollFrame = ConstFrame<MsgId_NAV_TIMEGPS>;
+using NavTimelsPollFrame = ConstFrame<MsgId_NAV_TIMELS>;
+using NavTimeutcPollFrame = ConstFrame<MsgId_NAV_TIMEUTC>;
+using NavVelecefPollFrame = ConstFrame<MsgId_NAV_VELECEF>;
+using NavVelnedPollFrame = ConstFrame<MsgId_NAV_VELNED>;
+using RxmAlmPollFrame = ConstFrame<MsgId_RXM_ALM>;
+using RxmEphPollFrame = ConstFrame<MsgId_RXM_EPH>;
+using RxmImesPollFrame = ConstFrame<MsgId_RXM_IMES>;
+using RxmRawPollFrame = ConstFrame<MsgId_RXM_RAW>;
+using RxmRawxPollFrame = ConstFrame<MsgId_RXM_RAWX>;
+using RxmSvsiPollFrame = ConstFrame<MsgId_RXM_SVSI>;
+using TimFchgPollFrame = ConstFrame<MsgId_TIM_FCHG>;
+using TimSvinPollFrame = ConstFrame<MsgId_TIM_SVIN>;
+using TimTm2PollFrame = ConstFrame<MsgId_TIM_TM2>;
+using TimTpPollFrame = ConstFrame<MsgId_TIM_TP>;
+using TimVcocalPollFrame = ConstFrame<MsgId_TIM_VCOCAL>;
+using TimVrfyPollFrame = ConstFrame<MsgId_TIM_VRFY>;
+using UpdSosPollFrame = ConstFrame<MsgId_UPD_SOS>;
+/// @}
+
+/// @brief Frame of NAV-RESETODO message.
+using NavResetodoFrame = ConstFrame<MsgId_NAV_RESETODO>;
+
+/// @brief Frame of CFG-RST message performing hot start (GNSS only software reset).
+using CfgRstHotStartFrame = ConstFrame<MsgId_CFG_RST, 0x00, 0x00, 0x02, 0x00>;
+
+/// @brief Frame of CFG-RST message performing warm start (GNSS only software reset).
+using CfgRstWarmStartFrame = ConstFrame<MsgId_CFG_RST, 0x01, 0x00, 0x02, 0x00>;
+
+/// @brief Frame of CFG-RST message performing cold start (GNSS only software reset).
+using CfgRstColdStartFrame = ConstFrame<MsgId_CFG_RST, 0xff, 0xff, 0x02, 0x00>;
+
+/// @brief Frame of CFG-RST message performing controlled GNSS stop.
+using CfgRstGnssStopFrame = ConstFrame<MsgId_CFG_RST, 0x00, 0x00, 0x08, 0x00>;
+
+/// @brief Frame of CFG-RST message performing controlled GNSS start.
+using CfgRstGnssStartFrame = ConstFrame<MsgId_CFG_RST, 0x00, 0x00, 0x09, 0x00>;
+
+// Reference frames from the protocol specification
+static_assert(NavPvtPollFrame::Checksum == 0x1908, "Invalid checksum");
+static_assert(MonVerPollFrame::Checksum == 0x340e, "Invalid checksum");
+static_assert(CfgRstHotStartFrame::Checksum == 0x6810, "Invalid checksum");
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
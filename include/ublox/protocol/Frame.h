@@ -0,0 +1,143 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Contains definition of UBX frame layout and the framing
+///     functions used by all the code writing or checking the frames
+///     outside the protocol stack.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "ublox/MsgId.h"
+#include "ChecksumCalc.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+/// @brief First synchronisation character of UBX frame.
+static const std::uint8_t FrameSyncChar1 = 0xb5;
+
+/// @brief Second synchronisation character of UBX frame.
+static const std::uint8_t FrameSyncChar2 = 0x62;
+
+/// @brief Length of UBX frame header (sync chars, class, ID, and length).
+static const std::size_t FrameHeaderLen = 6U;
+
+/// @brief Length of UBX frame checksum.
+static const std::size_t FrameChecksumLen = 2U;
+
+/// @brief Length of the complete UBX frame with the payload of given length.
+constexpr std::size_t frameLength(std::size_t payloadLen)
+{
+    return FrameHeaderLen + payloadLen + FrameChecksumLen;
+}
+
+/// @brief Class ID of the message.
+constexpr std::uint8_t frameClassOf(MsgId id)
+{
+    return static_cast<std::uint8_t>(static_cast<unsigned>(id) >> 8);
+}
+
+/// @brief ID of the message within its class.
+constexpr std::uint8_t frameIdOf(MsgId id)
+{
+    return static_cast<std::uint8_t>(static_cast<unsigned>(id) & 0xffU);
+}
+
+/// @brief ID of the message the frame belongs to.
+/// @param[in] frame First byte of the frame, the header must be present.
+inline MsgId frameMsgId(const std::uint8_t* frame)
+{
+    return static_cast<MsgId>((static_cast<unsigned>(frame[2]) << 8) | frame[3]);
+}
+
+/// @brief Length of the frame payload recorded in the header.
+/// @param[in] frame First byte of the frame, the header must be present.
+inline std::size_t framePayloadLength(const std::uint8_t* frame)
+{
+    return static_cast<std::size_t>(frame[4]) | (static_cast<std::size_t>(frame[5]) << 8);
+}
+
+/// @brief Write the frame header (sync characters, class and ID, length).
+/// @param[in] id ID of the message.
+/// @param[in] payloadLen Length of the payload, at most 0xffff.
+/// @param[out] frame First byte of the frame.
+inline void writeFrameHeader(MsgId id, std::size_t payloadLen, std::uint8_t* frame)
+{
+    frame[0] = FrameSyncChar1;
+    frame[1] = FrameSyncChar2;
+    frame[2] = frameClassOf(id);
+    frame[3] = frameIdOf(id);
+    frame[4] = static_cast<std::uint8_t>(payloadLen & 0xffU);
+    frame[5] = static_cast<std::uint8_t>((payloadLen >> 8) & 0xffU);
+}
+
+/// @brief Compute checksum of the frame (class, ID, length, and payload).
+/// @return First checksum byte in the low and second one in the high bits.
+inline std::uint16_t frameChecksum(const std::uint8_t* frame, std::size_t payloadLen)
+{
+    const std::uint8_t* iter = frame + 2U;
+    return ChecksumCalc()(iter, payloadLen + 4U);
+}
+
+/// @brief Write the checksum after the payload of the frame whose header
+///     and payload are already written.
+inline void writeFrameChecksum(std::uint8_t* frame, std::size_t payloadLen)
+{
+    auto checksum = frameChecksum(frame, payloadLen);
+    frame[FrameHeaderLen + payloadLen] = static_cast<std::uint8_t>(checksum & 0xffU);
+    frame[FrameHeaderLen + payloadLen + 1U] = static_cast<std::uint8_t>(checksum >> 8);
+}
+
+/// @brief Check the checksum of the complete frame.
+inline bool frameChecksumValid(const std::uint8_t* frame, std::size_t payloadLen)
+{
+    auto checksum = frameChecksum(frame, payloadLen);
+    return
+        (frame[FrameHeaderLen + payloadLen] == static_cast<std::uint8_t>(checksum & 0xffU)) &&
+        (frame[FrameHeaderLen + payloadLen + 1U] == static_cast<std::uint8_t>(checksum >> 8));
+}
+
+/// @brief Write complete frame with already serialised payload.
+/// @details The payload is copied, then the checksum is computed over the
+///     copy, which is still in the cache.
+/// @param[in] id ID of the message.
+/// @param[in] payload Payload of the message.
+/// @param[in] len Length of the payload, at most 0xffff.
+/// @param[out] frame Output buffer of at least @ref frameLength() bytes.
+/// @return Length of the frame.
+inline std::size_t writeFrame(MsgId id, const std::uint8_t* payload, std::size_t len, std::uint8_t* frame)
+{
+    writeFrameHeader(id, len, frame);
+    if (0U < len) {
+        std::memcpy(frame + FrameHeaderLen, payload, len);
+    }
+    writeFrameChecksum(frame, len);
+    return frameLength(len);
+}
+
+}  // namespace protocol
+
+}  // namespace ublox
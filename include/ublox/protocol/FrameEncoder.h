@@ -0,0 +1,190 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of the output frames encoding facilities.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <iterator>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "Frame.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+namespace details
+{
+
+/// @brief Running checksum of UBX frame.
+struct FrameChecksumState
+{
+    std::uint8_t m_ckA = 0U;
+    std::uint8_t m_ckB = 0U;
+
+    void update(std::uint8_t byte)
+    {
+        m_ckA = static_cast<std::uint8_t>(m_ckA + byte);
+        m_ckB = static_cast<std::uint8_t>(m_ckB + m_ckA);
+    }
+};
+
+/// @brief Output iterator writing the payload bytes into the buffer and
+///     accumulating the checksum of every written byte.
+/// @details The copies of the iterator share the checksum state, so the
+///     iterator can be passed around by value like a pointer.
+class FrameChecksumWriter
+{
+public:
+    typedef std::output_iterator_tag iterator_category;
+    typedef std::uint8_t value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    FrameChecksumWriter(std::uint8_t* pos, FrameChecksumState& state)
+      : m_pos(pos),
+        m_state(&state)
+    {
+    }
+
+    FrameChecksumWriter& operator*()
+    {
+        return *this;
+    }
+
+    FrameChecksumWriter& operator=(std::uint8_t byte)
+    {
+        *m_pos = byte;
+        m_state->update(byte);
+        return *this;
+    }
+
+    FrameChecksumWriter& operator++()
+    {
+        ++m_pos;
+        return *this;
+    }
+
+    FrameChecksumWriter operator++(int)
+    {
+        auto copy = *this;
+        ++m_pos;
+        return copy;
+    }
+
+    /// @brief Position of the next byte.
+    std::uint8_t* base() const
+    {
+        return m_pos;
+    }
+
+private:
+    std::uint8_t* m_pos;
+    FrameChecksumState* m_state;
+};
+
+}  // namespace details
+
+/// @brief Serialise message into complete UBX frame.
+/// @details Writes the frame (sync characters, class and ID, length,
+///     payload, and checksum) straight into the provided buffer, the
+///     payload is serialised in place right after the header. Doesn't use
+///     any intermediate buffer nor dynamic memory allocation. Applicable to
+///     any message type (see @ref ublox::OutputMessages), without the need
+///     to define the protocol stack and the interface class with
+///     polymorphic write.
+///
+///     The length field is written up front from @b doLength(), and the
+///     payload is written by the message's own @b doWrite() through the
+///     iterator accumulating the checksum, i.e. the frame is produced in
+///     single pass without reading back the written bytes.
+/// @param[in] msg Message object.
+/// @param[out] buf Output buffer.
+/// @param[in] size Size of the output buffer.
+/// @param[out] len Length of the written frame, 0 on failure.
+/// @return Status of the write operation,
+///     @b comms::ErrorStatus::BufferOverflow if the buffer is too small,
+///     @b comms::ErrorStatus::InvalidMsgData if the payload is too long or
+///     the message writes other number of bytes than reported by
+///     @b doLength().
+template <typename TMsg>
+comms::ErrorStatus encodeFrame(
+    const TMsg& msg,
+    std::uint8_t* buf,
+    std::size_t size,
+    std::size_t& len)
+{
+    len = 0U;
+    auto payloadLen = msg.doLength();
+    if (size < frameLength(payloadLen)) {
+        return comms::ErrorStatus::BufferOverflow;
+    }
+
+    if (std::numeric_limits<std::uint16_t>::max() < payloadLen) {
+        return comms::ErrorStatus::InvalidMsgData;
+    }
+
+    writeFrameHeader(static_cast<MsgId>(msg.doGetId()), payloadLen, buf);
+    details::FrameChecksumState checksum;
+    for (auto idx = 2U; idx < FrameHeaderLen; ++idx) {
+        checksum.update(buf[idx]);
+    }
+
+    auto* payload = buf + FrameHeaderLen;
+    details::FrameChecksumWriter iter(payload, checksum);
+    auto es = msg.doWrite(iter, payloadLen);
+    if (es != comms::ErrorStatus::Success) {
+        return es;
+    }
+
+    if (iter.base() != (payload + payloadLen)) {
+        return comms::ErrorStatus::InvalidMsgData;
+    }
+
+    payload[payloadLen] = checksum.m_ckA;
+    payload[payloadLen + 1U] = checksum.m_ckB;
+    len = frameLength(payloadLen);
+    return comms::ErrorStatus::Success;
+}
+
+/// @brief Serialise message into complete UBX frame in the array.
+/// @details Same as other @ref encodeFrame(), the size of the buffer is
+///     deduced.
+template <typename TMsg, std::size_t TSize>
+comms::ErrorStatus encodeFrame(
+    const TMsg& msg,
+    std::uint8_t (&buf)[TSize],
+    std::size_t& len)
+{
+    return encodeFrame(msg, &buf[0], TSize, len);
+}
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
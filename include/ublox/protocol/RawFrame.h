@@ -0,0 +1,196 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of raw frame retention facilities.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+namespace ublox
+{
+
+namespace protocol
+{
+
+/// @brief Non-owning view of the serialised frame (from @b SYNC CHAR 1 to
+///     the last checksum byte) a message object was decoded from.
+/// @details Doesn't copy any data, it remains valid as long as the input
+///     buffer the message was read from is alive and unmodified.
+class RawFrame
+{
+public:
+    /// @brief Default constructor, creates empty view.
+    RawFrame() = default;
+
+    /// @brief Constructor
+    /// @param[in] data Pointer to the first byte of the frame.
+    /// @param[in] size Number of bytes in the frame.
+    RawFrame(const std::uint8_t* data, std::size_t size)
+      : m_data(data),
+        m_size(size)
+    {
+    }
+
+    /// @brief Pointer to the first byte of the frame.
+    const std::uint8_t* data() const
+    {
+        return m_data;
+    }
+
+    /// @brief Number of bytes in the frame.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    /// @brief Check whether the view is empty.
+    bool empty() const
+    {
+        return m_size == 0U;
+    }
+
+    /// @brief Iterator to the first byte of the frame.
+    const std::uint8_t* begin() const
+    {
+        return m_data;
+    }
+
+    /// @brief Iterator past the last byte of the frame.
+    const std::uint8_t* end() const
+    {
+        return m_data + m_size;
+    }
+
+    /// @brief Reset the view to be empty.
+    void clear()
+    {
+        m_data = nullptr;
+        m_size = 0U;
+    }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0U;
+};
+
+/// @brief Extension of the messages interface class allowing retention of
+///     the raw frame the message was decoded from.
+/// @details Used to wrap the interface class (some variant of ublox::MessageT)
+///     of @b input messages:
+///     @code
+///     using MyInputMessage =
+///         ublox::protocol::RawFrameRetaining<
+///             ublox::MessageT<
+///                 comms::option::ReadIterator<const std::uint8_t*>,
+///                 comms::option::Handler<MyHandler>
+///             >
+///         >;
+///     @endcode
+///     When the message is read using @ref readRetainingFrame(), the view
+///     of its raw frame becomes accessible using @ref rawFrame() member
+///     function. It allows forwarding of the received message without
+///     re-serialising it.
+/// @tparam TBase Interface class to extend.
+template <typename TBase>
+class RawFrameRetaining : public TBase
+{
+public:
+    /// @brief Default constructor
+    RawFrameRetaining() = default;
+
+    /// @brief Copy constructor
+    RawFrameRetaining(const RawFrameRetaining&) = default;
+
+    /// @brief Move constructor
+    RawFrameRetaining(RawFrameRetaining&&) = default;
+
+    /// @brief Destructor
+    virtual ~RawFrameRetaining() = default;
+
+    /// @brief Copy assignment operator
+    RawFrameRetaining& operator=(const RawFrameRetaining&) = default;
+
+    /// @brief Move assignment operator
+    RawFrameRetaining& operator=(RawFrameRetaining&&) = default;
+
+    /// @brief Get view of the raw frame the message was decoded from.
+    /// @details Empty in case the message wasn't read using
+    ///     @ref readRetainingFrame().
+    const RawFrame& rawFrame() const
+    {
+        return m_rawFrame;
+    }
+
+    /// @brief Set view of the raw frame.
+    void setRawFrame(const RawFrame& frame)
+    {
+        m_rawFrame = frame;
+    }
+
+private:
+    RawFrame m_rawFrame;
+};
+
+/// @brief Read message using protocol stack and record view of its raw frame.
+/// @details Invokes @b read() member function of the protocol stack (see @ref ublox::Stack)
+///     and on success assigns the view of consumed bytes to the read
+///     message object using its @b setRawFrame() member function
+///     (see @ref RawFrameRetaining). The interface class of the input
+///     messages is expected to be wrapped by @ref RawFrameRetaining and
+///     the read iterator to be a pointer to the raw data.
+/// @param[in] stack Protocol stack object.
+/// @param[out] msgPtr Smart pointer to the read message object.
+/// @param[in, out] iter Read iterator, advanced past the consumed data.
+/// @param[in] len Number of bytes available for reading.
+/// @param[out] missingSize Number of missing bytes in case of
+///     @b comms::ErrorStatus::NotEnoughData error.
+/// @return Status of the read operation.
+template <typename TStack, typename TMsgPtr, typename TIter>
+comms::ErrorStatus readRetainingFrame(
+    TStack& stack,
+    TMsgPtr& msgPtr,
+    TIter& iter,
+    std::size_t len,
+    std::size_t* missingSize = nullptr)
+{
+    static_assert(std::is_pointer<TIter>::value,
+        "Raw frame can be retained only when reading from contiguous buffer");
+
+    auto* frameBegin = reinterpret_cast<const std::uint8_t*>(iter);
+    auto es = stack.read(msgPtr, iter, len, missingSize);
+    if ((es == comms::ErrorStatus::Success) && msgPtr) {
+        auto* frameEnd = reinterpret_cast<const std::uint8_t*>(iter);
+        msgPtr->setRawFrame(
+            RawFrame(
+                frameBegin,
+                static_cast<std::size_t>(std::distance(frameBegin, frameEnd))));
+    }
+    return es;
+}
+
+}  // namespace protocol
+
+}  // namespace ublox
+
+
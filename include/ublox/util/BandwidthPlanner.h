@@ -0,0 +1,582 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::BandwidthPlanner class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include "ublox/MsgId.h"
+#include "ublox/message/NavPosecef.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavStatus.h"
+#include "ublox/message/NavDop.h"
+#include "ublox/message/NavSol.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavOdo.h"
+#include "ublox/message/NavVelecef.h"
+#include "ublox/message/NavVelned.h"
+#include "ublox/message/NavTimegps.h"
+#include "ublox/message/NavTimeutc.h"
+#include "ublox/message/NavClock.h"
+#include "ublox/message/NavTimeglo.h"
+#include "ublox/message/NavTimebds.h"
+#include "ublox/message/NavTimegal.h"
+#include "ublox/message/NavTimels.h"
+#include "ublox/message/NavSvinfo.h"
+#include "ublox/message/NavOrb.h"
+#include "ublox/message/NavSat.h"
+#include "ublox/message/NavEoe.h"
+#include "ublox/message/RxmRaw.h"
+#include "ublox/message/RxmSfrbx.h"
+#include "ublox/message/RxmMeasx.h"
+#include "ublox/message/RxmRawx.h"
+#include "ublox/message/RxmSvsi.h"
+#include "ublox/message/CfgPrtUart.h"
+#include "ublox/message/CfgMsg.h"
+#include "ublox/message/CfgMsgCurrent.h"
+#include "ublox/message/CfgRate.h"
+#include "ublox/message/MonHw.h"
+#include "ublox/message/MonHw2.h"
+#include "ublox/message/MonRxbuf.h"
+#include "ublox/message/MonTxbuf.h"
+#include "ublox/message/TimTp.h"
+#include "ublox/message/TimTm2.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Number of output items of the variable length message.
+enum class BandwidthItems : std::uint8_t
+{
+    None, ///< Fixed length message
+    Satellites, ///< Item per used or tracked satellite
+    Signals ///< Item per tracked signal (measurement)
+};
+
+/// @brief Event the output rate of the message is relative to.
+enum class BandwidthEvent : std::uint8_t
+{
+    NavSolution, ///< Navigation solution
+    Measurement, ///< Raw measurement epoch
+    Subframe, ///< Reception of the navigation data subframe of any satellite
+    Second ///< Second of time (periodic MON-XXX messages, TIM-TP at 1 Hz time pulse)
+};
+
+/// @brief Load status of the port.
+enum class BandwidthStatus : std::uint8_t
+{
+    Unknown, ///< Capacity of the port (baud rate) is unknown
+    Ok, ///< Below the warning level
+    Warning, ///< Above the warning level
+    Saturated ///< Above the capacity of the port
+};
+
+/// @brief Load prediction of the single port.
+struct BandwidthReport
+{
+    double m_bytesPerSec = 0.0; ///< Predicted output, bytes per second
+    double m_capacityBytesPerSec = 0.0; ///< Capacity of the port, 0 if unknown
+    double m_utilisation = 0.0; ///< Ratio of the output and the capacity
+    BandwidthStatus m_status = BandwidthStatus::Unknown; ///< Load status
+    std::uint32_t m_recommendedBaud = 0U; ///< Lowest standard baud rate below the warning level, 0 if none
+    unsigned m_recommendedDecimation = 1U; ///< Factor to multiply all the rates by to get below the warning level at current baud rate
+};
+
+/// @brief Predictor of the output bandwidth of the receiver ports.
+/// @details Combines the output rates of the messages (@b CFG-MSG), the
+///     measurement and navigation rates (@b CFG-RATE), and the expected
+///     numbers of satellites and signals into the number of bytes per
+///     second output on every port, and compares it with the capacity of
+///     UART ports given by their baud rate (@b CFG-PRT, 10 bits per byte).
+///
+///     The payload lengths of UBX messages are taken from the message
+///     definitions: the length of default constructed message and the length
+///     of single element of its list for the variable length messages.
+///     The rates of the messages unknown to the planner are recorded, but
+///     not accounted until their sizes are provided using
+///     @ref setMessageSize(), the number of such messages is reported by
+///     @ref unknownRates(). The standard NMEA sentences are accounted with
+///     their maximal length of 82 characters. The periodic @b MON-XXX
+///     messages and @b TIM-TP are output once per second (time pulse)
+///     rather than per navigation solution.
+class BandwidthPlanner
+{
+public:
+    /// @brief Number of ports in @b CFG-MSG.
+    static const std::size_t PortsCount = 6U;
+
+    /// @brief Length of UBX frame without payload.
+    static const std::size_t FrameOverhead = 8U;
+
+    /// @brief Constructor
+    /// @param[in] warnUtilisation Utilisation of the port considered to be
+    ///     too close to saturation.
+    explicit BandwidthPlanner(double warnUtilisation = 0.7)
+      : m_warnUtilisation(warnUtilisation)
+    {
+        for (auto& baud : m_baud) {
+            baud = 0U;
+        }
+
+        addFixed<message::NavPosecef<> >();
+        addFixed<message::NavPosllh<> >();
+        addFixed<message::NavStatus<> >();
+        addFixed<message::NavDop<> >();
+        addFixed<message::NavSol<> >();
+        addFixed<message::NavPvt<> >();
+        addFixed<message::NavOdo<> >();
+        addFixed<message::NavVelecef<> >();
+        addFixed<message::NavVelned<> >();
+        addFixed<message::NavTimegps<> >();
+        addFixed<message::NavTimeutc<> >();
+        addFixed<message::NavClock<> >();
+        addFixed<message::NavTimeglo<> >();
+        addFixed<message::NavTimebds<> >();
+        addFixed<message::NavTimegal<> >();
+        addFixed<message::NavTimels<> >();
+        addList<message::NavSvinfo<>, message::NavSvinfoFields::block>(BandwidthItems::Satellites, BandwidthEvent::NavSolution);
+        addList<message::NavOrb<>, message::NavOrbFields::block>(BandwidthItems::Satellites, BandwidthEvent::NavSolution);
+        addList<message::NavSat<>, message::NavSatFields::block>(BandwidthItems::Satellites, BandwidthEvent::NavSolution);
+        addFixed<message::NavEoe<> >();
+        addList<message::RxmRaw<>, message::RxmRawFields::block>(BandwidthItems::Satellites, BandwidthEvent::Measurement);
+        addSubframes();
+        addList<message::RxmMeasx<>, message::RxmMeasxFields::block>(BandwidthItems::Satellites, BandwidthEvent::Measurement);
+        addList<message::RxmRawx<>, message::RxmRawxFields::block>(BandwidthItems::Signals, BandwidthEvent::Measurement);
+        addList<message::RxmSvsi<>, message::RxmSvsiFields::block>(BandwidthItems::Satellites, BandwidthEvent::Measurement);
+        addFixed<message::MonRxbuf<> >(BandwidthEvent::Second);
+        addFixed<message::MonTxbuf<> >(BandwidthEvent::Second);
+        addFixed<message::MonHw<> >(BandwidthEvent::Second);
+        addFixed<message::MonHw2<> >(BandwidthEvent::Second);
+        addFixed<message::TimTp<> >(BandwidthEvent::Second);
+        addFixed<message::TimTm2<> >();
+        addNmea();
+    }
+
+    /// @brief Set length of the message unknown to the planner or
+    ///     override the known one.
+    /// @param[in] id ID of the message.
+    /// @param[in] fixedLen Length of the fixed part of the payload.
+    /// @param[in] itemLen Length of the single item of the variable part.
+    /// @param[in] items What the number of the items depends on.
+    /// @param[in] event Event the output rate is relative to.
+    /// @param[in] framed Whether the UBX frame overhead needs to be added.
+    void setMessageSize(
+        MsgId id,
+        std::size_t fixedLen,
+        std::size_t itemLen = 0U,
+        BandwidthItems items = BandwidthItems::None,
+        BandwidthEvent event = BandwidthEvent::NavSolution,
+        bool framed = true)
+    {
+        auto& info = entry(id);
+        info.m_fixedLen = fixedLen;
+        info.m_itemLen = itemLen;
+        info.m_items = items;
+        info.m_event = event;
+        info.m_framed = framed;
+        info.m_known = true;
+    }
+
+    /// @brief Set output rate of the message on the port.
+    /// @param[in] id ID of the message.
+    /// @param[in] port Port ID (0 - DDC, 1 - UART1, 2 - UART2, 3 - USB,
+    ///     4 - SPI, 5 - reserved), see @ref PortsCount.
+    /// @param[in] rate Output rate relative to the event, 0 disables the output.
+    void setRate(MsgId id, std::size_t port, unsigned rate)
+    {
+        if (PortsCount <= port) {
+            return;
+        }
+
+        auto* info = find(id);
+        if ((info == nullptr) && (rate == 0U)) {
+            return;
+        }
+
+        if (info == nullptr) {
+            info = &entry(id);
+        }
+
+        info->m_rates[port] = static_cast<std::uint8_t>(std::min(rate, 255U));
+    }
+
+    /// @brief Set baud rate of UART port.
+    void setBaud(std::size_t port, std::uint32_t baud)
+    {
+        if (port < PortsCount) {
+            m_baud[port] = baud;
+        }
+    }
+
+    /// @brief Set measurement and navigation rates.
+    /// @param[in] measRateMs Measurement period, ms.
+    /// @param[in] navRate Number of measurements per navigation solution.
+    void setMeasurementRate(unsigned measRateMs, unsigned navRate = 1U)
+    {
+        m_measRateMs = std::max(measRateMs, 1U);
+        m_navRate = std::max(navRate, 1U);
+    }
+
+    /// @brief Set expected numbers of satellites and signals.
+    /// @param[in] numSvs Number of tracked satellites.
+    /// @param[in] numSignals Number of tracked signals (multi-band receivers
+    ///     track more than one signal per satellite), 0 means the same as
+    ///     the number of satellites.
+    void setSatellites(unsigned numSvs, unsigned numSignals = 0U)
+    {
+        m_numSvs = numSvs;
+        m_numSignals = (numSignals == 0U) ? numSvs : numSignals;
+    }
+
+    /// @brief Set average number of navigation data subframes (pages)
+    ///     received per satellite per second.
+    void setSubframeRate(double subframesPerSec)
+    {
+        m_subframesPerSec = subframesPerSec;
+    }
+
+    /// @brief Set port used by @b CFG-MSG (@b current port) messages.
+    void setCurrentPort(std::size_t port)
+    {
+        m_currentPort = port;
+    }
+
+    /// @brief Apply @b CFG-MSG message.
+    template <typename TMsgBase, typename TRateOpt>
+    void handle(const message::CfgMsg<TMsgBase, TRateOpt>& msg)
+    {
+        auto id = msg.field_id().value();
+        auto& rates = msg.field_rate().value();
+        for (std::size_t port = 0U; (port < rates.size()) && (port < PortsCount); ++port) {
+            setRate(id, port, static_cast<unsigned>(rates[port].value()));
+        }
+    }
+
+    /// @brief Apply @b CFG-MSG (@b current port) message.
+    template <typename TMsgBase>
+    void handle(const message::CfgMsgCurrent<TMsgBase>& msg)
+    {
+        setRate(msg.field_id().value(), m_currentPort, static_cast<unsigned>(msg.field_rate().value()));
+    }
+
+    /// @brief Apply @b CFG-RATE message.
+    template <typename TMsgBase>
+    void handle(const message::CfgRate<TMsgBase>& msg)
+    {
+        setMeasurementRate(
+            static_cast<unsigned>(msg.field_measRate().value()),
+            static_cast<unsigned>(msg.field_navRate().value()));
+    }
+
+    /// @brief Apply @b CFG-PRT (@b UART) message.
+    template <typename TMsgBase>
+    void handle(const message::CfgPrtUart<TMsgBase>& msg)
+    {
+        setBaud(
+            static_cast<std::size_t>(msg.field_portID().value()),
+            static_cast<std::uint32_t>(msg.field_baudRate().value()));
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Predicted output of the message on the port, bytes per second.
+    double bytesPerSec(MsgId id, std::size_t port) const
+    {
+        auto* info = find(id);
+        if ((info == nullptr) || (PortsCount <= port)) {
+            return 0.0;
+        }
+
+        return load(*info, port);
+    }
+
+    /// @brief Invoke function object for every message output on the port.
+    /// @param[in] port Port ID.
+    /// @param[in] func Function object with signature
+    ///     @code void (MsgId id, double bytesPerSec) @endcode
+    template <typename TFunc>
+    void forEachLoad(std::size_t port, TFunc&& func) const
+    {
+        if (PortsCount <= port) {
+            return;
+        }
+
+        for (auto& info : m_infos) {
+            if (info.m_known && (info.m_rates[port] != 0U)) {
+                func(info.m_id, load(info, port));
+            }
+        }
+    }
+
+    /// @brief Predict the load of the port.
+    BandwidthReport report(std::size_t port) const
+    {
+        static const std::uint32_t StandardBauds[] = {
+            9600U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U, 921600U
+        };
+
+        BandwidthReport result;
+        if (PortsCount <= port) {
+            return result;
+        }
+
+        for (auto& info : m_infos) {
+            result.m_bytesPerSec += load(info, port);
+        }
+
+        auto warnBytesPerSec = [this](std::uint32_t baud) -> double
+            {
+                return (static_cast<double>(baud) / static_cast<double>(BitsPerByte)) * m_warnUtilisation;
+            };
+
+        for (auto baud : StandardBauds) {
+            if (result.m_bytesPerSec <= warnBytesPerSec(baud)) {
+                result.m_recommendedBaud = baud;
+                break;
+            }
+        }
+
+        if (m_baud[port] == 0U) {
+            return result;
+        }
+
+        result.m_capacityBytesPerSec = static_cast<double>(m_baud[port]) / static_cast<double>(BitsPerByte);
+        result.m_utilisation = result.m_bytesPerSec / result.m_capacityBytesPerSec;
+        if (1.0 < result.m_utilisation) {
+            result.m_status = BandwidthStatus::Saturated;
+        }
+        else if (m_warnUtilisation < result.m_utilisation) {
+            result.m_status = BandwidthStatus::Warning;
+        }
+        else {
+            result.m_status = BandwidthStatus::Ok;
+        }
+
+        auto ratio = result.m_bytesPerSec / warnBytesPerSec(m_baud[port]);
+        result.m_recommendedDecimation = static_cast<unsigned>(std::max(std::ceil(ratio), 1.0));
+        return result;
+    }
+
+    /// @brief Number of the messages unknown to the planner (see
+    ///     @ref setMessageSize()) with non-zero rate on any port.
+    std::size_t unknownRates() const
+    {
+        return static_cast<std::size_t>(
+            std::count_if(
+                m_infos.begin(), m_infos.end(),
+                [](const MsgInfo& info) -> bool
+                {
+                    return (!info.m_known) &&
+                           std::any_of(
+                               std::begin(info.m_rates), std::end(info.m_rates),
+                               [](std::uint8_t rate) -> bool
+                               {
+                                   return rate != 0U;
+                               });
+                }));
+    }
+
+private:
+    static const unsigned BitsPerByte = 10U; // start, 8 data, stop bits
+    static const std::size_t NmeaMaxLen = 82U;
+    static const unsigned SubframeWords = 10U;
+
+    struct MsgInfo
+    {
+        MsgId m_id;
+        std::size_t m_fixedLen;
+        std::size_t m_itemLen;
+        BandwidthItems m_items;
+        BandwidthEvent m_event;
+        bool m_framed;
+        bool m_known; // the size is known
+        std::uint8_t m_rates[PortsCount];
+    };
+
+    template <typename TMsg>
+    void addFixed(BandwidthEvent event = BandwidthEvent::NavSolution)
+    {
+        TMsg msg;
+        setMessageSize(TMsg::doGetId(), msg.doLength(), 0U, BandwidthItems::None, event);
+    }
+
+    template <typename TMsg, typename TItem>
+    void addList(BandwidthItems items, BandwidthEvent event)
+    {
+        TMsg msg;
+        TItem item;
+        setMessageSize(TMsg::doGetId(), msg.doLength(), item.length(), items, event);
+    }
+
+    void addSubframes()
+    {
+        // Single subframe per message, up to 10 words (GPS, BeiDou)
+        typedef message::RxmSfrbx<> Msg;
+        Msg msg;
+        field::common::U4 word;
+        setMessageSize(
+            Msg::doGetId(),
+            msg.doLength() + (word.length() * SubframeWords),
+            0U,
+            BandwidthItems::None,
+            BandwidthEvent::Subframe);
+    }
+
+    void addNmea()
+    {
+        static const unsigned NmeaClass = 0xf000;
+        static const unsigned Sentences[] = {
+            0x00, // GGA
+            0x01, // GLL
+            0x02, // GSA
+            0x04, // RMC
+            0x05, // VTG
+            0x06, // GRS
+            0x07, // GST
+            0x08, // ZDA
+            0x09, // GBS
+            0x0d, // GNS
+        };
+
+        for (auto sentence : Sentences) {
+            setMessageSize(
+                static_cast<MsgId>(NmeaClass | sentence),
+                NmeaMaxLen, 0U, BandwidthItems::None, BandwidthEvent::NavSolution, false);
+        }
+
+        // GSV reports up to 4 satellites per sentence
+        static const unsigned GsvId = 0x03;
+        static const std::size_t SatellitesPerGsv = 4U;
+        setMessageSize(
+            static_cast<MsgId>(NmeaClass | GsvId),
+            0U,
+            (NmeaMaxLen + SatellitesPerGsv - 1U) / SatellitesPerGsv,
+            BandwidthItems::Satellites,
+            BandwidthEvent::NavSolution,
+            false);
+    }
+
+    MsgInfo& entry(MsgId id)
+    {
+        auto iter =
+            std::lower_bound(
+                m_infos.begin(), m_infos.end(), id,
+                [](const MsgInfo& info, MsgId idParam) -> bool
+                {
+                    return info.m_id < idParam;
+                });
+
+        if ((iter != m_infos.end()) && (iter->m_id == id)) {
+            return *iter;
+        }
+
+        MsgInfo info = MsgInfo();
+        info.m_id = id;
+        std::fill(std::begin(info.m_rates), std::end(info.m_rates), std::uint8_t(0U));
+        return *m_infos.insert(iter, info);
+    }
+
+    const MsgInfo* find(MsgId id) const
+    {
+        auto iter =
+            std::lower_bound(
+                m_infos.begin(), m_infos.end(), id,
+                [](const MsgInfo& info, MsgId idParam) -> bool
+                {
+                    return info.m_id < idParam;
+                });
+
+        if ((iter == m_infos.end()) || (iter->m_id != id)) {
+            return nullptr;
+        }
+        return &(*iter);
+    }
+
+    MsgInfo* find(MsgId id)
+    {
+        return const_cast<MsgInfo*>(static_cast<const BandwidthPlanner*>(this)->find(id));
+    }
+
+    double load(const MsgInfo& info, std::size_t port) const
+    {
+        auto rate = info.m_rates[port];
+        if ((!info.m_known) || (rate == 0U)) {
+            return 0.0;
+        }
+
+        std::size_t items = 0U;
+        if (info.m_items == BandwidthItems::Satellites) {
+            items = m_numSvs;
+        }
+        else if (info.m_items == BandwidthItems::Signals) {
+            items = m_numSignals;
+        }
+
+        auto len = info.m_fixedLen + (info.m_itemLen * items);
+        if (info.m_framed) {
+            len += FrameOverhead;
+        }
+
+        auto measHz = 1000.0 / static_cast<double>(m_measRateMs);
+        double eventsPerSec = 0.0;
+        if (info.m_event == BandwidthEvent::NavSolution) {
+            eventsPerSec = measHz / static_cast<double>(m_navRate);
+        }
+        else if (info.m_event == BandwidthEvent::Measurement) {
+            eventsPerSec = measHz;
+        }
+        else if (info.m_event == BandwidthEvent::Second) {
+            eventsPerSec = 1.0;
+        }
+        else {
+            eventsPerSec = static_cast<double>(m_numSvs) * m_subframesPerSec;
+        }
+
+        return (static_cast<double>(len) * eventsPerSec) / static_cast<double>(rate);
+    }
+
+    std::vector<MsgInfo> m_infos; // sorted by ID
+    std::uint32_t m_baud[PortsCount];
+    double m_warnUtilisation = 0.7;
+    double m_subframesPerSec = 0.5;
+    unsigned m_measRateMs = 1000U;
+    unsigned m_navRate = 1U;
+    unsigned m_numSvs = 0U;
+    unsigned m_numSignals = 0U;
+    std::size_t m_currentPort = 1U;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,920 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::CfgTransactionEngine and
+///     ublox::util::CfgSimulatedReceiver classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "ublox/message/AckAck.h"
+#include "ublox/message/AckNak.h"
+#include "ublox/protocol/Frame.h"
+#include "ublox/util/details/frame.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Class ID of CFG messages.
+static const std::uint8_t CfgClassId = 0x06;
+
+/// @brief Number of possible message IDs within the class.
+static const std::size_t CfgIdsCount = 256U;
+
+}  // namespace details
+
+/// @brief State of the single transaction of @ref CfgTransactionEngine.
+enum class CfgTransactionStatus : std::uint8_t
+{
+    Queued, ///< Waiting to be sent
+    Sent, ///< Sent, waiting for the acknowledgement
+    Acked, ///< Acknowledged with @b ACK-ACK
+    Nacked, ///< Rejected with @b ACK-NAK
+    TimedOut, ///< No acknowledgement after all the retries
+    Skipped ///< Not sent due to the failure of the preceding transaction
+};
+
+/// @brief State of the @ref CfgTransactionEngine.
+enum class CfgEngineState : std::uint8_t
+{
+    Idle, ///< Not started yet
+    Running, ///< Sending the configuration
+    Draining, ///< Failure detected, waiting for outstanding acknowledgements
+    RollingBack, ///< Restoring the original configuration
+    Completed, ///< All the transactions acknowledged
+    RolledBack, ///< Failure detected, original configuration restored
+    Failed ///< Failure detected, restoring original configuration failed as well
+};
+
+/// @brief Statistics of @ref CfgTransactionEngine.
+struct CfgEngineStats
+{
+    std::uint32_t m_frames = 0U; ///< Number of sent frames, including retries
+    std::uint32_t m_retries = 0U; ///< Number of retransmissions
+    std::uint32_t m_acks = 0U; ///< Number of matched @b ACK-ACK messages
+    std::uint32_t m_naks = 0U; ///< Number of matched @b ACK-NAK messages
+    std::uint32_t m_unexpected = 0U; ///< Number of acknowledgements not matching any request
+};
+
+/// @brief Pipelined writer of the receiver configuration.
+/// @details Sends up to @b window CFG messages without waiting for their
+///     acknowledgements. The receiver processes the messages in order
+///     and acknowledges them with @b ACK-ACK or @b ACK-NAK, which carry
+///     only class and ID of the acknowledged message. Hence the requests
+///     of the same ID (for example multiple @b CFG-MSG) are kept in the
+///     FIFO per message ID, and the acknowledgement is matched to the
+///     oldest outstanding request of the ID by single lookup into
+///     the table indexed by the message ID.
+///
+///     The request which isn't acknowledged within the timeout is
+///     retransmitted until the number of attempts is exhausted. The lost
+///     request causes the acknowledgements of its successors of the same ID
+///     to be matched to their predecessors, so all the requests of the ID
+///     acknowledged since there were no outstanding ones of the ID are
+///     retransmitted as well, and the requests of the ID are not pipelined
+///     any more.
+///
+///     When the request is rejected or times out, no new requests are
+///     sent; once all the outstanding ones are resolved the original
+///     configuration, provided to @ref add() alongside the new one, of all
+///     the acknowledged (or timed out) requests is written back in reverse
+///     order.
+///
+///     Messages which must not be pipelined, such as @b CFG-CFG saving
+///     the configuration or @b CFG-PRT changing the baud rate, are added
+///     using @ref addBarrier(). They are sent only after all the preceding
+///     requests are acknowledged, and no other request is sent until
+///     they are acknowledged themselves.
+///
+///     The time is provided by the caller, @ref start() and @ref tick()
+///     report current time in milliseconds of any monotonic scale. The
+///     acknowledgements reported from within the output function object
+///     are processed once it returns.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const std::uint8_t* data, std::size_t len) @endcode
+///     receiving complete UBX frames.
+template <typename TOutput>
+class CfgTransactionEngine
+{
+public:
+    /// @brief Value returned by @ref add() on failure.
+    static const std::size_t InvalidTransaction = std::numeric_limits<std::size_t>::max();
+
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] window Maximal number of outstanding requests.
+    /// @param[in] timeoutMs Acknowledgement timeout, ms.
+    /// @param[in] attempts Maximal number of transmissions of the single request.
+    explicit CfgTransactionEngine(
+        TOutput output,
+        std::size_t window = 8U,
+        std::int64_t timeoutMs = 500,
+        unsigned attempts = 3U)
+      : m_output(std::move(output)),
+        m_window((window == 0U) ? 1U : window),
+        m_timeoutMs(timeoutMs),
+        m_attempts((attempts == 0U) ? 1U : attempts)
+    {
+        for (auto& pending : m_pending) {
+            pending.m_head = NoIndex;
+            pending.m_tail = NoIndex;
+            pending.m_busySince = 0U;
+            pending.m_serial = false;
+        }
+    }
+
+    /// @brief Queue the configuration message.
+    /// @details Must be called before @ref start().
+    /// @param[in] msg Message of the CFG class.
+    /// @return Index of the transaction or @ref InvalidTransaction if the
+    ///     message doesn't belong to the CFG class or can't be serialised.
+    template <typename TMsg>
+    std::size_t add(const TMsg& msg)
+    {
+        return addMsg(msg, nullptr, false);
+    }
+
+    /// @brief Queue the configuration message with the original
+    ///     configuration to restore on failure.
+    /// @param[in] msg Message of the CFG class.
+    /// @param[in] original Message restoring the original configuration,
+    ///     usually the response to the poll of the same message.
+    /// @return Index of the transaction or @ref InvalidTransaction.
+    template <typename TMsg, typename TOrigMsg>
+    std::size_t add(const TMsg& msg, const TOrigMsg& original)
+    {
+        return addWithOriginal(msg, original, false);
+    }
+
+    /// @brief Queue the configuration message which must not be pipelined.
+    /// @return Index of the transaction or @ref InvalidTransaction.
+    template <typename TMsg>
+    std::size_t addBarrier(const TMsg& msg)
+    {
+        return addMsg(msg, nullptr, true);
+    }
+
+    /// @brief Queue the configuration message which must not be pipelined
+    ///     with the original configuration to restore on failure.
+    /// @details The original configuration is restored without pipelining
+    ///     as well.
+    /// @return Index of the transaction or @ref InvalidTransaction.
+    template <typename TMsg, typename TOrigMsg>
+    std::size_t addBarrier(const TMsg& msg, const TOrigMsg& original)
+    {
+        return addWithOriginal(msg, original, true);
+    }
+
+    /// @brief Queue the configuration message using its serialised payload.
+    /// @param[in] id ID of the message of the CFG class.
+    /// @param[in] payload Payload of the message.
+    /// @param[in] len Length of the payload.
+    /// @param[in] barrier The message must not be pipelined.
+    /// @return Index of the transaction or @ref InvalidTransaction.
+    std::size_t addRaw(MsgId id, const std::uint8_t* payload, std::size_t len, bool barrier = false)
+    {
+        if ((m_state != CfgEngineState::Idle) ||
+            (classOf(id) != details::CfgClassId) ||
+            (std::numeric_limits<std::uint16_t>::max() < len)) {
+            return InvalidTransaction;
+        }
+
+        m_transactions.emplace_back();
+        auto& trans = m_transactions.back();
+        trans.m_id = id;
+        trans.m_barrier = barrier;
+        details::appendFrame(id, payload, len, trans.m_frame);
+        ++m_requested;
+        return m_transactions.size() - 1U;
+    }
+
+    /// @brief Start sending the queued messages.
+    /// @param[in] nowMs Current time, ms.
+    void start(std::int64_t nowMs)
+    {
+        if (m_state != CfgEngineState::Idle) {
+            return;
+        }
+
+        m_nowMs = nowMs;
+        m_state = CfgEngineState::Running;
+        m_busy = true;
+        settle();
+        m_busy = false;
+    }
+
+    /// @brief Process passage of time.
+    /// @details Retransmits the requests whose acknowledgement timed out.
+    ///     Expected to be called periodically, at least several times
+    ///     per timeout.
+    /// @param[in] nowMs Current time, ms.
+    void tick(std::int64_t nowMs)
+    {
+        m_nowMs = nowMs;
+        if ((!active()) || m_busy) {
+            return;
+        }
+
+        m_busy = true;
+        for (auto idx = m_firstOpen; idx < m_nextToSend; ++idx) {
+            auto& trans = m_transactions[idx];
+            if ((trans.m_status == CfgTransactionStatus::Sent) &&
+                (trans.m_deadlineMs <= nowMs)) {
+                timeout(idx);
+            }
+        }
+
+        settle();
+        m_busy = false;
+    }
+
+    /// @brief Process acknowledgement.
+    /// @param[in] id Class and ID of the acknowledged message.
+    /// @param[in] accepted @b true for @b ACK-ACK, @b false for @b ACK-NAK.
+    void processAck(MsgId id, bool accepted)
+    {
+        if (m_busy) {
+            // Reported synchronously from within the output function object
+            m_deferredAcks.push_back(std::make_pair(id, accepted));
+            return;
+        }
+
+        m_busy = true;
+        applyAck(id, accepted);
+        settle();
+        m_busy = false;
+    }
+
+    /// @brief Handle @b ACK-ACK message.
+    template <typename TMsgBase>
+    void handle(const message::AckAck<TMsgBase>& msg)
+    {
+        processAck(msg.field_id().value(), true);
+    }
+
+    /// @brief Handle @b ACK-NAK message.
+    template <typename TMsgBase>
+    void handle(const message::AckNak<TMsgBase>& msg)
+    {
+        processAck(msg.field_id().value(), false);
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Current state.
+    CfgEngineState state() const
+    {
+        return m_state;
+    }
+
+    /// @brief Check whether the engine finished its work (successfully or not).
+    bool done() const
+    {
+        return (m_state == CfgEngineState::Completed) ||
+               (m_state == CfgEngineState::RolledBack) ||
+               (m_state == CfgEngineState::Failed);
+    }
+
+    /// @brief Number of queued configuration messages.
+    /// @details Doesn't include the rollback transactions.
+    std::size_t count() const
+    {
+        return m_requested;
+    }
+
+    /// @brief Status of the transaction.
+    /// @param[in] idx Index of the transaction returned by @ref add().
+    CfgTransactionStatus status(std::size_t idx) const
+    {
+        return m_transactions[idx].m_status;
+    }
+
+    /// @brief Number of transmissions of the transaction.
+    unsigned transmissions(std::size_t idx) const
+    {
+        return m_transactions[idx].m_sent;
+    }
+
+    /// @brief Index of the first failed (rejected or timed out) transaction.
+    /// @return Index or @ref InvalidTransaction if none failed.
+    std::size_t failedTransaction() const
+    {
+        return m_failed;
+    }
+
+    /// @brief Number of currently outstanding requests.
+    std::size_t outstanding() const
+    {
+        return m_outstanding;
+    }
+
+    /// @brief Statistics.
+    const CfgEngineStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    static const std::uint32_t NoIndex = std::numeric_limits<std::uint32_t>::max();
+
+    struct Transaction
+    {
+        std::vector<std::uint8_t> m_frame;
+        std::vector<std::uint8_t> m_rollbackFrame;
+        std::int64_t m_deadlineMs = 0;
+        std::uint32_t m_nextPending = NoIndex;
+        std::uint32_t m_sentEvent = 0U;
+        std::uint32_t m_ackEvent = 0U;
+        MsgId m_id = MsgId_CFG_PRT;
+        unsigned m_sent = 0U;
+        unsigned m_timeouts = 0U;
+        CfgTransactionStatus m_status = CfgTransactionStatus::Queued;
+        bool m_barrier = false;
+    };
+
+    struct Pending
+    {
+        std::uint32_t m_head; // Oldest outstanding request of the ID
+        std::uint32_t m_tail; // Newest outstanding request of the ID
+        std::uint32_t m_busySince; // Event of the transmission into empty FIFO
+        bool m_serial; // Don't pipeline requests of the ID
+    };
+
+    static std::uint8_t classOf(MsgId id)
+    {
+        return protocol::frameClassOf(id);
+    }
+
+    static std::size_t idOf(MsgId id)
+    {
+        return protocol::frameIdOf(id);
+    }
+
+    static bool resolved(CfgTransactionStatus status)
+    {
+        return (status != CfgTransactionStatus::Queued) &&
+               (status != CfgTransactionStatus::Sent);
+    }
+
+    template <typename TMsg, typename TOrigMsg>
+    std::size_t addWithOriginal(const TMsg& msg, const TOrigMsg& original, bool barrier)
+    {
+        std::vector<std::uint8_t> payload;
+        if ((original.doGetId() != msg.doGetId()) ||
+            (!details::writePayload(original, payload))) {
+            return InvalidTransaction;
+        }
+
+        return addMsg(msg, &payload, barrier);
+    }
+
+    template <typename TMsg>
+    std::size_t addMsg(const TMsg& msg, const std::vector<std::uint8_t>* original, bool barrier)
+    {
+        std::vector<std::uint8_t> payload;
+        if (!details::writePayload(msg, payload)) {
+            return InvalidTransaction;
+        }
+
+        auto id = static_cast<MsgId>(msg.doGetId());
+        auto idx = addRaw(id, payload.data(), payload.size(), barrier);
+        if ((idx != InvalidTransaction) && (original != nullptr)) {
+            details::appendFrame(
+                id, original->data(), original->size(), m_transactions[idx].m_rollbackFrame);
+        }
+        return idx;
+    }
+
+    bool active() const
+    {
+        return (m_state == CfgEngineState::Running) ||
+               (m_state == CfgEngineState::Draining) ||
+               (m_state == CfgEngineState::RollingBack);
+    }
+
+    void applyAck(MsgId id, bool accepted)
+    {
+        if ((!active()) || (classOf(id) != details::CfgClassId)) {
+            ++m_stats.m_unexpected;
+            return;
+        }
+
+        auto idx = m_pending[idOf(id)].m_head;
+        if (idx == NoIndex) {
+            ++m_stats.m_unexpected;
+            return;
+        }
+
+        unlinkPending(idx);
+        if (accepted) {
+            m_transactions[idx].m_ackEvent = ++m_events;
+            ++m_stats.m_acks;
+            resolve(idx, CfgTransactionStatus::Acked);
+        }
+        else {
+            ++m_stats.m_naks;
+            resolve(idx, CfgTransactionStatus::Nacked);
+        }
+    }
+
+    void timeout(std::size_t idx)
+    {
+        auto& trans = m_transactions[idx];
+        auto& pending = m_pending[idOf(trans.m_id)];
+        auto busySince = pending.m_busySince;
+        unlinkPending(idx);
+        pending.m_serial = true;
+
+        auto begin = (m_state == CfgEngineState::RollingBack) ? m_rollbackBegin : 0U;
+        for (auto otherIdx = begin; otherIdx < m_nextToSend; ++otherIdx) {
+            auto& other = m_transactions[otherIdx];
+            if ((other.m_id == trans.m_id) &&
+                (other.m_status == CfgTransactionStatus::Acked) &&
+                (busySince < other.m_ackEvent)) {
+                other.m_status = CfgTransactionStatus::Queued;
+                m_resend.push_back(otherIdx);
+            }
+        }
+
+        ++trans.m_timeouts;
+        if (m_attempts <= trans.m_timeouts) {
+            resolve(idx, CfgTransactionStatus::TimedOut);
+        }
+        else {
+            trans.m_status = CfgTransactionStatus::Queued;
+            m_resend.push_back(idx);
+        }
+
+        std::sort(m_resend.begin(), m_resend.end());
+    }
+
+    void settle()
+    {
+        while (true) {
+            for (auto& ack : m_deferredAcks) {
+                applyAck(ack.first, ack.second);
+            }
+            m_deferredAcks.clear();
+
+            pump();
+            if (m_deferredAcks.empty()) {
+                break;
+            }
+        }
+    }
+
+    void linkPending(std::size_t idx)
+    {
+        auto& trans = m_transactions[idx];
+        auto& pending = m_pending[idOf(trans.m_id)];
+        trans.m_nextPending = NoIndex;
+        if (pending.m_tail == NoIndex) {
+            pending.m_head = static_cast<std::uint32_t>(idx);
+            pending.m_busySince = trans.m_sentEvent;
+        }
+        else {
+            m_transactions[pending.m_tail].m_nextPending = static_cast<std::uint32_t>(idx);
+        }
+        pending.m_tail = static_cast<std::uint32_t>(idx);
+        ++m_outstanding;
+    }
+
+    void unlinkPending(std::size_t idx)
+    {
+        auto& trans = m_transactions[idx];
+        auto& pending = m_pending[idOf(trans.m_id)];
+        auto prev = NoIndex;
+        auto cur = pending.m_head;
+        while ((cur != NoIndex) && (cur != idx)) {
+            prev = cur;
+            cur = m_transactions[cur].m_nextPending;
+        }
+
+        if (cur == NoIndex) {
+            return;
+        }
+
+        if (prev == NoIndex) {
+            pending.m_head = trans.m_nextPending;
+        }
+        else {
+            m_transactions[prev].m_nextPending = trans.m_nextPending;
+        }
+
+        if (pending.m_tail == idx) {
+            pending.m_tail = prev;
+        }
+
+        trans.m_nextPending = NoIndex;
+        --m_outstanding;
+    }
+
+    void transmit(std::size_t idx)
+    {
+        auto& trans = m_transactions[idx];
+        trans.m_status = CfgTransactionStatus::Sent;
+        trans.m_deadlineMs = m_nowMs + m_timeoutMs;
+        trans.m_sentEvent = ++m_events;
+        ++trans.m_sent;
+        ++m_stats.m_frames;
+        m_firstOpen = std::min(m_firstOpen, idx);
+        linkPending(idx);
+        m_output(trans.m_frame.data(), trans.m_frame.size());
+    }
+
+    void resolve(std::size_t idx, CfgTransactionStatus status)
+    {
+        m_transactions[idx].m_status = status;
+        if ((status == CfgTransactionStatus::Acked) ||
+            (m_failed != InvalidTransaction)) {
+            return;
+        }
+
+        // The first failure, rolled back transactions are not rolled back again
+        m_failed = idx;
+        if (m_state == CfgEngineState::Running) {
+            m_state = CfgEngineState::Draining;
+        }
+    }
+
+    void pump()
+    {
+        while ((m_firstOpen < m_nextToSend) &&
+               (m_transactions[m_firstOpen].m_status != CfgTransactionStatus::Sent)) {
+            ++m_firstOpen;
+        }
+
+        sendQueued(m_state != CfgEngineState::Draining);
+        if ((m_outstanding != 0U) || (!m_resend.empty())) {
+            return;
+        }
+
+        if (m_state == CfgEngineState::Draining) {
+            startRollback();
+            return;
+        }
+
+        if (m_nextToSend < m_transactions.size()) {
+            return;
+        }
+
+        if (m_state == CfgEngineState::Running) {
+            m_state = CfgEngineState::Completed;
+        }
+        else if (m_state == CfgEngineState::RollingBack) {
+            m_state = rollbackFailed() ? CfgEngineState::Failed : CfgEngineState::RolledBack;
+        }
+    }
+
+    bool canSend(std::size_t idx) const
+    {
+        auto& pending = m_pending[idOf(m_transactions[idx].m_id)];
+        return (!pending.m_serial) || (pending.m_head == NoIndex);
+    }
+
+    void sendQueued(bool sendNew)
+    {
+        while (m_outstanding < m_window) {
+            if (!m_resend.empty()) {
+                auto idx = m_resend.front();
+                if (!canSend(idx)) {
+                    break;
+                }
+
+                m_resend.erase(m_resend.begin());
+                ++m_stats.m_retries;
+                transmit(idx);
+                continue;
+            }
+
+            if ((!sendNew) || (m_transactions.size() <= m_nextToSend)) {
+                break;
+            }
+
+            if ((0U < m_nextToSend) &&
+                m_transactions[m_nextToSend - 1U].m_barrier &&
+                (!resolved(m_transactions[m_nextToSend - 1U].m_status))) {
+                break; // Nothing is sent while the barrier is outstanding
+            }
+
+            if (m_transactions[m_nextToSend].m_barrier && (m_outstanding != 0U)) {
+                break; // The barrier waits for all the preceding requests
+            }
+
+            if (!canSend(m_nextToSend)) {
+                break;
+            }
+
+            ++m_nextToSend;
+            transmit(m_nextToSend - 1U);
+        }
+    }
+
+    void startRollback()
+    {
+        for (auto idx = m_nextToSend; idx < m_requested; ++idx) {
+            m_transactions[idx].m_status = CfgTransactionStatus::Skipped;
+        }
+
+        m_rollbackBegin = m_transactions.size();
+        for (auto idx = m_nextToSend; 0U < idx; --idx) {
+            auto status = m_transactions[idx - 1U].m_status;
+            if ((status != CfgTransactionStatus::Acked) &&
+                (status != CfgTransactionStatus::TimedOut)) {
+                continue;
+            }
+
+            auto& frame = m_transactions[idx - 1U].m_rollbackFrame;
+            if (frame.empty()) {
+                continue;
+            }
+
+            Transaction trans;
+            trans.m_id = m_transactions[idx - 1U].m_id;
+            trans.m_barrier = m_transactions[idx - 1U].m_barrier;
+            trans.m_frame = frame;
+            m_transactions.push_back(std::move(trans));
+        }
+
+        m_state = CfgEngineState::RollingBack;
+        m_nextToSend = m_rollbackBegin;
+        m_firstOpen = m_rollbackBegin;
+        sendQueued(true);
+        if (m_outstanding == 0U) {
+            m_state = CfgEngineState::RolledBack;
+        }
+    }
+
+    bool rollbackFailed() const
+    {
+        for (auto idx = m_rollbackBegin; idx < m_transactions.size(); ++idx) {
+            if (m_transactions[idx].m_status != CfgTransactionStatus::Acked) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TOutput m_output;
+    std::vector<Transaction> m_transactions;
+    std::vector<std::size_t> m_resend;
+    std::vector<std::pair<MsgId, bool> > m_deferredAcks;
+    Pending m_pending[details::CfgIdsCount];
+    CfgEngineStats m_stats;
+    std::size_t m_window = 0U;
+    std::int64_t m_timeoutMs = 0;
+    unsigned m_attempts = 0U;
+    std::int64_t m_nowMs = 0;
+    std::size_t m_requested = 0U;
+    std::size_t m_nextToSend = 0U;
+    std::size_t m_firstOpen = 0U;
+    std::size_t m_outstanding = 0U;
+    std::size_t m_failed = InvalidTransaction;
+    std::size_t m_rollbackBegin = 0U;
+    std::uint32_t m_events = 0U;
+    CfgEngineState m_state = CfgEngineState::Idle;
+    bool m_busy = false;
+};
+
+/// @brief Simulated receiver acknowledging CFG messages.
+/// @details Parses UBX frames written by @ref CfgTransactionEngine (or any
+///     other host side code), keeps the last accepted payload of every CFG
+///     message ID, and responds with @b ACK-ACK or @b ACK-NAK frames after
+///     configured latency, in order of the reception. Allows testing of
+///     the configuration flows without the hardware: the rejection of
+///     selected messages and the loss of every N-th frame can be
+///     simulated.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const std::uint8_t* data, std::size_t len) @endcode
+///     receiving complete acknowledgement frames.
+template <typename TOutput>
+class CfgSimulatedReceiver
+{
+public:
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] latencyMs Delay of the acknowledgements, ms.
+    explicit CfgSimulatedReceiver(TOutput output, std::int64_t latencyMs = 0)
+      : m_output(std::move(output)),
+        m_latencyMs(latencyMs)
+    {
+        for (auto& rejected : m_rejected) {
+            rejected = false;
+        }
+    }
+
+    /// @brief Reject (respond with @b ACK-NAK) all messages with the ID.
+    void reject(MsgId id, bool rejected = true)
+    {
+        m_rejected[static_cast<std::size_t>(id) & 0xffU] = rejected;
+    }
+
+    /// @brief Ignore every N-th received CFG frame, 0 disables the loss.
+    void dropEvery(unsigned count)
+    {
+        m_dropEvery = count;
+        m_dropCounter = 0U;
+    }
+
+    /// @brief Process the data written to the receiver.
+    /// @details The frames don't have to be complete, the partial ones are
+    ///     completed by the subsequent calls. After the checksum mismatch
+    ///     the bytes following the sync characters of the rejected frame
+    ///     are scanned again, so the valid frame preceded by false sync
+    ///     characters is not lost.
+    void feed(const std::uint8_t* data, std::size_t len)
+    {
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            feedByte(data[idx]);
+        }
+    }
+
+    /// @brief Report passage of time, releases the acknowledgements whose
+    ///     latency expired.
+    /// @param[in] nowMs Current time, ms.
+    void tick(std::int64_t nowMs)
+    {
+        m_nowMs = nowMs;
+        std::size_t released = 0U;
+        while ((released < m_acks.size()) && (m_acks[released].m_dueMs <= nowMs)) {
+            auto ack = m_acks[released]; // output may feed new frames
+            ++released;
+            sendAck(ack.m_id, ack.m_accepted);
+        }
+        m_acks.erase(m_acks.begin(), m_acks.begin() + static_cast<std::ptrdiff_t>(released));
+    }
+
+    /// @brief Last accepted payload of the CFG message.
+    const std::vector<std::uint8_t>& payload(MsgId id) const
+    {
+        return m_config[static_cast<std::size_t>(id) & 0xffU];
+    }
+
+    /// @brief Number of received valid frames.
+    std::size_t received() const
+    {
+        return m_received;
+    }
+
+    /// @brief Number of accepted (acknowledged with @b ACK-ACK) frames.
+    std::size_t accepted() const
+    {
+        return m_accepted;
+    }
+
+    /// @brief Number of frames with invalid checksum.
+    std::size_t checksumErrors() const
+    {
+        return m_checksumErrors;
+    }
+
+private:
+    struct Ack
+    {
+        std::int64_t m_dueMs;
+        MsgId m_id;
+        bool m_accepted;
+    };
+
+    void feedByte(std::uint8_t byte)
+    {
+        if (m_frame.empty() && (byte != protocol::FrameSyncChar1)) {
+            return;
+        }
+
+        if ((m_frame.size() == 1U) && (byte != protocol::FrameSyncChar2)) {
+            m_frame.clear();
+            feedByte(byte);
+            return;
+        }
+
+        m_frame.push_back(byte);
+        if (m_frame.size() < protocol::FrameHeaderLen) {
+            return;
+        }
+
+        auto len = protocol::framePayloadLength(&m_frame[0]);
+        if (m_frame.size() < protocol::frameLength(len)) {
+            return;
+        }
+
+        if (!protocol::frameChecksumValid(&m_frame[0], len)) {
+            // The sync characters may have been part of other data,
+            // rescan everything after the first one
+            ++m_checksumErrors;
+            std::vector<std::uint8_t> rest;
+            rest.swap(m_frame);
+            for (std::size_t idx = 1U; idx < rest.size(); ++idx) {
+                feedByte(rest[idx]);
+            }
+            return;
+        }
+
+        processFrame(len);
+        m_frame.clear();
+    }
+
+    void processFrame(std::size_t len)
+    {
+        ++m_received;
+        if (m_frame[2] != details::CfgClassId) {
+            return;
+        }
+
+        if (m_dropEvery != 0U) {
+            ++m_dropCounter;
+            if (m_dropEvery <= m_dropCounter) {
+                m_dropCounter = 0U;
+                return;
+            }
+        }
+
+        auto id = protocol::frameMsgId(&m_frame[0]);
+        auto accepted = !m_rejected[m_frame[3]];
+        if (accepted) {
+            auto* payload = &m_frame[protocol::FrameHeaderLen];
+            m_config[m_frame[3]].assign(payload, payload + len);
+            ++m_accepted;
+        }
+
+        if (m_latencyMs <= 0) {
+            sendAck(id, accepted);
+            return;
+        }
+
+        Ack ack;
+        ack.m_dueMs = m_nowMs + m_latencyMs;
+        ack.m_id = id;
+        ack.m_accepted = accepted;
+        m_acks.push_back(ack);
+    }
+
+    void sendAck(MsgId id, bool accepted)
+    {
+        static const std::size_t AckPayloadLen = 2U;
+        static const std::size_t AckFrameLen = protocol::frameLength(AckPayloadLen);
+
+        auto ackId = accepted ? MsgId_ACK_ACK : MsgId_ACK_NAK;
+        std::uint8_t payload[AckPayloadLen] = {
+            protocol::frameClassOf(id),
+            protocol::frameIdOf(id)
+        };
+
+        // The local buffer, the output may feed new frames and trigger
+        // another acknowledgement
+        std::uint8_t frame[AckFrameLen];
+        protocol::writeFrame(ackId, &payload[0], AckPayloadLen, &frame[0]);
+        m_output(&frame[0], AckFrameLen);
+    }
+
+    TOutput m_output;
+    std::int64_t m_latencyMs = 0;
+    std::int64_t m_nowMs = 0;
+    std::vector<std::uint8_t> m_frame;
+    std::vector<Ack> m_acks;
+    std::vector<std::uint8_t> m_config[details::CfgIdsCount];
+    bool m_rejected[details::CfgIdsCount];
+    unsigned m_dropEvery = 0U;
+    unsigned m_dropCounter = 0U;
+    std::size_t m_received = 0U;
+    std::size_t m_accepted = 0U;
+    std::size_t m_checksumErrors = 0U;
+};
+
+}  // namespace util
+
+}  // namespace ublox
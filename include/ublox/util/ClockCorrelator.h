@@ -0,0 +1,454 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::ClockCorrelator class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <algorithm>
+
+#include "ublox/message/TimTp.h"
+#include "ublox/message/NavClock.h"
+#include "ublox/util/SeqLock.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Residual statistics of the clock correlation.
+struct ClockResidualStats
+{
+    std::uint32_t m_accepted; ///< Number of accepted observations
+    std::uint32_t m_rejected; ///< Number of rejected (outlier) observations
+    std::uint32_t m_resets; ///< Number of fit restarts
+    double m_lastNs; ///< Residual of the last observation, ns
+    double m_meanNs; ///< Exponentially weighted mean of the residuals, ns
+    double m_rmsNs; ///< Exponentially weighted RMS of the residuals, ns
+    double m_maxAbsNs; ///< Maximal absolute residual since the last restart, ns
+};
+
+/// @brief Linear relation between host clock and GPS time.
+/// @details Trivially copyable snapshot published by @ref ClockCorrelator.
+///     Both times are expressed in nanoseconds, GPS time since GPS epoch
+///     (1980-01-06 00:00:00), the host time in any monotonic scale (for
+///     example @b CLOCK_MONOTONIC).
+struct ClockCorrelation
+{
+    std::int64_t m_hostRefNs; ///< Host time of the reference point
+    std::int64_t m_diffRefNs; ///< GPS time minus host time at the reference point
+    double m_offsetNs; ///< Fitted offset at the reference point, ns
+    double m_driftPpb; ///< Fitted drift of GPS time relative to host time, ns/s
+    ClockResidualStats m_stats; ///< Residual statistics
+    bool m_valid; ///< The relation is available
+
+    /// @brief Convert host time into GPS time.
+    std::int64_t hostToGps(std::int64_t hostNs) const
+    {
+        auto dhNs = hostNs - m_hostRefNs;
+        auto corrNs = m_offsetNs + (m_driftPpb * (static_cast<double>(dhNs) * 1e-9));
+        return hostNs + m_diffRefNs + static_cast<std::int64_t>(std::llround(corrNs));
+    }
+
+    /// @brief Convert GPS time into host time.
+    std::int64_t gpsToHost(std::int64_t gpsNs) const
+    {
+        auto restNs = static_cast<double>(gpsNs - m_hostRefNs - m_diffRefNs) - m_offsetNs;
+        auto dhNs = restNs / (1.0 + (m_driftPpb * 1e-9));
+        return m_hostRefNs + static_cast<std::int64_t>(std::llround(dhNs));
+    }
+};
+
+/// @brief Correlates host clock with GPS time.
+/// @details Maintains exponentially weighted least squares linear fit of
+///     the difference between GPS and host times against the host time, and
+///     publishes it via @ref SeqLock, so @ref hostToGps() and @ref gpsToHost()
+///     are lock-free constant time calls available to any thread, while the
+///     observations are reported by single thread.
+///
+///     The observations are either:
+///     @li host timestamps of the time pulse edges (see @ref pulse()),
+///         paired with the time of the pulse reported by preceding @b TIM-TP
+///         and corrected by its quantisation error;
+///     @li host arrival timestamps of @b NAV-CLOCK frames (or any other
+///         navigation epoch message, see @ref epoch()), paired with the
+///         GPS time of the epoch corrected by the receiver clock bias,
+///         extrapolated with the reported drift.
+///
+///     The arrival timestamps include the output and transport latency,
+///     which the fit absorbs into its offset, so once the first pulse
+///     observation is accepted, the arrival observations are ignored.
+///     The observations deviating from the fit more than configured limit
+///     are rejected as outliers, several consecutive outliers (for example
+///     after host clock step) restart the fit.
+class ClockCorrelator
+{
+public:
+    /// @brief Number of consecutive outliers restarting the fit.
+    static const unsigned MaxConsecutiveOutliers = 8U;
+
+    /// @brief Minimal number of accepted observations before outliers
+    ///     are rejected.
+    static const unsigned MinObservationsToReject = 8U;
+
+    /// @brief Constructor
+    /// @param[in] timeConstantSec Time constant of the exponential weighting, s.
+    /// @param[in] rejectSigmas Outlier limit in RMS of the residuals.
+    /// @param[in] minRejectNs Minimal outlier limit, ns.
+    explicit ClockCorrelator(
+        double timeConstantSec = 600.0,
+        double rejectSigmas = 5.0,
+        double minRejectNs = 1000000.0)
+      : m_timeConstantSec(std::max(timeConstantSec, 1e-3)),
+        m_rejectSigmas(rejectSigmas),
+        m_minRejectNs(minRejectNs)
+    {
+        resetFit();
+        m_current.m_stats = ClockResidualStats();
+        publish();
+    }
+
+    ClockCorrelator(const ClockCorrelator&) = delete;
+    ClockCorrelator& operator=(const ClockCorrelator&) = delete;
+
+    /// @brief Handle TIM-TP message.
+    /// @details Records the GPS week and the time of the next GPS aligned
+    ///     time pulse (to be reported by @ref pulse()). BeiDou week and time
+    ///     of week are converted into GPS time. The messages with UTC time
+    ///     base (their week is not GPS one) or other time reference are
+    ///     ignored.
+    template <typename TMsgBase>
+    void handle(const message::TimTp<TMsgBase>& msg)
+    {
+        static const std::uint32_t TimeBaseMask = 0x1;
+        static const std::uint32_t TimeRefGnssMask = 0xf;
+        static const std::uint32_t TimeRefGps = 0U;
+        static const std::uint32_t TimeRefBeiDou = 2U;
+        static const std::int64_t SubMsScale = 1LL << 32;
+        static const std::int64_t WeekMs = 604800000LL;
+        static const std::int64_t BeiDouEpochGpsWeek = 1356LL;
+        static const std::int64_t BeiDouGpsOffsetMs = 14000LL;
+
+        m_pulsePending = false;
+        auto flags = details::packedValue(msg.field_flags());
+        if ((flags & TimeBaseMask) != 0U) {
+            return;
+        }
+
+        auto timeRefGnss = details::packedValue(msg.field_refInfo()) & TimeRefGnssMask;
+        auto weekMs =
+            (static_cast<std::int64_t>(msg.field_week().value()) * WeekMs) +
+            static_cast<std::int64_t>(msg.field_towMS().value());
+        if (timeRefGnss == TimeRefBeiDou) {
+            weekMs += (BeiDouEpochGpsWeek * WeekMs) + BeiDouGpsOffsetMs;
+        }
+        else if (timeRefGnss != TimeRefGps) {
+            return;
+        }
+
+        m_week = static_cast<std::uint32_t>(weekMs / WeekMs);
+        m_weekValid = true;
+        m_lastTowMs = static_cast<std::uint32_t>(weekMs % WeekMs);
+        if (timeRefGnss != TimeRefGps) {
+            return;
+        }
+
+        m_pulseGpsNs =
+            weekStartNs(m_week) +
+            (static_cast<std::int64_t>(msg.field_towMS().value()) * 1000000LL) +
+            ((static_cast<std::int64_t>(msg.field_towSubMS().value()) * 1000000LL) / SubMsScale) +
+            psToNs(msg.field_qErr().value());
+        m_pulsePending = true;
+    }
+
+    /// @brief Handle NAV-CLOCK message together with its arrival host time.
+    template <typename TMsgBase>
+    void handle(const message::NavClock<TMsgBase>& msg, std::int64_t hostNs)
+    {
+        m_clockTowMs = msg.field_iTOW().value();
+        m_clkBNs = msg.field_clkB().value();
+        m_clkDPpb = msg.field_clkD().value();
+        m_clockValid = true;
+        epoch(m_clockTowMs, hostNs);
+    }
+
+    /// @brief Report host timestamp of the time pulse edge described by
+    ///     the last TIM-TP message.
+    void pulse(std::int64_t hostNs)
+    {
+        if (!m_pulsePending) {
+            return;
+        }
+
+        m_pulsePending = false;
+        m_pulseMode = true;
+        observe(hostNs, m_pulseGpsNs);
+    }
+
+    /// @brief Report host arrival time of navigation epoch message.
+    /// @details Ignored until the GPS week is known from TIM-TP, or when
+    ///     the pulse observations are used.
+    /// @param[in] iTOW GPS time of week of the navigation epoch, ms.
+    /// @param[in] hostNs Host arrival time, ns.
+    void epoch(std::uint32_t iTOW, std::int64_t hostNs)
+    {
+        static const std::uint32_t HalfWeekMs = 302400000U;
+        if ((!m_weekValid) || m_pulseMode) {
+            return;
+        }
+
+        auto week = static_cast<std::int64_t>(m_week);
+        if ((iTOW + HalfWeekMs) < m_lastTowMs) {
+            ++week;
+        }
+        else if ((m_lastTowMs + HalfWeekMs) < iTOW) {
+            --week;
+        }
+
+        auto gpsNs = weekStartNs(week) + (static_cast<std::int64_t>(iTOW) * 1000000LL);
+        if (m_clockValid) {
+            // The receiver outputs the epoch when its local clock
+            // (GPS time + bias) reaches the epoch time.
+            auto elapsedSec = (static_cast<double>(iTOW) - static_cast<double>(m_clockTowMs)) * 1e-3;
+            auto biasNs = static_cast<double>(m_clkBNs) + (static_cast<double>(m_clkDPpb) * elapsedSec);
+            gpsNs -= static_cast<std::int64_t>(std::llround(biasNs));
+        }
+
+        observe(hostNs, gpsNs);
+    }
+
+    /// @brief Report pair of host and GPS times directly.
+    void observe(std::int64_t hostNs, std::int64_t gpsNs)
+    {
+        auto diffNs = gpsNs - hostNs;
+        if (m_weight <= 0.0) {
+            startFit(hostNs, diffNs);
+            return;
+        }
+
+        // Decay and move the origin into the new observation
+        auto dxSec = static_cast<double>(hostNs - m_hostRefNs) * 1e-9;
+        auto dyNs = static_cast<double>(diffNs - m_diffRefNs);
+        auto residualNs = dyNs - predict(dxSec);
+
+        auto& stats = m_current.m_stats;
+        auto limitNs = std::max(m_minRejectNs, m_rejectSigmas * stats.m_rmsNs);
+        if ((MinObservationsToReject <= stats.m_accepted) && (limitNs < std::abs(residualNs))) {
+            ++stats.m_rejected;
+            ++m_consecutiveOutliers;
+            if (MaxConsecutiveOutliers <= m_consecutiveOutliers) {
+                ++stats.m_resets;
+                startFit(hostNs, diffNs);
+                return;
+            }
+
+            stats.m_lastNs = residualNs;
+            publish();
+            return;
+        }
+
+        m_consecutiveOutliers = 0U;
+        auto decay = std::exp(-std::abs(dxSec) / m_timeConstantSec);
+        m_weight *= decay;
+        m_sumX *= decay;
+        m_sumY *= decay;
+        m_sumXX *= decay;
+        m_sumXY *= decay;
+        shiftOrigin(dxSec, dyNs);
+        m_hostRefNs = hostNs;
+        m_diffRefNs = diffNs;
+
+        // New observation is located at the origin, contributes to weight only
+        m_weight += 1.0;
+        solve();
+
+        auto alpha = std::max(1.0 / static_cast<double>(stats.m_accepted + 1U), 1.0 - decay);
+        stats.m_lastNs = residualNs;
+        stats.m_meanNs += alpha * (residualNs - stats.m_meanNs);
+        auto sq = (stats.m_rmsNs * stats.m_rmsNs) + (alpha * ((residualNs * residualNs) - (stats.m_rmsNs * stats.m_rmsNs)));
+        stats.m_rmsNs = std::sqrt(std::max(sq, 0.0));
+        stats.m_maxAbsNs = std::max(stats.m_maxAbsNs, std::abs(residualNs));
+        ++stats.m_accepted;
+        publish();
+    }
+
+    /// @brief Get snapshot of the correlation.
+    ClockCorrelation correlation() const
+    {
+        return m_published.load();
+    }
+
+    /// @brief Convert host time into GPS time.
+    /// @return @b false in case the correlation is not available yet.
+    bool hostToGps(std::int64_t hostNs, std::int64_t& gpsNs) const
+    {
+        auto corr = correlation();
+        if (!corr.m_valid) {
+            return false;
+        }
+
+        gpsNs = corr.hostToGps(hostNs);
+        return true;
+    }
+
+    /// @brief Convert GPS time into host time.
+    /// @return @b false in case the correlation is not available yet.
+    bool gpsToHost(std::int64_t gpsNs, std::int64_t& hostNs) const
+    {
+        auto corr = correlation();
+        if (!corr.m_valid) {
+            return false;
+        }
+
+        hostNs = corr.gpsToHost(gpsNs);
+        return true;
+    }
+
+    /// @brief Residual statistics.
+    ClockResidualStats stats() const
+    {
+        return correlation().m_stats;
+    }
+
+private:
+    static std::int64_t weekStartNs(std::int64_t week)
+    {
+        return week * 604800LL * 1000000000LL;
+    }
+
+    static std::int64_t psToNs(std::int32_t ps)
+    {
+        auto halfNs = (ps < 0) ? -500LL : 500LL;
+        return (static_cast<std::int64_t>(ps) + halfNs) / 1000LL;
+    }
+
+    double predict(double xSec) const
+    {
+        return m_offsetNs + (m_driftPpb * xSec);
+    }
+
+    void resetFit()
+    {
+        m_weight = 0.0;
+        m_sumX = 0.0;
+        m_sumY = 0.0;
+        m_sumXX = 0.0;
+        m_sumXY = 0.0;
+        m_offsetNs = 0.0;
+        m_driftPpb = 0.0;
+        m_consecutiveOutliers = 0U;
+        m_current.m_valid = false;
+    }
+
+    void startFit(std::int64_t hostNs, std::int64_t diffNs)
+    {
+        resetFit();
+        auto& stats = m_current.m_stats;
+        stats.m_accepted = 0U;
+        stats.m_lastNs = 0.0;
+        stats.m_meanNs = 0.0;
+        stats.m_rmsNs = 0.0;
+        stats.m_maxAbsNs = 0.0;
+        m_hostRefNs = hostNs;
+        m_diffRefNs = diffNs;
+        m_weight = 1.0;
+        solve();
+        ++stats.m_accepted;
+        publish();
+    }
+
+    /// @brief Express the sums relative to the new origin located at
+    ///     (dx, dy) of the old one.
+    void shiftOrigin(double dx, double dy)
+    {
+        auto w = m_weight;
+        auto sx = m_sumX;
+        auto sy = m_sumY;
+        auto sxx = m_sumXX;
+        auto sxy = m_sumXY;
+        m_sumXX = sxx - (2.0 * dx * sx) + (dx * dx * w);
+        m_sumXY = sxy - (dx * sy) - (dy * sx) + (dx * dy * w);
+        m_sumX = sx - (dx * w);
+        m_sumY = sy - (dy * w);
+    }
+
+    void solve()
+    {
+        static const double MinDet = 1e-9;
+        auto det = (m_weight * m_sumXX) - (m_sumX * m_sumX);
+        if (det <= (MinDet * m_weight * m_weight)) {
+            m_offsetNs = m_sumY / m_weight;
+        }
+        else {
+            m_driftPpb = ((m_weight * m_sumXY) - (m_sumX * m_sumY)) / det;
+            m_offsetNs = (m_sumY - (m_driftPpb * m_sumX)) / m_weight;
+        }
+        m_current.m_valid = true;
+    }
+
+    void publish()
+    {
+        m_current.m_hostRefNs = m_hostRefNs;
+        m_current.m_diffRefNs = m_diffRefNs;
+        m_current.m_offsetNs = m_offsetNs;
+        m_current.m_driftPpb = m_driftPpb;
+        m_published.store(m_current);
+    }
+
+    double m_timeConstantSec = 0.0;
+    double m_rejectSigmas = 0.0;
+    double m_minRejectNs = 0.0;
+
+    // Fit, relative to the last accepted observation
+    std::int64_t m_hostRefNs = 0;
+    std::int64_t m_diffRefNs = 0;
+    double m_weight = 0.0;
+    double m_sumX = 0.0;
+    double m_sumY = 0.0;
+    double m_sumXX = 0.0;
+    double m_sumXY = 0.0;
+    double m_offsetNs = 0.0;
+    double m_driftPpb = 0.0;
+    unsigned m_consecutiveOutliers = 0U;
+
+    // Receiver state
+    std::int64_t m_pulseGpsNs = 0;
+    std::uint32_t m_week = 0U;
+    std::uint32_t m_lastTowMs = 0U;
+    std::uint32_t m_clockTowMs = 0U;
+    std::int32_t m_clkBNs = 0;
+    std::int32_t m_clkDPpb = 0;
+    bool m_weekValid = false;
+    bool m_clockValid = false;
+    bool m_pulsePending = false;
+    bool m_pulseMode = false;
+
+    ClockCorrelation m_current = ClockCorrelation();
+    SeqLock<ClockCorrelation> m_published;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
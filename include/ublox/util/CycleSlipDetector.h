@@ -0,0 +1,351 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::CycleSlipDetector class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+
+#include "ublox/message/RxmRawx.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/TimeService.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Bits of the flags reported by @ref CycleSlipDetector for every
+///     measurement.
+enum CycleSlip : std::uint8_t
+{
+    CycleSlip_LockReset = 0x1, ///< Lock time decreased or is shorter than the epoch interval
+    CycleSlip_PhaseJump = 0x2, ///< Carrier phase differs from the Doppler prediction
+    CycleSlip_HalfCycle = 0x4, ///< Half cycle subtraction changed
+    CycleSlip_HalfCycleUnresolved = 0x8, ///< Half cycle ambiguity is not resolved
+    CycleSlip_NoPhase = 0x10, ///< Carrier phase is not valid
+    CycleSlip_NewTrack = 0x20, ///< No usable previous measurement (new satellite, gap, frequency change)
+
+    /// @brief Flags reporting broken continuity of the carrier phase.
+    CycleSlip_Slip = CycleSlip_LockReset | CycleSlip_PhaseJump | CycleSlip_HalfCycle | CycleSlip_NewTrack
+};
+
+/// @brief Configuration of @ref CycleSlipDetector.
+struct CycleSlipConfig
+{
+    double m_thresholdCycles = 1.0; ///< Allowed difference from the Doppler prediction, cycles
+    double m_thresholdCyclesPerSec = 0.5; ///< Additional difference allowed per second of the interval, cycles
+    double m_maxGapSec = 10.0; ///< Maximal interval between the epochs still predicted
+};
+
+/// @brief Statistics of @ref CycleSlipDetector.
+struct CycleSlipStats
+{
+    std::uint64_t m_epochs = 0U; ///< Number of processed epochs
+    std::uint64_t m_measurements = 0U; ///< Number of processed measurements
+    std::uint64_t m_slips = 0U; ///< Number of measurements with any of @ref CycleSlip_Slip flags
+};
+
+/// @brief Streaming detector of cycle slips and losses of lock in
+///     @b RXM-RAWX epochs.
+/// @details Keeps state of every satellite in a flat table indexed by
+///     @ref SatelliteTable::indexOf() (the GLONASS frequency slot is kept in
+///     the state, its change starts the new track). Every epoch is
+///     processed in three passes: the measurements and the previous states
+///     are gathered into the "structure of arrays", the checks (lock time
+///     reset, half cycle flags, carrier phase predicted from the previous
+///     phase and the mean Doppler) are evaluated for all the measurements by
+///     the loop without branches (the comparisons are evaluated by the
+///     arithmetic and combined by the bitwise operations), which GCC
+///     vectorises at @b -O3 for SSE2 as well as AVX2 targets, and the states
+///     are scattered back.
+///
+///     The results are available until the next epoch via @ref flags() and
+///     @ref residuals(), in the order of the measurements in the message.
+class CycleSlipDetector
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Maximal number of measurements in the epoch.
+    static const std::size_t MaxMeas = 256U;
+
+    /// @brief Constructor
+    explicit CycleSlipDetector(const CycleSlipConfig& config = CycleSlipConfig())
+      : m_config(config)
+    {
+        reset();
+    }
+
+    /// @brief Forget all the satellite states.
+    void reset()
+    {
+        for (std::size_t idx = 0U; idx < StatesCount; ++idx) {
+            m_stateTime[idx] = NoTime;
+            m_stateCp[idx] = 0.0;
+            m_stateDoppler[idx] = 0.0;
+            m_stateLock[idx] = 0.0;
+            m_stateTrkStat[idx] = 0U;
+            m_stateFreqId[idx] = 0U;
+        }
+        m_count = 0U;
+        m_baseNs = 0;
+        m_hasBase = false;
+    }
+
+    /// @brief Process RXM-RAWX epoch.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmRawx<TMsgBase, TDataOpt>& msg)
+    {
+        static const std::int64_t NsPerWeek = SecPerWeek * NsPerSec;
+
+        auto nowNs =
+            (static_cast<std::int64_t>(msg.field_week().value()) * NsPerWeek) +
+            std::llround(msg.field_rcvTow().value() * static_cast<double>(NsPerSec));
+        if (!m_hasBase) {
+            m_baseNs = nowNs;
+            m_hasBase = true;
+        }
+        auto now = static_cast<double>(nowNs - m_baseNs) / static_cast<double>(NsPerSec);
+
+        gather(msg);
+        evaluate(now);
+        scatter(now);
+
+        ++m_stats.m_epochs;
+        m_stats.m_measurements += m_count;
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Number of measurements of the last epoch.
+    std::size_t count() const
+    {
+        return m_count;
+    }
+
+    /// @brief Flags (see @ref CycleSlip) of the measurements of the last
+    ///     epoch.
+    const std::uint8_t* flags() const
+    {
+        return &m_flags[0];
+    }
+
+    /// @brief Difference of the carrier phase from the Doppler prediction
+    ///     (cycles) of the measurements of the last epoch, 0 when not
+    ///     predicted.
+    const double* residuals() const
+    {
+        return &m_residual[0];
+    }
+
+    /// @brief Whether the carrier phase continuity of the measurement of
+    ///     the last epoch has been broken.
+    bool slipped(std::size_t idx) const
+    {
+        return (m_flags[idx] & CycleSlip_Slip) != 0U;
+    }
+
+    /// @brief Get statistics.
+    const CycleSlipStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    static const std::size_t StatesCount = SatelliteTable::Capacity + 1U; // Last one for unsupported satellites
+    static const std::uint32_t CpValidMask = 0x2;
+    static const std::uint32_t HalfCycMask = 0x4;
+    static const std::uint32_t SubHalfCycMask = 0x8;
+    static constexpr double NoTime = -1.0e30;
+
+    // Comparison evaluated as the sign bit of the difference: 1 if lhs < rhs,
+    // 0 otherwise (x - x is +0). Conversion of the comparison operator result
+    // to the integer is a selection, which SSE2 doesn't support for 64 bit
+    // integers.
+    static std::uint64_t isLess(double lhs, double rhs)
+    {
+        auto diff = lhs - rhs;
+        std::uint64_t bits = 0U;
+        std::memcpy(&bits, &diff, sizeof(bits));
+        return bits >> 63U;
+    }
+
+    // Value if the condition (0 or 1) is set, 0 otherwise, selected by the
+    // bitwise operation (GCC turns the conditional expression into a branch)
+    static double maskValue(double value, std::uint64_t cond)
+    {
+        std::uint64_t bits = 0U;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits &= (static_cast<std::uint64_t>(0U) - cond);
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    template <typename TMsg>
+    void gather(const TMsg& msg)
+    {
+        std::size_t count = 0U;
+        for (auto& block : msg.field_data().value()) {
+            if (MaxMeas <= count) {
+                break;
+            }
+
+            auto satIdx = SatelliteTable::indexOf(block.field_gnssId().value(), block.field_svId().value());
+            m_satIdx[count] = static_cast<std::uint16_t>(satIdx); // Capacity for unsupported ones
+            m_cp[count] = block.field_cpMes().value();
+            m_doppler[count] = block.field_doMes().value();
+            m_lock[count] = block.field_locktime().value();
+            m_trkStat[count] = details::packedValue(block.field_trkStat());
+            m_freqId[count] = block.field_freqId().value();
+            ++count;
+        }
+        m_count = count;
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto satIdx = m_satIdx[idx];
+            m_prevTime[idx] = m_stateTime[satIdx];
+            m_prevCp[idx] = m_stateCp[satIdx];
+            m_prevDoppler[idx] = m_stateDoppler[satIdx];
+            m_prevLock[idx] = m_stateLock[satIdx];
+            m_prevTrkStat[idx] = m_stateTrkStat[satIdx];
+            m_sameSignal[idx] =
+                static_cast<std::uint32_t>((m_freqId[idx] == m_stateFreqId[satIdx]) && (satIdx < SatelliteTable::Capacity));
+        }
+    }
+
+    void evaluate(double now)
+    {
+        static const double MsPerSec = 1000.0;
+        static const double MaxLocktimeMs = 64500.0; // Reported value saturates
+        static const double LockToleranceMs = 10.0;
+
+        auto thresholdCycles = m_config.m_thresholdCycles;
+        auto thresholdPerSec = m_config.m_thresholdCyclesPerSec;
+        auto maxGap = m_config.m_maxGapSec;
+        std::uint64_t slips = 0U;
+        auto count = m_count;
+
+        // Conditions are evaluated as 0 or 1 integers (see isLess()) and
+        // combined by bitwise operations to keep the loop free of branches
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto dt = now - m_prevTime[idx];
+            std::uint64_t trkStat = m_trkStat[idx];
+            std::uint64_t prevTrkStat = m_prevTrkStat[idx];
+            auto cpValid = (trkStat & CpValidMask) >> 1U;
+            auto tracked =
+                isLess(0.0, dt) &
+                (isLess(maxGap, dt) ^ 1U) &
+                ((prevTrkStat & CpValidMask) >> 1U) &
+                m_sameSignal[idx];
+            auto continued = tracked & cpValid;
+
+            // Lock time must grow by the interval unless saturated
+            auto lock = m_lock[idx];
+            auto lockReset =
+                isLess(lock, m_prevLock[idx]) |
+                (isLess(lock, (dt * MsPerSec) - LockToleranceMs) &
+                 isLess(lock, MaxLocktimeMs - LockToleranceMs));
+
+            // Phase predicted by the mean Doppler (positive for approaching satellites)
+            auto predicted = m_prevCp[idx] - ((0.5 * (m_prevDoppler[idx] + m_doppler[idx])) * dt);
+            auto residual = m_cp[idx] - predicted;
+            auto threshold = thresholdCycles + (thresholdPerSec * dt);
+            auto phaseJump = isLess(threshold, std::fabs(residual));
+
+            auto halfCycle = ((trkStat ^ prevTrkStat) & SubHalfCycMask) >> 3U;
+            auto halfCycleUnresolved = ((~trkStat) & HalfCycMask) >> 2U;
+
+            auto newTrack = cpValid & (tracked ^ 1U);
+            auto flags =
+                ((continued & lockReset) * CycleSlip_LockReset) |
+                ((continued & phaseJump) * CycleSlip_PhaseJump) |
+                ((continued & halfCycle) * CycleSlip_HalfCycle) |
+                ((cpValid & halfCycleUnresolved) * CycleSlip_HalfCycleUnresolved) |
+                ((cpValid ^ 1U) * CycleSlip_NoPhase) |
+                (newTrack * CycleSlip_NewTrack);
+
+            m_flags[idx] = static_cast<std::uint8_t>(flags);
+            m_residual[idx] = maskValue(residual, continued);
+            slips += (continued & (lockReset | phaseJump | halfCycle)) | newTrack; // CycleSlip_Slip
+        }
+
+        m_stats.m_slips += slips;
+    }
+
+    void scatter(double now)
+    {
+        for (std::size_t idx = 0U; idx < m_count; ++idx) {
+            auto satIdx = m_satIdx[idx];
+            m_stateTime[satIdx] = now;
+            m_stateCp[satIdx] = m_cp[idx];
+            m_stateDoppler[satIdx] = m_doppler[idx];
+            m_stateLock[satIdx] = m_lock[idx];
+            m_stateTrkStat[satIdx] = m_trkStat[idx];
+            m_stateFreqId[satIdx] = m_freqId[idx];
+        }
+    }
+
+    CycleSlipConfig m_config;
+    CycleSlipStats m_stats;
+    std::int64_t m_baseNs = 0;
+    bool m_hasBase = false;
+    std::size_t m_count = 0U;
+
+    // State of every satellite
+    double m_stateTime[StatesCount];
+    double m_stateCp[StatesCount];
+    double m_stateDoppler[StatesCount];
+    double m_stateLock[StatesCount];
+    std::uint32_t m_stateTrkStat[StatesCount];
+    std::uint32_t m_stateFreqId[StatesCount];
+
+    // Measurements of the current epoch and the gathered states
+    std::uint16_t m_satIdx[MaxMeas];
+    double m_cp[MaxMeas];
+    double m_doppler[MaxMeas];
+    double m_lock[MaxMeas];
+    std::uint32_t m_trkStat[MaxMeas];
+    std::uint32_t m_freqId[MaxMeas];
+    double m_prevTime[MaxMeas];
+    double m_prevCp[MaxMeas];
+    double m_prevDoppler[MaxMeas];
+    double m_prevLock[MaxMeas];
+    std::uint32_t m_prevTrkStat[MaxMeas];
+    std::uint32_t m_sameSignal[MaxMeas];
+
+    // Results
+    std::uint8_t m_flags[MaxMeas];
+    double m_residual[MaxMeas];
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
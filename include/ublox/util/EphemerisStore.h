@@ -0,0 +1,720 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::EphemerisStore class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "ublox/field/common.h"
+#include "ublox/message/RxmSfrbx.h"
+#include "ublox/message/RxmEph.h"
+#include "ublox/message/AidEph.h"
+#include "ublox/message/MgaGpsEph.h"
+#include "ublox/message/MgaQzssEph.h"
+#include "ublox/message/MgaGalEph.h"
+#include "ublox/message/MgaBdsEph.h"
+#include "ublox/message/MgaGloEph.h"
+#include "ublox/util/SeqLock.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/NavDataDecoder.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Statistics of @ref EphemerisStore.
+struct EphemerisStoreStats
+{
+    std::uint32_t m_received; ///< Received navigation data messages
+    std::uint32_t m_duplicates; ///< Messages skipped as duplicates of recently received ones
+    std::uint32_t m_decoded; ///< Messages decoded
+    std::uint32_t m_stored; ///< Ephemerides and almanacs stored (published)
+    std::uint32_t m_stale; ///< Decoded ephemerides older than the stored ones
+};
+
+/// @brief Store of the current ephemerides and almanacs shared by multiple
+///     receivers.
+/// @details Accepts the navigation data from @b RXM-SFRBX, @b RXM-EPH,
+///     @b AID-EPH, and @b MGA-*-EPH messages of any number of receivers,
+///     possibly from different threads. Every incoming message is
+///     identified by the hash of its raw words (payload) and skipped without
+///     decoding when the same data has recently been received for the same
+///     satellite (normally from another receiver). The decoded ephemeris
+///     replaces the stored one only when its issue of data or reference
+///     time (IODE / IODnav / AODE and toe, GLONASS tb) differs and it is
+///     not older.
+///
+///     The writers are serialised by the mutex, which is taken only for the
+///     messages passing the lock-free duplicates check. The readers never
+///     take any locks, every ephemeris is published by separate sequence
+///     lock (see @ref SeqLock).
+class EphemerisStore
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Number of GLONASS slots.
+    static const std::size_t GlonassCount = 32U;
+
+    /// @brief Constructor
+    EphemerisStore()
+      : m_sink(*this),
+        m_decoder(m_sink)
+    {
+        for (auto& recent : m_recent) {
+            for (auto& hash : recent.m_hashes) {
+                hash.store(0U, std::memory_order_relaxed);
+            }
+            recent.m_next = 0U;
+        }
+
+        std::memset(&m_keys[0], 0, sizeof(m_keys));
+        std::memset(&m_glonassKeys[0], 0, sizeof(m_glonassKeys));
+    }
+
+    EphemerisStore(const EphemerisStore&) = delete;
+    EphemerisStore& operator=(const EphemerisStore&) = delete;
+
+    /// @brief Handle RXM-SFRBX message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmSfrbx<TMsgBase, TDataOpt>& msg)
+    {
+        static const std::size_t MaxWords = 16U;
+        auto gnssId = msg.field_gnssId().value();
+        auto svId = msg.field_svId().value();
+        auto freqId = msg.field_freqId().value();
+        auto& list = msg.field_dwrd().value();
+        std::uint32_t words[MaxWords];
+        auto count = std::min(list.size(), MaxWords);
+        auto hash = hashStart(static_cast<std::uint32_t>(gnssId), svId);
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            words[idx] = list[idx].value();
+            hash = hashMix(hash, words[idx]);
+        }
+
+        process(
+            SatelliteTable::indexOf(gnssId, svId),
+            hash,
+            [this, gnssId, svId, freqId, &words, count]()
+            {
+                m_decoder.decode(gnssId, svId, freqId, &words[0], count);
+            });
+    }
+
+    /// @brief Handle RXM-EPH message.
+    template <typename TMsgBase, typename TSfOpt>
+    void handle(const message::RxmEph<TMsgBase, TSfOpt>& msg)
+    {
+        handleLnavEph(msg);
+    }
+
+    /// @brief Handle AID-EPH message.
+    template <typename TMsgBase, typename TSfOpt>
+    void handle(const message::AidEph<TMsgBase, TSfOpt>& msg)
+    {
+        handleLnavEph(msg);
+    }
+
+    /// @brief Handle MGA-GPS-EPH message.
+    template <typename TMsgBase>
+    void handle(const message::MgaGpsEph<TMsgBase>& msg)
+    {
+        handleMga(
+            msg, GnssId::Gps,
+            [this, &msg]()
+            {
+                KeplerEphemeris eph = KeplerEphemeris();
+                fromMgaLnav(msg, GnssId::Gps, eph);
+                store(eph);
+            });
+    }
+
+    /// @brief Handle MGA-QZSS-EPH message.
+    template <typename TMsgBase>
+    void handle(const message::MgaQzssEph<TMsgBase>& msg)
+    {
+        handleMga(
+            msg, GnssId::Qzss,
+            [this, &msg]()
+            {
+                KeplerEphemeris eph = KeplerEphemeris();
+                fromMgaLnav(msg, GnssId::Qzss, eph);
+                store(eph);
+            });
+    }
+
+    /// @brief Handle MGA-GAL-EPH message.
+    template <typename TMsgBase>
+    void handle(const message::MgaGalEph<TMsgBase>& msg)
+    {
+        handleMga(
+            msg, GnssId::Galileo,
+            [this, &msg]()
+            {
+                KeplerEphemeris eph = KeplerEphemeris();
+                fromMgaGal(msg, eph);
+                store(eph);
+            });
+    }
+
+    /// @brief Handle MGA-BDS-EPH message.
+    template <typename TMsgBase>
+    void handle(const message::MgaBdsEph<TMsgBase>& msg)
+    {
+        handleMga(
+            msg, GnssId::BeiDou,
+            [this, &msg]()
+            {
+                KeplerEphemeris eph = KeplerEphemeris();
+                fromMgaBds(msg, eph);
+                store(eph);
+            });
+    }
+
+    /// @brief Handle MGA-GLO-EPH message.
+    template <typename TMsgBase>
+    void handle(const message::MgaGloEph<TMsgBase>& msg)
+    {
+        handleMga(
+            msg, GnssId::Glonass,
+            [this, &msg]()
+            {
+                GlonassEphemeris eph = GlonassEphemeris();
+                fromMgaGlo(msg, eph);
+                store(eph);
+            });
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Get copy of the current ephemeris (GPS, QZSS, Galileo, BeiDou).
+    /// @details Lock-free, may be called from any thread.
+    /// @return @b false in case there is no ephemeris of the satellite.
+    bool ephemeris(GnssId gnssId, unsigned svId, KeplerEphemeris& eph) const
+    {
+        auto idx = SatelliteTable::indexOf(gnssId, svId);
+        if ((SatelliteTable::Capacity <= idx) || (m_eph[idx].sequence() == 0U)) {
+            return false;
+        }
+
+        eph = m_eph[idx].load();
+        return true;
+    }
+
+    /// @brief Get copy of the current GLONASS ephemeris.
+    /// @details Lock-free, may be called from any thread.
+    /// @return @b false in case there is no ephemeris of the satellite.
+    bool glonassEphemeris(unsigned svId, GlonassEphemeris& eph) const
+    {
+        if ((svId < 1U) || (GlonassCount < svId) || (m_glonass[svId - 1U].sequence() == 0U)) {
+            return false;
+        }
+
+        eph = m_glonass[svId - 1U].load();
+        return true;
+    }
+
+    /// @brief Get copy of the current almanac.
+    /// @details Lock-free, may be called from any thread.
+    /// @return @b false in case there is no almanac of the satellite.
+    bool almanac(GnssId gnssId, unsigned svId, KeplerAlmanac& alm) const
+    {
+        auto idx = SatelliteTable::indexOf(gnssId, svId);
+        if ((SatelliteTable::Capacity <= idx) || (m_alm[idx].sequence() == 0U)) {
+            return false;
+        }
+
+        alm = m_alm[idx].load();
+        return true;
+    }
+
+    /// @brief Invoke the function with copy of every stored Keplerian
+    ///     ephemeris.
+    /// @details Lock-free, may be called from any thread.
+    /// @param[in] func Function with signature
+    ///     @code void func(const ublox::util::KeplerEphemeris& eph); @endcode
+    template <typename TFunc>
+    void forEachEphemeris(TFunc&& func) const
+    {
+        for (auto& slot : m_eph) {
+            if (slot.sequence() != 0U) {
+                auto eph = slot.load();
+                func(static_cast<const KeplerEphemeris&>(eph));
+            }
+        }
+    }
+
+    /// @brief Number incremented on every update of the stored data.
+    /// @details Allows the readers to detect changes without copying.
+    std::uint32_t sequence() const
+    {
+        return m_sequence.load(std::memory_order_acquire);
+    }
+
+    /// @brief Get copy of the statistics.
+    EphemerisStoreStats stats() const
+    {
+        EphemerisStoreStats result;
+        result.m_received = m_received.load(std::memory_order_relaxed);
+        result.m_duplicates = m_duplicates.load(std::memory_order_relaxed);
+        result.m_decoded = m_decoded.load(std::memory_order_relaxed);
+        result.m_stored = m_stored.load(std::memory_order_relaxed);
+        result.m_stale = m_stale.load(std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    static const std::size_t RecentCount = 16U;
+    static const std::size_t MaxMgaPayload = 128U;
+    static const std::uint32_t SecPerWeek = 7U * 24U * 3600U;
+    static const std::uint32_t SecPerDay = 24U * 3600U;
+
+    /// @brief Hashes of the data recently received for the satellite.
+    struct RecentHashes
+    {
+        std::atomic<std::uint64_t> m_hashes[RecentCount];
+        std::size_t m_next; // Updated under the mutex only
+    };
+
+    /// @brief Writer side identification of the stored ephemeris.
+    struct StoredKey
+    {
+        std::uint32_t m_iod;
+        std::uint32_t m_toe;
+        bool m_valid;
+    };
+
+    /// @brief Handler of the decoded data reported by @ref NavDataDecoder.
+    struct Sink
+    {
+        explicit Sink(EphemerisStore& store) : m_store(store) {}
+
+        void handle(const KeplerEphemeris& eph)
+        {
+            m_store.store(eph);
+        }
+
+        void handle(const GlonassEphemeris& eph)
+        {
+            m_store.store(eph);
+        }
+
+        void handle(const KeplerAlmanac& alm)
+        {
+            m_store.store(alm);
+        }
+
+        template <typename T>
+        void handle(const T&)
+        {
+        }
+
+        EphemerisStore& m_store;
+    };
+
+    static std::uint64_t hashStart(std::uint32_t kind, std::uint32_t svId)
+    {
+        return hashMix(0xcbf29ce484222325ULL, (kind << 16) | svId);
+    }
+
+    static std::uint64_t hashMix(std::uint64_t hash, std::uint32_t value)
+    {
+        hash = (hash ^ value) * 0x9e3779b97f4a7c15ULL;
+        return hash ^ (hash >> 29);
+    }
+
+    static bool contains(const RecentHashes& recent, std::uint64_t hash)
+    {
+        for (auto& elem : recent.m_hashes) {
+            if (elem.load(std::memory_order_relaxed) == hash) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename TFunc>
+    void process(std::size_t idx, std::uint64_t hash, TFunc&& decodeFunc)
+    {
+        m_received.fetch_add(1U, std::memory_order_relaxed);
+        if (SatelliteTable::Capacity <= idx) {
+            return;
+        }
+
+        if (hash == 0U) {
+            hash = 1U; // 0 marks unused entry
+        }
+
+        auto& recent = m_recent[idx];
+        if (contains(recent, hash)) {
+            m_duplicates.fetch_add(1U, std::memory_order_relaxed);
+            return;
+        }
+
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (contains(recent, hash)) {
+            m_duplicates.fetch_add(1U, std::memory_order_relaxed);
+            return;
+        }
+
+        recent.m_hashes[recent.m_next].store(hash, std::memory_order_relaxed);
+        recent.m_next = (recent.m_next + 1U) % RecentCount;
+        m_decoded.fetch_add(1U, std::memory_order_relaxed);
+        decodeFunc();
+    }
+
+    template <typename TMsg>
+    void handleLnavEph(const TMsg& msg)
+    {
+        static const std::size_t SubframeWords = 10U;
+        static const unsigned FramesCount = 3U;
+
+        auto& sf1 = msg.field_sf1d();
+        auto& sf2 = msg.field_sf2d();
+        auto& sf3 = msg.field_sf3d();
+        if ((sf1.getMode() != comms::field::OptionalMode::Exists) ||
+            (sf2.getMode() != comms::field::OptionalMode::Exists) ||
+            (sf3.getMode() != comms::field::OptionalMode::Exists)) {
+            return; // Poll response without ephemeris
+        }
+
+        auto svId = static_cast<unsigned>(msg.field_svid().value());
+        std::uint32_t subframes[FramesCount][SubframeWords];
+        auto hash = hashStart(static_cast<std::uint32_t>(GnssId::Gps), svId);
+        if ((!copySubframe(sf1.field().value(), 1U, subframes[0], hash)) ||
+            (!copySubframe(sf2.field().value(), 2U, subframes[1], hash)) ||
+            (!copySubframe(sf3.field().value(), 3U, subframes[2], hash))) {
+            return;
+        }
+
+        process(
+            SatelliteTable::indexOf(GnssId::Gps, svId),
+            hash,
+            [this, svId, &subframes]()
+            {
+                for (auto& words : subframes) {
+                    m_decoder.decodeLnavData(GnssId::Gps, svId, &words[0]);
+                }
+            });
+    }
+
+    /// @brief Restore the LNAV subframe from 8 data words (words 3 - 10).
+    template <typename TList>
+    static bool copySubframe(const TList& list, unsigned subframe, std::uint32_t* words, std::uint64_t& hash)
+    {
+        static const std::size_t DataWords = 8U;
+        static const std::uint32_t Tlm = 0x8b0000U; // Preamble
+
+        if (list.size() < DataWords) {
+            return false;
+        }
+
+        words[0] = Tlm;
+        words[1] = subframe << 2; // HOW with subframe ID only
+        for (std::size_t idx = 0U; idx < DataWords; ++idx) {
+            words[idx + 2U] = list[idx].value() & 0xffffffU;
+            hash = hashMix(hash, words[idx + 2U]);
+        }
+        return true;
+    }
+
+    template <typename TMsg, typename TFunc>
+    void handleMga(const TMsg& msg, GnssId gnssId, TFunc&& decodeFunc)
+    {
+        std::uint8_t buf[MaxMgaPayload];
+        auto len = msg.doLength();
+        std::uint8_t* iter = &buf[0];
+        if ((MaxMgaPayload < len) || (msg.doWrite(iter, len) != comms::ErrorStatus::Success)) {
+            return;
+        }
+
+        auto svId = static_cast<unsigned>(msg.field_svId().value());
+        auto hash = hashStart(static_cast<std::uint32_t>(gnssId) | 0x80U, svId);
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            hash = hashMix(hash, buf[idx]);
+        }
+
+        process(SatelliteTable::indexOf(gnssId, svId), hash, std::forward<TFunc>(decodeFunc));
+    }
+
+    static double sc(int exp)
+    {
+        return details::navPow2(exp) * details::NavSemiCircle;
+    }
+
+    static double p2(int exp)
+    {
+        return details::navPow2(exp);
+    }
+
+    template <typename TMsg>
+    static void fromMgaLnav(const TMsg& msg, GnssId gnssId, KeplerEphemeris& eph)
+    {
+        eph.m_gnssId = static_cast<std::uint8_t>(gnssId);
+        eph.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        eph.m_accuracy = msg.field_uraIndex().value();
+        eph.m_health = msg.field_svHealth().value();
+        eph.m_iodc = msg.field_iodc().value();
+        eph.m_iode = static_cast<std::uint16_t>(eph.m_iodc & 0xffU);
+        eph.m_tgd = msg.field_tgd().value() * p2(-31);
+        eph.m_toc = msg.field_toc().value() * 16.0;
+        eph.m_af2 = msg.field_af2().value() * p2(-55);
+        eph.m_af1 = msg.field_af1().value() * p2(-43);
+        eph.m_af0 = msg.field_af0().value() * p2(-31);
+        eph.m_crs = msg.field_crs().value() * p2(-5);
+        eph.m_deltaN = msg.field_deltaN().value() * sc(-43);
+        eph.m_m0 = msg.field_m0().value() * sc(-31);
+        eph.m_cuc = msg.field_cuc().value() * p2(-29);
+        eph.m_cus = msg.field_cus().value() * p2(-29);
+        eph.m_e = msg.field_e().value() * p2(-33);
+        eph.m_sqrtA = msg.field_sqrtA().value() * p2(-19);
+        eph.m_toe = msg.field_toe().value() * 16.0;
+        eph.m_cic = msg.field_cic().value() * p2(-29);
+        eph.m_omega0 = msg.field_omega0().value() * sc(-31);
+        eph.m_cis = msg.field_cis().value() * p2(-29);
+        eph.m_crc = msg.field_crc().value() * p2(-5);
+        eph.m_i0 = msg.field_i0().value() * sc(-31);
+        eph.m_omega = msg.field_omega().value() * sc(-31);
+        eph.m_omegaDot = msg.field_omegaDot().value() * sc(-43);
+        eph.m_iDot = msg.field_idot().value() * sc(-43);
+    }
+
+    template <typename TMsg>
+    static void fromMgaGal(const TMsg& msg, KeplerEphemeris& eph)
+    {
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::Galileo);
+        eph.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        eph.m_iode = msg.field_iodNav().value();
+        eph.m_iodc = eph.m_iode;
+        eph.m_accuracy = msg.field_sisaIndexE1E5b().value();
+        eph.m_health = static_cast<std::uint16_t>(
+            (msg.field_dataValidityE1B().value() & 0x1U) |
+            ((msg.field_healthE1B().value() & 0x3U) << 1) |
+            ((msg.field_dataValidityE5B().value() & 0x1U) << 6) |
+            ((msg.field_healthE5B().value() & 0x3U) << 7));
+        eph.m_deltaN = msg.field_deltaN().value() * sc(-43);
+        eph.m_m0 = msg.field_m0().value() * sc(-31);
+        eph.m_e = msg.field_e().value() * p2(-33);
+        eph.m_sqrtA = msg.field_sqrtA().value() * p2(-19);
+        eph.m_omega0 = msg.field_omega0().value() * sc(-31);
+        eph.m_i0 = msg.field_i0().value() * sc(-31);
+        eph.m_omega = msg.field_omega().value() * sc(-31);
+        eph.m_omegaDot = msg.field_omegaDot().value() * sc(-43);
+        eph.m_iDot = msg.field_iDot().value() * sc(-43);
+        eph.m_cuc = msg.field_cuc().value() * p2(-29);
+        eph.m_cus = msg.field_cus().value() * p2(-29);
+        eph.m_crc = msg.field_crc().value() * p2(-5);
+        eph.m_crs = msg.field_crs().value() * p2(-5);
+        eph.m_cic = msg.field_cic().value() * p2(-29);
+        eph.m_cis = msg.field_cis().value() * p2(-29);
+        eph.m_toe = msg.field_toe().value() * 60.0;
+        eph.m_af0 = msg.field_af0().value() * p2(-34);
+        eph.m_af1 = msg.field_af1().value() * p2(-46);
+        eph.m_af2 = msg.field_af2().value() * p2(-59);
+        eph.m_toc = msg.field_toc().value() * 60.0;
+        eph.m_tgd2 = msg.field_bgdE1E5b().value() * p2(-32);
+    }
+
+    template <typename TMsg>
+    static void fromMgaBds(const TMsg& msg, KeplerEphemeris& eph)
+    {
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::BeiDou);
+        eph.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        eph.m_health = msg.field_SatH1().value();
+        eph.m_iodc = msg.field_IODC().value();
+        eph.m_iode = msg.field_IODE().value();
+        eph.m_accuracy = msg.field_URAI().value();
+        eph.m_af2 = msg.field_a2().value() * p2(-66);
+        eph.m_af1 = msg.field_a1().value() * p2(-50);
+        eph.m_af0 = msg.field_a0().value() * p2(-33);
+        eph.m_toc = msg.field_toc().value() * 8.0;
+        eph.m_tgd = msg.field_TGD1().value() * 1e-10;
+        eph.m_toe = msg.field_toe().value() * 8.0;
+        eph.m_sqrtA = msg.field_sqrtA().value() * p2(-19);
+        eph.m_e = msg.field_e().value() * p2(-33);
+        eph.m_omega = msg.field_omega().value() * sc(-31);
+        eph.m_deltaN = msg.field_Deltan().value() * sc(-43);
+        eph.m_iDot = msg.field_IDOT().value() * sc(-43);
+        eph.m_m0 = msg.field_M0().value() * sc(-31);
+        eph.m_omega0 = msg.field_Omega0().value() * sc(-31);
+        eph.m_omegaDot = msg.field_OmegaDot().value() * sc(-43);
+        eph.m_i0 = msg.field_i0().value() * sc(-31);
+        eph.m_cuc = msg.field_Cuc().value() * p2(-31);
+        eph.m_cus = msg.field_Cus().value() * p2(-31);
+        eph.m_crc = msg.field_Crc().value() * p2(-6);
+        eph.m_crs = msg.field_Crs().value() * p2(-6);
+        eph.m_cic = msg.field_Cic().value() * p2(-31);
+        eph.m_cis = msg.field_Cis().value() * p2(-31);
+    }
+
+    template <typename TMsg>
+    static void fromMgaGlo(const TMsg& msg, GlonassEphemeris& eph)
+    {
+        static const double PosScale = p2(-11) * 1e3;
+        static const double VelScale = p2(-20) * 1e3;
+        static const double AccScale = p2(-30) * 1e3;
+        static const double TbScale = 15.0 * 60.0;
+
+        eph.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        eph.m_ft = msg.field_FT().value();
+        eph.m_health = static_cast<std::uint8_t>((msg.field_B().value() >> 2) & 0x1U);
+        eph.m_m = msg.field_M().value();
+        eph.m_freqNum = msg.field_H().value();
+        eph.m_x = msg.field_x().value() * PosScale;
+        eph.m_y = msg.field_y().value() * PosScale;
+        eph.m_z = msg.field_z().value() * PosScale;
+        eph.m_vx = msg.field_dx().value() * VelScale;
+        eph.m_vy = msg.field_dy().value() * VelScale;
+        eph.m_vz = msg.field_dz().value() * VelScale;
+        eph.m_ax = msg.field_ddx().value() * AccScale;
+        eph.m_ay = msg.field_ddy().value() * AccScale;
+        eph.m_az = msg.field_ddz().value() * AccScale;
+        eph.m_tb = msg.field_tb().value() * TbScale;
+        eph.m_gammaN = msg.field_gamma().value() * p2(-40);
+        eph.m_age = msg.field_E().value();
+        eph.m_deltaTauN = msg.field_deltaTau().value() * p2(-30);
+        eph.m_tauN = msg.field_tau().value() * p2(-30);
+    }
+
+    /// @brief Check whether the reference time is not older than the
+    ///     stored one, taking into account the rollover of the period.
+    static bool notOlder(std::uint32_t time, std::uint32_t stored, std::uint32_t period)
+    {
+        auto diff = (time + period - stored) % period;
+        return diff < (period / 2U);
+    }
+
+    void published()
+    {
+        m_stored.fetch_add(1U, std::memory_order_relaxed);
+        m_sequence.fetch_add(1U, std::memory_order_release);
+    }
+
+    // Called under the mutex
+    void store(const KeplerEphemeris& eph)
+    {
+        auto idx = SatelliteTable::indexOf(static_cast<GnssId>(eph.m_gnssId), eph.m_svId);
+        if (SatelliteTable::Capacity <= idx) {
+            return;
+        }
+
+        auto& key = m_keys[idx];
+        auto toe = static_cast<std::uint32_t>(std::lround(eph.m_toe)) % SecPerWeek;
+        if (key.m_valid) {
+            if ((key.m_iod == eph.m_iode) && (key.m_toe == toe)) {
+                return; // Already stored
+            }
+
+            if (!notOlder(toe, key.m_toe, SecPerWeek)) {
+                m_stale.fetch_add(1U, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        key.m_iod = eph.m_iode;
+        key.m_toe = toe;
+        key.m_valid = true;
+        m_eph[idx].store(eph);
+        published();
+    }
+
+    // Called under the mutex
+    void store(const GlonassEphemeris& eph)
+    {
+        if ((eph.m_svId < 1U) || (GlonassCount < eph.m_svId)) {
+            return;
+        }
+
+        auto idx = eph.m_svId - 1U;
+        auto& key = m_glonassKeys[idx];
+        auto tb = static_cast<std::uint32_t>(std::lround(eph.m_tb)) % SecPerDay;
+        if (key.m_valid) {
+            if (key.m_toe == tb) {
+                return; // Already stored
+            }
+
+            if (!notOlder(tb, key.m_toe, SecPerDay)) {
+                m_stale.fetch_add(1U, std::memory_order_relaxed);
+                return;
+            }
+        }
+
+        key.m_toe = tb;
+        key.m_valid = true;
+        m_glonass[idx].store(eph);
+        published();
+    }
+
+    // Called under the mutex
+    void store(const KeplerAlmanac& alm)
+    {
+        auto idx = SatelliteTable::indexOf(static_cast<GnssId>(alm.m_gnssId), alm.m_svId);
+        if (SatelliteTable::Capacity <= idx) {
+            return;
+        }
+
+        auto& slot = m_alm[idx];
+        if (slot.sequence() != 0U) {
+            if (slot.load() == alm) {
+                return;
+            }
+        }
+
+        slot.store(alm);
+        published();
+    }
+
+    Sink m_sink;
+    NavDataDecoder<Sink> m_decoder;
+    std::mutex m_mutex;
+    RecentHashes m_recent[SatelliteTable::Capacity];
+    StoredKey m_keys[SatelliteTable::Capacity];
+    StoredKey m_glonassKeys[GlonassCount];
+    SeqLock<KeplerEphemeris> m_eph[SatelliteTable::Capacity];
+    SeqLock<KeplerAlmanac> m_alm[SatelliteTable::Capacity];
+    SeqLock<GlonassEphemeris> m_glonass[GlonassCount];
+    std::atomic<std::uint32_t> m_sequence{0};
+    std::atomic<std::uint32_t> m_received{0};
+    std::atomic<std::uint32_t> m_duplicates{0};
+    std::atomic<std::uint32_t> m_decoded{0};
+    std::atomic<std::uint32_t> m_stored{0};
+    std::atomic<std::uint32_t> m_stale{0};
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
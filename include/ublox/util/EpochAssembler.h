@@ -0,0 +1,537 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::EpochAssembler class and
+///     the navigation epoch it produces.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavPosllh.h"
+#include "ublox/message/NavPosecef.h"
+#include "ublox/message/NavVelned.h"
+#include "ublox/message/NavDop.h"
+#include "ublox/message/NavStatus.h"
+#include "ublox/message/NavClock.h"
+#include "ublox/message/NavTimegps.h"
+#include "ublox/message/NavSat.h"
+#include "ublox/message/NavEoe.h"
+#include "ublox/util/SeqLock.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Bits of @ref NavEpoch::present member, reporting which messages
+///     contributed to the epoch.
+enum NavEpochPart : std::uint32_t
+{
+    NavEpochPart_Pvt = 0x1, ///< NAV-PVT
+    NavEpochPart_Posllh = 0x2, ///< NAV-POSLLH
+    NavEpochPart_Posecef = 0x4, ///< NAV-POSECEF
+    NavEpochPart_Velned = 0x8, ///< NAV-VELNED
+    NavEpochPart_Dop = 0x10, ///< NAV-DOP
+    NavEpochPart_Status = 0x20, ///< NAV-STATUS
+    NavEpochPart_Clock = 0x40, ///< NAV-CLOCK
+    NavEpochPart_Timegps = 0x80, ///< NAV-TIMEGPS
+    NavEpochPart_Sat = 0x100 ///< NAV-SAT
+};
+
+/// @brief Reason of the epoch completion.
+enum class NavEpochEnd : std::uint8_t
+{
+    Eoe, ///< NAV-EOE message has been received
+    ITowChange, ///< Message with different iTOW has been received
+    Timeout, ///< No new messages during configured timeout
+    Flush, ///< Explicit call to EpochAssembler::flush()
+    NumOfValues ///< number of available values
+};
+
+/// @brief Contents of NAV-PVT message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochPvt
+{
+    std::uint16_t year; ///< Year (UTC)
+    std::uint8_t month; ///< Month (UTC)
+    std::uint8_t day; ///< Day of month (UTC)
+    std::uint8_t hour; ///< Hour of day (UTC)
+    std::uint8_t min; ///< Minute of hour (UTC)
+    std::uint8_t sec; ///< Seconds of minute (UTC)
+    std::uint8_t valid; ///< Validity flags
+    std::uint32_t tAcc; ///< Time accuracy estimate, ns
+    std::int32_t nano; ///< Fraction of second, ns
+    std::uint8_t fixType; ///< GNSS fix type
+    std::uint8_t flags; ///< Fix status flags (serialised bitfield)
+    std::uint8_t flags2; ///< Additional flags
+    std::uint8_t numSV; ///< Number of satellites used in solution
+    std::int32_t lon; ///< Longitude, 1e-7 deg
+    std::int32_t lat; ///< Latitude, 1e-7 deg
+    std::int32_t height; ///< Height above ellipsoid, mm
+    std::int32_t hMSL; ///< Height above mean sea level, mm
+    std::uint32_t hAcc; ///< Horizontal accuracy estimate, mm
+    std::uint32_t vAcc; ///< Vertical accuracy estimate, mm
+    std::int32_t velN; ///< NED north velocity, mm/s
+    std::int32_t velE; ///< NED east velocity, mm/s
+    std::int32_t velD; ///< NED down velocity, mm/s
+    std::int32_t gSpeed; ///< Ground speed, mm/s
+    std::int32_t headMot; ///< Heading of motion, 1e-5 deg
+    std::uint32_t sAcc; ///< Speed accuracy estimate, mm/s
+    std::uint32_t headAcc; ///< Heading accuracy estimate, 1e-5 deg
+    std::uint16_t pDOP; ///< Position DOP, 0.01
+    std::int32_t headVeh; ///< Heading of vehicle, 1e-5 deg (0 when not reported)
+};
+
+/// @brief Contents of NAV-POSLLH message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochPosllh
+{
+    std::int32_t lon; ///< Longitude, 1e-7 deg
+    std::int32_t lat; ///< Latitude, 1e-7 deg
+    std::int32_t height; ///< Height above ellipsoid, mm
+    std::int32_t hMSL; ///< Height above mean sea level, mm
+    std::uint32_t hAcc; ///< Horizontal accuracy estimate, mm
+    std::uint32_t vAcc; ///< Vertical accuracy estimate, mm
+};
+
+/// @brief Contents of NAV-POSECEF message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochPosecef
+{
+    std::int32_t ecefX; ///< ECEF X, cm
+    std::int32_t ecefY; ///< ECEF Y, cm
+    std::int32_t ecefZ; ///< ECEF Z, cm
+    std::uint32_t pAcc; ///< Position accuracy estimate, cm
+};
+
+/// @brief Contents of NAV-VELNED message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochVelned
+{
+    std::int32_t velN; ///< North velocity, cm/s
+    std::int32_t velE; ///< East velocity, cm/s
+    std::int32_t velD; ///< Down velocity, cm/s
+    std::uint32_t speed; ///< Speed (3-D), cm/s
+    std::uint32_t gSpeed; ///< Ground speed (2-D), cm/s
+    std::int32_t heading; ///< Heading of motion, 1e-5 deg
+    std::uint32_t sAcc; ///< Speed accuracy estimate, cm/s
+    std::uint32_t cAcc; ///< Course accuracy estimate, 1e-5 deg
+};
+
+/// @brief Contents of NAV-DOP message.
+/// @details All the values are in units of 0.01.
+struct NavEpochDop
+{
+    std::uint16_t gDOP; ///< Geometric DOP
+    std::uint16_t pDOP; ///< Position DOP
+    std::uint16_t tDOP; ///< Time DOP
+    std::uint16_t vDOP; ///< Vertical DOP
+    std::uint16_t hDOP; ///< Horizontal DOP
+    std::uint16_t nDOP; ///< Northing DOP
+    std::uint16_t eDOP; ///< Easting DOP
+};
+
+/// @brief Contents of NAV-STATUS message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochStatus
+{
+    std::uint8_t gpsFix; ///< GPS fix type
+    std::uint8_t flags; ///< Navigation status flags
+    std::uint8_t fixStat; ///< Fix status information (serialised bitfield)
+    std::uint8_t flags2; ///< Further information (serialised bitfield)
+    std::uint32_t ttff; ///< Time to first fix, ms
+    std::uint32_t msss; ///< Milliseconds since startup / reset
+};
+
+/// @brief Contents of NAV-CLOCK message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochClock
+{
+    std::int32_t clkB; ///< Clock bias, ns
+    std::int32_t clkD; ///< Clock drift, ns/s
+    std::uint32_t tAcc; ///< Time accuracy estimate, ns
+    std::uint32_t fAcc; ///< Frequency accuracy estimate, ps/s
+};
+
+/// @brief Contents of NAV-TIMEGPS message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochTimegps
+{
+    std::int32_t fTOW; ///< Fractional part of iTOW, ns
+    std::int16_t week; ///< GPS week number
+    std::int8_t leapS; ///< GPS leap seconds
+    std::uint8_t valid; ///< Validity flags
+    std::uint32_t tAcc; ///< Time accuracy estimate, ns
+};
+
+/// @brief Single satellite block of NAV-SAT message.
+/// @details All the values are in units of the protocol (not scaled).
+struct NavEpochSat
+{
+    std::uint8_t gnssId; ///< GNSS identifier
+    std::uint8_t svId; ///< Satellite identifier
+    std::uint8_t cno; ///< Carrier to noise ratio, dBHz
+    std::int8_t elev; ///< Elevation, deg
+    std::int16_t azim; ///< Azimuth, deg
+    std::int16_t prRes; ///< Pseudo range residual, 0.1 m
+    std::uint32_t flags; ///< Flags (serialised bitfield)
+};
+
+/// @brief Navigation solution collected from all the messages reported
+///     by the receiver for single epoch (iTOW).
+/// @details Has fixed layout and is trivially copyable. Only the parts
+///     reported by the @ref present bits are valid, all others are zeroed.
+/// @tparam TMaxSats Maximal number of the satellites stored from NAV-SAT.
+template <std::size_t TMaxSats = 64>
+struct NavEpoch
+{
+    /// @brief Maximal number of the stored satellites.
+    static const std::size_t MaxSats = TMaxSats;
+
+    std::uint32_t iTOW; ///< GPS time of week of the epoch, ms
+    std::uint32_t present; ///< Contributed parts, see @ref NavEpochPart
+    NavEpochEnd end; ///< Reason of the epoch completion
+    NavEpochPvt pvt; ///< NAV-PVT contents
+    NavEpochPosllh posllh; ///< NAV-POSLLH contents
+    NavEpochPosecef posecef; ///< NAV-POSECEF contents
+    NavEpochVelned velned; ///< NAV-VELNED contents
+    NavEpochDop dop; ///< NAV-DOP contents
+    NavEpochStatus status; ///< NAV-STATUS contents
+    NavEpochClock clock; ///< NAV-CLOCK contents
+    NavEpochTimegps timegps; ///< NAV-TIMEGPS contents
+    std::uint8_t numSvs; ///< Number of satellites reported by NAV-SAT
+    std::uint8_t numSats; ///< Number of valid entries in @ref sats
+    NavEpochSat sats[TMaxSats]; ///< Satellites reported by NAV-SAT
+
+    /// @brief Check whether specified part has been reported.
+    bool has(NavEpochPart part) const
+    {
+        return (present & part) != 0U;
+    }
+};
+
+/// @brief Assembles the navigation messages reported for the same iTOW
+///     into single @ref NavEpoch and publishes complete epochs.
+/// @details Intended to be used as a handler of the input messages:
+///     the messages other than the supported ones are ignored. The epoch
+///     is completed when NAV-EOE is received. For the receivers not
+///     reporting NAV-EOE, the epoch is completed when a message with
+///     different iTOW is received, or, if the timeout is configured, when
+///     no new messages arrive during the timeout (see @ref poll()).
+///
+///     The epoch is assembled in private storage and published via
+///     @ref SeqLock only when complete, so the readers (possibly running
+///     in other threads) never observe partial state and never block the
+///     assembler.
+/// @tparam TMaxSats Maximal number of the satellites stored from NAV-SAT.
+template <std::size_t TMaxSats = 64>
+class EpochAssembler
+{
+public:
+    /// @brief Type of the assembled epoch.
+    typedef NavEpoch<TMaxSats> Epoch;
+
+    /// @brief Constructor
+    /// @param[in] timeoutMs Timeout (in milliseconds) of inactivity after
+    ///     which the open epoch is completed by @ref poll(), 0 disables it.
+    explicit EpochAssembler(std::uint32_t timeoutMs = 0U)
+      : m_timeoutMs(timeoutMs)
+    {
+        std::memset(&m_current, 0, sizeof(m_current));
+    }
+
+    EpochAssembler(const EpochAssembler&) = delete;
+    EpochAssembler& operator=(const EpochAssembler&) = delete;
+
+    /// @brief Handle NAV-PVT message.
+    template <typename TMsgBase>
+    void handle(const message::NavPvt<TMsgBase>& msg)
+    {
+        auto& pvt = begin(msg.field_iTOW().value(), NavEpochPart_Pvt).pvt;
+        pvt.year = msg.field_year().value();
+        pvt.month = msg.field_month().value();
+        pvt.day = msg.field_day().value();
+        pvt.hour = msg.field_hour().value();
+        pvt.min = msg.field_min().value();
+        pvt.sec = msg.field_sec().value();
+        pvt.valid = static_cast<std::uint8_t>(msg.field_valid().value());
+        pvt.tAcc = msg.field_tAcc().value();
+        pvt.nano = msg.field_nano().value();
+        pvt.fixType = static_cast<std::uint8_t>(msg.field_fixType().value());
+        pvt.flags = static_cast<std::uint8_t>(details::packedValue(msg.field_flags()));
+        pvt.flags2 = static_cast<std::uint8_t>(msg.field_flags2().value());
+        pvt.numSV = msg.field_numSV().value();
+        pvt.lon = msg.field_lon().value();
+        pvt.lat = msg.field_lat().value();
+        pvt.height = msg.field_height().value();
+        pvt.hMSL = msg.field_hMSL().value();
+        pvt.hAcc = msg.field_hAcc().value();
+        pvt.vAcc = msg.field_vAcc().value();
+        pvt.velN = msg.field_velN().value();
+        pvt.velE = msg.field_velE().value();
+        pvt.velD = msg.field_velD().value();
+        pvt.gSpeed = msg.field_gSpeed().value();
+        pvt.headMot = msg.field_headMot().value();
+        pvt.sAcc = msg.field_sAcc().value();
+        pvt.headAcc = msg.field_headAcc().value();
+        pvt.pDOP = msg.field_pDOP().value();
+        pvt.headVeh = 0;
+        if (msg.field_headVeh().getMode() == comms::field::OptionalMode::Exists) {
+            pvt.headVeh = msg.field_headVeh().field().value();
+        }
+    }
+
+    /// @brief Handle NAV-POSLLH message.
+    template <typename TMsgBase>
+    void handle(const message::NavPosllh<TMsgBase>& msg)
+    {
+        auto& posllh = begin(msg.field_iTOW().value(), NavEpochPart_Posllh).posllh;
+        posllh.lon = msg.field_lon().value();
+        posllh.lat = msg.field_lat().value();
+        posllh.height = msg.field_height().value();
+        posllh.hMSL = msg.field_hMSL().value();
+        posllh.hAcc = msg.field_hAcc().value();
+        posllh.vAcc = msg.field_vAcc().value();
+    }
+
+    /// @brief Handle NAV-POSECEF message.
+    template <typename TMsgBase>
+    void handle(const message::NavPosecef<TMsgBase>& msg)
+    {
+        auto& posecef = begin(msg.field_iTOW().value(), NavEpochPart_Posecef).posecef;
+        posecef.ecefX = msg.field_ecefX().value();
+        posecef.ecefY = msg.field_ecefY().value();
+        posecef.ecefZ = msg.field_ecefZ().value();
+        posecef.pAcc = msg.field_pAcc().value();
+    }
+
+    /// @brief Handle NAV-VELNED message.
+    template <typename TMsgBase>
+    void handle(const message::NavVelned<TMsgBase>& msg)
+    {
+        auto& velned = begin(msg.field_iTOW().value(), NavEpochPart_Velned).velned;
+        velned.velN = msg.field_velN().value();
+        velned.velE = msg.field_velE().value();
+        velned.velD = msg.field_velD().value();
+        velned.speed = msg.field_speed().value();
+        velned.gSpeed = msg.field_gSpeed().value();
+        velned.heading = msg.field_heading().value();
+        velned.sAcc = msg.field_sAcc().value();
+        velned.cAcc = msg.field_cAcc().value();
+    }
+
+    /// @brief Handle NAV-DOP message.
+    template <typename TMsgBase>
+    void handle(const message::NavDop<TMsgBase>& msg)
+    {
+        auto& dop = begin(msg.field_iTOW().value(), NavEpochPart_Dop).dop;
+        dop.gDOP = msg.field_gDOP().value();
+        dop.pDOP = msg.field_pDOP().value();
+        dop.tDOP = msg.field_tDOP().value();
+        dop.vDOP = msg.field_vDOP().value();
+        dop.hDOP = msg.field_hDOP().value();
+        dop.nDOP = msg.field_nDOP().value();
+        dop.eDOP = msg.field_eDOP().value();
+    }
+
+    /// @brief Handle NAV-STATUS message.
+    template <typename TMsgBase>
+    void handle(const message::NavStatus<TMsgBase>& msg)
+    {
+        auto& status = begin(msg.field_iTOW().value(), NavEpochPart_Status).status;
+        status.gpsFix = static_cast<std::uint8_t>(msg.field_gpsFix().value());
+        status.flags = static_cast<std::uint8_t>(msg.field_flags().value());
+        status.fixStat = static_cast<std::uint8_t>(details::packedValue(msg.field_fixStat()));
+        status.flags2 = static_cast<std::uint8_t>(details::packedValue(msg.field_flags2()));
+        status.ttff = msg.field_ttff().value();
+        status.msss = msg.field_msss().value();
+    }
+
+    /// @brief Handle NAV-CLOCK message.
+    template <typename TMsgBase>
+    void handle(const message::NavClock<TMsgBase>& msg)
+    {
+        auto& clock = begin(msg.field_iTOW().value(), NavEpochPart_Clock).clock;
+        clock.clkB = msg.field_clkB().value();
+        clock.clkD = msg.field_clkD().value();
+        clock.tAcc = msg.field_tAcc().value();
+        clock.fAcc = msg.field_fAcc().value();
+    }
+
+    /// @brief Handle NAV-TIMEGPS message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimegps<TMsgBase>& msg)
+    {
+        auto& timegps = begin(msg.field_iTOW().value(), NavEpochPart_Timegps).timegps;
+        timegps.fTOW = msg.field_fTOW().value();
+        timegps.week = msg.field_week().value();
+        timegps.leapS = msg.field_leapS().value();
+        timegps.valid = static_cast<std::uint8_t>(msg.field_valid().value());
+        timegps.tAcc = msg.field_tAcc().value();
+    }
+
+    /// @brief Handle NAV-SAT message.
+    /// @details Satellites exceeding @b TMaxSats capacity are dropped.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::NavSat<TMsgBase, TDataOpt>& msg)
+    {
+        auto& epoch = begin(msg.field_iTOW().value(), NavEpochPart_Sat);
+        epoch.numSvs = msg.field_numSvs().value();
+        std::size_t count = 0U;
+        for (auto& block : msg.field_data().value()) {
+            if (TMaxSats <= count) {
+                break;
+            }
+
+            auto& sat = epoch.sats[count];
+            sat.gnssId = static_cast<std::uint8_t>(block.field_gnssId().value());
+            sat.svId = block.field_svId().value();
+            sat.cno = block.field_cno().value();
+            sat.elev = block.field_elev().value();
+            sat.azim = block.field_azim().value();
+            sat.prRes = block.field_prRes().value();
+            sat.flags = details::packedValue(block.field_flags());
+            ++count;
+        }
+        epoch.numSats = static_cast<std::uint8_t>(count);
+    }
+
+    /// @brief Handle NAV-EOE message, completes the open epoch.
+    template <typename TMsgBase>
+    void handle(const message::NavEoe<TMsgBase>& msg)
+    {
+        static_cast<void>(msg);
+        m_eoeReported = true;
+        if (m_open) {
+            finalise(NavEpochEnd::Eoe);
+        }
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Check for inactivity timeout.
+    /// @details Expected to be called periodically. Completes the open
+    ///     epoch in case no supported message has been received during
+    ///     the timeout passed to the constructor. The assembler doesn't
+    ///     access any clock, the message activity is time stamped by the
+    ///     first call to this function following it, i.e. the timeout is
+    ///     counted from that call.
+    /// @param[in] nowMs Current monotonic time in milliseconds (may wrap around).
+    void poll(std::uint32_t nowMs)
+    {
+        if ((!m_open) || (m_timeoutMs == 0U)) {
+            return;
+        }
+
+        if (m_activity != m_polledActivity) {
+            m_polledActivity = m_activity;
+            m_activityTimeMs = nowMs;
+            return;
+        }
+
+        if (m_timeoutMs <= static_cast<std::uint32_t>(nowMs - m_activityTimeMs)) {
+            finalise(NavEpochEnd::Timeout);
+        }
+    }
+
+    /// @brief Complete the open epoch (if any) immediately.
+    void flush()
+    {
+        if (m_open) {
+            finalise(NavEpochEnd::Flush);
+        }
+    }
+
+    /// @brief Check whether NAV-EOE has ever been received.
+    bool eoeReported() const
+    {
+        return m_eoeReported;
+    }
+
+    /// @brief Number of published epochs.
+    std::uint32_t publishedCount() const
+    {
+        return m_published.sequence() / 2U;
+    }
+
+    /// @brief Get copy of the last published epoch.
+    /// @details Can be called from any thread.
+    /// @return @b false if no epoch has been published yet.
+    bool latest(Epoch& epoch) const
+    {
+        std::uint32_t seq = 0U;
+        epoch = m_published.load(&seq);
+        return seq != 0U;
+    }
+
+    /// @brief Access the publication storage.
+    const SeqLock<Epoch>& published() const
+    {
+        return m_published;
+    }
+
+private:
+    Epoch& begin(std::uint32_t iTOW, NavEpochPart part)
+    {
+        if (m_open && (m_current.iTOW != iTOW)) {
+            finalise(NavEpochEnd::ITowChange);
+        }
+
+        if (!m_open) {
+            std::memset(&m_current, 0, sizeof(m_current));
+            m_current.iTOW = iTOW;
+            m_open = true;
+        }
+
+        m_current.present |= part;
+        ++m_activity;
+        return m_current;
+    }
+
+    void finalise(NavEpochEnd end)
+    {
+        m_current.end = end;
+        m_published.store(m_current);
+        m_open = false;
+    }
+
+    Epoch m_current;
+    SeqLock<Epoch> m_published;
+    std::uint32_t m_timeoutMs = 0U;
+    std::uint32_t m_activity = 0U;
+    std::uint32_t m_polledActivity = 0U;
+    std::uint32_t m_activityTimeMs = 0U;
+    bool m_open = false;
+    bool m_eoeReported = false;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,648 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::GeofenceEngine and
+///     ublox::util::GeofenceTracker classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "ublox/field/nav.h"
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavGeofence.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief State of the geofence, same as reported by NAV-GEOFENCE message.
+typedef message::NavGeofenceFields::State GeofenceState;
+
+class GeofenceEngine;
+
+/// @brief Geofencing state of the single receiver.
+/// @details Keeps states of all the fences of the @ref GeofenceEngine for
+///     the single receiver. The fences that are not listed as active are
+///     @b Outside. Different trackers may be updated by the same engine
+///     concurrently.
+class GeofenceTracker
+{
+public:
+    /// @brief Default constructor
+    GeofenceTracker() = default;
+
+    /// @brief Check whether the geofencing is active, i.e. the last fix
+    ///     was valid (same as @b status field of NAV-GEOFENCE).
+    bool available() const
+    {
+        return m_available;
+    }
+
+    /// @brief State of the fence.
+    GeofenceState state(std::size_t fenceIdx) const
+    {
+        if ((!m_available) || (m_states.size() <= fenceIdx)) {
+            return GeofenceState::Unknown;
+        }
+
+        return static_cast<GeofenceState>(m_states[fenceIdx]);
+    }
+
+    /// @brief Combined state of all the fences (same as @b combState field
+    ///     of NAV-GEOFENCE).
+    /// @details @b Inside if at least one fence is inside, @b Outside if
+    ///     all the fences are outside, @b Unknown otherwise.
+    GeofenceState combinedState() const
+    {
+        if ((!m_available) || m_states.empty()) {
+            return GeofenceState::Unknown;
+        }
+
+        if (0U < m_insideCount) {
+            return GeofenceState::Inside;
+        }
+
+        if (0U < m_unknownCount) {
+            return GeofenceState::Unknown;
+        }
+
+        return GeofenceState::Outside;
+    }
+
+    /// @brief Indices of the fences which are not @b Outside or have
+    ///     pending state transition.
+    const std::vector<std::uint32_t>& activeFences() const
+    {
+        return m_active;
+    }
+
+private:
+    friend class GeofenceEngine;
+
+    std::vector<std::uint8_t> m_states;
+    std::vector<std::uint8_t> m_pendingStates;
+    std::vector<std::uint8_t> m_pendingCounts;
+    std::vector<std::uint32_t> m_stamps;
+    std::vector<std::uint32_t> m_active;
+    std::vector<std::uint32_t> m_candidates;
+    std::uint32_t m_stamp = 0U;
+    std::size_t m_insideCount = 0U;
+    std::size_t m_unknownCount = 0U;
+    bool m_available = false;
+};
+
+/// @brief Evaluates the receiver positions against large number of
+///     circular and polygonal geofences.
+/// @details The fences are indexed by uniform latitude / longitude grid,
+///     so every fix is evaluated only against the fences in its vicinity
+///     and the ones which are currently not @b Outside for the receiver.
+///
+///     The state of the fence follows the semantics of NAV-GEOFENCE: the
+///     position together with its uncertainty circle (horizontal accuracy
+///     multiplied by the factor of the configured confidence level, same as
+///     @b confLvl of CFG-GEOFENCE) must be completely inside the fence to
+///     be @b Inside, completely outside to be @b Outside, and @b Unknown
+///     otherwise. Without valid fix the states of all fences are @b Unknown.
+///
+///     The hysteresis prevents flapping of the states: the fence leaves
+///     definite (@b Inside or @b Outside) state only when the boundary is
+///     crossed by more than configured margin, and any transition requires
+///     configured number of consecutive fixes agreeing on the new state.
+///
+///     The distances are computed in local equirectangular projection
+///     around the position, which is accurate for fences up to few tens of
+///     kilometres. The fences crossing the antimeridian are not supported.
+///     The fences must be added before the @ref build() call, the engine
+///     must not be modified while the trackers are being updated.
+class GeofenceEngine
+{
+public:
+    /// @brief Default constructor
+    GeofenceEngine() = default;
+
+    /// @brief Add circular fence.
+    /// @param[in] latDeg Latitude of the centre, deg.
+    /// @param[in] lonDeg Longitude of the centre, deg.
+    /// @param[in] radiusM Radius, m.
+    /// @return Index of the fence.
+    std::size_t addCircle(double latDeg, double lonDeg, double radiusM)
+    {
+        Fence fence;
+        fence.m_latDeg = latDeg;
+        fence.m_lonDeg = lonDeg;
+        fence.m_radiusM = radiusM;
+        auto dLat = metresToLatDeg(radiusM);
+        auto dLon = metresToLonDeg(radiusM, latDeg);
+        fence.m_minLat = latDeg - dLat;
+        fence.m_maxLat = latDeg + dLat;
+        fence.m_minLon = lonDeg - dLon;
+        fence.m_maxLon = lonDeg + dLon;
+        m_fences.push_back(fence);
+        m_built = false;
+        return m_fences.size() - 1U;
+    }
+
+    /// @brief Add polygonal fence.
+    /// @param[in] latDeg Latitudes of the vertices, deg.
+    /// @param[in] lonDeg Longitudes of the vertices, deg.
+    /// @param[in] count Number of the vertices, at least 3.
+    /// @return Index of the fence or @b std::numeric_limits<std::size_t>::max()
+    ///     in case of invalid parameters.
+    std::size_t addPolygon(const double* latDeg, const double* lonDeg, std::size_t count)
+    {
+        if (count < 3U) {
+            return std::numeric_limits<std::size_t>::max();
+        }
+
+        Fence fence;
+        fence.m_firstVertex = static_cast<std::uint32_t>(m_vertices.size());
+        fence.m_verticesCount = static_cast<std::uint32_t>(count);
+        fence.m_minLat = fence.m_maxLat = latDeg[0];
+        fence.m_minLon = fence.m_maxLon = lonDeg[0];
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            m_vertices.push_back(Vertex{latDeg[idx], lonDeg[idx]});
+            fence.m_minLat = std::min(fence.m_minLat, latDeg[idx]);
+            fence.m_maxLat = std::max(fence.m_maxLat, latDeg[idx]);
+            fence.m_minLon = std::min(fence.m_minLon, lonDeg[idx]);
+            fence.m_maxLon = std::max(fence.m_maxLon, lonDeg[idx]);
+        }
+        m_fences.push_back(fence);
+        m_built = false;
+        return m_fences.size() - 1U;
+    }
+
+    /// @brief Number of the fences.
+    std::size_t fencesCount() const
+    {
+        return m_fences.size();
+    }
+
+    /// @brief Set confidence level, same as @b confLvl field of CFG-GEOFENCE.
+    /// @details 0 - no confidence required, 1 - 68%, 2 - 95%, 3 - 99.7%,
+    ///     4 - 99.99%, 5 - 99.9999%. The default is 0.
+    void setConfidenceLevel(unsigned confLvl)
+    {
+        static const double Sigmas[] = {0.0, 1.0, 1.96, 3.0, 3.89, 4.89};
+        static const unsigned MaxLvl = sizeof(Sigmas) / sizeof(Sigmas[0]) - 1U;
+        m_sigma = Sigmas[std::min(confLvl, MaxLvl)];
+    }
+
+    /// @brief Configure hysteresis.
+    /// @param[in] marginM Distance (m) the boundary must be crossed by to
+    ///     leave definite state.
+    /// @param[in] consecutiveFixes Number of consecutive fixes required to
+    ///     change the state (1 means no debouncing).
+    void setHysteresis(double marginM, unsigned consecutiveFixes)
+    {
+        m_marginM = std::max(marginM, 0.0);
+        m_consecutiveFixes = static_cast<std::uint8_t>(std::max(1U, std::min(consecutiveFixes, 255U)));
+    }
+
+    /// @brief Build the spatial index.
+    /// @param[in] cellDeg Size of the grid cell, deg. Increased automatically
+    ///     if the grid would exceed @b maxCells cells.
+    /// @param[in] maxCells Maximal number of the grid cells.
+    void build(double cellDeg = 0.01, std::size_t maxCells = 1U << 22)
+    {
+        m_cellStart.clear();
+        m_cellFences.clear();
+        m_rows = 0U;
+        m_cols = 0U;
+        m_built = true;
+        if (m_fences.empty()) {
+            return;
+        }
+
+        m_minLat = m_fences[0].m_minLat;
+        m_minLon = m_fences[0].m_minLon;
+        auto maxLat = m_fences[0].m_maxLat;
+        auto maxLon = m_fences[0].m_maxLon;
+        for (auto& fence : m_fences) {
+            m_minLat = std::min(m_minLat, fence.m_minLat);
+            m_minLon = std::min(m_minLon, fence.m_minLon);
+            maxLat = std::max(maxLat, fence.m_maxLat);
+            maxLon = std::max(maxLon, fence.m_maxLon);
+        }
+
+        m_cellDeg = std::max(cellDeg, 1e-6);
+        while (true) {
+            m_rows = static_cast<std::size_t>((maxLat - m_minLat) / m_cellDeg) + 1U;
+            m_cols = static_cast<std::size_t>((maxLon - m_minLon) / m_cellDeg) + 1U;
+            if ((m_rows * m_cols) <= std::max<std::size_t>(maxCells, 1U)) {
+                break;
+            }
+            m_cellDeg *= 2.0;
+        }
+
+        // Counting sort of the fences into the cells (CSR layout)
+        m_cellStart.assign((m_rows * m_cols) + 1U, 0U);
+        for (auto& fence : m_fences) {
+            forEachCell(fence.m_minLat, fence.m_maxLat, fence.m_minLon, fence.m_maxLon,
+                [this](std::size_t cell)
+                {
+                    ++m_cellStart[cell + 1U];
+                });
+        }
+
+        for (std::size_t cell = 0U; cell < (m_rows * m_cols); ++cell) {
+            m_cellStart[cell + 1U] += m_cellStart[cell];
+        }
+
+        m_cellFences.resize(m_cellStart.back());
+        std::vector<std::uint32_t> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+        for (std::size_t idx = 0U; idx < m_fences.size(); ++idx) {
+            auto& fence = m_fences[idx];
+            forEachCell(fence.m_minLat, fence.m_maxLat, fence.m_minLon, fence.m_maxLon,
+                [this, &fill, idx](std::size_t cell)
+                {
+                    m_cellFences[fill[cell]] = static_cast<std::uint32_t>(idx);
+                    ++fill[cell];
+                });
+        }
+    }
+
+    /// @brief Update the tracker with new fix.
+    /// @param[in, out] tracker Tracker of the receiver.
+    /// @param[in] valid Whether the fix is valid.
+    /// @param[in] latDeg Latitude, deg.
+    /// @param[in] lonDeg Longitude, deg.
+    /// @param[in] hAccM Horizontal accuracy estimate, m.
+    /// @param[in] func Function with <b>void (std::size_t fenceIdx, GeofenceState prev, GeofenceState cur)</b>
+    ///     signature, invoked for every changed state of the fence. On the
+    ///     first valid fix (after the geofencing was unavailable) the states
+    ///     are set without hysteresis and only the fences which are not
+    ///     @b Outside are reported (as changed from @b Unknown). Not invoked
+    ///     when the geofencing becomes unavailable.
+    template <typename TFunc>
+    void update(GeofenceTracker& tracker, bool valid, double latDeg, double lonDeg, double hAccM, TFunc&& func) const
+    {
+        if (tracker.m_states.size() != m_fences.size()) {
+            reset(tracker);
+        }
+
+        if (!valid) {
+            if (tracker.m_available) {
+                reset(tracker);
+            }
+            return;
+        }
+
+        bool initial = !tracker.m_available;
+        tracker.m_available = true;
+        ++tracker.m_stamp;
+        if (tracker.m_stamp == 0U) {
+            std::fill(tracker.m_stamps.begin(), tracker.m_stamps.end(), 0U);
+            tracker.m_stamp = 1U;
+        }
+
+        auto& candidates = tracker.m_candidates;
+        candidates.clear();
+        for (auto fenceIdx : tracker.m_active) {
+            addCandidate(tracker, fenceIdx);
+        }
+
+        auto radiusM = hAccM * m_sigma;
+        auto reachM = radiusM + m_marginM;
+        if (m_built && (0U < m_rows)) {
+            auto dLat = metresToLatDeg(reachM);
+            auto dLon = metresToLonDeg(reachM, latDeg);
+            forEachCell(latDeg - dLat, latDeg + dLat, lonDeg - dLon, lonDeg + dLon,
+                [this, &tracker](std::size_t cell)
+                {
+                    for (auto pos = m_cellStart[cell]; pos < m_cellStart[cell + 1U]; ++pos) {
+                        addCandidate(tracker, m_cellFences[pos]);
+                    }
+                });
+        }
+
+        tracker.m_active.clear();
+        tracker.m_insideCount = 0U;
+        tracker.m_unknownCount = 0U;
+        auto cosLat = std::cos(latDeg * DegToRad);
+        for (auto fenceIdx : candidates) {
+            auto dist = signedDistance(m_fences[fenceIdx], latDeg, lonDeg, cosLat);
+            auto prev = static_cast<GeofenceState>(tracker.m_states[fenceIdx]);
+            if (initial) {
+                prev = GeofenceState::Unknown;
+            }
+
+            auto next = evaluate(prev, dist, radiusM);
+            if (initial) {
+                tracker.m_pendingCounts[fenceIdx] = 0U;
+            }
+            else if (next != prev) {
+                next = debounce(tracker, fenceIdx, next);
+            }
+            else {
+                tracker.m_pendingCounts[fenceIdx] = 0U;
+            }
+
+            tracker.m_states[fenceIdx] = static_cast<std::uint8_t>(next);
+            if ((next != GeofenceState::Outside) || (tracker.m_pendingCounts[fenceIdx] != 0U)) {
+                tracker.m_active.push_back(fenceIdx);
+            }
+
+            if (next == GeofenceState::Inside) {
+                ++tracker.m_insideCount;
+            }
+            else if (next == GeofenceState::Unknown) {
+                ++tracker.m_unknownCount;
+            }
+
+            if ((next != prev) && ((!initial) || (next != GeofenceState::Outside))) {
+                func(static_cast<std::size_t>(fenceIdx), prev, next);
+            }
+        }
+    }
+
+    /// @brief Update the tracker with new fix.
+    /// @details Same as other @ref update(), but without reporting changes.
+    void update(GeofenceTracker& tracker, bool valid, double latDeg, double lonDeg, double hAccM) const
+    {
+        update(tracker, valid, latDeg, lonDeg, hAccM,
+            [](std::size_t, GeofenceState, GeofenceState)
+            {
+            });
+    }
+
+    /// @brief Check whether the fix may be used for geofencing.
+    /// @details Only 2D, 3D and combined GNSS + dead reckoning fixes with
+    ///     @b gnssFixOK flag set (within DOP and accuracy masks) are
+    ///     accepted. Dead reckoning only and time only fixes are rejected,
+    ///     so the fences never change their states on positions which are
+    ///     not supported by GNSS measurements.
+    /// @param[in] fixType Fix type (@b fixType field of NAV-PVT).
+    /// @param[in] gnssFixOk Value of @b gnssFixOK bit of @b flags field of NAV-PVT.
+    static bool validFix(field::nav::GpsFix fixType, bool gnssFixOk)
+    {
+        if (!gnssFixOk) {
+            return false;
+        }
+
+        return
+            (fixType == field::nav::GpsFix::Fix_2D) ||
+            (fixType == field::nav::GpsFix::Fix_3D) ||
+            (fixType == field::nav::GpsFix::GPS_DeadReckoning);
+    }
+
+    /// @brief Update the tracker with the fix reported by NAV-PVT message.
+    /// @details The fix is considered valid when accepted by @ref validFix().
+    template <typename TMsgBase, typename TFunc>
+    void update(GeofenceTracker& tracker, const message::NavPvt<TMsgBase>& msg, TFunc&& func) const
+    {
+        static const std::uint32_t GnssFixOkMask = 0x1;
+        bool valid =
+            validFix(
+                msg.field_fixType().value(),
+                (details::packedValue(msg.field_flags()) & GnssFixOkMask) != 0U);
+
+        update(
+            tracker,
+            valid,
+            msg.field_lat().value() * 1e-7,
+            msg.field_lon().value() * 1e-7,
+            msg.field_hAcc().value() * 1e-3,
+            std::forward<TFunc>(func));
+    }
+
+    /// @brief Update the tracker with the fix reported by NAV-PVT message.
+    /// @details Same as other @ref update(), but without reporting changes.
+    template <typename TMsgBase>
+    void update(GeofenceTracker& tracker, const message::NavPvt<TMsgBase>& msg) const
+    {
+        update(tracker, msg,
+            [](std::size_t, GeofenceState, GeofenceState)
+            {
+            });
+    }
+
+private:
+    struct Fence
+    {
+        double m_minLat = 0.0;
+        double m_maxLat = 0.0;
+        double m_minLon = 0.0;
+        double m_maxLon = 0.0;
+        double m_latDeg = 0.0;
+        double m_lonDeg = 0.0;
+        double m_radiusM = 0.0;
+        std::uint32_t m_firstVertex = 0U;
+        std::uint32_t m_verticesCount = 0U;
+    };
+
+    struct Vertex
+    {
+        double m_latDeg;
+        double m_lonDeg;
+    };
+
+    static constexpr double DegToRad = 3.14159265358979323846 / 180.0;
+    static constexpr double MetresPerDeg = 6371008.8 * DegToRad;
+
+    static double metresToLatDeg(double metres)
+    {
+        return metres / MetresPerDeg;
+    }
+
+    static double metresToLonDeg(double metres, double latDeg)
+    {
+        auto cosLat = std::max(std::cos(latDeg * DegToRad), 1e-6);
+        return std::min(metres / (MetresPerDeg * cosLat), 360.0);
+    }
+
+    template <typename TFunc>
+    void forEachCell(double minLat, double maxLat, double minLon, double maxLon, TFunc&& func) const
+    {
+        auto rowFrom = cellCoord(minLat - m_minLat, m_rows);
+        auto rowTo = cellCoord(maxLat - m_minLat, m_rows);
+        auto colFrom = cellCoord(minLon - m_minLon, m_cols);
+        auto colTo = cellCoord(maxLon - m_minLon, m_cols);
+        if ((rowTo < 0) || (colTo < 0) ||
+            (static_cast<long>(m_rows) <= rowFrom) ||
+            (static_cast<long>(m_cols) <= colFrom)) {
+            return;
+        }
+
+        rowFrom = std::max(rowFrom, 0L);
+        colFrom = std::max(colFrom, 0L);
+        rowTo = std::min(rowTo, static_cast<long>(m_rows) - 1);
+        colTo = std::min(colTo, static_cast<long>(m_cols) - 1);
+        for (auto row = rowFrom; row <= rowTo; ++row) {
+            for (auto col = colFrom; col <= colTo; ++col) {
+                func((static_cast<std::size_t>(row) * m_cols) + static_cast<std::size_t>(col));
+            }
+        }
+    }
+
+    long cellCoord(double offsetDeg, std::size_t count) const
+    {
+        auto coord = std::floor(offsetDeg / m_cellDeg);
+        if (coord < -1.0) {
+            return -1;
+        }
+
+        if (static_cast<double>(count) < coord) {
+            return static_cast<long>(count);
+        }
+
+        return static_cast<long>(coord);
+    }
+
+    static void addCandidate(GeofenceTracker& tracker, std::uint32_t fenceIdx)
+    {
+        if (tracker.m_stamps[fenceIdx] == tracker.m_stamp) {
+            return;
+        }
+
+        tracker.m_stamps[fenceIdx] = tracker.m_stamp;
+        tracker.m_candidates.push_back(fenceIdx);
+    }
+
+    void reset(GeofenceTracker& tracker) const
+    {
+        auto count = m_fences.size();
+        tracker.m_states.assign(count, static_cast<std::uint8_t>(GeofenceState::Outside));
+        tracker.m_pendingStates.assign(count, static_cast<std::uint8_t>(GeofenceState::Outside));
+        tracker.m_pendingCounts.assign(count, 0U);
+        tracker.m_stamps.assign(count, 0U);
+        tracker.m_active.clear();
+        tracker.m_candidates.clear();
+        tracker.m_stamp = 0U;
+        tracker.m_insideCount = 0U;
+        tracker.m_unknownCount = 0U;
+        tracker.m_available = false;
+    }
+
+    /// @brief Signed distance (m) from the fence boundary, negative inside.
+    double signedDistance(const Fence& fence, double latDeg, double lonDeg, double cosLat) const
+    {
+        if (fence.m_verticesCount == 0U) {
+            auto dy = (fence.m_latDeg - latDeg) * MetresPerDeg;
+            auto dx = (fence.m_lonDeg - lonDeg) * MetresPerDeg * cosLat;
+            return std::sqrt((dx * dx) + (dy * dy)) - fence.m_radiusM;
+        }
+
+        // Position is the origin of the local projection
+        bool inside = false;
+        auto minDist2 = std::numeric_limits<double>::max();
+        auto* vertices = &m_vertices[fence.m_firstVertex];
+        auto count = fence.m_verticesCount;
+        for (std::uint32_t idx = 0U, prevIdx = count - 1U; idx < count; prevIdx = idx, ++idx) {
+            auto ax = (vertices[prevIdx].m_lonDeg - lonDeg) * MetresPerDeg * cosLat;
+            auto ay = (vertices[prevIdx].m_latDeg - latDeg) * MetresPerDeg;
+            auto bx = (vertices[idx].m_lonDeg - lonDeg) * MetresPerDeg * cosLat;
+            auto by = (vertices[idx].m_latDeg - latDeg) * MetresPerDeg;
+
+            if (((ay > 0.0) != (by > 0.0)) &&
+                (0.0 < (ax + (((0.0 - ay) * (bx - ax)) / (by - ay))))) {
+                inside = !inside;
+            }
+
+            auto ex = bx - ax;
+            auto ey = by - ay;
+            auto len2 = (ex * ex) + (ey * ey);
+            auto t = 0.0;
+            if (0.0 < len2) {
+                t = std::max(0.0, std::min(1.0, -((ax * ex) + (ay * ey)) / len2));
+            }
+            auto px = ax + (t * ex);
+            auto py = ay + (t * ey);
+            minDist2 = std::min(minDist2, (px * px) + (py * py));
+        }
+
+        auto dist = std::sqrt(minDist2);
+        return inside ? -dist : dist;
+    }
+
+    GeofenceState evaluate(GeofenceState prev, double dist, double radiusM) const
+    {
+        auto insideLimit = -radiusM;
+        auto outsideLimit = radiusM;
+        if (prev == GeofenceState::Inside) {
+            insideLimit += m_marginM;
+        }
+        else if (prev == GeofenceState::Outside) {
+            outsideLimit -= m_marginM;
+        }
+
+        if (dist <= insideLimit) {
+            return GeofenceState::Inside;
+        }
+
+        if (outsideLimit <= dist) {
+            return GeofenceState::Outside;
+        }
+
+        return GeofenceState::Unknown;
+    }
+
+    GeofenceState debounce(GeofenceTracker& tracker, std::uint32_t fenceIdx, GeofenceState next) const
+    {
+        auto prev = static_cast<GeofenceState>(tracker.m_states[fenceIdx]);
+        if (m_consecutiveFixes <= 1U) {
+            tracker.m_pendingCounts[fenceIdx] = 0U;
+            return next;
+        }
+
+        auto& pendingState = tracker.m_pendingStates[fenceIdx];
+        auto& pendingCount = tracker.m_pendingCounts[fenceIdx];
+        if ((pendingCount == 0U) || (pendingState != static_cast<std::uint8_t>(next))) {
+            pendingState = static_cast<std::uint8_t>(next);
+            pendingCount = 1U;
+            return prev;
+        }
+
+        ++pendingCount;
+        if (pendingCount < m_consecutiveFixes) {
+            return prev;
+        }
+
+        pendingCount = 0U;
+        return next;
+    }
+
+    std::vector<Fence> m_fences;
+    std::vector<Vertex> m_vertices;
+    std::vector<std::uint32_t> m_cellStart;
+    std::vector<std::uint32_t> m_cellFences;
+    double m_minLat = 0.0;
+    double m_minLon = 0.0;
+    double m_cellDeg = 0.01;
+    std::size_t m_rows = 0U;
+    std::size_t m_cols = 0U;
+    double m_sigma = 0.0;
+    double m_marginM = 0.0;
+    std::uint8_t m_consecutiveFixes = 1U;
+    bool m_built = false;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
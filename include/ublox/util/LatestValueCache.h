@@ -0,0 +1,456 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::LatestValueCache class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <atomic>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "ublox/util/SeqLock.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Size of the cache line the slots of @ref LatestValueCache are
+///     aligned to.
+static const std::size_t CacheLineSize = 64U;
+
+namespace details
+{
+
+/// @brief Storage of the serialised payload of the single message type.
+template <std::size_t TCapacity>
+struct alignas(CacheLineSize) LatestValueSlot
+{
+    SeqCounter m_seq;
+    std::size_t m_len = 0U;
+    std::uint8_t m_data[TCapacity];
+};
+
+/// @brief Type independent access to the slot.
+struct LatestValueSlotRef
+{
+    MsgId m_id;
+    bool m_shared; ///< Other cached message type has the same ID
+    SeqCounter* m_seq;
+    std::size_t* m_len;
+    std::uint8_t* m_data;
+    std::size_t m_capacity;
+};
+
+}  // namespace details
+
+/// @brief Cache of the latest received value of every message type.
+/// @details Keeps serialised payload of the last received message of
+///     every type listed in @b TMessages tuple (normally a trimmed
+///     version of ublox::InputMessages) in separate cache line aligned
+///     slot protected by sequence lock (see @ref SeqCounter). The single
+///     writer (reading thread) updates the slots in place, without blocking,
+///     while any number of readers get consistent copies without taking any
+///     locks, so the readers of different message types never contend.
+///
+///     Intended to be used as a handler of the input messages, the
+///     messages of types not listed in @b TMessages are ignored. Due to
+///     over-aligned members the object should be allocated statically
+///     or on the stack (pre C++17 @b new does not respect the alignment).
+///
+///     The capacity of the slot is the maximal length of the message
+///     payload, for the messages with unlimited lists it is the maximal
+///     length of the UBX payload (65535 bytes), unless limited by
+///     non-zero @b TMaxPayload. Note that the readers decode the copy
+///     placed on the stack, the limit keeps the stack usage sane when
+///     caching messages like RXM-RAWX or MON-VER. The payload exceeding
+///     the limit is not stored, the slot is invalidated, i.e. the readers
+///     get no value rather than the stale one, and the overflow is counted
+///     (see @ref overflows()).
+///
+///     Some messages share the same ID (for example variants of CFG-PRT),
+///     the raw payloads of such messages can be stored and retrieved by
+///     the message type only.
+/// @tparam TMessages All the cached message types bundled in std::tuple.
+/// @tparam TMaxPayload Optional upper limit of the stored payload length,
+///     0 means no limit.
+template <typename TMessages, std::size_t TMaxPayload = 0U>
+class LatestValueCache;
+
+template <typename... TMsgs, std::size_t TMaxPayload>
+class LatestValueCache<std::tuple<TMsgs...>, TMaxPayload>
+{
+    typedef std::tuple<TMsgs...> Messages;
+
+    static const std::size_t MaxUbxPayload = 0xffff;
+
+    template <typename TMsg>
+    struct PayloadCapacity
+    {
+        static const std::size_t MaxLength =
+            details::FieldsMaxLength<typename TMsg::AllFields>::Value;
+
+        static const std::size_t Limit =
+            ((TMaxPayload == 0U) || (MaxUbxPayload < TMaxPayload)) ? MaxUbxPayload : TMaxPayload;
+
+        static const std::size_t Value =
+            MaxLength < Limit ? MaxLength : Limit;
+    };
+
+    typedef std::tuple<details::LatestValueSlot<PayloadCapacity<TMsgs>::Value>...> Slots;
+
+public:
+    /// @brief Number of cached message types.
+    static const std::size_t SlotsCount = sizeof...(TMsgs);
+
+    static_assert(0U < SlotsCount, "At least one message type is expected");
+
+    /// @brief Constructor
+    LatestValueCache()
+    {
+        InitRefs<0U, SlotsCount>::exec(m_slots, m_refs);
+        for (std::size_t idx = 1U; idx < SlotsCount; ++idx) {
+            auto ref = m_refs[idx];
+            auto pos = idx;
+            while ((0U < pos) && (ref.m_id < m_refs[pos - 1].m_id)) {
+                m_refs[pos] = m_refs[pos - 1];
+                --pos;
+            }
+            m_refs[pos] = ref;
+        }
+
+        for (std::size_t idx = 1U; idx < SlotsCount; ++idx) {
+            if (m_refs[idx].m_id == m_refs[idx - 1].m_id) {
+                m_refs[idx].m_shared = true;
+                m_refs[idx - 1].m_shared = true;
+            }
+        }
+    }
+
+    LatestValueCache(const LatestValueCache&) = delete;
+    LatestValueCache& operator=(const LatestValueCache&) = delete;
+
+    /// @brief Update the cached value by serialising the message directly
+    ///     into its slot.
+    /// @details Messages of types not listed in @b TMessages are ignored.
+    template <typename TMsg>
+    void handle(const TMsg& msg)
+    {
+        update(msg, std::integral_constant<bool, details::TupleIndexOf<TMsg, Messages>::Found>());
+    }
+
+    /// @brief Update the cached value from the raw payload (for example
+    ///     the one retained by @ref ublox::protocol::RawFrameRetaining).
+    /// @return @b false in case the message type is not cached, its ID is
+    ///     shared with other cached message type, or payload exceeds the
+    ///     capacity, the slot is invalidated in the latter case.
+    bool store(MsgId id, const std::uint8_t* payload, std::size_t len)
+    {
+        auto* ref = findRef(id);
+        if ((ref == nullptr) || ref->m_shared) {
+            return false;
+        }
+
+        return storePayload(*ref->m_seq, *ref->m_len, ref->m_data, ref->m_capacity, payload, len);
+    }
+
+    /// @brief Update the cached value of the message type from the raw payload.
+    /// @details Same as @ref store(MsgId, const std::uint8_t*, std::size_t),
+    ///     but selects the slot by the message type, works for the messages
+    ///     sharing the same ID.
+    template <typename TMsg>
+    bool store(const std::uint8_t* payload, std::size_t len)
+    {
+        auto& slot = std::get<SlotIndex<TMsg>::Value>(m_slots);
+        return storePayload(slot.m_seq, slot.m_len, slot.m_data, sizeof(slot.m_data), payload, len);
+    }
+
+    /// @brief Try to get the latest value of the message.
+    /// @details Wait-free, performs single attempt to copy the payload
+    ///     and decodes it into the provided message object.
+    /// @param[out] msg Message object to update.
+    /// @param[out] seq Optional sequence number of the retrieved value.
+    /// @return @b false in case the value hasn't been reported yet,
+    ///     didn't fit into the slot, the copy overlapped with the update,
+    ///     or decoding failed.
+    template <typename TMsg>
+    bool tryLoad(TMsg& msg, std::uint32_t* seq = nullptr) const
+    {
+        std::uint8_t buf[PayloadCapacity<TMsg>::Value];
+        std::size_t len = 0U;
+        if ((!copySlot<TMsg>(buf, len, seq)) || (len == 0U)) {
+            return false;
+        }
+
+        const std::uint8_t* iter = &buf[0];
+        return msg.doRead(iter, len) == comms::ErrorStatus::Success;
+    }
+
+    /// @brief Get the latest value of the message, retrying the copy
+    ///     in case it overlapped with the update.
+    /// @return @b false in case the value hasn't been reported yet,
+    ///     didn't fit into the slot, or decoding failed.
+    template <typename TMsg>
+    bool load(TMsg& msg, std::uint32_t* seq = nullptr) const
+    {
+        std::uint8_t buf[PayloadCapacity<TMsg>::Value];
+        std::size_t len = 0U;
+        while (!copySlot<TMsg>(buf, len, seq)) {
+            if (sequence<TMsg>() == 0U) {
+                return false;
+            }
+        }
+
+        if (len == 0U) {
+            return false;
+        }
+
+        const std::uint8_t* iter = &buf[0];
+        return msg.doRead(iter, len) == comms::ErrorStatus::Success;
+    }
+
+    /// @brief Try to get copy of the latest raw payload of the message.
+    /// @details Wait-free, performs single attempt.
+    /// @param[in] id ID of the message.
+    /// @param[out] buf Output buffer.
+    /// @param[in] bufLen Size of the output buffer.
+    /// @param[out] len Length of the copied payload.
+    /// @param[out] seq Optional sequence number of the retrieved value.
+    /// @return @b false in case the message type is not cached or its ID
+    ///     is shared with other cached message type, the value hasn't been
+    ///     reported yet or didn't fit into the slot, the output buffer is
+    ///     too small, or the copy overlapped with the update.
+    bool tryLoadPayload(
+        MsgId id,
+        std::uint8_t* buf,
+        std::size_t bufLen,
+        std::size_t& len,
+        std::uint32_t* seq = nullptr) const
+    {
+        auto* ref = findRef(id);
+        if ((ref == nullptr) || ref->m_shared) {
+            return false;
+        }
+
+        return
+            copyPayload(*ref->m_seq, *ref->m_len, ref->m_data, bufLen, buf, len, seq) &&
+            (0U < len);
+    }
+
+    /// @brief Try to get copy of the latest raw payload of the message type.
+    /// @details Same as @ref tryLoadPayload(MsgId, std::uint8_t*, std::size_t, std::size_t&, std::uint32_t*) const,
+    ///     but selects the slot by the message type, works for the messages
+    ///     sharing the same ID.
+    template <typename TMsg>
+    bool tryLoadPayload(
+        std::uint8_t* buf,
+        std::size_t bufLen,
+        std::size_t& len,
+        std::uint32_t* seq = nullptr) const
+    {
+        auto& slot = std::get<SlotIndex<TMsg>::Value>(m_slots);
+        return
+            copyPayload(slot.m_seq, slot.m_len, slot.m_data, bufLen, buf, len, seq) &&
+            (0U < len);
+    }
+
+    /// @brief Capacity of the slot of the message type.
+    template <typename TMsg>
+    static constexpr std::size_t capacity()
+    {
+        return PayloadCapacity<TMsg>::Value;
+    }
+
+    /// @brief Sequence number of the latest value of the message.
+    /// @details Incremented by 2 on every update, 0 means the value
+    ///     hasn't been reported yet.
+    template <typename TMsg>
+    std::uint32_t sequence() const
+    {
+        return std::get<SlotIndex<TMsg>::Value>(m_slots).m_seq.sequence();
+    }
+
+    /// @brief Number of values dropped because they exceeded the capacity
+    ///     of their slot.
+    std::uint32_t overflows() const
+    {
+        return m_overflows.load(std::memory_order_relaxed);
+    }
+
+private:
+    template <typename TMsg>
+    struct SlotIndex
+    {
+        static_assert(details::TupleIndexOf<TMsg, Messages>::Found,
+            "The message type is not cached");
+        static const std::size_t Value = details::TupleIndexOf<TMsg, Messages>::Value;
+    };
+
+    template <std::size_t TIdx, std::size_t TCount>
+    struct InitRefs
+    {
+        static void exec(Slots& slots, details::LatestValueSlotRef* refs)
+        {
+            typedef typename std::tuple_element<TIdx, Messages>::type MsgType;
+            auto& slot = std::get<TIdx>(slots);
+            auto& ref = refs[TIdx];
+            ref.m_id = MsgType::doGetId();
+            ref.m_shared = false;
+            ref.m_seq = &slot.m_seq;
+            ref.m_len = &slot.m_len;
+            ref.m_data = &slot.m_data[0];
+            ref.m_capacity = sizeof(slot.m_data);
+            InitRefs<TIdx + 1, TCount>::exec(slots, refs);
+        }
+    };
+
+    template <std::size_t TCount>
+    struct InitRefs<TCount, TCount>
+    {
+        static void exec(Slots&, details::LatestValueSlotRef*)
+        {
+        }
+    };
+
+    template <typename TMsg>
+    void update(const TMsg& msg, std::true_type)
+    {
+        auto& slot = std::get<details::TupleIndexOf<TMsg, Messages>::Value>(m_slots);
+        auto len = msg.doLength();
+        if (sizeof(slot.m_data) < len) {
+            invalidate(slot.m_seq, slot.m_len);
+            return;
+        }
+
+        slot.m_seq.beginWrite();
+        std::uint8_t* iter = &slot.m_data[0];
+        auto es = msg.doWrite(iter, len);
+        slot.m_len = (es == comms::ErrorStatus::Success) ? len : 0U; // empty payload marks invalid value
+        slot.m_seq.endWrite();
+    }
+
+    template <typename TMsg>
+    void update(const TMsg&, std::false_type)
+    {
+    }
+
+    void invalidate(SeqCounter& seqCounter, std::size_t& slotLen)
+    {
+        m_overflows.fetch_add(1U, std::memory_order_relaxed);
+        seqCounter.beginWrite();
+        slotLen = 0U; // empty payload marks invalid value
+        seqCounter.endWrite();
+    }
+
+    bool storePayload(
+        SeqCounter& seqCounter,
+        std::size_t& slotLen,
+        std::uint8_t* data,
+        std::size_t capacity,
+        const std::uint8_t* payload,
+        std::size_t len)
+    {
+        if (capacity < len) {
+            invalidate(seqCounter, slotLen);
+            return false;
+        }
+
+        seqCounter.beginWrite();
+        std::memcpy(data, payload, len);
+        slotLen = len;
+        seqCounter.endWrite();
+        return true;
+    }
+
+    template <typename TMsg>
+    bool copySlot(std::uint8_t* buf, std::size_t& len, std::uint32_t* seq) const
+    {
+        auto& slot = std::get<SlotIndex<TMsg>::Value>(m_slots);
+        return copyPayload(slot.m_seq, slot.m_len, slot.m_data, sizeof(slot.m_data), buf, len, seq);
+    }
+
+    const details::LatestValueSlotRef* findRef(MsgId id) const
+    {
+        std::size_t from = 0U;
+        std::size_t to = SlotsCount;
+        while (from < to) {
+            auto mid = from + ((to - from) / 2);
+            if (m_refs[mid].m_id < id) {
+                from = mid + 1;
+                continue;
+            }
+
+            to = mid;
+        }
+
+        if ((from < SlotsCount) && (m_refs[from].m_id == id)) {
+            return &m_refs[from];
+        }
+
+        return nullptr;
+    }
+
+    static bool copyPayload(
+        const SeqCounter& seqCounter,
+        const std::size_t& slotLen,
+        const std::uint8_t* data,
+        std::size_t bufLen,
+        std::uint8_t* buf,
+        std::size_t& len,
+        std::uint32_t* seq)
+    {
+        std::uint32_t before = 0U;
+        if ((!seqCounter.beginRead(before)) || (before == 0U)) {
+            return false;
+        }
+
+        len = slotLen;
+        if (bufLen < len) {
+            return false;
+        }
+
+        std::memcpy(buf, data, len);
+        if (!seqCounter.endRead(before)) {
+            return false;
+        }
+
+        if (seq != nullptr) {
+            *seq = before;
+        }
+        return true;
+    }
+
+    Slots m_slots;
+    details::LatestValueSlotRef m_refs[SlotsCount];
+    std::atomic<std::uint32_t> m_overflows{0U};
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,1146 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::NavDataDecoder class and
+///     structures of the decoded navigation data.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <iterator>
+
+#include "ublox/field/common.h"
+#include "ublox/message/RxmSfrbx.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/details/navdata.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Broadcast Keplerian ephemeris (GPS, QZSS, Galileo, BeiDou).
+/// @details All the values are in SI units (s, m, rad) as broadcast,
+///     the times are in the time scale of the satellite's system.
+struct KeplerEphemeris
+{
+    std::uint8_t m_gnssId; ///< GNSS identifier (see ublox::field::common::GnssId)
+    std::uint8_t m_svId; ///< Satellite identifier
+    std::uint16_t m_week; ///< Week number (GPS / QZSS modulo 1024, Galileo from the last word type 5)
+    std::uint16_t m_iode; ///< IODE / IODnav / AODE
+    std::uint16_t m_iodc; ///< IODC / IODnav / AODC
+    std::uint16_t m_health; ///< Satellite health (Galileo in RINEX layout)
+    std::uint16_t m_accuracy; ///< URA index / SISA / URAI
+    double m_toe; ///< Reference time of ephemeris, s
+    double m_toc; ///< Reference time of clock, s
+    double m_sqrtA; ///< Square root of semi-major axis, m^0.5
+    double m_e; ///< Eccentricity
+    double m_i0; ///< Inclination at reference time, rad
+    double m_omega0; ///< Longitude of ascending node at weekly epoch, rad
+    double m_omega; ///< Argument of perigee, rad
+    double m_m0; ///< Mean anomaly at reference time, rad
+    double m_deltaN; ///< Mean motion difference, rad/s
+    double m_omegaDot; ///< Rate of right ascension, rad/s
+    double m_iDot; ///< Rate of inclination, rad/s
+    double m_cuc; ///< Latitude argument cosine correction, rad
+    double m_cus; ///< Latitude argument sine correction, rad
+    double m_crc; ///< Orbit radius cosine correction, m
+    double m_crs; ///< Orbit radius sine correction, m
+    double m_cic; ///< Inclination cosine correction, rad
+    double m_cis; ///< Inclination sine correction, rad
+    double m_af0; ///< Clock bias, s
+    double m_af1; ///< Clock drift, s/s
+    double m_af2; ///< Clock drift rate, s/s^2
+    double m_tgd; ///< Group delay (GPS TGD, Galileo BGD E1-E5a, BeiDou TGD1), s
+    double m_tgd2; ///< Second group delay (Galileo BGD E1-E5b, BeiDou TGD2), s
+};
+
+/// @brief Broadcast GLONASS ephemeris (strings 1 - 4).
+/// @details Coordinates are in PZ-90 frame, SI units.
+struct GlonassEphemeris
+{
+    std::uint8_t m_svId; ///< Slot number
+    std::int8_t m_freqNum; ///< Frequency channel number (-7 .. 6)
+    std::uint8_t m_health; ///< Most significant bit of Bn
+    std::uint8_t m_age; ///< Age of the data (En), days
+    std::uint8_t m_ft; ///< Accuracy index (FT)
+    std::uint8_t m_flags; ///< P (bits 0-1), P1 (bits 2-3), P2 (bit 4), P3 (bit 5), P4 (bit 6), ln (bit 7)
+    std::uint8_t m_m; ///< Satellite type (M)
+    std::uint16_t m_nt; ///< Day within four year interval (NT)
+    double m_tk; ///< Start time of the frame within the day (Moscow time), s
+    double m_tb; ///< Reference time within the day (Moscow time), s
+    double m_x; ///< X coordinate, m
+    double m_y; ///< Y coordinate, m
+    double m_z; ///< Z coordinate, m
+    double m_vx; ///< X velocity, m/s
+    double m_vy; ///< Y velocity, m/s
+    double m_vz; ///< Z velocity, m/s
+    double m_ax; ///< X luni-solar acceleration, m/s^2
+    double m_ay; ///< Y luni-solar acceleration, m/s^2
+    double m_az; ///< Z luni-solar acceleration, m/s^2
+    double m_gammaN; ///< Relative frequency bias
+    double m_tauN; ///< Clock bias, s
+    double m_deltaTauN; ///< L1 / L2 group delay difference, s
+};
+
+/// @brief Almanac (GPS).
+struct KeplerAlmanac
+{
+    std::uint8_t m_gnssId; ///< GNSS identifier (see ublox::field::common::GnssId)
+    std::uint8_t m_svId; ///< Satellite identifier
+    std::uint8_t m_health; ///< Satellite health
+    double m_toa; ///< Reference time of almanac, s
+    double m_e; ///< Eccentricity
+    double m_i0; ///< Inclination, rad
+    double m_omegaDot; ///< Rate of right ascension, rad/s
+    double m_sqrtA; ///< Square root of semi-major axis, m^0.5
+    double m_omega0; ///< Longitude of ascending node at weekly epoch, rad
+    double m_omega; ///< Argument of perigee, rad
+    double m_m0; ///< Mean anomaly at reference time, rad
+    double m_af0; ///< Clock bias, s
+    double m_af1; ///< Clock drift, s/s
+};
+
+/// @brief Equality comparison of @ref KeplerAlmanac.
+inline bool operator==(const KeplerAlmanac& lhs, const KeplerAlmanac& rhs)
+{
+    return
+        (lhs.m_gnssId == rhs.m_gnssId) &&
+        (lhs.m_svId == rhs.m_svId) &&
+        (lhs.m_health == rhs.m_health) &&
+        (lhs.m_toa == rhs.m_toa) &&
+        (lhs.m_e == rhs.m_e) &&
+        (lhs.m_i0 == rhs.m_i0) &&
+        (lhs.m_omegaDot == rhs.m_omegaDot) &&
+        (lhs.m_sqrtA == rhs.m_sqrtA) &&
+        (lhs.m_omega0 == rhs.m_omega0) &&
+        (lhs.m_omega == rhs.m_omega) &&
+        (lhs.m_m0 == rhs.m_m0) &&
+        (lhs.m_af0 == rhs.m_af0) &&
+        (lhs.m_af1 == rhs.m_af1);
+}
+
+/// @brief Inequality comparison of @ref KeplerAlmanac.
+inline bool operator!=(const KeplerAlmanac& lhs, const KeplerAlmanac& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/// @brief Klobuchar ionospheric model parameters (GPS, QZSS, BeiDou).
+struct KlobucharIono
+{
+    std::uint8_t m_gnssId; ///< GNSS identifier (see ublox::field::common::GnssId)
+    double m_alpha0; ///< Alpha 0, s
+    double m_alpha1; ///< Alpha 1, s/semi-circle
+    double m_alpha2; ///< Alpha 2, s/semi-circle^2
+    double m_alpha3; ///< Alpha 3, s/semi-circle^3
+    double m_beta0; ///< Beta 0, s
+    double m_beta1; ///< Beta 1, s/semi-circle
+    double m_beta2; ///< Beta 2, s/semi-circle^2
+    double m_beta3; ///< Beta 3, s/semi-circle^3
+};
+
+/// @brief Equality comparison of @ref KlobucharIono.
+inline bool operator==(const KlobucharIono& lhs, const KlobucharIono& rhs)
+{
+    return
+        (lhs.m_gnssId == rhs.m_gnssId) &&
+        (lhs.m_alpha0 == rhs.m_alpha0) &&
+        (lhs.m_alpha1 == rhs.m_alpha1) &&
+        (lhs.m_alpha2 == rhs.m_alpha2) &&
+        (lhs.m_alpha3 == rhs.m_alpha3) &&
+        (lhs.m_beta0 == rhs.m_beta0) &&
+        (lhs.m_beta1 == rhs.m_beta1) &&
+        (lhs.m_beta2 == rhs.m_beta2) &&
+        (lhs.m_beta3 == rhs.m_beta3);
+}
+
+/// @brief Inequality comparison of @ref KlobucharIono.
+inline bool operator!=(const KlobucharIono& lhs, const KlobucharIono& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/// @brief NeQuick G ionospheric model parameters (Galileo).
+struct NequickIono
+{
+    std::uint8_t m_regions; ///< Ionospheric disturbance flags of regions 1 - 5
+    double m_ai0; ///< Effective ionisation level 1st order, sfu
+    double m_ai1; ///< Effective ionisation level 2nd order, sfu/deg
+    double m_ai2; ///< Effective ionisation level 3rd order, sfu/deg^2
+};
+
+/// @brief Equality comparison of @ref NequickIono.
+inline bool operator==(const NequickIono& lhs, const NequickIono& rhs)
+{
+    return
+        (lhs.m_regions == rhs.m_regions) &&
+        (lhs.m_ai0 == rhs.m_ai0) &&
+        (lhs.m_ai1 == rhs.m_ai1) &&
+        (lhs.m_ai2 == rhs.m_ai2);
+}
+
+/// @brief Inequality comparison of @ref NequickIono.
+inline bool operator!=(const NequickIono& lhs, const NequickIono& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/// @brief Parameters relating the system time to UTC (GPS, QZSS, Galileo).
+struct GnssUtcParams
+{
+    std::uint8_t m_gnssId; ///< GNSS identifier (see ublox::field::common::GnssId)
+    std::int8_t m_dtLs; ///< Current leap seconds
+    std::int8_t m_dtLsf; ///< Leap seconds after the scheduled event
+    std::uint8_t m_wnt; ///< Reference week of UTC parameters (modulo 256)
+    std::uint8_t m_wnLsf; ///< Week of the leap second event (modulo 256)
+    std::uint8_t m_dn; ///< Day of the leap second event
+    double m_a0; ///< Bias, s
+    double m_a1; ///< Drift, s/s
+    double m_tot; ///< Reference time of UTC parameters, s
+};
+
+/// @brief Equality comparison of @ref GnssUtcParams.
+inline bool operator==(const GnssUtcParams& lhs, const GnssUtcParams& rhs)
+{
+    return
+        (lhs.m_gnssId == rhs.m_gnssId) &&
+        (lhs.m_dtLs == rhs.m_dtLs) &&
+        (lhs.m_dtLsf == rhs.m_dtLsf) &&
+        (lhs.m_wnt == rhs.m_wnt) &&
+        (lhs.m_wnLsf == rhs.m_wnLsf) &&
+        (lhs.m_dn == rhs.m_dn) &&
+        (lhs.m_a0 == rhs.m_a0) &&
+        (lhs.m_a1 == rhs.m_a1) &&
+        (lhs.m_tot == rhs.m_tot);
+}
+
+/// @brief Inequality comparison of @ref GnssUtcParams.
+inline bool operator!=(const GnssUtcParams& lhs, const GnssUtcParams& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/// @brief GLONASS time parameters (string 5).
+struct GlonassTimeParams
+{
+    std::uint16_t m_na; ///< Day within four year interval of @ref m_tauC
+    std::uint8_t m_n4; ///< Four year interval number
+    double m_tauC; ///< GLONASS time to UTC(SU) correction, s
+    double m_tauGps; ///< GPS time to GLONASS time correction, s
+};
+
+/// @brief Equality comparison of @ref GlonassTimeParams.
+inline bool operator==(const GlonassTimeParams& lhs, const GlonassTimeParams& rhs)
+{
+    return
+        (lhs.m_na == rhs.m_na) &&
+        (lhs.m_n4 == rhs.m_n4) &&
+        (lhs.m_tauC == rhs.m_tauC) &&
+        (lhs.m_tauGps == rhs.m_tauGps);
+}
+
+/// @brief Inequality comparison of @ref GlonassTimeParams.
+inline bool operator!=(const GlonassTimeParams& lhs, const GlonassTimeParams& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/// @brief Statistics of @ref NavDataDecoder.
+struct NavDataStats
+{
+    std::uint32_t m_subframes; ///< Accepted subframes (pages, strings)
+    std::uint32_t m_parityErrors; ///< Rejected by parity / CRC check
+    std::uint32_t m_unsupported; ///< Unsupported signals or satellites
+};
+
+/// @brief Decoder of the navigation data reported by RXM-SFRBX message.
+/// @details Verifies the data (GPS / QZSS parity, Galileo CRC-24Q, BeiDou
+///     BCH(15,11), GLONASS Hamming code), assembles the subframes belonging
+///     to the same data set, and reports decoded structures to the handler.
+///     Supported data: GPS and QZSS L1 C/A LNAV (ephemeris, almanac,
+///     ionospheric and UTC parameters), Galileo E1-B I/NAV (ephemeris,
+///     ionospheric and UTC parameters), BeiDou D1 (ephemeris and ionospheric
+///     parameters), GLONASS L1OF (ephemeris and time parameters).
+///
+///     The fields are described by tables of precomputed word offsets, shifts
+///     and masks over the data bits packed without parity, so every field is
+///     extracted with few shifts regardless of its position. The ionospheric
+///     and time parameters are reported only when changed, the ephemeris is
+///     reported every time its complete data set is received.
+/// @tparam THandler Type of the handler, must provide @b handle() member
+///     functions accepting @ref KeplerEphemeris, @ref GlonassEphemeris,
+///     @ref KeplerAlmanac, @ref KlobucharIono, @ref NequickIono,
+///     @ref GnssUtcParams, and @ref GlonassTimeParams (the template catch-all
+///     one may be used to ignore some of them).
+template <typename THandler>
+class NavDataDecoder
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Constructor
+    explicit NavDataDecoder(THandler& handler)
+      : m_handler(handler)
+    {
+        clear();
+    }
+
+    NavDataDecoder(const NavDataDecoder&) = delete;
+    NavDataDecoder& operator=(const NavDataDecoder&) = delete;
+
+    /// @brief Clear all the partially assembled data and statistics.
+    void clear()
+    {
+        std::memset(&m_slots[0], 0, sizeof(m_slots));
+        std::memset(&m_stats, 0, sizeof(m_stats));
+        // The first decoded values are always reported
+        std::fill(std::begin(m_lastIonoValid), std::end(m_lastIonoValid), false);
+        std::fill(std::begin(m_lastUtcValid), std::end(m_lastUtcValid), false);
+        m_lastNequickValid = false;
+        m_lastGloTimeValid = false;
+        m_galWeek = 0U;
+    }
+
+    /// @brief Handle RXM-SFRBX message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmSfrbx<TMsgBase, TDataOpt>& msg)
+    {
+        static const std::size_t MaxWords = 16U;
+        auto& list = msg.field_dwrd().value();
+        std::uint32_t words[MaxWords];
+        auto count = std::min(list.size(), MaxWords);
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            words[idx] = list[idx].value();
+        }
+
+        decode(
+            msg.field_gnssId().value(),
+            msg.field_svId().value(),
+            msg.field_freqId().value(),
+            &words[0],
+            count);
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Decode words of single subframe (page, string).
+    /// @param[in] gnssId GNSS identifier.
+    /// @param[in] svId Satellite identifier.
+    /// @param[in] freqId Frequency identifier (GLONASS only).
+    /// @param[in] words Data words as reported by @b dwrd field of RXM-SFRBX.
+    /// @param[in] count Number of the words.
+    /// @return @b true in case the data has been accepted.
+    bool decode(GnssId gnssId, unsigned svId, unsigned freqId, const std::uint32_t* words, std::size_t count)
+    {
+        auto idx = SatelliteTable::indexOf(gnssId, svId);
+        if (SatelliteTable::Capacity <= idx) {
+            ++m_stats.m_unsupported;
+            return false;
+        }
+
+        auto& slot = m_slots[idx];
+        switch (gnssId) {
+        case GnssId::Gps:
+        case GnssId::Qzss:
+            return decodeLnav(gnssId, svId, slot, words, count);
+        case GnssId::Galileo:
+            return decodeInav(svId, slot, words, count);
+        case GnssId::BeiDou:
+            return decodeD1(svId, slot, words, count);
+        case GnssId::Glonass:
+            return decodeGlonass(svId, freqId, slot, words, count);
+        default:
+            break;
+        }
+
+        ++m_stats.m_unsupported;
+        return false;
+    }
+
+    /// @brief Decode GPS / QZSS LNAV subframe with parity already removed
+    ///     (as reported by @b RXM-EPH and @b AID-EPH messages).
+    /// @param[in] gnssId GNSS identifier.
+    /// @param[in] svId Satellite identifier.
+    /// @param[in] data Ten words of the subframe, 24 data bits each in
+    ///     bits 23 - 0.
+    /// @return @b true in case the data has been accepted.
+    bool decodeLnavData(GnssId gnssId, unsigned svId, const std::uint32_t* data)
+    {
+        auto idx = SatelliteTable::indexOf(gnssId, svId);
+        if ((SatelliteTable::Capacity <= idx) || ((gnssId != GnssId::Gps) && (gnssId != GnssId::Qzss))) {
+            ++m_stats.m_unsupported;
+            return false;
+        }
+
+        std::uint32_t stream[StreamWords] = {0};
+        details::NavBitWriter writer(&stream[0]);
+        for (std::size_t wordIdx = 0U; wordIdx < LnavWordsCount; ++wordIdx) {
+            writer.append(data[wordIdx], 24U);
+        }
+        writer.flush();
+        return processLnav(gnssId, svId, m_slots[idx], stream);
+    }
+
+    /// @brief Statistics.
+    const NavDataStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    typedef details::NavField NavField;
+    typedef details::NavSign NavSign;
+
+    static const std::size_t StreamWords = 9U; // Up to 256 data bits + spare word
+    static const std::size_t FramesCount = 5U;
+    static const std::size_t LnavWordsCount = 10U;
+
+    struct Slot
+    {
+        std::uint32_t m_frames[FramesCount][StreamWords];
+        std::uint32_t m_sow[3];
+        std::uint8_t m_mask;
+    };
+
+    /// @brief Position of the bit in the stream of BeiDou D1 data bits.
+    /// @param[in] pos Position of the bit in the subframe including parity
+    ///     bits (26 data bits in the first word, 22 in the others).
+    static constexpr unsigned bdsBit(unsigned pos)
+    {
+        return (pos < 30U) ? pos : (26U + (((pos / 30U) - 1U) * 22U) + (pos % 30U));
+    }
+
+    static double sc(int exp)
+    {
+        return details::navPow2(exp) * details::NavSemiCircle;
+    }
+
+    static constexpr double p2(int exp)
+    {
+        return details::navPow2(exp);
+    }
+
+    static std::uint32_t bits(const std::uint32_t* stream, unsigned pos, unsigned len)
+    {
+        return details::navBits(stream, NavField(pos, len));
+    }
+
+    static std::int32_t sbits(const std::uint32_t* stream, unsigned pos, unsigned len)
+    {
+        return static_cast<std::int32_t>(details::navValue(stream, NavField(pos, len, NavSign::TwosComplement)));
+    }
+
+    bool rejected()
+    {
+        ++m_stats.m_parityErrors;
+        return false;
+    }
+
+    bool accepted()
+    {
+        ++m_stats.m_subframes;
+        return true;
+    }
+
+    /// @brief GPS / QZSS L1 C/A LNAV subframe.
+    bool decodeLnav(GnssId gnssId, unsigned svId, Slot& slot, const std::uint32_t* words, std::size_t count)
+    {
+        static const std::uint32_t DataBitsMask = 0x3fffffc0U;
+
+        if (count < LnavWordsCount) {
+            ++m_stats.m_unsupported;
+            return false;
+        }
+
+        std::uint32_t stream[StreamWords] = {0};
+        details::NavBitWriter writer(&stream[0]);
+        std::uint32_t prev = 0U; // D29*, D30* of the last word of previous subframe are 0
+        for (std::size_t idx = 0U; idx < LnavWordsCount; ++idx) {
+            auto word = (prev << 30) | (words[idx] & 0x3fffffffU);
+            if (!details::gpsParityOk(word)) {
+                // The data bits may be reported as transmitted (inverted when D30* is set)
+                word ^= DataBitsMask;
+                if (((prev & 0x1U) == 0U) || (!details::gpsParityOk(word))) {
+                    return rejected();
+                }
+            }
+
+            writer.append(word >> 6, 24U);
+            prev = word & 0x3U;
+        }
+        writer.flush();
+        return processLnav(gnssId, svId, slot, stream);
+    }
+
+    bool processLnav(GnssId gnssId, unsigned svId, Slot& slot, const std::uint32_t* stream)
+    {
+        static const std::uint32_t Preamble = 0x8b;
+        if (bits(stream, 0U, 8U) != Preamble) {
+            return rejected();
+        }
+
+        auto subframe = bits(stream, 43U, 3U);
+        if ((1U <= subframe) && (subframe <= 3U)) {
+            storeFrame(slot, subframe - 1U, stream);
+            if (slot.m_mask == 0x7U) {
+                reportLnavEphemeris(gnssId, svId, slot);
+            }
+            return accepted();
+        }
+
+        static const unsigned IonoUtcPage = 56U;
+        auto pageSvId = bits(stream, 50U, 6U);
+        if ((subframe == 4U) && (pageSvId == IonoUtcPage)) {
+            reportLnavIonoUtc(gnssId, stream);
+        }
+        else if ((gnssId == GnssId::Gps) && (1U <= pageSvId) && (pageSvId <= 32U) &&
+                 ((subframe == 5U) || (25U <= pageSvId))) {
+            reportLnavAlmanac(pageSvId, stream);
+        }
+
+        return accepted();
+    }
+
+    void reportLnavEphemeris(GnssId gnssId, unsigned svId, Slot& slot)
+    {
+        typedef details::NavFieldSpec<KeplerEphemeris> Spec;
+        static const Spec Subframe1[] = {
+            {NavField(160U, 8U, NavSign::TwosComplement), p2(-31), &KeplerEphemeris::m_tgd},
+            {NavField(176U, 16U), 16.0, &KeplerEphemeris::m_toc},
+            {NavField(192U, 8U, NavSign::TwosComplement), p2(-55), &KeplerEphemeris::m_af2},
+            {NavField(200U, 16U, NavSign::TwosComplement), p2(-43), &KeplerEphemeris::m_af1},
+            {NavField(216U, 22U, NavSign::TwosComplement), p2(-31), &KeplerEphemeris::m_af0},
+        };
+
+        static const Spec Subframe2[] = {
+            {NavField(56U, 16U, NavSign::TwosComplement), p2(-5), &KeplerEphemeris::m_crs},
+            {NavField(72U, 16U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_deltaN},
+            {NavField(88U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_m0},
+            {NavField(120U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cuc},
+            {NavField(136U, 32U), p2(-33), &KeplerEphemeris::m_e},
+            {NavField(168U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cus},
+            {NavField(184U, 32U), p2(-19), &KeplerEphemeris::m_sqrtA},
+            {NavField(216U, 16U), 16.0, &KeplerEphemeris::m_toe},
+        };
+
+        static const Spec Subframe3[] = {
+            {NavField(48U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cic},
+            {NavField(64U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_omega0},
+            {NavField(96U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cis},
+            {NavField(112U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_i0},
+            {NavField(144U, 16U, NavSign::TwosComplement), p2(-5), &KeplerEphemeris::m_crc},
+            {NavField(160U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_omega},
+            {NavField(192U, 24U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_omegaDot},
+            {NavField(224U, 14U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_iDot},
+        };
+
+        auto* sf1 = slot.m_frames[0];
+        auto* sf2 = slot.m_frames[1];
+        auto* sf3 = slot.m_frames[2];
+        auto iodc = details::navBits(sf1, NavField(70U, 2U, 168U, 8U));
+        auto iode = bits(sf2, 48U, 8U);
+        if ((iode != bits(sf3, 216U, 8U)) || (iode != (iodc & 0xffU))) {
+            return; // Subframes of different data sets, wait for the next ones
+        }
+
+        KeplerEphemeris eph = KeplerEphemeris();
+        eph.m_gnssId = static_cast<std::uint8_t>(gnssId);
+        eph.m_svId = static_cast<std::uint8_t>(svId);
+        eph.m_week = static_cast<std::uint16_t>(bits(sf1, 48U, 10U));
+        eph.m_accuracy = static_cast<std::uint16_t>(bits(sf1, 60U, 4U));
+        eph.m_health = static_cast<std::uint16_t>(bits(sf1, 64U, 6U));
+        eph.m_iodc = static_cast<std::uint16_t>(iodc);
+        eph.m_iode = static_cast<std::uint16_t>(iode);
+        details::navApply(sf1, Subframe1, eph);
+        details::navApply(sf2, Subframe2, eph);
+        details::navApply(sf3, Subframe3, eph);
+        slot.m_mask = 0U;
+        m_handler.handle(static_cast<const KeplerEphemeris&>(eph));
+    }
+
+    void reportLnavIonoUtc(GnssId gnssId, const std::uint32_t* stream)
+    {
+        typedef details::NavFieldSpec<KlobucharIono> IonoSpec;
+        static const IonoSpec IonoTable[] = {
+            {NavField(56U, 8U, NavSign::TwosComplement), p2(-30), &KlobucharIono::m_alpha0},
+            {NavField(64U, 8U, NavSign::TwosComplement), p2(-27), &KlobucharIono::m_alpha1},
+            {NavField(72U, 8U, NavSign::TwosComplement), p2(-24), &KlobucharIono::m_alpha2},
+            {NavField(80U, 8U, NavSign::TwosComplement), p2(-24), &KlobucharIono::m_alpha3},
+            {NavField(88U, 8U, NavSign::TwosComplement), p2(11), &KlobucharIono::m_beta0},
+            {NavField(96U, 8U, NavSign::TwosComplement), p2(14), &KlobucharIono::m_beta1},
+            {NavField(104U, 8U, NavSign::TwosComplement), p2(16), &KlobucharIono::m_beta2},
+            {NavField(112U, 8U, NavSign::TwosComplement), p2(16), &KlobucharIono::m_beta3},
+        };
+
+        typedef details::NavFieldSpec<GnssUtcParams> UtcSpec;
+        static const UtcSpec UtcTable[] = {
+            {NavField(120U, 24U, NavSign::TwosComplement), p2(-50), &GnssUtcParams::m_a1},
+            {NavField(144U, 32U, NavSign::TwosComplement), p2(-30), &GnssUtcParams::m_a0},
+            {NavField(176U, 8U), p2(12), &GnssUtcParams::m_tot},
+        };
+
+        KlobucharIono iono = KlobucharIono();
+        iono.m_gnssId = static_cast<std::uint8_t>(gnssId);
+        details::navApply(stream, IonoTable, iono);
+        reportIono(iono);
+
+        GnssUtcParams utc = GnssUtcParams();
+        utc.m_gnssId = static_cast<std::uint8_t>(gnssId);
+        details::navApply(stream, UtcTable, utc);
+        utc.m_wnt = static_cast<std::uint8_t>(bits(stream, 184U, 8U));
+        utc.m_dtLs = static_cast<std::int8_t>(sbits(stream, 192U, 8U));
+        utc.m_wnLsf = static_cast<std::uint8_t>(bits(stream, 200U, 8U));
+        utc.m_dn = static_cast<std::uint8_t>(bits(stream, 208U, 8U));
+        utc.m_dtLsf = static_cast<std::int8_t>(sbits(stream, 216U, 8U));
+        reportUtc(utc);
+    }
+
+    void reportLnavAlmanac(unsigned svId, const std::uint32_t* stream)
+    {
+        typedef details::NavFieldSpec<KeplerAlmanac> Spec;
+        static const Spec Table[] = {
+            {NavField(56U, 16U), p2(-21), &KeplerAlmanac::m_e},
+            {NavField(72U, 8U), p2(12), &KeplerAlmanac::m_toa},
+            {NavField(80U, 16U, NavSign::TwosComplement), sc(-19), &KeplerAlmanac::m_i0},
+            {NavField(96U, 16U, NavSign::TwosComplement), sc(-38), &KeplerAlmanac::m_omegaDot},
+            {NavField(120U, 24U), p2(-11), &KeplerAlmanac::m_sqrtA},
+            {NavField(144U, 24U, NavSign::TwosComplement), sc(-23), &KeplerAlmanac::m_omega0},
+            {NavField(168U, 24U, NavSign::TwosComplement), sc(-23), &KeplerAlmanac::m_omega},
+            {NavField(192U, 24U, NavSign::TwosComplement), sc(-23), &KeplerAlmanac::m_m0},
+            {NavField(216U, 8U, 235U, 3U, NavSign::TwosComplement), p2(-20), &KeplerAlmanac::m_af0},
+            {NavField(224U, 11U, NavSign::TwosComplement), p2(-38), &KeplerAlmanac::m_af1},
+        };
+
+        static const double ReferenceInclination = 0.3 * details::NavSemiCircle;
+
+        if (bits(stream, 56U, 16U) == 0U) {
+            return; // Dummy (unused) almanac page
+        }
+
+        KeplerAlmanac alm = KeplerAlmanac();
+        alm.m_gnssId = static_cast<std::uint8_t>(GnssId::Gps);
+        alm.m_svId = static_cast<std::uint8_t>(svId);
+        alm.m_health = static_cast<std::uint8_t>(bits(stream, 112U, 8U));
+        details::navApply(stream, Table, alm);
+        alm.m_i0 += ReferenceInclination;
+        m_handler.handle(static_cast<const KeplerAlmanac&>(alm));
+    }
+
+    /// @brief Galileo E1-B I/NAV nominal page (even and odd parts).
+    bool decodeInav(unsigned svId, Slot& slot, const std::uint32_t* words, std::size_t count)
+    {
+        static const std::size_t WordsCount = 8U;
+        static const unsigned OddPos = 128U;
+        static const std::size_t CrcBytes = 25U;
+
+        if (count < WordsCount) {
+            ++m_stats.m_unsupported;
+            return false;
+        }
+
+        std::uint32_t page[WordsCount + 1U] = {0};
+        std::memcpy(&page[0], words, WordsCount * sizeof(std::uint32_t));
+
+        // Even part first, nominal (not alert) pages only
+        if ((bits(page, 0U, 2U) != 0U) || (bits(page, OddPos, 2U) != 2U)) {
+            ++m_stats.m_unsupported;
+            return false;
+        }
+
+        // CRC-24Q covers 114 bits of even and 82 bits of odd part (padded to 200 bits)
+        std::uint32_t crcStream[8] = {0};
+        details::NavBitWriter crcWriter(&crcStream[0]);
+        crcWriter.append(0U, 4U);
+        appendBits(crcWriter, page, 0U, 114U);
+        appendBits(crcWriter, page, OddPos, 82U);
+        crcWriter.flush();
+
+        std::uint8_t crcData[CrcBytes];
+        for (std::size_t idx = 0U; idx < CrcBytes; ++idx) {
+            crcData[idx] = static_cast<std::uint8_t>(crcStream[idx / 4U] >> (24U - ((idx % 4U) * 8U)));
+        }
+
+        if (details::crc24q(&crcData[0], CrcBytes) != bits(page, OddPos + 82U, 24U)) {
+            return rejected();
+        }
+
+        // 128 bits data word: 112 bits of even and 16 bits of odd part
+        std::uint32_t data[StreamWords] = {0};
+        details::NavBitWriter writer(&data[0]);
+        appendBits(writer, page, 2U, 112U);
+        appendBits(writer, page, OddPos + 2U, 16U);
+        writer.flush();
+
+        auto type = bits(data, 0U, 6U);
+        if ((1U <= type) && (type <= 5U)) {
+            storeFrame(slot, type - 1U, data);
+        }
+
+        if (type == 5U) {
+            reportInavIono(data);
+        }
+        else if (type == 6U) {
+            reportInavUtc(data);
+        }
+
+        if (((1U <= type) && (type <= 4U)) && ((slot.m_mask & 0xfU) == 0xfU)) {
+            reportInavEphemeris(svId, slot);
+        }
+
+        return accepted();
+    }
+
+    static void appendBits(details::NavBitWriter& writer, const std::uint32_t* stream, unsigned pos, unsigned len)
+    {
+        while (0U < len) {
+            auto chunk = std::min(len, 32U);
+            writer.append(bits(stream, pos, chunk), chunk);
+            pos += chunk;
+            len -= chunk;
+        }
+    }
+
+    void reportInavEphemeris(unsigned svId, Slot& slot)
+    {
+        typedef details::NavFieldSpec<KeplerEphemeris> Spec;
+        static const Spec Word1[] = {
+            {NavField(16U, 14U), 60.0, &KeplerEphemeris::m_toe},
+            {NavField(30U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_m0},
+            {NavField(62U, 32U), p2(-33), &KeplerEphemeris::m_e},
+            {NavField(94U, 32U), p2(-19), &KeplerEphemeris::m_sqrtA},
+        };
+
+        static const Spec Word2[] = {
+            {NavField(16U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_omega0},
+            {NavField(48U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_i0},
+            {NavField(80U, 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_omega},
+            {NavField(112U, 14U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_iDot},
+        };
+
+        static const Spec Word3[] = {
+            {NavField(16U, 24U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_omegaDot},
+            {NavField(40U, 16U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_deltaN},
+            {NavField(56U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cuc},
+            {NavField(72U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cus},
+            {NavField(88U, 16U, NavSign::TwosComplement), p2(-5), &KeplerEphemeris::m_crc},
+            {NavField(104U, 16U, NavSign::TwosComplement), p2(-5), &KeplerEphemeris::m_crs},
+        };
+
+        static const Spec Word4[] = {
+            {NavField(22U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cic},
+            {NavField(38U, 16U, NavSign::TwosComplement), p2(-29), &KeplerEphemeris::m_cis},
+            {NavField(54U, 14U), 60.0, &KeplerEphemeris::m_toc},
+            {NavField(68U, 31U, NavSign::TwosComplement), p2(-34), &KeplerEphemeris::m_af0},
+            {NavField(99U, 21U, NavSign::TwosComplement), p2(-46), &KeplerEphemeris::m_af1},
+            {NavField(120U, 6U, NavSign::TwosComplement), p2(-59), &KeplerEphemeris::m_af2},
+        };
+
+        static const Spec Word5[] = {
+            {NavField(47U, 10U, NavSign::TwosComplement), p2(-32), &KeplerEphemeris::m_tgd},
+            {NavField(57U, 10U, NavSign::TwosComplement), p2(-32), &KeplerEphemeris::m_tgd2},
+        };
+
+        auto iod = bits(slot.m_frames[0], 6U, 10U);
+        for (std::size_t idx = 1U; idx < 4U; ++idx) {
+            if (bits(slot.m_frames[idx], 6U, 10U) != iod) {
+                return; // Words of different data sets, wait for the next ones
+            }
+        }
+
+        KeplerEphemeris eph = KeplerEphemeris();
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::Galileo);
+        eph.m_svId = static_cast<std::uint8_t>(svId);
+        eph.m_week = m_galWeek;
+        eph.m_iode = static_cast<std::uint16_t>(iod);
+        eph.m_iodc = static_cast<std::uint16_t>(iod);
+        eph.m_accuracy = static_cast<std::uint16_t>(bits(slot.m_frames[2], 120U, 8U));
+        details::navApply(slot.m_frames[0], Word1, eph);
+        details::navApply(slot.m_frames[1], Word2, eph);
+        details::navApply(slot.m_frames[2], Word3, eph);
+        details::navApply(slot.m_frames[3], Word4, eph);
+        if ((slot.m_mask & 0x10U) != 0U) {
+            auto* word5 = slot.m_frames[4];
+            details::navApply(word5, Word5, eph);
+            eph.m_health = static_cast<std::uint16_t>(
+                bits(word5, 72U, 1U) | // E1-B DVS
+                (bits(word5, 69U, 2U) << 1) | // E1-B HS
+                (bits(word5, 71U, 1U) << 6) | // E5b DVS
+                (bits(word5, 67U, 2U) << 7)); // E5b HS
+        }
+
+        slot.m_mask = static_cast<std::uint8_t>(slot.m_mask & ~0xfU);
+        m_handler.handle(static_cast<const KeplerEphemeris&>(eph));
+    }
+
+    void reportInavIono(const std::uint32_t* data)
+    {
+        typedef details::NavFieldSpec<NequickIono> Spec;
+        static const Spec Table[] = {
+            {NavField(6U, 11U), p2(-2), &NequickIono::m_ai0},
+            {NavField(17U, 11U, NavSign::TwosComplement), p2(-8), &NequickIono::m_ai1},
+            {NavField(28U, 14U, NavSign::TwosComplement), p2(-15), &NequickIono::m_ai2},
+        };
+
+        m_galWeek = static_cast<std::uint16_t>(bits(data, 73U, 12U));
+
+        NequickIono iono = NequickIono();
+        iono.m_regions = static_cast<std::uint8_t>(bits(data, 42U, 5U));
+        details::navApply(data, Table, iono);
+        if ((!m_lastNequickValid) || (iono != m_lastNequick)) {
+            m_lastNequick = iono;
+            m_lastNequickValid = true;
+            m_handler.handle(static_cast<const NequickIono&>(iono));
+        }
+    }
+
+    void reportInavUtc(const std::uint32_t* data)
+    {
+        typedef details::NavFieldSpec<GnssUtcParams> Spec;
+        static const Spec Table[] = {
+            {NavField(6U, 32U, NavSign::TwosComplement), p2(-30), &GnssUtcParams::m_a0},
+            {NavField(38U, 24U, NavSign::TwosComplement), p2(-50), &GnssUtcParams::m_a1},
+            {NavField(70U, 8U), 3600.0, &GnssUtcParams::m_tot},
+        };
+
+        GnssUtcParams utc = GnssUtcParams();
+        utc.m_gnssId = static_cast<std::uint8_t>(GnssId::Galileo);
+        details::navApply(data, Table, utc);
+        utc.m_dtLs = static_cast<std::int8_t>(sbits(data, 62U, 8U));
+        utc.m_wnt = static_cast<std::uint8_t>(bits(data, 78U, 8U));
+        utc.m_wnLsf = static_cast<std::uint8_t>(bits(data, 86U, 8U));
+        utc.m_dn = static_cast<std::uint8_t>(bits(data, 94U, 3U));
+        utc.m_dtLsf = static_cast<std::int8_t>(sbits(data, 97U, 8U));
+        reportUtc(utc);
+    }
+
+    /// @brief BeiDou D1 subframe (MEO / IGSO satellites).
+    bool decodeD1(unsigned svId, Slot& slot, const std::uint32_t* words, std::size_t count)
+    {
+        static const std::size_t WordsCount = 10U;
+        static const std::uint32_t Preamble = 0x712;
+        static const unsigned MaxGeoSvId = 5U;
+        static const unsigned MinGeo3SvId = 59U;
+
+        if ((count < WordsCount) || (svId <= MaxGeoSvId) || (MinGeo3SvId <= svId)) {
+            ++m_stats.m_unsupported; // D2 navigation message of GEO satellites
+            return false;
+        }
+
+        std::uint32_t stream[StreamWords] = {0};
+        details::NavBitWriter writer(&stream[0]);
+        for (std::size_t idx = 0U; idx < WordsCount; ++idx) {
+            auto word = words[idx] & 0x3fffffffU;
+            if (idx == 0U) {
+                // First 15 bits are not encoded
+                if (details::bch1511Syndrome(word & 0x7fffU) != 0U) {
+                    return rejected();
+                }
+
+                writer.append(word >> 4, 26U);
+                continue;
+            }
+
+            // Deinterleaved: 11 + 11 information bits followed by 4 + 4 parity bits
+            auto codeWord1 = (((word >> 19) & 0x7ffU) << 4) | ((word >> 4) & 0xfU);
+            auto codeWord2 = (((word >> 8) & 0x7ffU) << 4) | (word & 0xfU);
+            if ((details::bch1511Syndrome(codeWord1) != 0U) || (details::bch1511Syndrome(codeWord2) != 0U)) {
+                return rejected();
+            }
+
+            writer.append(word >> 8, 22U);
+        }
+        writer.flush();
+
+        if (bits(stream, 0U, 11U) != Preamble) {
+            return rejected();
+        }
+
+        auto subframe = bits(stream, bdsBit(15U), 3U);
+        if ((subframe < 1U) || (3U < subframe)) {
+            return accepted();
+        }
+
+        auto frameIdx = subframe - 1U;
+        storeFrame(slot, frameIdx, stream);
+        slot.m_sow[frameIdx] = bits(stream, bdsBit(18U), 20U);
+        if (subframe == 1U) {
+            reportD1Iono(stream);
+        }
+
+        static const std::uint32_t SubframeSec = 6U;
+        if ((slot.m_mask & 0x7U) == 0x7U) {
+            if (((slot.m_sow[0] + SubframeSec) == slot.m_sow[1]) &&
+                ((slot.m_sow[1] + SubframeSec) == slot.m_sow[2])) {
+                reportD1Ephemeris(svId, slot);
+            }
+        }
+
+        return accepted();
+    }
+
+    void reportD1Ephemeris(unsigned svId, Slot& slot)
+    {
+        typedef details::NavFieldSpec<KeplerEphemeris> Spec;
+        static const Spec Subframe1[] = {
+            {NavField(bdsBit(73U), 17U), 8.0, &KeplerEphemeris::m_toc},
+            {NavField(bdsBit(98U), 10U, NavSign::TwosComplement), 1e-10, &KeplerEphemeris::m_tgd},
+            {NavField(bdsBit(108U), 10U, NavSign::TwosComplement), 1e-10, &KeplerEphemeris::m_tgd2},
+            {NavField(bdsBit(214U), 11U, NavSign::TwosComplement), p2(-66), &KeplerEphemeris::m_af2},
+            {NavField(bdsBit(225U), 24U, NavSign::TwosComplement), p2(-33), &KeplerEphemeris::m_af0},
+            {NavField(bdsBit(257U), 22U, NavSign::TwosComplement), p2(-50), &KeplerEphemeris::m_af1},
+        };
+
+        static const Spec Subframe2[] = {
+            {NavField(bdsBit(42U), 16U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_deltaN},
+            {NavField(bdsBit(66U), 18U, NavSign::TwosComplement), p2(-31), &KeplerEphemeris::m_cuc},
+            {NavField(bdsBit(92U), 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_m0},
+            {NavField(bdsBit(132U), 32U), p2(-33), &KeplerEphemeris::m_e},
+            {NavField(bdsBit(180U), 18U, NavSign::TwosComplement), p2(-31), &KeplerEphemeris::m_cus},
+            {NavField(bdsBit(198U), 18U, NavSign::TwosComplement), p2(-6), &KeplerEphemeris::m_crc},
+            {NavField(bdsBit(224U), 18U, NavSign::TwosComplement), p2(-6), &KeplerEphemeris::m_crs},
+            {NavField(bdsBit(250U), 32U), p2(-19), &KeplerEphemeris::m_sqrtA},
+        };
+
+        static const Spec Subframe3[] = {
+            {NavField(bdsBit(65U), 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_i0},
+            {NavField(bdsBit(105U), 18U, NavSign::TwosComplement), p2(-31), &KeplerEphemeris::m_cic},
+            {NavField(bdsBit(131U), 24U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_omegaDot},
+            {NavField(bdsBit(163U), 18U, NavSign::TwosComplement), p2(-31), &KeplerEphemeris::m_cis},
+            {NavField(bdsBit(189U), 14U, NavSign::TwosComplement), sc(-43), &KeplerEphemeris::m_iDot},
+            {NavField(bdsBit(211U), 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_omega0},
+            {NavField(bdsBit(251U), 32U, NavSign::TwosComplement), sc(-31), &KeplerEphemeris::m_omega},
+        };
+
+        auto* sf1 = slot.m_frames[0];
+        auto* sf2 = slot.m_frames[1];
+        auto* sf3 = slot.m_frames[2];
+
+        KeplerEphemeris eph = KeplerEphemeris();
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::BeiDou);
+        eph.m_svId = static_cast<std::uint8_t>(svId);
+        eph.m_health = static_cast<std::uint16_t>(bits(sf1, bdsBit(42U), 1U));
+        eph.m_iodc = static_cast<std::uint16_t>(bits(sf1, bdsBit(43U), 5U));
+        eph.m_accuracy = static_cast<std::uint16_t>(bits(sf1, bdsBit(48U), 4U));
+        eph.m_week = static_cast<std::uint16_t>(bits(sf1, bdsBit(60U), 13U));
+        eph.m_iode = static_cast<std::uint16_t>(bits(sf1, bdsBit(287U), 5U));
+        details::navApply(sf1, Subframe1, eph);
+        details::navApply(sf2, Subframe2, eph);
+        details::navApply(sf3, Subframe3, eph);
+        auto toe = (bits(sf2, bdsBit(290U), 2U) << 15) | bits(sf3, bdsBit(42U), 15U);
+        eph.m_toe = static_cast<double>(toe) * 8.0;
+        slot.m_mask = 0U;
+        m_handler.handle(static_cast<const KeplerEphemeris&>(eph));
+    }
+
+    void reportD1Iono(const std::uint32_t* stream)
+    {
+        typedef details::NavFieldSpec<KlobucharIono> Spec;
+        static const Spec Table[] = {
+            {NavField(bdsBit(126U), 8U, NavSign::TwosComplement), p2(-30), &KlobucharIono::m_alpha0},
+            {NavField(bdsBit(134U), 8U, NavSign::TwosComplement), p2(-27), &KlobucharIono::m_alpha1},
+            {NavField(bdsBit(150U), 8U, NavSign::TwosComplement), p2(-24), &KlobucharIono::m_alpha2},
+            {NavField(bdsBit(158U), 8U, NavSign::TwosComplement), p2(-24), &KlobucharIono::m_alpha3},
+            {NavField(bdsBit(166U), 8U, NavSign::TwosComplement), p2(11), &KlobucharIono::m_beta0},
+            {NavField(bdsBit(182U), 8U, NavSign::TwosComplement), p2(14), &KlobucharIono::m_beta1},
+            {NavField(bdsBit(190U), 8U, NavSign::TwosComplement), p2(16), &KlobucharIono::m_beta2},
+            {NavField(bdsBit(198U), 8U, NavSign::TwosComplement), p2(16), &KlobucharIono::m_beta3},
+        };
+
+        KlobucharIono iono = KlobucharIono();
+        iono.m_gnssId = static_cast<std::uint8_t>(GnssId::BeiDou);
+        details::navApply(stream, Table, iono);
+        reportIono(iono);
+    }
+
+    /// @brief GLONASS L1OF string.
+    bool decodeGlonass(unsigned svId, unsigned freqId, Slot& slot, const std::uint32_t* words, std::size_t count)
+    {
+        static const std::size_t WordsCount = 4U;
+        if (count < WordsCount) {
+            ++m_stats.m_unsupported;
+            return false;
+        }
+
+        std::uint32_t stream[StreamWords] = {0};
+        std::memcpy(&stream[0], words, WordsCount * sizeof(std::uint32_t));
+        if ((bits(stream, 0U, 1U) != 0U) || (!details::glonassHammingOk(stream))) {
+            return rejected();
+        }
+
+        auto string = bits(stream, 1U, 4U);
+        if ((1U <= string) && (string <= 4U)) {
+            if (string == 1U) {
+                slot.m_mask = 0U;
+            }
+
+            storeFrame(slot, string - 1U, stream);
+            if ((string == 4U) && (slot.m_mask == 0xfU)) {
+                reportGlonassEphemeris(svId, freqId, slot);
+            }
+        }
+        else if (string == 5U) {
+            reportGlonassTime(stream);
+        }
+
+        return accepted();
+    }
+
+    void reportGlonassEphemeris(unsigned svId, unsigned freqId, Slot& slot)
+    {
+        static const double PosScale = p2(-11) * 1e3;
+        static const double VelScale = p2(-20) * 1e3;
+        static const double AccScale = p2(-30) * 1e3;
+
+        typedef details::NavFieldSpec<GlonassEphemeris> Spec;
+        static const Spec String1[] = {
+            {NavField(21U, 24U, NavSign::SignMagnitude), VelScale, &GlonassEphemeris::m_vx},
+            {NavField(45U, 5U, NavSign::SignMagnitude), AccScale, &GlonassEphemeris::m_ax},
+            {NavField(50U, 27U, NavSign::SignMagnitude), PosScale, &GlonassEphemeris::m_x},
+        };
+
+        static const Spec String2[] = {
+            {NavField(9U, 7U), 900.0, &GlonassEphemeris::m_tb},
+            {NavField(21U, 24U, NavSign::SignMagnitude), VelScale, &GlonassEphemeris::m_vy},
+            {NavField(45U, 5U, NavSign::SignMagnitude), AccScale, &GlonassEphemeris::m_ay},
+            {NavField(50U, 27U, NavSign::SignMagnitude), PosScale, &GlonassEphemeris::m_y},
+        };
+
+        static const Spec String3[] = {
+            {NavField(6U, 11U, NavSign::SignMagnitude), p2(-40), &GlonassEphemeris::m_gammaN},
+            {NavField(21U, 24U, NavSign::SignMagnitude), VelScale, &GlonassEphemeris::m_vz},
+            {NavField(45U, 5U, NavSign::SignMagnitude), AccScale, &GlonassEphemeris::m_az},
+            {NavField(50U, 27U, NavSign::SignMagnitude), PosScale, &GlonassEphemeris::m_z},
+        };
+
+        static const Spec String4[] = {
+            {NavField(5U, 22U, NavSign::SignMagnitude), p2(-30), &GlonassEphemeris::m_tauN},
+            {NavField(27U, 5U, NavSign::SignMagnitude), p2(-30), &GlonassEphemeris::m_deltaTauN},
+        };
+
+        static const int FreqIdOffset = 7;
+
+        auto* str1 = slot.m_frames[0];
+        auto* str2 = slot.m_frames[1];
+        auto* str3 = slot.m_frames[2];
+        auto* str4 = slot.m_frames[3];
+
+        GlonassEphemeris eph = GlonassEphemeris();
+        eph.m_svId = static_cast<std::uint8_t>(svId);
+        eph.m_freqNum = static_cast<std::int8_t>(static_cast<int>(freqId) - FreqIdOffset);
+        eph.m_tk =
+            static_cast<double>(
+                (bits(str1, 9U, 5U) * 3600U) +
+                (bits(str1, 14U, 6U) * 60U) +
+                (bits(str1, 20U, 1U) * 30U));
+        eph.m_health = static_cast<std::uint8_t>(bits(str2, 5U, 1U));
+        eph.m_age = static_cast<std::uint8_t>(bits(str4, 32U, 5U));
+        eph.m_ft = static_cast<std::uint8_t>(bits(str4, 52U, 4U));
+        eph.m_nt = static_cast<std::uint16_t>(bits(str4, 59U, 11U));
+        eph.m_m = static_cast<std::uint8_t>(bits(str4, 75U, 2U));
+        eph.m_flags = static_cast<std::uint8_t>(
+            bits(str3, 18U, 2U) |
+            (bits(str1, 7U, 2U) << 2) |
+            (bits(str2, 8U, 1U) << 4) |
+            (bits(str3, 5U, 1U) << 5) |
+            (bits(str4, 51U, 1U) << 6) |
+            (bits(str3, 20U, 1U) << 7));
+        details::navApply(str1, String1, eph);
+        details::navApply(str2, String2, eph);
+        details::navApply(str3, String3, eph);
+        details::navApply(str4, String4, eph);
+        slot.m_mask = 0U;
+        m_handler.handle(static_cast<const GlonassEphemeris&>(eph));
+    }
+
+    void reportGlonassTime(const std::uint32_t* stream)
+    {
+        typedef details::NavFieldSpec<GlonassTimeParams> Spec;
+        static const Spec Table[] = {
+            {NavField(16U, 32U, NavSign::SignMagnitude), p2(-31), &GlonassTimeParams::m_tauC},
+            {NavField(54U, 22U, NavSign::SignMagnitude), p2(-30), &GlonassTimeParams::m_tauGps},
+        };
+
+        GlonassTimeParams params = GlonassTimeParams();
+        params.m_na = static_cast<std::uint16_t>(bits(stream, 5U, 11U));
+        params.m_n4 = static_cast<std::uint8_t>(bits(stream, 49U, 5U));
+        details::navApply(stream, Table, params);
+        if ((!m_lastGloTimeValid) || (params != m_lastGloTime)) {
+            m_lastGloTime = params;
+            m_lastGloTimeValid = true;
+            m_handler.handle(static_cast<const GlonassTimeParams&>(params));
+        }
+    }
+
+    static void storeFrame(Slot& slot, unsigned frameIdx, const std::uint32_t* stream)
+    {
+        std::memcpy(&slot.m_frames[frameIdx][0], stream, StreamWords * sizeof(std::uint32_t));
+        slot.m_mask = static_cast<std::uint8_t>(slot.m_mask | (1U << frameIdx));
+    }
+
+    void reportIono(const KlobucharIono& iono)
+    {
+        auto& last = m_lastIono[iono.m_gnssId];
+        auto& valid = m_lastIonoValid[iono.m_gnssId];
+        if ((!valid) || (iono != last)) {
+            last = iono;
+            valid = true;
+            m_handler.handle(iono);
+        }
+    }
+
+    void reportUtc(const GnssUtcParams& utc)
+    {
+        auto& last = m_lastUtc[utc.m_gnssId];
+        auto& valid = m_lastUtcValid[utc.m_gnssId];
+        if ((!valid) || (utc != last)) {
+            last = utc;
+            valid = true;
+            m_handler.handle(utc);
+        }
+    }
+
+    static const std::size_t GnssCount = static_cast<std::size_t>(GnssId::NumOfValues);
+
+    THandler& m_handler;
+    Slot m_slots[SatelliteTable::Capacity];
+    NavDataStats m_stats;
+    KlobucharIono m_lastIono[GnssCount];
+    GnssUtcParams m_lastUtc[GnssCount];
+    NequickIono m_lastNequick;
+    GlonassTimeParams m_lastGloTime;
+    bool m_lastIonoValid[GnssCount];
+    bool m_lastUtcValid[GnssCount];
+    bool m_lastNequickValid = false;
+    bool m_lastGloTimeValid = false;
+    std::uint16_t m_galWeek = 0U;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
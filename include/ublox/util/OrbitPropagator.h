@@ -0,0 +1,660 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::OrbitPropagator class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "comms/comms.h"
+#include "ublox/field/common.h"
+#include "ublox/message/RxmAlm.h"
+#include "ublox/message/AidAlm.h"
+#include "ublox/message/MgaGpsAlm.h"
+#include "ublox/message/MgaQzssAlm.h"
+#include "ublox/message/MgaGalAlm.h"
+#include "ublox/message/MgaBdsAlm.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/NavDataDecoder.h"
+#include "ublox/util/geodesy.h"
+#include "ublox/util/details/vecmath.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Batch propagator of the Keplerian orbits (GPS, QZSS, Galileo,
+///     BeiDou) evaluating the azimuths and elevations of all the
+///     satellites at many epochs for many sites.
+/// @details The orbits are loaded from the broadcast ephemerides
+///     (@ref KeplerEphemeris) or almanacs (@ref KeplerAlmanac, RXM-ALM,
+///     AID-ALM, MGA-XXX-ALM messages), one orbit per satellite, the later
+///     one replacing the earlier. The orbit parameters are kept as
+///     "structure of arrays" and all the satellites are propagated by
+///     single loop using the branch-free approximations of the square root
+///     and trigonometric functions (see ublox/util/details/vecmath.h)
+///     instead of the library calls, so that GCC vectorises the
+///     propagation and look angle loops at @b -O3 without any special
+///     floating point options. The computation error is far below the
+///     error of the orbits themselves.
+///
+///     The epochs are expressed as GPS time of week, the reference time of
+///     every orbit is resolved to the nearest one (within half a week),
+///     same as the orbit is evaluated by the receivers. The azimuths
+///     (0 - 360 deg, clockwise from north) and elevations (-90 - 90 deg)
+///     are geometric ones (no light time correction), rounding them gives
+///     the values comparable to NAV-SAT and RXM-SVSI.
+///
+///     The propagation doesn't modify the object and doesn't allocate any
+///     memory, so it may be performed for different sites or epochs by
+///     multiple threads concurrently.
+class OrbitPropagator
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Number of Newton iterations solving the Kepler's equation.
+    /// @details Sufficient for the eccentricities up to 0.1 (QZSS).
+    static const unsigned KeplerIterations = 3U;
+
+    /// @brief Constructor
+    OrbitPropagator()
+    {
+        clear();
+    }
+
+    /// @brief Remove all the orbits.
+    void clear()
+    {
+        std::fill(&m_slots[0], &m_slots[SatelliteTable::Capacity], 0U);
+        for (auto* vec : doubleArrays()) {
+            vec->clear();
+        }
+        m_gnssIds.clear();
+        m_svIds.clear();
+        m_healths.clear();
+    }
+
+    /// @brief Add orbit from the broadcast ephemeris.
+    /// @return @b false in case the system or satellite is not supported.
+    bool add(const KeplerEphemeris& eph)
+    {
+        static const unsigned BdsMaxGeoSvId = 5U;
+        static const unsigned BdsMinGeoSvId = 59U;
+        static const double BdsGeoInclination = -5.0 * details::VecPi / 180.0;
+
+        Orbit orbit = Orbit();
+        orbit.m_gnssId = eph.m_gnssId;
+        orbit.m_svId = eph.m_svId;
+        orbit.m_health = eph.m_health;
+        orbit.m_toe = eph.m_toe;
+        orbit.m_sqrtA = eph.m_sqrtA;
+        orbit.m_deltaN = eph.m_deltaN;
+        orbit.m_e = eph.m_e;
+        orbit.m_m0 = eph.m_m0;
+        orbit.m_omega = eph.m_omega;
+        orbit.m_i0 = eph.m_i0;
+        orbit.m_iDot = eph.m_iDot;
+        orbit.m_omega0 = eph.m_omega0;
+        orbit.m_omegaDot = eph.m_omegaDot;
+        orbit.m_cuc = eph.m_cuc;
+        orbit.m_cus = eph.m_cus;
+        orbit.m_crc = eph.m_crc;
+        orbit.m_crs = eph.m_crs;
+        orbit.m_cic = eph.m_cic;
+        orbit.m_cis = eph.m_cis;
+
+        auto gnssId = static_cast<GnssId>(eph.m_gnssId);
+        if ((gnssId == GnssId::BeiDou) && ((eph.m_svId <= BdsMaxGeoSvId) || (BdsMinGeoSvId <= eph.m_svId))) {
+            orbit.m_geoInclination = BdsGeoInclination;
+        }
+        return add(orbit);
+    }
+
+    /// @brief Add orbit from the almanac.
+    /// @return @b false in case the system or satellite is not supported.
+    bool add(const KeplerAlmanac& alm)
+    {
+        Orbit orbit = Orbit();
+        orbit.m_gnssId = alm.m_gnssId;
+        orbit.m_svId = alm.m_svId;
+        orbit.m_health = alm.m_health;
+        orbit.m_toe = alm.m_toa;
+        orbit.m_sqrtA = alm.m_sqrtA;
+        orbit.m_e = alm.m_e;
+        orbit.m_m0 = alm.m_m0;
+        orbit.m_omega = alm.m_omega;
+        orbit.m_i0 = alm.m_i0;
+        orbit.m_omega0 = alm.m_omega0;
+        orbit.m_omegaDot = alm.m_omegaDot;
+        return add(orbit);
+    }
+
+    /// @brief Handle RXM-ALM message (GPS almanac).
+    template <typename TMsgBase, typename TDwrdOpt>
+    void handle(const message::RxmAlm<TMsgBase, TDwrdOpt>& msg)
+    {
+        addLnavAlmanac(msg);
+    }
+
+    /// @brief Handle AID-ALM message (GPS almanac).
+    template <typename TMsgBase, typename TDwrdOpt>
+    void handle(const message::AidAlm<TMsgBase, TDwrdOpt>& msg)
+    {
+        addLnavAlmanac(msg);
+    }
+
+    /// @brief Handle MGA-GPS-ALM message.
+    template <typename TMsgBase>
+    void handle(const message::MgaGpsAlm<TMsgBase>& msg)
+    {
+        static const double ReferenceInclination = 0.3 * details::NavSemiCircle;
+        addMgaAlmanac(msg, GnssId::Gps, ReferenceInclination);
+    }
+
+    /// @brief Handle MGA-QZSS-ALM message.
+    template <typename TMsgBase>
+    void handle(const message::MgaQzssAlm<TMsgBase>& msg)
+    {
+        static const double ReferenceInclination = 0.25 * details::NavSemiCircle;
+        addMgaAlmanac(msg, GnssId::Qzss, ReferenceInclination);
+    }
+
+    /// @brief Handle MGA-GAL-ALM message.
+    template <typename TMsgBase>
+    void handle(const message::MgaGalAlm<TMsgBase>& msg)
+    {
+        static const double ReferenceSqrtA = 5440.588203494177; // sqrt(29600000)
+        static const double ReferenceInclination = 56.0 * details::VecPi / 180.0;
+
+        KeplerAlmanac alm = KeplerAlmanac();
+        alm.m_gnssId = static_cast<std::uint8_t>(GnssId::Galileo);
+        alm.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        alm.m_health = static_cast<std::uint8_t>(msg.field_healthE1B().value());
+        alm.m_toa = msg.field_toa().value() * 600.0;
+        alm.m_sqrtA = ReferenceSqrtA + (msg.field_deltaSqrtA().value() * p2(-9));
+        alm.m_e = msg.field_e().value() * p2(-16);
+        alm.m_i0 = ReferenceInclination + (msg.field_deltaI().value() * sc(-14));
+        alm.m_omega0 = msg.field_omega0().value() * sc(-15);
+        alm.m_omegaDot = msg.field_omegaDot().value() * sc(-33);
+        alm.m_omega = msg.field_omega().value() * sc(-15);
+        alm.m_m0 = msg.field_m0().value() * sc(-15);
+        alm.m_af0 = msg.field_af0().value() * p2(-19);
+        alm.m_af1 = msg.field_af1().value() * p2(-38);
+        add(alm);
+    }
+
+    /// @brief Handle MGA-BDS-ALM message.
+    template <typename TMsgBase>
+    void handle(const message::MgaBdsAlm<TMsgBase>& msg)
+    {
+        static const unsigned MaxGeoSvId = 5U;
+        static const unsigned MinGeoSvId = 59U;
+        static const double ReferenceInclination = 0.3 * details::NavSemiCircle;
+
+        KeplerAlmanac alm = KeplerAlmanac();
+        alm.m_gnssId = static_cast<std::uint8_t>(GnssId::BeiDou);
+        alm.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        alm.m_toa = msg.field_toa().value() * p2(12);
+        alm.m_sqrtA = msg.field_sqrtA().value() * p2(-11);
+        alm.m_e = msg.field_e().value() * p2(-21);
+        alm.m_i0 = msg.field_deltaI().value() * sc(-19);
+        if ((MaxGeoSvId < alm.m_svId) && (alm.m_svId < MinGeoSvId)) {
+            alm.m_i0 += ReferenceInclination; // Inclination of GEO is relative to 0
+        }
+        alm.m_omega0 = msg.field_Omega0().value() * sc(-23);
+        alm.m_omegaDot = msg.field_OmegaDot().value() * sc(-38);
+        alm.m_omega = msg.field_omega().value() * sc(-23);
+        alm.m_m0 = msg.field_M0().value() * sc(-23);
+        alm.m_af0 = msg.field_a0().value() * p2(-20);
+        alm.m_af1 = msg.field_a1().value() * p2(-38);
+        add(alm);
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Number of the orbits.
+    std::size_t count() const
+    {
+        return m_gnssIds.size();
+    }
+
+    /// @brief GNSS identifier of the orbit.
+    GnssId gnssId(std::size_t idx) const
+    {
+        return static_cast<GnssId>(m_gnssIds[idx]);
+    }
+
+    /// @brief Satellite identifier of the orbit.
+    unsigned svId(std::size_t idx) const
+    {
+        return m_svIds[idx];
+    }
+
+    /// @brief Satellite health reported with the orbit.
+    unsigned health(std::size_t idx) const
+    {
+        return m_healths[idx];
+    }
+
+    /// @brief Set the sites, replacing the previous ones.
+    /// @param[in] latDeg Latitudes, deg.
+    /// @param[in] lonDeg Longitudes, deg.
+    /// @param[in] height Heights above ellipsoid, m.
+    /// @param[in] count Number of the sites.
+    void setSites(const double* latDeg, const double* lonDeg, const double* height, std::size_t count)
+    {
+        static const double DegToRad = details::VecPi / 180.0;
+
+        m_siteX.resize(count);
+        m_siteY.resize(count);
+        m_siteZ.resize(count);
+        geodesy::geodeticToEcef(latDeg, lonDeg, height, count, &m_siteX[0], &m_siteY[0], &m_siteZ[0]);
+
+        m_siteSinLat.resize(count);
+        m_siteCosLat.resize(count);
+        m_siteSinLon.resize(count);
+        m_siteCosLon.resize(count);
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            details::vecSinCos(latDeg[idx] * DegToRad, m_siteSinLat[idx], m_siteCosLat[idx]);
+            details::vecSinCos(lonDeg[idx] * DegToRad, m_siteSinLon[idx], m_siteCosLon[idx]);
+        }
+    }
+
+    /// @brief Number of the sites.
+    std::size_t sitesCount() const
+    {
+        return m_siteX.size();
+    }
+
+    /// @brief Calculate ECEF positions of all the satellites.
+    /// @param[in] gpsTow GPS time of week, s.
+    /// @param[out] x ECEF X coordinates, m (@ref count() elements).
+    /// @param[out] y ECEF Y coordinates, m (@ref count() elements).
+    /// @param[out] z ECEF Z coordinates, m (@ref count() elements).
+    void positions(double gpsTow, double* x, double* y, double* z) const
+    {
+        static const double SecPerWeek = 604800.0;
+
+        // Computed into local arrays, which can't alias the parameters
+        double xs[SatelliteTable::Capacity];
+        double ys[SatelliteTable::Capacity];
+        double zs[SatelliteTable::Capacity];
+        auto count = m_toe.size();
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto tk = gpsTow - m_toe[idx];
+            tk -= SecPerWeek * details::vecRound(tk / SecPerWeek);
+
+            // Eccentric anomaly
+            auto e = m_e[idx];
+            auto mk = m_m0[idx] + (m_n[idx] * tk);
+            double sinE = 0.0;
+            double cosE = 0.0;
+            details::vecSinCos(mk, sinE, cosE);
+            auto ek = mk + (e * sinE);
+            for (unsigned iter = 0U; iter < KeplerIterations; ++iter) {
+                details::vecSinCos(ek, sinE, cosE);
+                ek -= (ek - (e * sinE) - mk) / (1.0 - (e * cosE));
+            }
+            details::vecSinCos(ek, sinE, cosE);
+
+            // Argument of latitude, radius, and inclination with the harmonic corrections
+            auto phi = details::vecAtan2(m_ecc[idx] * sinE, cosE - e) + m_omega[idx];
+            double sin2Phi = 0.0;
+            double cos2Phi = 0.0;
+            details::vecSinCos(2.0 * phi, sin2Phi, cos2Phi);
+            auto uk = phi + (m_cus[idx] * sin2Phi) + (m_cuc[idx] * cos2Phi);
+            auto rk = (m_a[idx] * (1.0 - (e * cosE))) + (m_crs[idx] * sin2Phi) + (m_crc[idx] * cos2Phi);
+            auto ik = m_i0[idx] + (m_iDot[idx] * tk) + (m_cis[idx] * sin2Phi) + (m_cic[idx] * cos2Phi);
+
+            double sinU = 0.0;
+            double cosU = 0.0;
+            double sinI = 0.0;
+            double cosI = 0.0;
+            double sinO = 0.0;
+            double cosO = 0.0;
+            details::vecSinCos(uk, sinU, cosU);
+            details::vecSinCos(ik, sinI, cosI);
+            details::vecSinCos(m_omega0[idx] + (m_omegaRate[idx] * tk), sinO, cosO);
+            auto xp = rk * cosU;
+            auto yp = rk * sinU;
+            auto xk = (xp * cosO) - (yp * cosI * sinO);
+            auto yk = (xp * sinO) + (yp * cosI * cosO);
+            auto zk = yp * sinI;
+
+            // BeiDou GEO: rotation from the inertial frame (identity for other orbits)
+            double sinG = 0.0;
+            double cosG = 0.0;
+            details::vecSinCos(m_geoRate[idx] * tk, sinG, cosG);
+            auto yr = (yk * m_geoCos[idx]) + (zk * m_geoSin[idx]);
+            xs[idx] = (xk * cosG) + (yr * sinG);
+            ys[idx] = (yr * cosG) - (xk * sinG);
+            zs[idx] = (zk * m_geoCos[idx]) - (yk * m_geoSin[idx]);
+        }
+
+        std::copy(&xs[0], &xs[count], x);
+        std::copy(&ys[0], &ys[count], y);
+        std::copy(&zs[0], &zs[count], z);
+    }
+
+    /// @brief Calculate azimuths and elevations of all the satellites for
+    ///     all the sites at all the epochs.
+    /// @details The outputs are indexed by
+    ///     <b>(epochIdx * sitesCount() + siteIdx) * count() + orbitIdx</b>.
+    /// @param[in] gpsTow GPS times of week of the epochs, s.
+    /// @param[in] epochsCount Number of the epochs.
+    /// @param[out] azDeg Azimuths, deg.
+    /// @param[out] elDeg Elevations, deg.
+    void propagate(const double* gpsTow, std::size_t epochsCount, float* azDeg, float* elDeg) const
+    {
+        double x[SatelliteTable::Capacity];
+        double y[SatelliteTable::Capacity];
+        double z[SatelliteTable::Capacity];
+
+        auto count = this->count();
+        auto sites = sitesCount();
+        for (std::size_t epoch = 0U; epoch < epochsCount; ++epoch) {
+            positions(gpsTow[epoch], &x[0], &y[0], &z[0]);
+            for (std::size_t site = 0U; site < sites; ++site) {
+                auto offset = ((epoch * sites) + site) * count;
+                lookAngles(site, &x[0], &y[0], &z[0], count, &azDeg[offset], &elDeg[offset]);
+            }
+        }
+    }
+
+    /// @brief Calculate azimuths and elevations of the satellites for the
+    ///     single site.
+    /// @param[in] site Index of the site.
+    /// @param[in] x ECEF X coordinates of the satellites, m.
+    /// @param[in] y ECEF Y coordinates of the satellites, m.
+    /// @param[in] z ECEF Z coordinates of the satellites, m.
+    /// @param[in] count Number of the satellites.
+    /// @param[out] azDeg Azimuths, deg.
+    /// @param[out] elDeg Elevations, deg.
+    void lookAngles(
+        std::size_t site,
+        const double* x,
+        const double* y,
+        const double* z,
+        std::size_t count,
+        float* azDeg,
+        float* elDeg) const
+    {
+        static const double RadToDeg = 180.0 / details::VecPi;
+
+        auto sx = m_siteX[site];
+        auto sy = m_siteY[site];
+        auto sz = m_siteZ[site];
+        auto sinLat = m_siteSinLat[site];
+        auto cosLat = m_siteCosLat[site];
+        auto sinLon = m_siteSinLon[site];
+        auto cosLon = m_siteCosLon[site];
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto dx = x[idx] - sx;
+            auto dy = y[idx] - sy;
+            auto dz = z[idx] - sz;
+            auto east = (dy * cosLon) - (dx * sinLon);
+            auto along = (dx * cosLon) + (dy * sinLon);
+            auto north = (dz * cosLat) - (along * sinLat);
+            auto up = (dz * sinLat) + (along * cosLat);
+            // Azimuth of the opposite direction is in [-180, 180]
+            azDeg[idx] = static_cast<float>(180.0 + (details::vecAtan2(-east, -north) * RadToDeg));
+            elDeg[idx] = static_cast<float>(
+                details::vecAtan2(up, details::vecSqrt((east * east) + (north * north))) * RadToDeg);
+        }
+    }
+
+private:
+    struct Orbit
+    {
+        std::uint8_t m_gnssId;
+        std::uint8_t m_svId;
+        std::uint16_t m_health;
+        double m_toe;
+        double m_sqrtA;
+        double m_deltaN;
+        double m_e;
+        double m_m0;
+        double m_omega;
+        double m_i0;
+        double m_iDot;
+        double m_omega0;
+        double m_omegaDot;
+        double m_cuc;
+        double m_cus;
+        double m_crc;
+        double m_crs;
+        double m_cic;
+        double m_cis;
+        double m_geoInclination;
+    };
+
+    struct SystemConstants
+    {
+        double m_mu; ///< Gravitational constant, m^3/s^2
+        double m_earthRate; ///< Earth rotation rate, rad/s
+        double m_timeOffset; ///< Offset of GPS time of week from the system one, s
+    };
+
+    static const SystemConstants* constantsOf(GnssId gnssId)
+    {
+        static const SystemConstants Gps = {3.986005e14, 7.2921151467e-5, 0.0};
+        static const SystemConstants Galileo = {3.986004418e14, 7.2921151467e-5, 0.0};
+        static const SystemConstants BeiDou = {3.986004418e14, 7.292115e-5, 14.0};
+
+        switch (gnssId) {
+        case GnssId::Gps:
+        case GnssId::Qzss:
+            return &Gps;
+        case GnssId::Galileo:
+            return &Galileo;
+        case GnssId::BeiDou:
+            return &BeiDou;
+        default:
+            break;
+        }
+        return nullptr;
+    }
+
+    bool add(const Orbit& orbit)
+    {
+        auto gnssId = static_cast<GnssId>(orbit.m_gnssId);
+        auto* constants = constantsOf(gnssId);
+        auto slot = SatelliteTable::indexOf(gnssId, orbit.m_svId);
+        if ((constants == nullptr) || (SatelliteTable::Capacity <= slot) || (orbit.m_sqrtA <= 0.0) ||
+            (orbit.m_e < 0.0) || (1.0 <= orbit.m_e)) {
+            return false;
+        }
+
+        auto idx = static_cast<std::size_t>(m_slots[slot]);
+        if (idx == 0U) {
+            for (auto* vec : doubleArrays()) {
+                vec->push_back(0.0);
+            }
+            m_gnssIds.push_back(0U);
+            m_svIds.push_back(0U);
+            m_healths.push_back(0U);
+            idx = m_gnssIds.size();
+            m_slots[slot] = static_cast<std::uint8_t>(idx);
+        }
+        --idx;
+
+        auto geo = (orbit.m_geoInclination != 0.0);
+        auto a = orbit.m_sqrtA * orbit.m_sqrtA;
+        auto toe = orbit.m_toe + constants->m_timeOffset;
+        m_gnssIds[idx] = orbit.m_gnssId;
+        m_svIds[idx] = orbit.m_svId;
+        m_healths[idx] = orbit.m_health;
+        m_toe[idx] = toe;
+        m_a[idx] = a;
+        m_n[idx] = std::sqrt(constants->m_mu / (a * a * a)) + orbit.m_deltaN;
+        m_e[idx] = orbit.m_e;
+        m_ecc[idx] = std::sqrt(1.0 - (orbit.m_e * orbit.m_e));
+        m_m0[idx] = orbit.m_m0;
+        m_omega[idx] = orbit.m_omega;
+        m_i0[idx] = orbit.m_i0;
+        m_iDot[idx] = orbit.m_iDot;
+        m_omega0[idx] = orbit.m_omega0 - (constants->m_earthRate * orbit.m_toe);
+        m_omegaRate[idx] = orbit.m_omegaDot - (geo ? 0.0 : constants->m_earthRate);
+        m_cuc[idx] = orbit.m_cuc;
+        m_cus[idx] = orbit.m_cus;
+        m_crc[idx] = orbit.m_crc;
+        m_crs[idx] = orbit.m_crs;
+        m_cic[idx] = orbit.m_cic;
+        m_cis[idx] = orbit.m_cis;
+        m_geoRate[idx] = geo ? constants->m_earthRate : 0.0;
+        m_geoCos[idx] = std::cos(orbit.m_geoInclination);
+        m_geoSin[idx] = std::sin(orbit.m_geoInclination);
+        return true;
+    }
+
+    /// @brief Decode almanac from words 3 - 10 of LNAV subframe 4 / 5
+    ///     (24 data bits each).
+    template <typename TMsg>
+    void addLnavAlmanac(const TMsg& msg)
+    {
+        static const std::size_t DataWords = 8U;
+        static const double ReferenceInclination = 0.3 * details::NavSemiCircle;
+
+        auto& dwrd = msg.field_dwrd();
+        if ((dwrd.getMode() != comms::field::OptionalMode::Exists) || (dwrd.field().value().size() < DataWords)) {
+            return; // Poll response without almanac
+        }
+
+        std::uint32_t words[DataWords];
+        auto& list = dwrd.field().value();
+        for (std::size_t idx = 0U; idx < DataWords; ++idx) {
+            words[idx] = list[idx].value() & 0xffffffU;
+        }
+
+        KeplerAlmanac alm = KeplerAlmanac();
+        alm.m_gnssId = static_cast<std::uint8_t>(GnssId::Gps);
+        alm.m_svId = static_cast<std::uint8_t>(msg.field_svid().value());
+        alm.m_health = static_cast<std::uint8_t>(words[2]);
+        alm.m_e = (words[0] & 0xffffU) * p2(-21);
+        alm.m_toa = ((words[1] >> 16) & 0xffU) * p2(12);
+        alm.m_i0 = ReferenceInclination + (signExtend(words[1], 16U) * sc(-19));
+        alm.m_omegaDot = signExtend(words[2] >> 8, 16U) * sc(-38);
+        alm.m_sqrtA = words[3] * p2(-11);
+        alm.m_omega0 = signExtend(words[4], 24U) * sc(-23);
+        alm.m_omega = signExtend(words[5], 24U) * sc(-23);
+        alm.m_m0 = signExtend(words[6], 24U) * sc(-23);
+        alm.m_af0 = signExtend(((words[7] >> 13) & 0x7f8U) | ((words[7] >> 2) & 0x7U), 11U) * p2(-20);
+        alm.m_af1 = signExtend(words[7] >> 5, 11U) * p2(-38);
+        add(alm);
+    }
+
+    template <typename TMsg>
+    void addMgaAlmanac(const TMsg& msg, GnssId gnssId, double referenceInclination)
+    {
+        KeplerAlmanac alm = KeplerAlmanac();
+        alm.m_gnssId = static_cast<std::uint8_t>(gnssId);
+        alm.m_svId = static_cast<std::uint8_t>(msg.field_svId().value());
+        alm.m_health = static_cast<std::uint8_t>(msg.field_svHealth().value());
+        alm.m_e = msg.field_e().value() * p2(-21);
+        alm.m_toa = msg.field_toa().value() * p2(12);
+        alm.m_i0 = referenceInclination + (msg.field_deltaI().value() * sc(-19));
+        alm.m_omegaDot = msg.field_omegaDot().value() * sc(-38);
+        alm.m_sqrtA = msg.field_sqrtA().value() * p2(-11);
+        alm.m_omega0 = msg.field_omega0().value() * sc(-23);
+        alm.m_omega = msg.field_omega().value() * sc(-23);
+        alm.m_m0 = msg.field_m0().value() * sc(-23);
+        alm.m_af0 = msg.field_af0().value() * p2(-20);
+        alm.m_af1 = msg.field_af1().value() * p2(-38);
+        add(alm);
+    }
+
+    static std::int32_t signExtend(std::uint32_t value, unsigned len)
+    {
+        auto signBit = static_cast<std::uint32_t>(1U) << (len - 1U);
+        value &= (signBit << 1) - 1U;
+        return static_cast<std::int32_t>(value ^ signBit) - static_cast<std::int32_t>(signBit);
+    }
+
+    static double sc(int exp)
+    {
+        return details::navPow2(exp) * details::NavSemiCircle;
+    }
+
+    static double p2(int exp)
+    {
+        return details::navPow2(exp);
+    }
+
+    std::vector<std::vector<double>*> doubleArrays()
+    {
+        return {
+            &m_toe, &m_a, &m_n, &m_e, &m_ecc, &m_m0, &m_omega, &m_i0, &m_iDot, &m_omega0, &m_omegaRate,
+            &m_cuc, &m_cus, &m_crc, &m_crs, &m_cic, &m_cis, &m_geoRate, &m_geoCos, &m_geoSin
+        };
+    }
+
+    // Orbit parameters
+    std::vector<double> m_toe; // GPS time of week
+    std::vector<double> m_a;
+    std::vector<double> m_n; // Corrected mean motion
+    std::vector<double> m_e;
+    std::vector<double> m_ecc; // sqrt(1 - e^2)
+    std::vector<double> m_m0;
+    std::vector<double> m_omega;
+    std::vector<double> m_i0;
+    std::vector<double> m_iDot;
+    std::vector<double> m_omega0; // Including Earth rotation at the reference time
+    std::vector<double> m_omegaRate; // Including Earth rotation (except BeiDou GEO)
+    std::vector<double> m_cuc;
+    std::vector<double> m_cus;
+    std::vector<double> m_crc;
+    std::vector<double> m_crs;
+    std::vector<double> m_cic;
+    std::vector<double> m_cis;
+    std::vector<double> m_geoRate;
+    std::vector<double> m_geoCos;
+    std::vector<double> m_geoSin;
+    std::vector<std::uint8_t> m_gnssIds;
+    std::vector<std::uint8_t> m_svIds;
+    std::vector<std::uint16_t> m_healths;
+
+    // Sites
+    std::vector<double> m_siteX;
+    std::vector<double> m_siteY;
+    std::vector<double> m_siteZ;
+    std::vector<double> m_siteSinLat;
+    std::vector<double> m_siteCosLat;
+    std::vector<double> m_siteSinLon;
+    std::vector<double> m_siteCosLon;
+
+    // Index of the orbit + 1 of every satellite table slot, 0 if none
+    std::uint8_t m_slots[SatelliteTable::Capacity];
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,332 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::PollScheduler class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "ublox/util/details/frame.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Statistics of the single poll of @ref PollScheduler.
+struct PollStats
+{
+    std::uint32_t m_sent = 0U; ///< Number of sent poll requests
+    std::uint32_t m_responses = 0U; ///< Number of matched responses
+    std::uint32_t m_skipped = 0U; ///< Number of polls skipped because the previous one was pending
+    std::uint32_t m_lost = 0U; ///< Number of requests without response within the timeout
+    std::int64_t m_lastLatencyMs = 0; ///< Latency of the last response, ms
+    std::int64_t m_minLatencyMs = 0; ///< Minimal latency, ms
+    std::int64_t m_maxLatencyMs = 0; ///< Maximal latency, ms
+    std::int64_t m_totalLatencyMs = 0; ///< Sum of all the latencies, ms
+
+    /// @brief Mean latency of the responses, ms.
+    double meanLatencyMs() const
+    {
+        if (m_responses == 0U) {
+            return 0.0;
+        }
+
+        return static_cast<double>(m_totalLatencyMs) / static_cast<double>(m_responses);
+    }
+};
+
+/// @brief Scheduler of periodic poll requests.
+/// @details Keeps the polls in the min-heap ordered by their due time,
+///     every @ref tick() appends frames of all the polls that became due
+///     into single buffer and passes it to the output function object at
+///     once, i.e. single write per tick regardless of the number of polls.
+///
+///     The poll is pending from its transmission until the message with
+///     the same ID is received (see @ref received() and @ref handle()).
+///     The pending poll is not repeated, its due occurrences are skipped,
+///     unless the response doesn't arrive within the timeout, in which
+///     case the request is considered lost. The latency of the responses
+///     is recorded in the statistics of every poll.
+///
+///     The time is provided by the caller in milliseconds of any monotonic
+///     scale, the first @ref tick() defines the start of the schedule.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const std::uint8_t* data, std::size_t len) @endcode
+///     receiving one or more complete UBX frames.
+template <typename TOutput>
+class PollScheduler
+{
+public:
+    /// @brief Value returned by @ref add() on failure.
+    static const std::size_t InvalidPoll = std::numeric_limits<std::size_t>::max();
+
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] timeoutMs Response timeout, ms.
+    explicit PollScheduler(TOutput output, std::int64_t timeoutMs = 1000)
+      : m_output(std::move(output)),
+        m_timeoutMs(timeoutMs)
+    {
+    }
+
+    /// @brief Add periodic poll.
+    /// @param[in] msg Poll message, the response is expected to have the
+    ///     same ID.
+    /// @param[in] periodMs Period of the poll, ms.
+    /// @param[in] phaseMs Delay of the first poll since the schedule
+    ///     start (or since the last @ref tick() when added later), ms.
+    /// @return Index of the poll or @ref InvalidPoll if the message can't
+    ///     be serialised or the period is not positive.
+    template <typename TMsg>
+    std::size_t add(const TMsg& msg, std::int64_t periodMs, std::int64_t phaseMs = 0)
+    {
+        std::vector<std::uint8_t> payload;
+        if (!details::writePayload(msg, payload)) {
+            return InvalidPoll;
+        }
+
+        return addRaw(static_cast<MsgId>(msg.doGetId()), payload.data(), payload.size(), periodMs, phaseMs);
+    }
+
+    /// @brief Add periodic poll using its serialised payload.
+    /// @return Index of the poll or @ref InvalidPoll.
+    std::size_t addRaw(
+        MsgId id,
+        const std::uint8_t* payload,
+        std::size_t len,
+        std::int64_t periodMs,
+        std::int64_t phaseMs = 0)
+    {
+        if ((periodMs <= 0) || (std::numeric_limits<std::uint16_t>::max() < len)) {
+            return InvalidPoll;
+        }
+
+        auto idx = m_polls.size();
+        m_polls.emplace_back();
+        auto& poll = m_polls.back();
+        poll.m_id = id;
+        poll.m_periodMs = periodMs;
+        poll.m_phaseMs = phaseMs;
+        details::appendFrame(id, payload, len, poll.m_frame);
+
+        auto lookupIter =
+            std::upper_bound(
+                m_lookup.begin(), m_lookup.end(), id,
+                [](MsgId idParam, const LookupEntry& entry) -> bool
+                {
+                    return idParam < entry.first;
+                });
+        m_lookup.insert(lookupIter, LookupEntry(id, idx));
+
+        if (m_started) {
+            schedule(idx, m_nowMs + phaseMs);
+        }
+        return idx;
+    }
+
+    /// @brief Send all the polls that became due.
+    /// @param[in] nowMs Current time, ms.
+    void tick(std::int64_t nowMs)
+    {
+        m_nowMs = nowMs;
+        if (!m_started) {
+            m_started = true;
+            for (std::size_t idx = 0U; idx < m_polls.size(); ++idx) {
+                schedule(idx, nowMs + m_polls[idx].m_phaseMs);
+            }
+        }
+
+        m_batch.clear();
+        while ((!m_queue.empty()) && (m_queue.front().first <= nowMs)) {
+            std::pop_heap(m_queue.begin(), m_queue.end(), std::greater<QueueEntry>());
+            auto dueMs = m_queue.back().first;
+            auto idx = m_queue.back().second;
+            m_queue.pop_back();
+
+            auto& poll = m_polls[idx];
+            if (poll.m_pending && (nowMs < (poll.m_sentMs + m_timeoutMs))) {
+                ++poll.m_stats.m_skipped;
+            }
+            else {
+                if (poll.m_pending) {
+                    ++poll.m_stats.m_lost;
+                }
+
+                poll.m_pending = true;
+                poll.m_sentMs = nowMs;
+                ++poll.m_stats.m_sent;
+                m_batch.insert(m_batch.end(), poll.m_frame.begin(), poll.m_frame.end());
+            }
+
+            // Keep the phase, skip the occurrences missed by late tick
+            auto periods = ((nowMs - dueMs) / poll.m_periodMs) + 1;
+            schedule(idx, dueMs + (periods * poll.m_periodMs));
+        }
+
+        if (m_batch.empty()) {
+            return;
+        }
+
+        ++m_writes;
+        m_output(m_batch.data(), m_batch.size());
+    }
+
+    /// @brief Report reception of the message.
+    /// @details Completes the oldest pending poll with the same ID.
+    /// @param[in] id ID of the received message.
+    /// @param[in] nowMs Reception time, ms.
+    /// @return @b true if the message was a response to the pending poll.
+    bool received(MsgId id, std::int64_t nowMs)
+    {
+        auto range =
+            std::equal_range(
+                m_lookup.begin(), m_lookup.end(), LookupEntry(id, 0U),
+                [](const LookupEntry& first, const LookupEntry& second) -> bool
+                {
+                    return first.first < second.first;
+                });
+
+        Poll* oldest = nullptr;
+        for (auto iter = range.first; iter != range.second; ++iter) {
+            auto& poll = m_polls[iter->second];
+            if (poll.m_pending &&
+                ((oldest == nullptr) || (poll.m_sentMs < oldest->m_sentMs))) {
+                oldest = &poll;
+            }
+        }
+
+        if (oldest == nullptr) {
+            return false;
+        }
+
+        auto latencyMs = nowMs - oldest->m_sentMs;
+        auto& stats = oldest->m_stats;
+        if ((stats.m_responses == 0U) || (latencyMs < stats.m_minLatencyMs)) {
+            stats.m_minLatencyMs = latencyMs;
+        }
+
+        if ((stats.m_responses == 0U) || (stats.m_maxLatencyMs < latencyMs)) {
+            stats.m_maxLatencyMs = latencyMs;
+        }
+
+        stats.m_lastLatencyMs = latencyMs;
+        stats.m_totalLatencyMs += latencyMs;
+        ++stats.m_responses;
+        oldest->m_pending = false;
+        return true;
+    }
+
+    /// @brief Handle any received message.
+    /// @details Reports the reception using the time of the last
+    ///     @ref tick(), use @ref received() directly when more precise
+    ///     latency is required.
+    template <typename TMsg>
+    void handle(const TMsg& msg)
+    {
+        received(static_cast<MsgId>(msg.doGetId()), m_nowMs);
+    }
+
+    /// @brief Number of added polls.
+    std::size_t count() const
+    {
+        return m_polls.size();
+    }
+
+    /// @brief ID of the poll.
+    MsgId id(std::size_t idx) const
+    {
+        return m_polls[idx].m_id;
+    }
+
+    /// @brief Check whether the poll is waiting for the response.
+    bool pending(std::size_t idx) const
+    {
+        return m_polls[idx].m_pending;
+    }
+
+    /// @brief Statistics of the poll.
+    const PollStats& stats(std::size_t idx) const
+    {
+        return m_polls[idx].m_stats;
+    }
+
+    /// @brief Number of invocations of the output function object.
+    std::uint64_t writes() const
+    {
+        return m_writes;
+    }
+
+    /// @brief Time the next poll becomes due.
+    /// @return Due time, ms, or maximal value if there are no scheduled polls.
+    std::int64_t nextDueMs() const
+    {
+        if (m_queue.empty()) {
+            return std::numeric_limits<std::int64_t>::max();
+        }
+        return m_queue.front().first;
+    }
+
+private:
+    struct Poll
+    {
+        std::vector<std::uint8_t> m_frame;
+        PollStats m_stats;
+        std::int64_t m_periodMs = 0;
+        std::int64_t m_phaseMs = 0;
+        std::int64_t m_sentMs = 0;
+        MsgId m_id = MsgId_MON_HW;
+        bool m_pending = false;
+    };
+
+    typedef std::pair<std::int64_t, std::size_t> QueueEntry;
+    typedef std::pair<MsgId, std::size_t> LookupEntry;
+
+    void schedule(std::size_t idx, std::int64_t dueMs)
+    {
+        m_queue.push_back(QueueEntry(dueMs, idx));
+        std::push_heap(m_queue.begin(), m_queue.end(), std::greater<QueueEntry>());
+    }
+
+    TOutput m_output;
+    std::vector<Poll> m_polls;
+    std::vector<QueueEntry> m_queue; // min-heap by due time
+    std::vector<LookupEntry> m_lookup; // sorted by ID
+    std::vector<std::uint8_t> m_batch;
+    std::int64_t m_timeoutMs = 0;
+    std::int64_t m_nowMs = 0;
+    std::uint64_t m_writes = 0U;
+    bool m_started = false;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
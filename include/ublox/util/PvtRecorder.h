@@ -0,0 +1,679 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::PvtRecorder and
+///     ublox::util::PvtBlockReader classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "ublox/message/NavPvt.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Columns recorded by @ref PvtRecorder.
+/// @details Every column corresponds to the NAV-PVT field with the same
+///     name, the values are in units of the protocol (not scaled).
+enum class PvtColumn : std::uint8_t
+{
+    iTOW, ///< GPS time of week, ms
+    year, ///< Year (UTC)
+    month, ///< Month (UTC)
+    day, ///< Day of month (UTC)
+    hour, ///< Hour of day (UTC)
+    min, ///< Minute of hour (UTC)
+    sec, ///< Seconds of minute (UTC)
+    valid, ///< Validity flags
+    tAcc, ///< Time accuracy estimate, ns
+    nano, ///< Fraction of second, ns
+    fixType, ///< GNSS fix type
+    flags, ///< Fix status flags (serialised bitfield)
+    flags2, ///< Additional flags
+    numSV, ///< Number of satellites used in solution
+    lon, ///< Longitude, 1e-7 deg
+    lat, ///< Latitude, 1e-7 deg
+    height, ///< Height above ellipsoid, mm
+    hMSL, ///< Height above mean sea level, mm
+    hAcc, ///< Horizontal accuracy estimate, mm
+    vAcc, ///< Vertical accuracy estimate, mm
+    velN, ///< NED north velocity, mm/s
+    velE, ///< NED east velocity, mm/s
+    velD, ///< NED down velocity, mm/s
+    gSpeed, ///< Ground speed, mm/s
+    headMot, ///< Heading of motion, 1e-5 deg
+    sAcc, ///< Speed accuracy estimate, mm/s
+    headAcc, ///< Heading accuracy estimate, 1e-5 deg
+    pDOP, ///< Position DOP, 0.01
+    headVeh, ///< Heading of vehicle, 1e-5 deg (0 when not reported)
+    NumOfValues ///< number of available values
+};
+
+namespace details
+{
+
+/// @brief Constants of the columnar block format.
+/// @details The block is serialised using little endian and has the
+///     following layout:
+///     @li magic bytes @b 'P', @b 'C'
+///     @li format version (1 byte)
+///     @li number of columns (1 byte)
+///     @li number of rows (2 bytes)
+///     @li total length of the block (4 bytes)
+///     @li offset of every column from the beginning of the block (4 bytes each)
+///     @li encoded columns
+///
+///     Every column starts with the delta order (1 byte) and bit width
+///     of the packed values (1 byte), followed by the first @b order
+///     values / deltas encoded as zigzag varints, and the remaining
+///     zigzagged deltas of the specified order packed with fixed bit width
+///     (least significant bit first).
+struct PvtBlockFormat
+{
+    static const std::uint8_t Magic0 = 'P';
+    static const std::uint8_t Magic1 = 'C';
+    static const std::uint8_t Version = 1U;
+    static const std::size_t HeaderLen = 10U;
+    static const std::size_t ColumnsCount = static_cast<std::size_t>(PvtColumn::NumOfValues);
+    static const std::size_t DirectoryLen = ColumnsCount * sizeof(std::uint32_t);
+    static const std::size_t MaxOrder = 2U;
+    static const std::size_t MaxVarintLen = 10U;
+    static const std::size_t ColumnHeaderLen = 2U;
+
+    static std::uint64_t zigzag(std::int64_t value)
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    static std::int64_t unzigzag(std::uint64_t value)
+    {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 0x1);
+    }
+
+    static unsigned bitWidth(std::uint64_t value)
+    {
+        unsigned width = 0U;
+        while (value != 0U) {
+            ++width;
+            value >>= 1;
+        }
+        return width;
+    }
+
+    static void writeU16(std::uint8_t* pos, std::uint16_t value)
+    {
+        pos[0] = static_cast<std::uint8_t>(value);
+        pos[1] = static_cast<std::uint8_t>(value >> 8);
+    }
+
+    static void writeU32(std::uint8_t* pos, std::uint32_t value)
+    {
+        for (auto idx = 0U; idx < sizeof(value); ++idx) {
+            pos[idx] = static_cast<std::uint8_t>(value >> (idx * 8));
+        }
+    }
+
+    static std::uint16_t readU16(const std::uint8_t* pos)
+    {
+        return static_cast<std::uint16_t>(pos[0] | (pos[1] << 8));
+    }
+
+    static std::uint32_t readU32(const std::uint8_t* pos)
+    {
+        std::uint32_t value = 0U;
+        for (auto idx = 0U; idx < sizeof(value); ++idx) {
+            value |= static_cast<std::uint32_t>(pos[idx]) << (idx * 8);
+        }
+        return value;
+    }
+};
+
+/// @brief Writes values of fixed bit width, least significant bit first.
+class BitPacker
+{
+public:
+    explicit BitPacker(std::uint8_t* pos)
+      : m_pos(pos)
+    {
+    }
+
+    void write(std::uint64_t value, unsigned width)
+    {
+        while (0U < width) {
+            auto chunk = width < 32U ? width : 32U;
+            m_acc |= (value & ((static_cast<std::uint64_t>(1U) << chunk) - 1U)) << m_bits;
+            m_bits += chunk;
+            value = chunk < 64U ? (value >> chunk) : 0U;
+            width -= chunk;
+            while (8U <= m_bits) {
+                *m_pos = static_cast<std::uint8_t>(m_acc);
+                ++m_pos;
+                m_acc >>= 8;
+                m_bits -= 8U;
+            }
+        }
+    }
+
+    std::uint8_t* finish()
+    {
+        if (0U < m_bits) {
+            *m_pos = static_cast<std::uint8_t>(m_acc);
+            ++m_pos;
+            m_acc = 0U;
+            m_bits = 0U;
+        }
+        return m_pos;
+    }
+
+private:
+    std::uint8_t* m_pos = nullptr;
+    std::uint64_t m_acc = 0U;
+    unsigned m_bits = 0U;
+};
+
+/// @brief Reads values of fixed bit width, least significant bit first.
+class BitUnpacker
+{
+public:
+    BitUnpacker(const std::uint8_t* pos, const std::uint8_t* end)
+      : m_pos(pos),
+        m_end(end)
+    {
+    }
+
+    bool read(std::uint64_t& value, unsigned width)
+    {
+        value = 0U;
+        unsigned done = 0U;
+        while (done < width) {
+            auto chunk = (width - done) < 32U ? (width - done) : 32U;
+            while (m_bits < chunk) {
+                if (m_pos == m_end) {
+                    return false;
+                }
+                m_acc |= static_cast<std::uint64_t>(*m_pos) << m_bits;
+                ++m_pos;
+                m_bits += 8U;
+            }
+
+            value |= (m_acc & ((static_cast<std::uint64_t>(1U) << chunk) - 1U)) << done;
+            m_acc >>= chunk;
+            m_bits -= chunk;
+            done += chunk;
+        }
+        return true;
+    }
+
+private:
+    const std::uint8_t* m_pos = nullptr;
+    const std::uint8_t* m_end = nullptr;
+    std::uint64_t m_acc = 0U;
+    unsigned m_bits = 0U;
+};
+
+}  // namespace details
+
+/// @brief Records NAV-PVT messages into compressed columnar blocks.
+/// @details Accumulates the values of the NAV-PVT fields (see @ref PvtColumn)
+///     and when @b TBlockRows rows are collected, encodes them into a block
+///     where every column is stored separately. The columns are delta
+///     encoded (first or second order, whichever is more compact), zigzag
+///     transformed and bit packed, which makes the slowly changing values
+///     (position, time of week, accuracies) occupy only a few bits per row.
+///     The encoded block is kept in the internal buffer until the next
+///     block is complete, no dynamic memory allocation is performed. Use
+///     @ref PvtBlockReader to decode the columns.
+/// @tparam TBlockRows Number of rows in the complete block.
+template <std::size_t TBlockRows = 256U>
+class PvtRecorder
+{
+    static_assert((1U < TBlockRows) && (TBlockRows <= 0xffff), "Invalid number of rows");
+    typedef details::PvtBlockFormat Format;
+
+public:
+    /// @brief Maximal length of the encoded block.
+    static const std::size_t MaxBlockLen =
+        Format::HeaderLen +
+        Format::DirectoryLen +
+        (Format::ColumnsCount *
+            (Format::ColumnHeaderLen + (Format::MaxOrder * Format::MaxVarintLen) + (TBlockRows * sizeof(std::uint64_t))));
+
+    /// @brief Default constructor
+    PvtRecorder() = default;
+
+    PvtRecorder(const PvtRecorder&) = delete;
+    PvtRecorder& operator=(const PvtRecorder&) = delete;
+
+    /// @brief Append NAV-PVT message.
+    /// @return @b true when the block is complete and available via
+    ///     @ref blockData() and @ref blockLength().
+    template <typename TMsgBase>
+    bool append(const message::NavPvt<TMsgBase>& msg)
+    {
+        auto row = m_rows;
+        set(PvtColumn::iTOW, row, msg.field_iTOW().value());
+        set(PvtColumn::year, row, msg.field_year().value());
+        set(PvtColumn::month, row, msg.field_month().value());
+        set(PvtColumn::day, row, msg.field_day().value());
+        set(PvtColumn::hour, row, msg.field_hour().value());
+        set(PvtColumn::min, row, msg.field_min().value());
+        set(PvtColumn::sec, row, msg.field_sec().value());
+        set(PvtColumn::valid, row, msg.field_valid().value());
+        set(PvtColumn::tAcc, row, msg.field_tAcc().value());
+        set(PvtColumn::nano, row, msg.field_nano().value());
+        set(PvtColumn::fixType, row, static_cast<std::uint8_t>(msg.field_fixType().value()));
+        set(PvtColumn::flags, row, details::packedValue(msg.field_flags()));
+        set(PvtColumn::flags2, row, msg.field_flags2().value());
+        set(PvtColumn::numSV, row, msg.field_numSV().value());
+        set(PvtColumn::lon, row, msg.field_lon().value());
+        set(PvtColumn::lat, row, msg.field_lat().value());
+        set(PvtColumn::height, row, msg.field_height().value());
+        set(PvtColumn::hMSL, row, msg.field_hMSL().value());
+        set(PvtColumn::hAcc, row, msg.field_hAcc().value());
+        set(PvtColumn::vAcc, row, msg.field_vAcc().value());
+        set(PvtColumn::velN, row, msg.field_velN().value());
+        set(PvtColumn::velE, row, msg.field_velE().value());
+        set(PvtColumn::velD, row, msg.field_velD().value());
+        set(PvtColumn::gSpeed, row, msg.field_gSpeed().value());
+        set(PvtColumn::headMot, row, msg.field_headMot().value());
+        set(PvtColumn::sAcc, row, msg.field_sAcc().value());
+        set(PvtColumn::headAcc, row, msg.field_headAcc().value());
+        set(PvtColumn::pDOP, row, msg.field_pDOP().value());
+        std::int64_t headVeh = 0;
+        if (msg.field_headVeh().getMode() == comms::field::OptionalMode::Exists) {
+            headVeh = msg.field_headVeh().field().value();
+        }
+        set(PvtColumn::headVeh, row, headVeh);
+
+        ++m_rows;
+        if (m_rows < TBlockRows) {
+            return false;
+        }
+
+        encode();
+        return true;
+    }
+
+    /// @brief Encode the incomplete block (if any).
+    /// @return @b true when the block has been encoded and available via
+    ///     @ref blockData() and @ref blockLength().
+    bool flush()
+    {
+        if (m_rows == 0U) {
+            return false;
+        }
+
+        encode();
+        return true;
+    }
+
+    /// @brief Number of rows accumulated for the next block.
+    std::size_t pendingRows() const
+    {
+        return m_rows;
+    }
+
+    /// @brief Last encoded block.
+    const std::uint8_t* blockData() const
+    {
+        return &m_block[0];
+    }
+
+    /// @brief Length of the last encoded block.
+    std::size_t blockLength() const
+    {
+        return m_blockLen;
+    }
+
+private:
+    template <typename T>
+    void set(PvtColumn col, std::size_t row, T value)
+    {
+        m_values[static_cast<std::size_t>(col)][row] = static_cast<std::int64_t>(value);
+    }
+
+    void encode()
+    {
+        auto* begin = &m_block[0];
+        begin[0] = Format::Magic0;
+        begin[1] = Format::Magic1;
+        begin[2] = Format::Version;
+        begin[3] = static_cast<std::uint8_t>(Format::ColumnsCount);
+        Format::writeU16(&begin[4], static_cast<std::uint16_t>(m_rows));
+
+        auto* pos = begin + Format::HeaderLen + Format::DirectoryLen;
+        for (std::size_t col = 0U; col < Format::ColumnsCount; ++col) {
+            Format::writeU32(
+                begin + Format::HeaderLen + (col * sizeof(std::uint32_t)),
+                static_cast<std::uint32_t>(pos - begin));
+            pos = encodeColumn(m_values[col], pos);
+        }
+
+        m_blockLen = static_cast<std::size_t>(pos - begin);
+        Format::writeU32(&begin[6], static_cast<std::uint32_t>(m_blockLen));
+        m_rows = 0U;
+    }
+
+    std::uint8_t* encodeColumn(const std::int64_t* values, std::uint8_t* pos)
+    {
+        // Choose the delta order resulting in the narrowest packed values
+        std::uint64_t orMasks[Format::MaxOrder + 1] = {0U};
+        for (std::size_t row = 0U; row < m_rows; ++row) {
+            for (std::size_t order = 0U; order <= Format::MaxOrder; ++order) {
+                if (order <= row) {
+                    orMasks[order] |= Format::zigzag(delta(values, row, order));
+                }
+            }
+        }
+
+        std::size_t bestOrder = 0U;
+        auto bestWidth = Format::bitWidth(orMasks[0]);
+        for (std::size_t order = 1U; (order <= Format::MaxOrder) && (order < m_rows); ++order) {
+            auto width = Format::bitWidth(orMasks[order]);
+            if (width < bestWidth) {
+                bestOrder = order;
+                bestWidth = width;
+            }
+        }
+
+        *pos = static_cast<std::uint8_t>(bestOrder);
+        ++pos;
+        *pos = static_cast<std::uint8_t>(bestWidth);
+        ++pos;
+        for (std::size_t row = 0U; row < bestOrder; ++row) {
+            pos = writeVarint(Format::zigzag(delta(values, row, row)), pos);
+        }
+
+        details::BitPacker packer(pos);
+        for (std::size_t row = bestOrder; row < m_rows; ++row) {
+            packer.write(Format::zigzag(delta(values, row, bestOrder)), bestWidth);
+        }
+        return packer.finish();
+    }
+
+    static std::int64_t delta(const std::int64_t* values, std::size_t row, std::size_t order)
+    {
+        if (order == 0U) {
+            return values[row];
+        }
+
+        if (order == 1U) {
+            return values[row] - values[row - 1];
+        }
+
+        return (values[row] - values[row - 1]) - (values[row - 1] - values[row - 2]);
+    }
+
+    static std::uint8_t* writeVarint(std::uint64_t value, std::uint8_t* pos)
+    {
+        while (0x80 <= value) {
+            *pos = static_cast<std::uint8_t>(value | 0x80);
+            ++pos;
+            value >>= 7;
+        }
+        *pos = static_cast<std::uint8_t>(value);
+        ++pos;
+        return pos;
+    }
+
+    std::int64_t m_values[details::PvtBlockFormat::ColumnsCount][TBlockRows];
+    std::uint8_t m_block[MaxBlockLen];
+    std::size_t m_rows = 0U;
+    std::size_t m_blockLen = 0U;
+};
+
+/// @brief Reader of the blocks produced by @ref PvtRecorder.
+/// @details Every column can be decoded independently without touching
+///     the data of other columns.
+class PvtBlockReader
+{
+    typedef details::PvtBlockFormat Format;
+
+public:
+    /// @brief Streaming decoder of the single column.
+    class ColumnReader
+    {
+    public:
+        /// @brief Constructor of the invalid reader.
+        ColumnReader()
+          : m_unpacker(nullptr, nullptr)
+        {
+        }
+
+        /// @brief Get next value of the column.
+        /// @return @b false when there are no more values or the data is malformed.
+        bool next(std::int64_t& value)
+        {
+            if (m_rows <= m_row) {
+                return false;
+            }
+
+            std::int64_t delta = 0;
+            if (m_row < m_order) {
+                std::uint64_t raw = 0U;
+                if (!readVarint(raw)) {
+                    m_rows = 0U;
+                    return false;
+                }
+                delta = Format::unzigzag(raw);
+            }
+            else {
+                std::uint64_t raw = 0U;
+                if (!m_unpacker.read(raw, m_width)) {
+                    m_rows = 0U;
+                    return false;
+                }
+                delta = Format::unzigzag(raw);
+            }
+
+            value = integrate(delta);
+            ++m_row;
+            return true;
+        }
+
+        /// @brief Number of values remaining to read.
+        std::size_t remaining() const
+        {
+            return m_rows - m_row;
+        }
+
+    private:
+        friend class PvtBlockReader;
+
+        ColumnReader(const std::uint8_t* pos, const std::uint8_t* end, std::size_t rows)
+          : m_unpacker(nullptr, nullptr),
+            m_rows(rows)
+        {
+            if ((end - pos) < static_cast<std::ptrdiff_t>(Format::ColumnHeaderLen)) {
+                m_rows = 0U;
+                return;
+            }
+
+            m_order = pos[0];
+            m_width = pos[1];
+            if ((Format::MaxOrder < m_order) || (64U < m_width)) {
+                m_rows = 0U;
+                return;
+            }
+
+            m_pos = pos + Format::ColumnHeaderLen;
+            m_end = end;
+            const std::uint8_t* packed = m_pos;
+            for (std::size_t idx = 0U; idx < m_order; ++idx) {
+                while ((packed != end) && ((*packed & 0x80) != 0U)) {
+                    ++packed;
+                }
+
+                if (packed == end) {
+                    m_rows = 0U;
+                    return;
+                }
+                ++packed;
+            }
+            m_unpacker = details::BitUnpacker(packed, end);
+        }
+
+        bool readVarint(std::uint64_t& value)
+        {
+            value = 0U;
+            unsigned shift = 0U;
+            while ((m_pos != m_end) && (shift < 64U)) {
+                auto byte = *m_pos;
+                ++m_pos;
+                value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                if ((byte & 0x80) == 0U) {
+                    return true;
+                }
+                shift += 7U;
+            }
+            return false;
+        }
+
+        std::int64_t integrate(std::int64_t delta)
+        {
+            // m_prev[0] is last value, m_prev[1] is last first order delta
+            if (m_order == 0U) {
+                return delta;
+            }
+
+            if (m_order == 1U) {
+                m_prev[0] = (m_row == 0U) ? delta : (m_prev[0] + delta);
+                return m_prev[0];
+            }
+
+            if (m_row == 0U) {
+                m_prev[0] = delta;
+                return m_prev[0];
+            }
+
+            if (m_row == 1U) {
+                m_prev[1] = delta;
+            }
+            else {
+                m_prev[1] += delta;
+            }
+            m_prev[0] += m_prev[1];
+            return m_prev[0];
+        }
+
+        details::BitUnpacker m_unpacker;
+        const std::uint8_t* m_pos = nullptr;
+        const std::uint8_t* m_end = nullptr;
+        std::size_t m_rows = 0U;
+        std::size_t m_row = 0U;
+        std::size_t m_order = 0U;
+        unsigned m_width = 0U;
+        std::int64_t m_prev[Format::MaxOrder] = {0, 0};
+    };
+
+    /// @brief Constructor
+    /// @param[in] data Beginning of the block.
+    /// @param[in] len Number of available bytes, may exceed the block length.
+    PvtBlockReader(const std::uint8_t* data, std::size_t len)
+      : m_data(data)
+    {
+        if ((len < (Format::HeaderLen + Format::DirectoryLen)) ||
+            (data[0] != Format::Magic0) ||
+            (data[1] != Format::Magic1) ||
+            (data[2] != Format::Version) ||
+            (data[3] != Format::ColumnsCount)) {
+            return;
+        }
+
+        auto blockLen = Format::readU32(&data[6]);
+        if (len < blockLen) {
+            return;
+        }
+
+        m_rows = Format::readU16(&data[4]);
+        m_len = blockLen;
+    }
+
+    /// @brief Check whether the block header is valid.
+    bool valid() const
+    {
+        return m_len != 0U;
+    }
+
+    /// @brief Length of the whole block, allows iteration over the
+    ///     sequence of stored blocks.
+    std::size_t length() const
+    {
+        return m_len;
+    }
+
+    /// @brief Number of rows in the block.
+    std::size_t rows() const
+    {
+        return m_rows;
+    }
+
+    /// @brief Get streaming reader of the column.
+    ColumnReader column(PvtColumn col) const
+    {
+        auto idx = static_cast<std::size_t>(col);
+        if ((!valid()) || (Format::ColumnsCount <= idx)) {
+            return ColumnReader();
+        }
+
+        auto offset = Format::readU32(m_data + Format::HeaderLen + (idx * sizeof(std::uint32_t)));
+        std::size_t end = m_len;
+        if ((idx + 1) < Format::ColumnsCount) {
+            end = Format::readU32(m_data + Format::HeaderLen + ((idx + 1) * sizeof(std::uint32_t)));
+        }
+
+        if ((end < offset) || (m_len < end)) {
+            return ColumnReader();
+        }
+
+        return ColumnReader(m_data + offset, m_data + end, m_rows);
+    }
+
+    /// @brief Decode the whole column.
+    /// @param[in] col Column.
+    /// @param[out] values Output buffer.
+    /// @param[in] capacity Capacity of the output buffer.
+    /// @return Number of decoded values.
+    std::size_t decode(PvtColumn col, std::int64_t* values, std::size_t capacity) const
+    {
+        auto reader = column(col);
+        std::size_t count = 0U;
+        while ((count < capacity) && reader.next(values[count])) {
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    const std::uint8_t* m_data = nullptr;
+    std::size_t m_len = 0U;
+    std::size_t m_rows = 0U;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,622 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::RawxArchiveEncoder and
+///     ublox::util::RawxArchiveDecoder classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include "comms/comms.h"
+#include "ublox/message/RxmRawx.h"
+#include "ublox/util/details/rtcm.h"
+#include "ublox/util/details/rawxcodec.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Type of the archive record, stored in the first byte of the
+///     record body.
+enum class RawxRecordType : std::uint8_t
+{
+    Delta, ///< Predicted from the previous records
+    Key, ///< Independent of the previous records
+    Raw, ///< Payload stored as is
+    NumOfValues ///< Number of available values
+};
+
+/// @brief Statistics of @ref RawxArchiveEncoder.
+struct RawxArchiveStats
+{
+    std::uint64_t m_records = 0U; ///< Number of produced records
+    std::uint64_t m_rawRecords = 0U; ///< Number of records storing the payload as is
+    std::uint64_t m_inputBytes = 0U; ///< Total length of the encoded payloads
+    std::uint64_t m_outputBytes = 0U; ///< Total length of the produced records
+};
+
+namespace details
+{
+
+/// @brief Maximal length of the archive record.
+static const std::size_t RawxMaxRecordLen = 16U * 1024U;
+
+/// @brief Maximal length of the record length prefix.
+static const std::size_t RawxMaxPrefixLen = 3U;
+
+/// @brief Write run length coded column of bytes, the runs of the values
+///     equal to the references are coded by Elias gamma code.
+inline void rawxWriteRuns(RtcmBitWriter& writer, const std::uint8_t* values, const std::uint8_t* refs, std::size_t count)
+{
+    std::uint64_t run = 0U;
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        if (values[idx] == refs[idx]) {
+            ++run;
+            continue;
+        }
+
+        auto len = rawxBitLength(run + 1U);
+        writer.append(0U, len - 1U);
+        writer.append(run + 1U, len);
+        writer.append(values[idx], 8U);
+        run = 0U;
+    }
+
+    if (run != 0U) {
+        auto len = rawxBitLength(run + 1U);
+        writer.append(0U, len - 1U);
+        writer.append(run + 1U, len);
+    }
+}
+
+/// @brief Read column written by @ref rawxWriteRuns().
+inline bool rawxReadRuns(RtcmBitReader& reader, std::uint8_t* values, const std::uint8_t* refs, std::size_t count)
+{
+    static const unsigned MaxRunBits = 9U;
+
+    std::size_t idx = 0U;
+    while (idx < count) {
+        unsigned zeroes = 0U;
+        while (reader.read(1U) == 0U) {
+            ++zeroes;
+            if ((MaxRunBits < zeroes) || reader.overflow()) {
+                return false;
+            }
+        }
+
+        auto run = ((static_cast<std::uint64_t>(1U) << zeroes) | reader.read(zeroes)) - 1U;
+        if ((count - idx) < run) {
+            return false;
+        }
+
+        for (auto end = idx + run; idx < end; ++idx) {
+            values[idx] = refs[idx];
+        }
+
+        if (idx < count) {
+            values[idx] = static_cast<std::uint8_t>(reader.read(8U));
+            ++idx;
+        }
+    }
+    return !reader.overflow();
+}
+
+/// @brief Write column of values packed with common bit width.
+inline void rawxWritePacked(RtcmBitWriter& writer, const std::uint64_t* values, std::size_t count)
+{
+    static const unsigned MaxChunk = 32U;
+
+    std::uint64_t all = 0U;
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        all |= values[idx];
+    }
+
+    auto width = rawxBitLength(all);
+    writer.append(width, 7U);
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        if (MaxChunk < width) {
+            writer.append(values[idx] >> MaxChunk, width - MaxChunk);
+            writer.append(values[idx], MaxChunk);
+            continue;
+        }
+        writer.append(values[idx], width);
+    }
+}
+
+/// @brief Read column written by @ref rawxWritePacked().
+inline bool rawxReadPacked(RtcmBitReader& reader, std::uint64_t* values, std::size_t count)
+{
+    static const unsigned MaxWidth = 64U;
+
+    auto width = static_cast<unsigned>(reader.read(7U));
+    if (MaxWidth < width) {
+        return false;
+    }
+
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        values[idx] = reader.read(width);
+    }
+    return !reader.overflow();
+}
+
+}  // namespace details
+
+/// @brief Lossless encoder of RXM-RAWX payloads into compact archive
+///     records.
+/// @details Every payload is encoded into the record consisting of the
+///     length of the record body (LEB128 encoded), followed by the body.
+///     The body contains the header values and the measurement values as
+///     columns: the identities (gnssId, svId, reserved2, freqId) and the
+///     rarely changing bytes (cno, standard deviations, trkStat) as runs of
+///     the values equal to the previous ones, Doppler, lock time,
+///     pseudorange, and carrier phase as the bit packed differences of
+///     their binary representation from the predictions. The pseudorange
+///     and carrier phase are predicted from the previous values of the
+///     same signal and the mean Doppler, the predictions are calculated by
+///     the integer arithmetic to be reproduced bit exactly by
+///     @ref RawxArchiveDecoder on any platform.
+///
+///     The record of the payload not matching RXM-RAWX layout (or not
+///     compressible) stores the payload as is. The encoder doesn't
+///     allocate any memory, the records are built in the internal buffer
+///     and passed to the output function object.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const std::uint8_t* data, std::size_t len) @endcode.
+template <typename TOutput>
+class RawxArchiveEncoder
+{
+    typedef details::RawxCodecModel Model;
+
+public:
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] keyInterval Number of records between the key records
+    ///     (independent of the previous ones), 0 to produce only the
+    ///     first one.
+    explicit RawxArchiveEncoder(TOutput output, unsigned keyInterval = 0U)
+      : m_output(std::move(output)),
+        m_keyInterval(keyInterval)
+    {
+    }
+
+    /// @brief Make the next record the key one.
+    void reset()
+    {
+        m_sinceKey = 0U;
+    }
+
+    /// @brief Encode RXM-RAWX message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmRawx<TMsgBase, TDataOpt>& msg)
+    {
+        auto len = msg.doLength();
+        std::uint8_t* iter = &m_payload[0];
+        if ((details::RawxMaxPayloadLen < len) || (msg.doWrite(iter, len) != comms::ErrorStatus::Success)) {
+            return;
+        }
+
+        encode(&m_payload[0], len);
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Encode payload of RXM-RAWX message.
+    void encode(const std::uint8_t* payload, std::size_t len)
+    {
+        auto* body = &m_record[details::RawxMaxPrefixLen];
+        std::size_t bodyLen = 0U;
+        auto numMeas = (details::RawxHeaderLen <= len) ? payload[11] : 0U;
+        auto matches = (details::RawxHeaderLen <= len) &&
+            (len == (details::RawxHeaderLen + (numMeas * details::RawxMeasLen)));
+
+        if (matches) {
+            auto key = (m_sinceKey == 0U);
+            if (key) {
+                m_model.reset();
+            }
+
+            bodyLen = encodeBody(payload, numMeas, key, body);
+            if (len < bodyLen) {
+                bodyLen = 0U; // Not compressible
+            }
+        }
+
+        if (bodyLen == 0U) {
+            body[0] = static_cast<std::uint8_t>(RawxRecordType::Raw);
+            std::memcpy(&body[1], payload, len);
+            bodyLen = len + 1U;
+            m_sinceKey = 0U; // The decoder resets its state
+            ++m_stats.m_rawRecords;
+        }
+        else {
+            ++m_sinceKey;
+            if ((m_keyInterval != 0U) && (m_keyInterval <= m_sinceKey)) {
+                m_sinceKey = 0U;
+            }
+        }
+
+        // Length prefix immediately before the body
+        std::size_t prefixLen = 1U;
+        while ((bodyLen >> (7U * prefixLen)) != 0U) {
+            ++prefixLen;
+        }
+
+        auto* start = body - prefixLen;
+        for (std::size_t idx = 0U; idx < prefixLen; ++idx) {
+            auto more = (idx + 1U) < prefixLen;
+            start[idx] = static_cast<std::uint8_t>(((bodyLen >> (7U * idx)) & 0x7fU) | (more ? 0x80U : 0U));
+        }
+
+        auto recordLen = prefixLen + bodyLen;
+        m_output(start, recordLen);
+        ++m_stats.m_records;
+        m_stats.m_inputBytes += len;
+        m_stats.m_outputBytes += recordLen;
+    }
+
+    /// @brief Get statistics.
+    const RawxArchiveStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    std::size_t encodeBody(const std::uint8_t* payload, std::size_t count, bool key, std::uint8_t* body)
+    {
+        body[0] = static_cast<std::uint8_t>(key ? RawxRecordType::Key : RawxRecordType::Delta);
+        details::RtcmBitWriter writer(&body[1]);
+
+        // Header
+        auto tow = details::rawxLoad<std::uint64_t>(&payload[0]);
+        auto week = details::rawxLoad<std::uint16_t>(&payload[8]);
+        m_values[0] = details::rawxZigZag(static_cast<std::int64_t>(tow - m_model.predictTow()));
+        details::rawxWritePacked(writer, &m_values[0], 1U);
+        writeChanged(writer, week, m_model.prevWeek(), 16U);
+        writer.append(count, 8U);
+        for (auto offset : details::RawxHeaderMiscOffsets) {
+            writeChanged(writer, payload[offset], m_model.prevHeaderByte(offset), 8U);
+        }
+        m_model.beginEpoch(payload);
+
+        // Identities
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto* block = &payload[details::RawxHeaderLen + (idx * details::RawxMeasLen)];
+            auto& meas = m_meas[idx];
+            meas.m_pr = details::rawxLoad<std::uint64_t>(&block[0]);
+            meas.m_cp = details::rawxLoad<std::uint64_t>(&block[8]);
+            meas.m_doppler = details::rawxLoad<std::uint32_t>(&block[16]);
+            meas.m_locktime = details::rawxLoad<std::uint16_t>(&block[24]);
+            for (std::size_t id = 0U; id < details::RawxIdCount; ++id) {
+                meas.m_ids[id] = block[details::RawxIdOffsets[id]];
+            }
+            for (std::size_t aux = 0U; aux < details::RawxAuxCount; ++aux) {
+                meas.m_aux[aux] = block[details::RawxAuxOffsets[aux]];
+            }
+        }
+
+        for (std::size_t id = 0U; id < details::RawxIdCount; ++id) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                m_bytes[idx] = m_meas[idx].m_ids[id];
+                m_refs[idx] = m_model.prevId(idx, id);
+            }
+            details::rawxWriteRuns(writer, &m_bytes[0], &m_refs[0], count);
+        }
+
+        // Predicted values
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto& meas = m_meas[idx];
+            m_keys[idx] = Model::keyOf(&meas.m_ids[0]);
+            m_model.predict(m_keys[idx], &meas.m_ids[0], meas.m_doppler, m_preds[idx]);
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto diff = static_cast<std::int32_t>(m_meas[idx].m_doppler - m_model.predictDoppler(m_keys[idx]));
+            m_values[idx] = details::rawxZigZag(diff);
+        }
+        details::rawxWritePacked(writer, &m_values[0], count);
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto diff = static_cast<std::int16_t>(m_meas[idx].m_locktime - m_preds[idx].m_locktime);
+            m_values[idx] = details::rawxZigZag(diff);
+        }
+        details::rawxWritePacked(writer, &m_values[0], count);
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            m_values[idx] = details::rawxZigZag(static_cast<std::int64_t>(m_meas[idx].m_pr - m_preds[idx].m_pr));
+        }
+        details::rawxWritePacked(writer, &m_values[0], count);
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            m_values[idx] = details::rawxZigZag(static_cast<std::int64_t>(m_meas[idx].m_cp - m_preds[idx].m_cp));
+        }
+        details::rawxWritePacked(writer, &m_values[0], count);
+
+        for (std::size_t aux = 0U; aux < details::RawxAuxCount; ++aux) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                m_bytes[idx] = m_meas[idx].m_aux[aux];
+                m_refs[idx] = m_preds[idx].m_aux[aux];
+            }
+            details::rawxWriteRuns(writer, &m_bytes[0], &m_refs[0], count);
+        }
+
+        writer.flush();
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            m_model.update(m_keys[idx], m_meas[idx]);
+        }
+        m_model.endEpoch(&m_meas[0], count);
+        return writer.bytes() + 1U;
+    }
+
+    static void writeChanged(details::RtcmBitWriter& writer, unsigned value, unsigned prev, unsigned len)
+    {
+        if (value == prev) {
+            writer.append(0U, 1U);
+            return;
+        }
+
+        writer.append(1U, 1U);
+        writer.append(value, len);
+    }
+
+    TOutput m_output;
+    unsigned m_keyInterval = 0U;
+    unsigned m_sinceKey = 0U;
+    RawxArchiveStats m_stats;
+    Model m_model;
+    Model::Meas m_meas[details::RawxMaxMeas];
+    Model::Prediction m_preds[details::RawxMaxMeas];
+    std::size_t m_keys[details::RawxMaxMeas];
+    std::uint64_t m_values[details::RawxMaxMeas];
+    std::uint8_t m_bytes[details::RawxMaxMeas];
+    std::uint8_t m_refs[details::RawxMaxMeas];
+    std::uint8_t m_payload[details::RawxMaxPayloadLen];
+    std::uint8_t m_record[details::RawxMaxPrefixLen + details::RawxMaxRecordLen];
+};
+
+/// @brief Decoder of the records produced by @ref RawxArchiveEncoder back
+///     into RXM-RAWX payloads.
+/// @details The records must be decoded in the order they were produced,
+///     starting from the first (or any key) record. The decoded payload is
+///     bit exact copy of the encoded one and may be read into RXM-RAWX
+///     message object or framed by the protocol stack.
+class RawxArchiveDecoder
+{
+    typedef details::RawxCodecModel Model;
+
+public:
+    /// @brief Decode single record.
+    /// @param[in, out] iter Iterator to the record, advanced past it on
+    ///     success.
+    /// @param[in] len Number of bytes available.
+    /// @return @b comms::ErrorStatus::Success on success,
+    ///     @b comms::ErrorStatus::NotEnoughData if the record is not
+    ///     complete, @b comms::ErrorStatus::ProtocolError if it's malformed
+    ///     (or not preceded by the key record).
+    comms::ErrorStatus decode(const std::uint8_t*& iter, std::size_t len)
+    {
+        std::size_t bodyLen = 0U;
+        std::size_t prefixLen = 0U;
+        while (true) {
+            if (len <= prefixLen) {
+                return comms::ErrorStatus::NotEnoughData;
+            }
+
+            if (details::RawxMaxPrefixLen <= prefixLen) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            auto byte = iter[prefixLen];
+            bodyLen |= static_cast<std::size_t>(byte & 0x7fU) << (7U * prefixLen);
+            ++prefixLen;
+            if ((byte & 0x80U) == 0U) {
+                break;
+            }
+        }
+
+        if ((bodyLen == 0U) || (details::RawxMaxRecordLen < bodyLen)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (len < (prefixLen + bodyLen)) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto* body = iter + prefixLen;
+        auto type = static_cast<RawxRecordType>(body[0]);
+        if (type == RawxRecordType::Raw) {
+            if (details::RawxMaxPayloadLen < (bodyLen - 1U)) {
+                return comms::ErrorStatus::ProtocolError;
+            }
+
+            std::memcpy(&m_payload[0], &body[1], bodyLen - 1U);
+            m_payloadLen = bodyLen - 1U;
+            m_synced = false; // The next record is the key one
+            iter += prefixLen + bodyLen;
+            return comms::ErrorStatus::Success;
+        }
+
+        if ((type != RawxRecordType::Key) && ((type != RawxRecordType::Delta) || (!m_synced))) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        if (type == RawxRecordType::Key) {
+            m_model.reset();
+        }
+
+        if (!decodeBody(&body[1], bodyLen - 1U)) {
+            m_synced = false;
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        m_synced = true;
+        iter += prefixLen + bodyLen;
+        return comms::ErrorStatus::Success;
+    }
+
+    /// @brief Payload of the last decoded record.
+    const std::uint8_t* payload() const
+    {
+        return &m_payload[0];
+    }
+
+    /// @brief Length of the payload of the last decoded record.
+    std::size_t payloadLength() const
+    {
+        return m_payloadLen;
+    }
+
+private:
+    bool decodeBody(const std::uint8_t* data, std::size_t len)
+    {
+        details::RtcmBitReader reader(data, len);
+
+        // Header
+        std::uint64_t towDiff = 0U;
+        if (!details::rawxReadPacked(reader, &towDiff, 1U)) {
+            return false;
+        }
+
+        auto tow = m_model.predictTow() + static_cast<std::uint64_t>(details::rawxUnZigZag(towDiff));
+        auto week = static_cast<std::uint16_t>(readChanged(reader, m_model.prevWeek(), 16U));
+        auto count = static_cast<std::size_t>(reader.read(8U));
+        std::uint8_t* header = &m_payload[0];
+        details::rawxStore(&header[0], tow);
+        details::rawxStore(&header[8], week);
+        header[11] = static_cast<std::uint8_t>(count);
+        for (auto offset : details::RawxHeaderMiscOffsets) {
+            header[offset] = static_cast<std::uint8_t>(readChanged(reader, m_model.prevHeaderByte(offset), 8U));
+        }
+
+        if (reader.overflow()) {
+            return false;
+        }
+        m_model.beginEpoch(header);
+
+        // Identities
+        for (std::size_t id = 0U; id < details::RawxIdCount; ++id) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                m_refs[idx] = m_model.prevId(idx, id);
+            }
+
+            if (!details::rawxReadRuns(reader, &m_bytes[0], &m_refs[0], count)) {
+                return false;
+            }
+
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                m_meas[idx].m_ids[id] = m_bytes[idx];
+            }
+        }
+
+        // Predicted values
+        if ((!details::rawxReadPacked(reader, &m_doppler[0], count)) ||
+            (!details::rawxReadPacked(reader, &m_locktime[0], count)) ||
+            (!details::rawxReadPacked(reader, &m_pr[0], count)) ||
+            (!details::rawxReadPacked(reader, &m_cp[0], count))) {
+            return false;
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto& meas = m_meas[idx];
+            auto& pred = m_preds[idx];
+            m_keys[idx] = Model::keyOf(&meas.m_ids[0]);
+            meas.m_doppler =
+                m_model.predictDoppler(m_keys[idx]) + static_cast<std::uint32_t>(details::rawxUnZigZag(m_doppler[idx]));
+            m_model.predict(m_keys[idx], &meas.m_ids[0], meas.m_doppler, pred);
+            meas.m_locktime =
+                static_cast<std::uint16_t>(pred.m_locktime + static_cast<std::uint16_t>(details::rawxUnZigZag(m_locktime[idx])));
+            meas.m_pr = pred.m_pr + static_cast<std::uint64_t>(details::rawxUnZigZag(m_pr[idx]));
+            meas.m_cp = pred.m_cp + static_cast<std::uint64_t>(details::rawxUnZigZag(m_cp[idx]));
+        }
+
+        for (std::size_t aux = 0U; aux < details::RawxAuxCount; ++aux) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                m_refs[idx] = m_preds[idx].m_aux[aux];
+            }
+
+            if (!details::rawxReadRuns(reader, &m_bytes[0], &m_refs[0], count)) {
+                return false;
+            }
+
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                m_meas[idx].m_aux[aux] = m_bytes[idx];
+            }
+        }
+
+        // Payload
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto& meas = m_meas[idx];
+            auto* block = &m_payload[details::RawxHeaderLen + (idx * details::RawxMeasLen)];
+            details::rawxStore(&block[0], meas.m_pr);
+            details::rawxStore(&block[8], meas.m_cp);
+            details::rawxStore(&block[16], meas.m_doppler);
+            details::rawxStore(&block[24], meas.m_locktime);
+            for (std::size_t id = 0U; id < details::RawxIdCount; ++id) {
+                block[details::RawxIdOffsets[id]] = meas.m_ids[id];
+            }
+            for (std::size_t aux = 0U; aux < details::RawxAuxCount; ++aux) {
+                block[details::RawxAuxOffsets[aux]] = meas.m_aux[aux];
+            }
+        }
+        m_payloadLen = details::RawxHeaderLen + (count * details::RawxMeasLen);
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            m_model.update(m_keys[idx], m_meas[idx]);
+        }
+        m_model.endEpoch(&m_meas[0], count);
+        return true;
+    }
+
+    static unsigned readChanged(details::RtcmBitReader& reader, unsigned prev, unsigned len)
+    {
+        if (reader.read(1U) == 0U) {
+            return prev;
+        }
+        return static_cast<unsigned>(reader.read(len));
+    }
+
+    Model m_model;
+    bool m_synced = false;
+    Model::Meas m_meas[details::RawxMaxMeas];
+    Model::Prediction m_preds[details::RawxMaxMeas];
+    std::size_t m_keys[details::RawxMaxMeas];
+    std::uint64_t m_doppler[details::RawxMaxMeas];
+    std::uint64_t m_locktime[details::RawxMaxMeas];
+    std::uint64_t m_pr[details::RawxMaxMeas];
+    std::uint64_t m_cp[details::RawxMaxMeas];
+    std::uint8_t m_bytes[details::RawxMaxMeas];
+    std::uint8_t m_refs[details::RawxMaxMeas];
+    std::uint8_t m_payload[details::RawxMaxPayloadLen];
+    std::size_t m_payloadLen = 0U;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
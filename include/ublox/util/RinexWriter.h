@@ -0,0 +1,1150 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::RinexObsWriter and
+///     ublox::util::RinexNavWriter classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include <algorithm>
+
+#include "ublox/field/common.h"
+#include "ublox/message/RxmRawx.h"
+#include "ublox/util/TextBuffer.h"
+#include "ublox/util/TimeService.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/NavDataDecoder.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Information written into RINEX headers.
+struct RinexHeaderInfo
+{
+    std::string m_program = "ublox"; ///< Name of the program creating the file
+    std::string m_runBy; ///< Name of the agency creating the file
+    std::string m_date; ///< Date of the file creation (yyyymmdd hhmmss UTC)
+    std::string m_markerName = "UNKNOWN"; ///< Name of the antenna marker
+    std::string m_observer; ///< Name of the observer
+    std::string m_agency; ///< Name of the observer's agency
+    std::string m_receiverNumber; ///< Receiver serial number
+    std::string m_receiverType = "UBLOX"; ///< Receiver type
+    std::string m_receiverVersion; ///< Receiver firmware version
+    std::string m_antennaNumber; ///< Antenna serial number
+    std::string m_antennaType; ///< Antenna type
+    double m_approxPos[3] = {0.0, 0.0, 0.0}; ///< Approximate marker position (ECEF), m
+    double m_antennaDelta[3] = {0.0, 0.0, 0.0}; ///< Antenna height, eccentricities east and north, m
+    double m_interval = 0.0; ///< Observation interval, s (0 if not known)
+};
+
+namespace details
+{
+
+/// @brief Single measurement of @b RXM-RAWX message.
+struct RinexMeas
+{
+    double m_pr; ///< Pseudorange, m
+    double m_cp; ///< Carrier phase, cycles
+    float m_doppler; ///< Doppler, Hz
+    std::uint16_t m_locktime; ///< Carrier phase lock time, ms
+    std::uint8_t m_gnssId; ///< GNSS identifier
+    std::uint8_t m_svId; ///< Satellite identifier
+    std::uint8_t m_freqId; ///< GLONASS frequency slot + 7
+    std::uint8_t m_cno; ///< Carrier to noise ratio, dBHz
+    std::uint8_t m_trkStat; ///< Tracking status
+};
+
+/// @brief Measurement epoch of @b RXM-RAWX message.
+struct RinexEpoch
+{
+    static const std::size_t MaxMeas = 128U;
+
+    std::int64_t m_gpsNs; ///< GPS time since GPS epoch, ns
+    std::uint16_t m_count; ///< Number of measurements
+    RinexMeas m_meas[MaxMeas];
+};
+
+/// @brief Buffer of formatted text flushed to the output in large blocks.
+template <typename TOutput>
+class RinexBlockBuffer
+{
+public:
+    RinexBlockBuffer(TOutput&& output, std::size_t blockSize)
+      : m_output(std::move(output)),
+        m_storage(blockSize),
+        m_buf(&m_storage[0], m_storage.size())
+    {
+    }
+
+    TextBuffer& text()
+    {
+        return m_buf;
+    }
+
+    /// @brief Make sure there is enough space for the text of specified
+    ///     length, flushes the block otherwise.
+    TextBuffer& reserve(std::size_t len)
+    {
+        if (m_buf.remaining() < len) {
+            flush();
+        }
+        return m_buf;
+    }
+
+    void flush()
+    {
+        if (m_buf.size() != 0U) {
+            m_output(m_buf.data(), m_buf.size());
+            m_buf.clear();
+        }
+    }
+
+private:
+    TOutput m_output;
+    std::vector<char> m_storage;
+    TextBuffer m_buf;
+};
+
+static const std::size_t RinexLabelPos = 60U;
+static const unsigned RinexVersionHundredths = 303U;
+
+/// @brief Finish the header line started at @b lineStart with the label.
+inline void rinexLabel(TextBuffer& buf, std::size_t lineStart, const char* label)
+{
+    auto len = buf.size() - lineStart;
+    if (len < RinexLabelPos) {
+        buf.appendFill(' ', RinexLabelPos - len);
+    }
+    buf.append(label);
+    buf.append('\n');
+}
+
+/// @brief Write common part of the "RINEX VERSION / TYPE" and
+///     "PGM / RUN BY / DATE" header lines.
+inline void rinexHeaderStart(TextBuffer& buf, const char* type, const RinexHeaderInfo& info)
+{
+    auto start = buf.size();
+    buf.appendFixedWidth(RinexVersionHundredths / 100.0, 9U, 2U);
+    buf.appendFill(' ', 11U);
+    buf.appendPadded(type, 20U);
+    buf.appendPadded("M", 20U);
+    rinexLabel(buf, start, "RINEX VERSION / TYPE");
+
+    start = buf.size();
+    buf.appendPadded(info.m_program.c_str(), 20U);
+    buf.appendPadded(info.m_runBy.c_str(), 20U);
+    buf.appendPadded(info.m_date.c_str(), 20U);
+    rinexLabel(buf, start, "PGM / RUN BY / DATE");
+}
+
+/// @brief Write two digits integer.
+inline void rinexTwoDigits(TextBuffer& buf, unsigned value)
+{
+    buf.appendUnsignedPadded(value, 2U, '0');
+}
+
+/// @brief Calendar date and time of the seconds since GPS epoch, the time
+///     scale (GPS, Galileo, BeiDou, UTC) is not changed.
+inline UtcDateTime rinexDateTime(std::int64_t gpsSec)
+{
+    return toUtcDateTime((gpsSec + GpsEpochUnixSec) * NsPerSec);
+}
+
+/// @brief Satellite system letter of RINEX, 0 for unsupported system.
+inline char rinexSystem(field::common::GnssId gnssId)
+{
+    static const char Letters[] = {'G', 'S', 'E', 'C', 0, 'J', 'R'};
+    auto idx = static_cast<std::size_t>(gnssId);
+    if (sizeof(Letters) <= idx) {
+        return 0;
+    }
+    return Letters[idx];
+}
+
+/// @brief Satellite number within the system as written by RINEX.
+inline unsigned rinexSvNum(field::common::GnssId gnssId, unsigned svId)
+{
+    static const unsigned SbasPrnOffset = 100U;
+    if (gnssId == field::common::GnssId::Sbas) {
+        return svId - SbasPrnOffset;
+    }
+    return svId;
+}
+
+/// @brief Write the satellite identifier (e.g. "G05").
+inline void rinexSatellite(TextBuffer& buf, field::common::GnssId gnssId, unsigned svId)
+{
+    buf.append(rinexSystem(gnssId));
+    rinexTwoDigits(buf, rinexSvNum(gnssId, svId) % 100U);
+}
+
+}  // namespace details
+
+/// @brief Streaming writer of RINEX 3.03 observation file from @b RXM-RAWX
+///     messages.
+/// @details Every epoch is written with pseudorange, carrier phase, Doppler,
+///     and carrier to noise ratio of the single signal tracked by the
+///     receiver per satellite (L1 C/A, E1 C, B1I), loss of lock indicator
+///     is derived from the lock time and half cycle validity. The header is
+///     written at the first epoch (it lists GLONASS frequency numbers of the
+///     satellites observed at that epoch).
+///
+///     The numbers are formatted by @ref TextBuffer into large block, which
+///     is passed to the output when full or on @ref flush(). Optionally
+///     (see @ref startWorker()) the epochs are copied into the queue and
+///     formatted by separate thread.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const char* data, std::size_t len) @endcode.
+template <typename TOutput>
+class RinexObsWriter
+{
+    typedef field::common::GnssId GnssId;
+    typedef details::RinexEpoch Epoch;
+
+public:
+    /// @brief Default size of the output block.
+    static const std::size_t DefaultBlockSize = 1024U * 1024U;
+
+    /// @brief Default number of the epochs queued for the worker thread.
+    static const std::size_t DefaultQueueDepth = 64U;
+
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] info Header information.
+    /// @param[in] blockSize Size of the output block.
+    explicit RinexObsWriter(
+        TOutput output,
+        const RinexHeaderInfo& info = RinexHeaderInfo(),
+        std::size_t blockSize = DefaultBlockSize)
+      : m_info(info),
+        m_out(std::move(output), (MinBlockSize < blockSize) ? blockSize : MinBlockSize)
+    {
+        std::memset(&m_locktime[0], 0, sizeof(m_locktime));
+    }
+
+    RinexObsWriter(const RinexObsWriter&) = delete;
+    RinexObsWriter& operator=(const RinexObsWriter&) = delete;
+
+    /// @brief Destructor, stops the worker thread and flushes the output.
+    ~RinexObsWriter()
+    {
+        stopWorker();
+        m_out.flush();
+    }
+
+    /// @brief Start formatting on the separate thread.
+    /// @details After the call the output function is invoked by the worker
+    ///     thread. The messages must still be passed by a single thread.
+    /// @param[in] queueDepth Maximal number of queued epochs, the @b handle()
+    ///     function blocks when the queue is full.
+    void startWorker(std::size_t queueDepth = DefaultQueueDepth)
+    {
+        if (m_worker.joinable()) {
+            return;
+        }
+
+        m_queue.resize(std::max(queueDepth, static_cast<std::size_t>(1U)));
+        m_head = 0U;
+        m_count = 0U;
+        m_stop = false;
+        m_worker = std::thread([this]() { workerLoop(); });
+    }
+
+    /// @brief Format all the queued epochs and stop the worker thread.
+    void stopWorker()
+    {
+        if (!m_worker.joinable()) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_stop = true;
+        }
+        m_queueCond.notify_all();
+        m_worker.join();
+        m_queue.clear();
+    }
+
+    /// @brief Handle RXM-RAWX message, format (or queue) the epoch.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmRawx<TMsgBase, TDataOpt>& msg)
+    {
+        if (!m_worker.joinable()) {
+            fill(msg, m_epoch);
+            format(m_epoch);
+            return;
+        }
+
+        std::size_t tail = 0U;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_queueCond.wait(lock, [this]() { return m_count < m_queue.size(); });
+            tail = (m_head + m_count) % m_queue.size();
+        }
+
+        fill(msg, m_queue[tail]); // The slot is not accessed by the worker until queued
+
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            ++m_count;
+        }
+        m_queueCond.notify_all();
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Wait for all the queued epochs to be formatted and pass the
+    ///     partially filled block to the output.
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_queueCond.wait(lock, [this]() { return m_count == 0U; });
+        m_out.flush();
+    }
+
+    /// @brief Number of written epochs.
+    std::size_t epochs() const
+    {
+        return m_epochs;
+    }
+
+private:
+    static const std::size_t MinBlockSize = 64U * 1024U;
+    static const std::size_t MaxHeaderLen = 4096U;
+    static const std::size_t EpochLineLen = 64U;
+    static const std::size_t ObsTypesCount = 4U;
+    static const std::size_t ObsFieldLen = 16U;
+    static const std::size_t SatLineLen = 3U + (ObsTypesCount * ObsFieldLen) + 1U;
+
+    template <typename TMsg>
+    static void fill(const TMsg& msg, Epoch& epoch)
+    {
+        static const std::int64_t NsPerWeek = SecPerWeek * NsPerSec;
+
+        epoch.m_gpsNs =
+            (static_cast<std::int64_t>(msg.field_week().value()) * NsPerWeek) +
+            std::llround(msg.field_rcvTow().value() * static_cast<double>(NsPerSec));
+
+        std::size_t count = 0U;
+        for (auto& block : msg.field_data().value()) {
+            if (Epoch::MaxMeas <= count) {
+                break;
+            }
+
+            auto& meas = epoch.m_meas[count];
+            meas.m_pr = block.field_prMes().value();
+            meas.m_cp = block.field_cpMes().value();
+            meas.m_doppler = block.field_doMes().value();
+            meas.m_locktime = block.field_locktime().value();
+            meas.m_gnssId = static_cast<std::uint8_t>(block.field_gnssId().value());
+            meas.m_svId = block.field_svId().value();
+            meas.m_freqId = block.field_freqId().value();
+            meas.m_cno = block.field_cno().value();
+            meas.m_trkStat = static_cast<std::uint8_t>(details::packedValue(block.field_trkStat()));
+            ++count;
+        }
+        epoch.m_count = static_cast<std::uint16_t>(count);
+    }
+
+    void workerLoop()
+    {
+        while (true) {
+            std::size_t head = 0U;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_queueCond.wait(lock, [this]() { return (m_count != 0U) || m_stop; });
+                if (m_count == 0U) {
+                    return; // Stopped and drained
+                }
+                head = m_head;
+            }
+
+            format(m_queue[head]);
+
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                m_head = (m_head + 1U) % m_queue.size();
+                --m_count;
+            }
+            m_queueCond.notify_all();
+        }
+    }
+
+    /// @brief Select the measurements to be written, the first one of
+    ///     every supported satellite.
+    std::size_t select(const Epoch& epoch, std::uint16_t* selected)
+    {
+        static const std::uint8_t UnknownGlonassSlot = 255U;
+
+        ++m_epochStamp;
+        std::size_t count = 0U;
+        for (std::size_t idx = 0U; idx < epoch.m_count; ++idx) {
+            auto& meas = epoch.m_meas[idx];
+            auto gnssId = static_cast<GnssId>(meas.m_gnssId);
+            if ((details::rinexSystem(gnssId) == 0) ||
+                ((gnssId == GnssId::Glonass) && (meas.m_svId == UnknownGlonassSlot))) {
+                continue;
+            }
+
+            auto satIdx = SatelliteTable::indexOf(gnssId, meas.m_svId);
+            if ((SatelliteTable::Capacity <= satIdx) || (m_seenStamp[satIdx] == m_epochStamp)) {
+                continue;
+            }
+
+            m_seenStamp[satIdx] = m_epochStamp;
+            selected[count] = static_cast<std::uint16_t>(idx);
+            ++count;
+        }
+        return count;
+    }
+
+    void format(const Epoch& epoch)
+    {
+        static const std::uint8_t PrValidMask = 0x1;
+        static const std::uint8_t CpValidMask = 0x2;
+        static const std::uint8_t HalfCycValidMask = 0x4;
+        static const unsigned LliLossOfLock = 0x1;
+        static const unsigned LliHalfCycle = 0x2;
+        static const unsigned CnoPerSsi = 6U;
+        static const unsigned MaxSsi = 9U;
+
+        std::uint16_t selected[Epoch::MaxMeas];
+        auto count = select(epoch, selected);
+        if (!m_headerWritten) {
+            writeHeader(epoch, selected, count);
+        }
+
+        auto& buf = m_out.reserve(EpochLineLen + (count * SatLineLen));
+        auto sec = details::floorDiv(epoch.m_gpsNs, NsPerSec);
+        auto dateTime = details::rinexDateTime(sec);
+        auto nanoSec = epoch.m_gpsNs - (sec * NsPerSec);
+
+        buf.append("> ", 2U);
+        buf.appendUnsignedPadded(static_cast<std::uint64_t>(dateTime.year), 4U);
+        appendTime(buf, dateTime);
+        buf.append(' ');
+        buf.appendUnsignedPadded(dateTime.sec, 2U);
+        buf.append('.');
+        buf.appendUnsignedPadded(static_cast<std::uint64_t>(nanoSec / 100), 7U, '0');
+        buf.append("  0", 3U);
+        buf.appendUnsignedPadded(count, 3U);
+        buf.append('\n');
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto& meas = epoch.m_meas[selected[idx]];
+            auto gnssId = static_cast<GnssId>(meas.m_gnssId);
+            auto satIdx = SatelliteTable::indexOf(gnssId, meas.m_svId);
+            unsigned lli = 0U;
+            if (meas.m_locktime < m_locktime[satIdx]) {
+                lli |= LliLossOfLock;
+            }
+            m_locktime[satIdx] = meas.m_locktime;
+
+            if ((meas.m_trkStat & HalfCycValidMask) == 0U) {
+                lli |= LliHalfCycle;
+            }
+
+            auto ssi = std::min(std::max(meas.m_cno / CnoPerSsi, 1U), MaxSsi);
+            details::rinexSatellite(buf, gnssId, meas.m_svId);
+
+            if ((meas.m_trkStat & PrValidMask) != 0U) {
+                appendObs(buf, meas.m_pr, 0U, ssi);
+            }
+            else {
+                buf.appendFill(' ', ObsFieldLen);
+            }
+
+            if ((meas.m_trkStat & CpValidMask) != 0U) {
+                appendObs(buf, meas.m_cp, lli, ssi);
+            }
+            else {
+                buf.appendFill(' ', ObsFieldLen);
+            }
+
+            appendObs(buf, meas.m_doppler, 0U, ssi);
+            appendObs(buf, meas.m_cno, 0U, 0U);
+            buf.append('\n');
+        }
+
+        ++m_epochs;
+    }
+
+    static void appendTime(TextBuffer& buf, const UtcDateTime& dateTime)
+    {
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.month);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.day);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.hour);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.min);
+    }
+
+    static void appendObs(TextBuffer& buf, double value, unsigned lli, unsigned ssi)
+    {
+        buf.appendFixedWidth(value, 14U, 3U);
+        buf.append((lli == 0U) ? ' ' : static_cast<char>('0' + lli));
+        buf.append((ssi == 0U) ? ' ' : static_cast<char>('0' + ssi));
+    }
+
+    void writeHeader(const Epoch& epoch, const std::uint16_t* selected, std::size_t count)
+    {
+        static const struct
+        {
+            char m_system;
+            const char* m_types;
+        } ObsTypes[] = {
+            {'G', " C1C L1C D1C S1C"},
+            {'R', " C1C L1C D1C S1C"},
+            {'E', " C1C L1C D1C S1C"},
+            {'C', " C2I L2I D2I S2I"},
+            {'J', " C1C L1C D1C S1C"},
+            {'S', " C1C L1C D1C S1C"},
+        };
+
+        m_headerWritten = true;
+        auto& buf = m_out.reserve(MaxHeaderLen);
+        details::rinexHeaderStart(buf, "OBSERVATION DATA", m_info);
+
+        auto start = buf.size();
+        buf.appendPadded(m_info.m_markerName.c_str(), 60U);
+        details::rinexLabel(buf, start, "MARKER NAME");
+
+        start = buf.size();
+        buf.append("NON_GEODETIC");
+        details::rinexLabel(buf, start, "MARKER TYPE");
+
+        start = buf.size();
+        buf.appendPadded(m_info.m_observer.c_str(), 20U);
+        buf.appendPadded(m_info.m_agency.c_str(), 40U);
+        details::rinexLabel(buf, start, "OBSERVER / AGENCY");
+
+        start = buf.size();
+        buf.appendPadded(m_info.m_receiverNumber.c_str(), 20U);
+        buf.appendPadded(m_info.m_receiverType.c_str(), 20U);
+        buf.appendPadded(m_info.m_receiverVersion.c_str(), 20U);
+        details::rinexLabel(buf, start, "REC # / TYPE / VERS");
+
+        start = buf.size();
+        buf.appendPadded(m_info.m_antennaNumber.c_str(), 20U);
+        buf.appendPadded(m_info.m_antennaType.c_str(), 20U);
+        details::rinexLabel(buf, start, "ANT # / TYPE");
+
+        start = buf.size();
+        for (auto coord : m_info.m_approxPos) {
+            buf.appendFixedWidth(coord, 14U, 4U);
+        }
+        details::rinexLabel(buf, start, "APPROX POSITION XYZ");
+
+        start = buf.size();
+        for (auto delta : m_info.m_antennaDelta) {
+            buf.appendFixedWidth(delta, 14U, 4U);
+        }
+        details::rinexLabel(buf, start, "ANTENNA: DELTA H/E/N");
+
+        for (auto& types : ObsTypes) {
+            start = buf.size();
+            // A1,2X,I3,13(1X,A3)
+            buf.append(types.m_system);
+            buf.appendFill(' ', 2U);
+            buf.appendUnsignedPadded(ObsTypesCount, 3U);
+            buf.append(types.m_types);
+            details::rinexLabel(buf, start, "SYS / # / OBS TYPES");
+        }
+
+        if (0.0 < m_info.m_interval) {
+            start = buf.size();
+            buf.appendFixedWidth(m_info.m_interval, 10U, 3U);
+            details::rinexLabel(buf, start, "INTERVAL");
+        }
+
+        auto sec = details::floorDiv(epoch.m_gpsNs, NsPerSec);
+        auto dateTime = details::rinexDateTime(sec);
+        start = buf.size();
+        buf.appendUnsignedPadded(static_cast<std::uint64_t>(dateTime.year), 6U);
+        buf.appendUnsignedPadded(dateTime.month, 6U);
+        buf.appendUnsignedPadded(dateTime.day, 6U);
+        buf.appendUnsignedPadded(dateTime.hour, 6U);
+        buf.appendUnsignedPadded(dateTime.min, 6U);
+        buf.appendFixedWidth(
+            static_cast<double>(dateTime.sec) + (static_cast<double>(epoch.m_gpsNs - (sec * NsPerSec)) / NsPerSec),
+            13U, 7U);
+        buf.append("     GPS", 8U);
+        details::rinexLabel(buf, start, "TIME OF FIRST OBS");
+
+        for (auto& types : ObsTypes) {
+            static const std::size_t PhaseTypePos = 5U;
+            start = buf.size();
+            // A1,1X,A3,1X,F8.5 without satellites list, no correction of the phases of all the satellites
+            buf.append(types.m_system);
+            buf.append(' ');
+            buf.append(types.m_types + PhaseTypePos, 3U);
+            buf.appendFixedWidth(0.0, 9U, 5U);
+            details::rinexLabel(buf, start, "SYS / PHASE SHIFT");
+        }
+
+        writeGlonassSlots(buf, epoch, selected, count);
+
+        start = buf.size();
+        buf.append(" C1C    0.000 C1P    0.000 C2C    0.000 C2P    0.000");
+        details::rinexLabel(buf, start, "GLONASS COD/PHS/BIS");
+
+        start = buf.size();
+        details::rinexLabel(buf, start, "END OF HEADER");
+    }
+
+    static void writeGlonassSlots(TextBuffer& buf, const Epoch& epoch, const std::uint16_t* selected, std::size_t count)
+    {
+        static const std::size_t SlotsPerLine = 8U;
+        static const int FreqIdOffset = 7;
+
+        std::size_t glonassCount = 0U;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            if (static_cast<GnssId>(epoch.m_meas[selected[idx]].m_gnssId) == GnssId::Glonass) {
+                ++glonassCount;
+            }
+        }
+
+        auto start = buf.size();
+        buf.appendUnsignedPadded(glonassCount, 3U);
+        buf.append(' ');
+        std::size_t written = 0U;
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            auto& meas = epoch.m_meas[selected[idx]];
+            if (static_cast<GnssId>(meas.m_gnssId) != GnssId::Glonass) {
+                continue;
+            }
+
+            if ((written != 0U) && ((written % SlotsPerLine) == 0U)) {
+                details::rinexLabel(buf, start, "GLONASS SLOT / FRQ #");
+                start = buf.size();
+                buf.appendFill(' ', 4U);
+            }
+
+            details::rinexSatellite(buf, GnssId::Glonass, meas.m_svId);
+            buf.append(' ');
+            auto freqNum = static_cast<int>(meas.m_freqId) - FreqIdOffset;
+            buf.append((freqNum < 0) ? '-' : ' ');
+            buf.appendUnsigned(static_cast<std::uint64_t>((freqNum < 0) ? -freqNum : freqNum));
+            buf.append(' ');
+            ++written;
+        }
+        details::rinexLabel(buf, start, "GLONASS SLOT / FRQ #");
+    }
+
+    RinexHeaderInfo m_info;
+    details::RinexBlockBuffer<TOutput> m_out;
+    bool m_headerWritten = false;
+    std::size_t m_epochs = 0U;
+    std::uint32_t m_epochStamp = 0U;
+    std::uint32_t m_seenStamp[SatelliteTable::Capacity] = {0};
+    std::uint16_t m_locktime[SatelliteTable::Capacity];
+    Epoch m_epoch;
+
+    std::thread m_worker;
+    std::mutex m_mutex;
+    std::condition_variable m_queueCond;
+    std::vector<Epoch> m_queue;
+    std::size_t m_head = 0U;
+    std::size_t m_count = 0U;
+    bool m_stop = false;
+};
+
+/// @brief Streaming writer of RINEX 3.03 navigation file.
+/// @details Intended to be used as the handler of @ref NavDataDecoder (or
+///     to receive data of @ref EphemerisStore), writes every reported
+///     ephemeris as a record. The ionospheric and UTC parameters reported
+///     before the first ephemeris are written into the header. The
+///     ephemerides carry only the time within the week (GLONASS within the
+///     day), the complete time is resolved using the reference time
+///     (see @ref setReferenceTime()) updated by @b RXM-RAWX messages.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const char* data, std::size_t len) @endcode.
+template <typename TOutput>
+class RinexNavWriter
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Default size of the output block.
+    static const std::size_t DefaultBlockSize = 64U * 1024U;
+
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] info Header information.
+    /// @param[in] blockSize Size of the output block.
+    explicit RinexNavWriter(
+        TOutput output,
+        const RinexHeaderInfo& info = RinexHeaderInfo(),
+        std::size_t blockSize = DefaultBlockSize)
+      : m_info(info),
+        m_out(std::move(output), (MinBlockSize < blockSize) ? blockSize : MinBlockSize)
+    {
+    }
+
+    RinexNavWriter(const RinexNavWriter&) = delete;
+    RinexNavWriter& operator=(const RinexNavWriter&) = delete;
+
+    /// @brief Destructor, flushes the output.
+    ~RinexNavWriter()
+    {
+        m_out.flush();
+    }
+
+    /// @brief Set the reference GPS time used to resolve the week numbers
+    ///     and dates of the ephemerides.
+    /// @param[in] week Full GPS week number.
+    /// @param[in] tow Time of week, s.
+    /// @param[in] leapSeconds GPS - UTC leap seconds.
+    void setReferenceTime(unsigned week, double tow, int leapSeconds)
+    {
+        m_refSec = (static_cast<std::int64_t>(week) * SecPerWeek) + static_cast<std::int64_t>(tow);
+        m_leapSeconds = leapSeconds;
+    }
+
+    /// @brief Update the reference time from RXM-RAWX message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmRawx<TMsgBase, TDataOpt>& msg)
+    {
+        setReferenceTime(msg.field_week().value(), msg.field_rcvTow().value(), msg.field_leapS().value());
+    }
+
+    /// @brief Write the record of GPS, QZSS, Galileo, or BeiDou ephemeris.
+    void handle(const KeplerEphemeris& eph)
+    {
+        auto gnssId = static_cast<GnssId>(eph.m_gnssId);
+        std::int64_t week = 0;
+        if (!resolveWeek(gnssId, eph.m_week, week)) {
+            ++m_skipped;
+            return;
+        }
+
+        writeHeaderIfNeeded();
+        auto& buf = m_out.reserve(RecordLen);
+        auto calendarWeek = week;
+        if (gnssId == GnssId::BeiDou) {
+            calendarWeek += BeiDouEpochGpsWeek; // BDT week 0 starts at GPS week 1356 calendar date
+        }
+        else if (gnssId == GnssId::Galileo) {
+            calendarWeek += GalileoEpochGpsWeek;
+        }
+
+        auto tocSec = (calendarWeek * SecPerWeek) + std::llround(eph.m_toc);
+        writeEpoch(buf, gnssId, eph.m_svId, tocSec);
+        appendValue(buf, eph.m_af0);
+        appendValue(buf, eph.m_af1);
+        appendValue(buf, eph.m_af2);
+        buf.append('\n');
+
+        appendLine(buf, eph.m_iode, eph.m_crs, eph.m_deltaN, eph.m_m0);
+        appendLine(buf, eph.m_cuc, eph.m_e, eph.m_cus, eph.m_sqrtA);
+        appendLine(buf, eph.m_toe, eph.m_cic, eph.m_omega0, eph.m_cis);
+        appendLine(buf, eph.m_i0, eph.m_crc, eph.m_omega, eph.m_omegaDot);
+
+        static const double UnknownTransmissionTime = 0.9999e9;
+        if (gnssId == GnssId::Galileo) {
+            static const double InavDataSources = 517.0; // I/NAV E1-B and E5b, clock for E5b/E1
+            appendLine(buf, eph.m_iDot, InavDataSources, static_cast<double>(week + GalileoEpochGpsWeek), 0.0);
+            appendLine(buf, sisaMeters(eph.m_accuracy), eph.m_health, eph.m_tgd, eph.m_tgd2);
+            appendLine(buf, UnknownTransmissionTime);
+            ++m_records;
+            return;
+        }
+
+        if (gnssId == GnssId::BeiDou) {
+            appendLine(buf, eph.m_iDot, 0.0, static_cast<double>(week), 0.0);
+            appendLine(buf, uraMeters(eph.m_accuracy), eph.m_health, eph.m_tgd, eph.m_tgd2);
+            appendLine(buf, UnknownTransmissionTime, eph.m_iodc);
+            ++m_records;
+            return;
+        }
+
+        appendLine(buf, eph.m_iDot, 0.0, static_cast<double>(week), 0.0);
+        appendLine(buf, uraMeters(eph.m_accuracy), eph.m_health, eph.m_tgd, eph.m_iodc);
+        appendLine(buf, UnknownTransmissionTime, 0.0);
+        ++m_records;
+    }
+
+    /// @brief Write the record of GLONASS ephemeris.
+    void handle(const GlonassEphemeris& eph)
+    {
+        static const double KmPerM = 1e-3;
+        static const std::int64_t MoscowOffsetSec = GlonassUtcOffsetSec;
+
+        if (m_refSec < 0) {
+            ++m_skipped;
+            return;
+        }
+
+        // Moscow time of the reference, tb is the nearest one with the same time of day
+        auto refMoscow = m_refSec - m_leapSeconds + MoscowOffsetSec;
+        auto dayStart = details::floorDiv(refMoscow, SecPerDay) * SecPerDay;
+        auto tb = dayStart + std::llround(eph.m_tb);
+        if ((refMoscow + (SecPerDay / 2)) < tb) {
+            tb -= SecPerDay;
+        }
+        else if (tb < (refMoscow - (SecPerDay / 2))) {
+            tb += SecPerDay;
+        }
+
+        auto tbDayStart = details::floorDiv(tb, SecPerDay) * SecPerDay;
+        auto tkUtc = tbDayStart + std::llround(eph.m_tk) - MoscowOffsetSec;
+        if (tb < tkUtc) {
+            tkUtc -= SecPerDay; // Frame transmitted on the previous day
+        }
+        auto tkWeekSec = tkUtc - (details::floorDiv(tkUtc, SecPerWeek) * SecPerWeek);
+
+        writeHeaderIfNeeded();
+        auto& buf = m_out.reserve(RecordLen);
+        writeEpoch(buf, GnssId::Glonass, eph.m_svId, tb - MoscowOffsetSec);
+        appendValue(buf, -eph.m_tauN);
+        appendValue(buf, eph.m_gammaN);
+        appendValue(buf, static_cast<double>(tkWeekSec));
+        buf.append('\n');
+
+        appendLine(buf, eph.m_x * KmPerM, eph.m_vx * KmPerM, eph.m_ax * KmPerM, eph.m_health);
+        appendLine(buf, eph.m_y * KmPerM, eph.m_vy * KmPerM, eph.m_ay * KmPerM, eph.m_freqNum);
+        appendLine(buf, eph.m_z * KmPerM, eph.m_vz * KmPerM, eph.m_az * KmPerM, eph.m_age);
+        ++m_records;
+    }
+
+    /// @brief Keep Klobuchar parameters for the header.
+    void handle(const KlobucharIono& iono)
+    {
+        auto gnssId = static_cast<GnssId>(iono.m_gnssId);
+        if (gnssId == GnssId::Gps) {
+            m_gpsIono = iono;
+            m_hasGpsIono = true;
+        }
+        else if (gnssId == GnssId::BeiDou) {
+            m_bdsIono = iono;
+            m_hasBdsIono = true;
+        }
+    }
+
+    /// @brief Keep NeQuick parameters for the header.
+    void handle(const NequickIono& iono)
+    {
+        m_galIono = iono;
+        m_hasGalIono = true;
+    }
+
+    /// @brief Keep UTC parameters for the header.
+    void handle(const GnssUtcParams& utc)
+    {
+        auto gnssId = static_cast<GnssId>(utc.m_gnssId);
+        if (gnssId == GnssId::Gps) {
+            m_gpsUtc = utc;
+            m_hasGpsUtc = true;
+        }
+        else if (gnssId == GnssId::Galileo) {
+            m_galUtc = utc;
+            m_hasGalUtc = true;
+        }
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Pass the partially filled block to the output.
+    void flush()
+    {
+        m_out.flush();
+    }
+
+    /// @brief Number of written records.
+    std::size_t records() const
+    {
+        return m_records;
+    }
+
+    /// @brief Number of ephemerides skipped due to unknown reference time.
+    std::size_t skipped() const
+    {
+        return m_skipped;
+    }
+
+private:
+    static const std::size_t MinBlockSize = 16U * 1024U;
+    static const std::size_t MaxHeaderLen = 2048U;
+    static const std::size_t RecordLen = 8U * 81U;
+    static const std::size_t ValueLen = 19U;
+    static const unsigned ValueDecimals = 12U;
+
+    bool resolveWeek(GnssId gnssId, unsigned week, std::int64_t& fullWeek) const
+    {
+        static const std::int64_t GpsWeekRollover = 1024;
+        static const std::int64_t CurrentGpsRollovers = 2;
+
+        auto refWeek = (0 <= m_refSec) ? (m_refSec / SecPerWeek) : static_cast<std::int64_t>(-1);
+        switch (gnssId) {
+        case GnssId::Gps:
+        case GnssId::Qzss:
+            fullWeek = (refWeek < 0) ?
+                ((CurrentGpsRollovers * GpsWeekRollover) + week) :
+                resolveModulo(refWeek, week, GpsWeekRollover);
+            return true;
+
+        case GnssId::Galileo:
+            if (week != 0U) {
+                fullWeek = week; // GST week, continuous with GPS week - 1024
+                return true;
+            }
+
+            if (refWeek < 0) {
+                return false;
+            }
+            fullWeek = refWeek - GalileoEpochGpsWeek;
+            return true;
+
+        case GnssId::BeiDou:
+            fullWeek = week;
+            return true;
+
+        default:
+            break;
+        }
+        return false;
+    }
+
+    static std::int64_t resolveModulo(std::int64_t ref, std::int64_t value, std::int64_t modulo)
+    {
+        auto diff = (value - ref) % modulo;
+        if (diff < -(modulo / 2)) {
+            diff += modulo;
+        }
+        else if ((modulo / 2) <= diff) {
+            diff -= modulo;
+        }
+        return ref + diff;
+    }
+
+    static double uraMeters(unsigned index)
+    {
+        static const double Values[] = {
+            2.4, 3.4, 4.85, 6.85, 9.65, 13.65, 24.0, 48.0,
+            96.0, 192.0, 384.0, 768.0, 1536.0, 3072.0, 6144.0, 6144.0
+        };
+
+        if ((sizeof(Values) / sizeof(Values[0])) <= index) {
+            return Values[(sizeof(Values) / sizeof(Values[0])) - 1U];
+        }
+        return Values[index];
+    }
+
+    static double sisaMeters(unsigned index)
+    {
+        if (index < 50U) {
+            return index * 0.01;
+        }
+
+        if (index < 75U) {
+            return 0.5 + ((index - 50U) * 0.02);
+        }
+
+        if (index < 100U) {
+            return 1.0 + ((index - 75U) * 0.04);
+        }
+
+        if (index < 126U) {
+            return 2.0 + ((index - 100U) * 0.16);
+        }
+
+        return -1.0; // No accuracy prediction available
+    }
+
+    static void appendValue(TextBuffer& buf, double value)
+    {
+        buf.appendExponentWidth(value, ValueLen, ValueDecimals);
+    }
+
+    static void appendLine(TextBuffer& buf, double v1)
+    {
+        buf.appendFill(' ', 4U);
+        appendValue(buf, v1);
+        buf.append('\n');
+    }
+
+    static void appendLine(TextBuffer& buf, double v1, double v2)
+    {
+        buf.appendFill(' ', 4U);
+        appendValue(buf, v1);
+        appendValue(buf, v2);
+        buf.append('\n');
+    }
+
+    static void appendLine(TextBuffer& buf, double v1, double v2, double v3, double v4)
+    {
+        buf.appendFill(' ', 4U);
+        appendValue(buf, v1);
+        appendValue(buf, v2);
+        appendValue(buf, v3);
+        appendValue(buf, v4);
+        buf.append('\n');
+    }
+
+    static void writeEpoch(TextBuffer& buf, GnssId gnssId, unsigned svId, std::int64_t sec)
+    {
+        auto dateTime = details::rinexDateTime(sec);
+        details::rinexSatellite(buf, gnssId, svId);
+        buf.append(' ');
+        buf.appendUnsignedPadded(static_cast<std::uint64_t>(dateTime.year), 4U);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.month);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.day);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.hour);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.min);
+        buf.append(' ');
+        details::rinexTwoDigits(buf, dateTime.sec);
+    }
+
+    static void writeIonoCorr(TextBuffer& buf, const char* type, double v1, double v2, double v3, double v4)
+    {
+        auto start = buf.size();
+        buf.appendPadded(type, 5U);
+        buf.appendExponentWidth(v1, 12U, 4U);
+        buf.appendExponentWidth(v2, 12U, 4U);
+        buf.appendExponentWidth(v3, 12U, 4U);
+        buf.appendExponentWidth(v4, 12U, 4U);
+        details::rinexLabel(buf, start, "IONOSPHERIC CORR");
+    }
+
+    void writeTimeCorr(TextBuffer& buf, const char* type, const GnssUtcParams& utc, std::int64_t weekOffset)
+    {
+        static const std::int64_t UtcWeekModulo = 256;
+
+        auto refWeek = (0 <= m_refSec) ? ((m_refSec / SecPerWeek) - weekOffset) : static_cast<std::int64_t>(utc.m_wnt);
+        auto start = buf.size();
+        buf.appendPadded(type, 5U);
+        buf.appendExponentWidth(utc.m_a0, 17U, 10U);
+        buf.appendExponentWidth(utc.m_a1, 16U, 9U);
+        buf.append(' ');
+        buf.appendUnsignedPadded(static_cast<std::uint64_t>(std::llround(utc.m_tot)), 6U);
+        buf.append(' ');
+        buf.appendUnsignedPadded(
+            static_cast<std::uint64_t>(resolveModulo(refWeek, utc.m_wnt, UtcWeekModulo) + weekOffset), 4U);
+        details::rinexLabel(buf, start, "TIME SYSTEM CORR");
+    }
+
+    static void appendSignedPadded(TextBuffer& buf, int value, std::size_t width)
+    {
+        char digits[8];
+        TextBuffer text(digits, sizeof(digits));
+        text.appendSigned(value);
+        buf.appendFill(' ', (text.size() < width) ? (width - text.size()) : 0U);
+        buf.append(text.data(), text.size());
+    }
+
+    void writeHeaderIfNeeded()
+    {
+        if (m_headerWritten) {
+            return;
+        }
+
+        m_headerWritten = true;
+        auto& buf = m_out.reserve(MaxHeaderLen);
+        details::rinexHeaderStart(buf, "N: GNSS NAV DATA", m_info);
+
+        if (m_hasGpsIono) {
+            writeIonoCorr(buf, "GPSA", m_gpsIono.m_alpha0, m_gpsIono.m_alpha1, m_gpsIono.m_alpha2, m_gpsIono.m_alpha3);
+            writeIonoCorr(buf, "GPSB", m_gpsIono.m_beta0, m_gpsIono.m_beta1, m_gpsIono.m_beta2, m_gpsIono.m_beta3);
+        }
+
+        if (m_hasGalIono) {
+            writeIonoCorr(buf, "GAL", m_galIono.m_ai0, m_galIono.m_ai1, m_galIono.m_ai2, 0.0);
+        }
+
+        if (m_hasBdsIono) {
+            writeIonoCorr(buf, "BDSA", m_bdsIono.m_alpha0, m_bdsIono.m_alpha1, m_bdsIono.m_alpha2, m_bdsIono.m_alpha3);
+            writeIonoCorr(buf, "BDSB", m_bdsIono.m_beta0, m_bdsIono.m_beta1, m_bdsIono.m_beta2, m_bdsIono.m_beta3);
+        }
+
+        if (m_hasGpsUtc) {
+            writeTimeCorr(buf, "GPUT", m_gpsUtc, 0);
+        }
+
+        if (m_hasGalUtc) {
+            writeTimeCorr(buf, "GAUT", m_galUtc, GalileoEpochGpsWeek);
+        }
+
+        if (m_hasGpsUtc) {
+            static const std::int64_t UtcWeekModulo = 256;
+            auto refWeek = (0 <= m_refSec) ? (m_refSec / SecPerWeek) : static_cast<std::int64_t>(m_gpsUtc.m_wnLsf);
+            auto start = buf.size();
+            appendSignedPadded(buf, m_gpsUtc.m_dtLs, 6U);
+            appendSignedPadded(buf, m_gpsUtc.m_dtLsf, 6U);
+            appendSignedPadded(buf, static_cast<int>(resolveModulo(refWeek, m_gpsUtc.m_wnLsf, UtcWeekModulo)), 6U);
+            appendSignedPadded(buf, m_gpsUtc.m_dn, 6U);
+            details::rinexLabel(buf, start, "LEAP SECONDS");
+        }
+
+        auto start = buf.size();
+        details::rinexLabel(buf, start, "END OF HEADER");
+    }
+
+    RinexHeaderInfo m_info;
+    details::RinexBlockBuffer<TOutput> m_out;
+    std::int64_t m_refSec = -1;
+    int m_leapSeconds = 0;
+    bool m_headerWritten = false;
+    std::size_t m_records = 0U;
+    std::size_t m_skipped = 0U;
+
+    KlobucharIono m_gpsIono = KlobucharIono();
+    KlobucharIono m_bdsIono = KlobucharIono();
+    NequickIono m_galIono = NequickIono();
+    GnssUtcParams m_gpsUtc = GnssUtcParams();
+    GnssUtcParams m_galUtc = GnssUtcParams();
+    bool m_hasGpsIono = false;
+    bool m_hasBdsIono = false;
+    bool m_hasGalIono = false;
+    bool m_hasGpsUtc = false;
+    bool m_hasGalUtc = false;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,765 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::RtcmMsmEncoder and
+///     ublox::util::RtcmMsmDecoder classes.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+#include "ublox/field/common.h"
+#include "ublox/message/RxmRawx.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/TimeService.h"
+#include "ublox/util/details/fields.h"
+#include "ublox/util/details/rtcm.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Type of RTCM 3 Multiple Signal Messages.
+enum class RtcmMsmType : std::uint8_t
+{
+    Msm4 = 4, ///< Full pseudorange and phase range, CNR
+    Msm7 = 7 ///< Extended resolution, Doppler
+};
+
+/// @brief Reference station information.
+struct RtcmStationInfo
+{
+    std::uint16_t m_stationId = 0U; ///< Reference station ID (0 - 4095)
+    std::uint8_t m_iods = 0U; ///< Issue of data station (0 - 7)
+    std::uint8_t m_itrfYear = 0U; ///< ITRF realization year (0 - 63)
+    double m_arp[3] = {0.0, 0.0, 0.0}; ///< Antenna reference point (ECEF), m
+    RtcmMsmType m_msmType = RtcmMsmType::Msm7; ///< Type of generated messages
+};
+
+/// @brief Statistics of @ref RtcmMsmEncoder.
+struct RtcmEncoderStats
+{
+    std::uint64_t m_epochs = 0U; ///< Number of encoded epochs
+    std::uint64_t m_frames = 0U; ///< Number of produced frames
+    std::uint64_t m_bytes = 0U; ///< Number of produced bytes
+    std::uint64_t m_phaseAdjustments = 0U; ///< Number of carrier phase re-alignments
+};
+
+/// @brief Encoder of @b RXM-RAWX epochs into RTCM 3 MSM4 or MSM7 messages.
+/// @details Every epoch produces single MSM frame per satellite system
+///     (GPS, GLONASS, Galileo, SBAS, QZSS, BeiDou), all but the last one
+///     having "multiple message" bit set. The signal tracked by
+///     @b RXM-RAWX is reported as L1 C/A, G1 C/A, E1 C, or B1I (signal
+///     ID 2). Carrier phase is kept within the phase range limits by
+///     subtracting integer number of cycles, every such re-alignment
+///     resets the reported lock time.
+///
+///     The encoder doesn't allocate any memory, the frames are built in
+///     the internal buffer and passed to the output function object.
+/// @tparam TOutput Type of the output function object with signature
+///     @code void (const std::uint8_t* data, std::size_t len) @endcode.
+template <typename TOutput>
+class RtcmMsmEncoder
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Constructor
+    /// @param[in] output Output function object.
+    /// @param[in] info Reference station information.
+    explicit RtcmMsmEncoder(TOutput output, const RtcmStationInfo& info = RtcmStationInfo())
+      : m_output(std::move(output)),
+        m_info(info)
+    {
+        for (auto& state : m_states) {
+            state.m_cpOffset = 0.0;
+            state.m_adjustNs = NoAdjustment;
+        }
+    }
+
+    /// @brief Encode RXM-RAWX message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmRawx<TMsgBase, TDataOpt>& msg)
+    {
+        static const std::int64_t MsPerWeek = SecPerWeek * 1000;
+        static const std::int64_t NsPerMs = 1000000;
+
+        auto towMs = std::llround(msg.field_rcvTow().value() * 1000.0);
+        auto gpsNs = (static_cast<std::int64_t>(msg.field_week().value()) * MsPerWeek + towMs) * NsPerMs;
+        auto leapS = static_cast<std::int64_t>(msg.field_leapS().value());
+
+        for (auto& sys : m_systems) {
+            sys.m_mask = 0U;
+        }
+
+        for (auto& block : msg.field_data().value()) {
+            auto gnssId = block.field_gnssId().value();
+            auto sysIdx = static_cast<std::size_t>(gnssId);
+            if ((SystemsCount <= sysIdx) || (details::rtcmMsmBase(gnssId) == 0U)) {
+                continue;
+            }
+
+            auto trkStat = details::packedValue(block.field_trkStat());
+            auto satId = details::rtcmSatId(gnssId, block.field_svId().value());
+            if ((satId == 0U) || ((trkStat & PrValidMask) == 0U)) {
+                continue;
+            }
+
+            auto& sys = m_systems[sysIdx];
+            auto satBit = satBitOf(satId);
+            if ((sys.m_mask & satBit) != 0U) {
+                continue; // Single signal per satellite
+            }
+
+            sys.m_mask |= satBit;
+            auto& obs = sys.m_obs[satId - 1U];
+            obs.m_pr = block.field_prMes().value();
+            obs.m_cp = block.field_cpMes().value();
+            obs.m_doppler = block.field_doMes().value();
+            obs.m_locktime = block.field_locktime().value();
+            obs.m_freqId = block.field_freqId().value();
+            obs.m_cno = block.field_cno().value();
+            obs.m_trkStat = static_cast<std::uint8_t>(trkStat);
+        }
+
+        static const GnssId Order[] = {
+            GnssId::Gps, GnssId::Glonass, GnssId::Galileo, GnssId::Sbas, GnssId::Qzss, GnssId::BeiDou
+        };
+
+        std::size_t remaining = 0U;
+        for (auto& sys : m_systems) {
+            if (sys.m_mask != 0U) {
+                ++remaining;
+            }
+        }
+
+        for (auto gnssId : Order) {
+            auto sysIdx = static_cast<std::size_t>(gnssId);
+            if (SystemsCount <= sysIdx) {
+                continue;
+            }
+
+            auto& sys = m_systems[sysIdx];
+            if (sys.m_mask == 0U) {
+                continue;
+            }
+
+            --remaining;
+            auto epochTime = epochTimeOf(gnssId, towMs, leapS);
+            encodeSystem(gnssId, sys, epochTime, gpsNs, remaining != 0U);
+        }
+
+        ++m_stats.m_epochs;
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Produce message 1005 (stationary antenna reference point).
+    /// @details Expected to be invoked periodically by the application.
+    void encodeStation()
+    {
+        static const unsigned MsgNum = 1005U;
+        static const double ArpScale = 1.0e4;
+
+        details::RtcmBitWriter writer(&m_frame[details::RtcmHeaderLen]);
+        writer.append(MsgNum, 12U);
+        writer.append(m_info.m_stationId, 12U);
+        writer.append(m_info.m_itrfYear, 6U);
+        writer.append(1U, 1U); // GPS
+        writer.append(1U, 1U); // GLONASS
+        writer.append(1U, 1U); // Galileo
+        writer.append(0U, 1U); // Physical reference station
+        writer.appendSigned(std::llround(m_info.m_arp[0] * ArpScale), 38U);
+        writer.append(0U, 1U); // Single receiver oscillator indicator
+        writer.append(0U, 1U); // Reserved
+        writer.appendSigned(std::llround(m_info.m_arp[1] * ArpScale), 38U);
+        writer.append(0U, 2U); // Quarter cycle indicator
+        writer.appendSigned(std::llround(m_info.m_arp[2] * ArpScale), 38U);
+        writer.flush();
+        outputFrame(writer.bytes());
+    }
+
+    /// @brief Access the reference station information.
+    const RtcmStationInfo& stationInfo() const
+    {
+        return m_info;
+    }
+
+    /// @brief Get statistics.
+    const RtcmEncoderStats& stats() const
+    {
+        return m_stats;
+    }
+
+private:
+    static const std::size_t SystemsCount = static_cast<std::size_t>(GnssId::NumOfValues);
+    static const std::size_t MaxSats = 64U;
+    static const std::size_t MaskPartLen = 32U;
+    static const std::uint32_t PrValidMask = 0x1;
+    static const std::uint32_t CpValidMask = 0x2;
+    static const std::uint32_t HalfCycValidMask = 0x4;
+    static const unsigned SignalId = 2U; // 1C (GPS, GLONASS, Galileo, QZSS, SBAS), 2I (BeiDou)
+    static const std::int64_t NoAdjustment = std::numeric_limits<std::int64_t>::min();
+
+    struct Obs
+    {
+        double m_pr;
+        double m_cp;
+        float m_doppler;
+        std::uint16_t m_locktime;
+        std::uint8_t m_freqId;
+        std::uint8_t m_cno;
+        std::uint8_t m_trkStat;
+    };
+
+    struct System
+    {
+        std::uint64_t m_mask;
+        Obs m_obs[MaxSats];
+    };
+
+    struct SatState
+    {
+        double m_cpOffset; // Cycles subtracted from the carrier phase
+        std::int64_t m_adjustNs; // Time of the last re-alignment
+    };
+
+    struct Cell
+    {
+        std::int64_t m_finePr;
+        std::int64_t m_finePhase;
+        std::int64_t m_fineRate;
+        std::uint32_t m_roughMs;
+        std::uint32_t m_roughMod;
+        std::int32_t m_roughRate;
+        std::uint32_t m_lock;
+        std::uint32_t m_cnr;
+        std::uint8_t m_extInfo;
+        std::uint8_t m_halfCycle;
+    };
+
+    static std::uint64_t satBitOf(unsigned satId)
+    {
+        return static_cast<std::uint64_t>(1U) << (MaxSats - satId);
+    }
+
+    static std::uint32_t epochTimeOf(GnssId gnssId, std::int64_t towMs, std::int64_t leapS)
+    {
+        static const std::int64_t MsPerWeek = SecPerWeek * 1000;
+        static const std::int64_t MsPerDay = SecPerDay * 1000;
+        static const std::int64_t BdsOffsetMs = 14000;
+        static const std::int64_t MoscowOffsetMs = GlonassUtcOffsetSec * 1000;
+        static const unsigned GlonassDayShift = 27U;
+
+        if (gnssId == GnssId::BeiDou) {
+            auto bdsMs = towMs - BdsOffsetMs;
+            return static_cast<std::uint32_t>(bdsMs - (details::floorDiv(bdsMs, MsPerWeek) * MsPerWeek));
+        }
+
+        if (gnssId == GnssId::Glonass) {
+            auto moscowMs = towMs - (leapS * 1000) + MoscowOffsetMs;
+            moscowMs -= details::floorDiv(moscowMs, MsPerWeek) * MsPerWeek;
+            auto day = static_cast<std::uint32_t>(moscowMs / MsPerDay);
+            auto tod = static_cast<std::uint32_t>(moscowMs % MsPerDay);
+            return (day << GlonassDayShift) | tod;
+        }
+
+        return static_cast<std::uint32_t>(towMs - (details::floorDiv(towMs, MsPerWeek) * MsPerWeek));
+    }
+
+    void encodeSystem(GnssId gnssId, const System& sys, std::uint32_t epochTime, std::int64_t gpsNs, bool multipleMessage)
+    {
+        auto msm7 = (m_info.m_msmType == RtcmMsmType::Msm7);
+
+        std::size_t count = 0U;
+        auto mask = sys.m_mask;
+        for (unsigned satId = 1U; satId <= MaxSats; ++satId) {
+            if ((mask & satBitOf(satId)) != 0U) {
+                fillCell(gnssId, satId, sys.m_obs[satId - 1U], gpsNs, msm7, m_cells[count]);
+                ++count;
+            }
+        }
+
+        details::RtcmBitWriter writer(&m_frame[details::RtcmHeaderLen]);
+        writer.append(details::rtcmMsmBase(gnssId) + static_cast<unsigned>(m_info.m_msmType) - 1U, 12U);
+        writer.append(m_info.m_stationId, 12U);
+        writer.append(epochTime, 30U);
+        writer.append(multipleMessage ? 1U : 0U, 1U);
+        writer.append(m_info.m_iods, 3U);
+        writer.append(0U, 7U); // Reserved
+        writer.append(0U, 2U); // Clock steering indicator
+        writer.append(0U, 2U); // External clock indicator
+        writer.append(0U, 1U); // Divergence free smoothing indicator
+        writer.append(0U, 3U); // Smoothing interval
+        writer.append(mask >> 32, 32U);
+        writer.append(mask & 0xffffffffU, 32U);
+        writer.append(static_cast<std::uint64_t>(1U) << (32U - SignalId), 32U);
+
+        // Cell mask (all set), written in parts as it may be 64 bits long
+        for (auto remaining = count; 0U < remaining;) {
+            auto bits = (remaining < MaskPartLen) ? remaining : MaskPartLen;
+            writer.append((static_cast<std::uint64_t>(1U) << bits) - 1U, static_cast<unsigned>(bits));
+            remaining -= bits;
+        }
+
+        // Satellite data
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.append(m_cells[idx].m_roughMs, 8U);
+        }
+
+        if (msm7) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                writer.append(m_cells[idx].m_extInfo, 4U);
+            }
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.append(m_cells[idx].m_roughMod, 10U);
+        }
+
+        if (msm7) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                writer.appendSigned(m_cells[idx].m_roughRate, 14U);
+            }
+        }
+
+        // Signal data
+        auto prLen = msm7 ? 20U : 15U;
+        auto phaseLen = msm7 ? 24U : 22U;
+        auto lockLen = msm7 ? 10U : 4U;
+        auto cnrLen = msm7 ? 10U : 6U;
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.appendSigned(m_cells[idx].m_finePr, prLen);
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.appendSigned(m_cells[idx].m_finePhase, phaseLen);
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.append(m_cells[idx].m_lock, lockLen);
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.append(m_cells[idx].m_halfCycle, 1U);
+        }
+
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            writer.append(m_cells[idx].m_cnr, cnrLen);
+        }
+
+        if (msm7) {
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                writer.appendSigned(m_cells[idx].m_fineRate, 15U);
+            }
+        }
+
+        writer.flush();
+        outputFrame(writer.bytes());
+    }
+
+    void fillCell(GnssId gnssId, unsigned satId, const Obs& obs, std::int64_t gpsNs, bool msm7, Cell& cell)
+    {
+        static const double RoughModScale = 1024.0;
+        static const std::uint32_t InvalidRoughMs = 0xff;
+        static const std::int64_t NsPerMs = 1000000;
+        static const double FineRateScale = 1.0e4;
+        static const std::int32_t InvalidRoughRate = -8192;
+        static const std::int64_t InvalidFineRate = -16384;
+        static const std::uint32_t CnrExtScale = 16U;
+        static const std::uint32_t MaxCnr = 63U;
+        static const std::uint32_t MaxCnrExt = 1023U;
+        static const std::uint8_t GlonassExtInfoMax = 13U;
+
+        auto prScale = msm7 ? details::navPow2(29) : details::navPow2(24);
+        auto phaseScale = msm7 ? details::navPow2(31) : details::navPow2(29);
+        auto prLimit = msm7 ? (static_cast<std::int64_t>(1) << 19) : (static_cast<std::int64_t>(1) << 14);
+        auto phaseLimit = msm7 ? (static_cast<std::int64_t>(1) << 23) : (static_cast<std::int64_t>(1) << 21);
+
+        auto prMs = obs.m_pr / details::RtcmRangeMs;
+        auto rough = std::llround(prMs * RoughModScale);
+        auto roughMs = static_cast<double>(rough) / RoughModScale;
+        cell.m_roughMs = static_cast<std::uint32_t>(rough >> 10);
+        cell.m_roughMod = static_cast<std::uint32_t>(rough & 0x3ff);
+        cell.m_finePr = std::llround((prMs - roughMs) * prScale);
+        if ((InvalidRoughMs <= cell.m_roughMs) || (prLimit <= std::llabs(cell.m_finePr))) {
+            cell.m_roughMs = InvalidRoughMs;
+            cell.m_roughMod = 0U;
+            cell.m_finePr = -prLimit;
+        }
+
+        auto freq = details::rtcmCarrierFreq(gnssId, obs.m_freqId);
+        auto satIdx = SatelliteTable::indexOf(gnssId, details::rtcmSvId(gnssId, satId));
+        std::uint32_t lockMs = obs.m_locktime;
+        cell.m_finePhase = -phaseLimit;
+        if (((obs.m_trkStat & CpValidMask) != 0U) && (satIdx < SatelliteTable::Capacity) &&
+            (cell.m_roughMs != InvalidRoughMs)) {
+            auto& state = m_states[satIdx];
+            auto phaseMs = ((obs.m_cp - state.m_cpOffset) * 1000.0) / freq;
+            auto finePhase = std::llround((phaseMs - roughMs) * phaseScale);
+            if (phaseLimit <= std::llabs(finePhase)) {
+                // Re-align the carrier phase with the pseudorange
+                state.m_cpOffset = std::round(obs.m_cp - ((roughMs * freq) / 1000.0));
+                state.m_adjustNs = gpsNs;
+                phaseMs = ((obs.m_cp - state.m_cpOffset) * 1000.0) / freq;
+                finePhase = std::llround((phaseMs - roughMs) * phaseScale);
+                ++m_stats.m_phaseAdjustments;
+            }
+
+            cell.m_finePhase = finePhase;
+            if (state.m_adjustNs != NoAdjustment) {
+                auto sinceMs = static_cast<std::uint64_t>((gpsNs - state.m_adjustNs) / NsPerMs);
+                if (sinceMs < lockMs) {
+                    lockMs = static_cast<std::uint32_t>(sinceMs);
+                }
+            }
+        }
+
+        cell.m_lock = msm7 ? details::rtcmLockIndicatorExt(lockMs) : details::rtcmLockIndicator(lockMs);
+        cell.m_halfCycle = ((obs.m_trkStat & HalfCycValidMask) == 0U) ? 1U : 0U;
+        cell.m_cnr = std::min(
+            static_cast<std::uint32_t>(obs.m_cno) * (msm7 ? CnrExtScale : 1U),
+            msm7 ? MaxCnrExt : MaxCnr);
+        cell.m_extInfo = 0U;
+        if ((gnssId == GnssId::Glonass) && (obs.m_freqId <= GlonassExtInfoMax)) {
+            cell.m_extInfo = obs.m_freqId;
+        }
+
+        // Phase range rate of MSM7
+        auto rate = -static_cast<double>(obs.m_doppler) * (details::RtcmSpeedOfLight / freq);
+        auto roughRate = std::llround(rate);
+        cell.m_roughRate = InvalidRoughRate;
+        cell.m_fineRate = InvalidFineRate;
+        if (std::llabs(roughRate) < -InvalidRoughRate) {
+            cell.m_roughRate = static_cast<std::int32_t>(roughRate);
+            cell.m_fineRate = std::llround((rate - static_cast<double>(roughRate)) * FineRateScale);
+        }
+    }
+
+    void outputFrame(std::size_t payloadLen)
+    {
+        auto len = details::rtcmFinishFrame(&m_frame[0], payloadLen);
+        m_output(&m_frame[0], len);
+        ++m_stats.m_frames;
+        m_stats.m_bytes += len;
+    }
+
+    TOutput m_output;
+    RtcmStationInfo m_info;
+    RtcmEncoderStats m_stats;
+    System m_systems[SystemsCount];
+    SatState m_states[SatelliteTable::Capacity];
+    Cell m_cells[MaxSats];
+    std::uint8_t m_frame[details::RtcmMaxFrameLen];
+};
+
+/// @brief Single observation decoded from MSM message.
+struct RtcmMsmObs
+{
+    /// @brief Validity flags of the observation values.
+    enum Flags : std::uint8_t
+    {
+        PrValid = 0x1, ///< @ref m_pr is valid
+        PhaseValid = 0x2, ///< @ref m_phaseRange is valid
+        CpValid = 0x4, ///< @ref m_cp is valid (carrier frequency is known)
+        DopplerValid = 0x8, ///< @ref m_doppler is valid
+        HalfCycle = 0x10 ///< Half cycle ambiguity is not resolved
+    };
+
+    double m_pr; ///< Pseudorange, m
+    double m_phaseRange; ///< Phase range, m
+    double m_cp; ///< Carrier phase, cycles
+    double m_doppler; ///< Doppler, Hz
+    double m_cno; ///< Carrier to noise ratio, dBHz
+    std::uint32_t m_locktime; ///< Minimal lock time, ms
+    std::uint8_t m_gnssId; ///< GNSS identifier
+    std::uint8_t m_svId; ///< Satellite identifier (u-blox numbering)
+    std::uint8_t m_sigId; ///< RTCM signal ID (1 - 32)
+    std::uint8_t m_freqId; ///< GLONASS frequency slot + 7 (255 if unknown)
+    std::uint8_t m_flags; ///< Validity flags, see @ref Flags
+};
+
+/// @brief Contents of MSM message decoded by @ref RtcmMsmDecoder.
+struct RtcmMsmData
+{
+    static const std::size_t MaxObs = 64U;
+
+    unsigned m_msgNum; ///< Message number
+    unsigned m_stationId; ///< Reference station ID
+    std::uint32_t m_epochTime; ///< Epoch time field (system specific)
+    bool m_multipleMessage; ///< More messages of the same epoch follow
+    std::uint8_t m_iods; ///< Issue of data station
+    std::size_t m_count; ///< Number of decoded observations
+    RtcmMsmObs m_obs[MaxObs]; ///< Observations
+};
+
+/// @brief Decoder of RTCM 3 frames containing MSM4 or MSM7 messages.
+/// @details Intended to verify output of @ref RtcmMsmEncoder. The carrier
+///     phase in cycles is reported for the signals produced by the
+///     encoder (signal ID 2), of GLONASS satellites only when the
+///     frequency slot is known (MSM7).
+class RtcmMsmDecoder
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Get length of the frame at the start of the buffer.
+    /// @return Length of the complete frame, 0 if the buffer doesn't start
+    ///     with the preamble or doesn't contain the complete frame.
+    static std::size_t frameLength(const std::uint8_t* data, std::size_t len)
+    {
+        if ((len < details::RtcmHeaderLen) || (data[0] != details::RtcmPreamble)) {
+            return 0U;
+        }
+
+        auto payloadLen = (static_cast<std::size_t>(data[1] & 0x3U) << 8) | data[2];
+        auto frameLen = details::RtcmHeaderLen + payloadLen + details::RtcmCrcLen;
+        if (len < frameLen) {
+            return 0U;
+        }
+        return frameLen;
+    }
+
+    /// @brief Decode the frame.
+    /// @return true in case of valid frame containing supported MSM message.
+    static bool decode(const std::uint8_t* data, std::size_t len, RtcmMsmData& out)
+    {
+        static const unsigned MaxCells = 64U;
+        static const unsigned SignalsCount = 32U;
+        static const unsigned MsgsPerSystem = 10U;
+
+        auto frameLen = frameLength(data, len);
+        if (frameLen == 0U) {
+            return false;
+        }
+
+        auto payloadLen = frameLen - details::RtcmHeaderLen - details::RtcmCrcLen;
+        auto crcPos = details::RtcmHeaderLen + payloadLen;
+        auto crc =
+            (static_cast<std::uint32_t>(data[crcPos]) << 16) |
+            (static_cast<std::uint32_t>(data[crcPos + 1]) << 8) |
+            static_cast<std::uint32_t>(data[crcPos + 2]);
+        if (details::crc24q(data, crcPos) != crc) {
+            return false;
+        }
+
+        details::RtcmBitReader reader(&data[details::RtcmHeaderLen], payloadLen);
+        out.m_msgNum = static_cast<unsigned>(reader.read(12U));
+
+        static const GnssId Systems[] = {
+            GnssId::Gps, GnssId::Glonass, GnssId::Galileo, GnssId::Sbas, GnssId::Qzss, GnssId::BeiDou
+        };
+
+        auto gnssId = GnssId::Gps;
+        unsigned msmNum = 0U;
+        for (auto sys : Systems) {
+            auto base = details::rtcmMsmBase(sys);
+            if ((base <= out.m_msgNum) && (out.m_msgNum < (base + MsgsPerSystem))) {
+                gnssId = sys;
+                msmNum = out.m_msgNum - base + 1U;
+            }
+        }
+
+        if ((msmNum != 4U) && (msmNum != 7U)) {
+            return false;
+        }
+
+        auto msm7 = (msmNum == 7U);
+        out.m_stationId = static_cast<unsigned>(reader.read(12U));
+        out.m_epochTime = static_cast<std::uint32_t>(reader.read(30U));
+        out.m_multipleMessage = (reader.read(1U) != 0U);
+        out.m_iods = static_cast<std::uint8_t>(reader.read(3U));
+        reader.read(7U + 2U + 2U + 1U + 3U); // Reserved, clock, smoothing
+
+        auto satMask = reader.read(64U);
+        auto sigMask = static_cast<std::uint32_t>(reader.read(32U));
+
+        unsigned satIds[MaxCells];
+        unsigned satCount = 0U;
+        for (unsigned satId = 1U; satId <= 64U; ++satId) {
+            if ((satMask & (static_cast<std::uint64_t>(1U) << (64U - satId))) != 0U) {
+                satIds[satCount] = satId;
+                ++satCount;
+            }
+        }
+
+        unsigned sigIds[SignalsCount];
+        unsigned sigCount = 0U;
+        for (unsigned sigId = 1U; sigId <= SignalsCount; ++sigId) {
+            if ((sigMask & (static_cast<std::uint32_t>(1U) << (SignalsCount - sigId))) != 0U) {
+                sigIds[sigCount] = sigId;
+                ++sigCount;
+            }
+        }
+
+        if (MaxCells < (satCount * sigCount)) {
+            return false;
+        }
+
+        auto cellMask = reader.read(satCount * sigCount);
+
+        // Satellite data
+        std::uint32_t roughMs[MaxCells];
+        std::uint32_t extInfo[MaxCells];
+        std::uint32_t roughMod[MaxCells];
+        std::int32_t roughRate[MaxCells];
+        readColumn(reader, roughMs, satCount, 8U);
+        if (msm7) {
+            readColumn(reader, extInfo, satCount, 4U);
+        }
+        readColumn(reader, roughMod, satCount, 10U);
+        if (msm7) {
+            readSignedColumn(reader, roughRate, satCount, 14U);
+        }
+
+        // Signal data
+        std::size_t cellCount = 0U;
+        for (unsigned bit = 0U; bit < (satCount * sigCount); ++bit) {
+            if ((cellMask & (static_cast<std::uint64_t>(1U) << bit)) != 0U) {
+                ++cellCount;
+            }
+        }
+
+        std::int32_t finePr[MaxCells];
+        std::int32_t finePhase[MaxCells];
+        std::uint32_t lock[MaxCells];
+        std::uint32_t halfCycle[MaxCells];
+        std::uint32_t cnr[MaxCells];
+        std::int32_t fineRate[MaxCells];
+        readSignedColumn(reader, finePr, cellCount, msm7 ? 20U : 15U);
+        readSignedColumn(reader, finePhase, cellCount, msm7 ? 24U : 22U);
+        readColumn(reader, lock, cellCount, msm7 ? 10U : 4U);
+        readColumn(reader, halfCycle, cellCount, 1U);
+        readColumn(reader, cnr, cellCount, msm7 ? 10U : 6U);
+        if (msm7) {
+            readSignedColumn(reader, fineRate, cellCount, 15U);
+        }
+
+        if (reader.overflow()) {
+            return false;
+        }
+
+        auto prScale = msm7 ? details::navPow2(-29) : details::navPow2(-24);
+        auto phaseScale = msm7 ? details::navPow2(-31) : details::navPow2(-29);
+        std::int32_t prInvalid = msm7 ? -(1 << 19) : -(1 << 14);
+        std::int32_t phaseInvalid = msm7 ? -(1 << 23) : -(1 << 21);
+        static const std::uint32_t InvalidRoughMs = 0xff;
+        static const std::int32_t InvalidRoughRate = -8192;
+        static const std::int32_t InvalidFineRate = -16384;
+        static const unsigned KnownSignalId = 2U;
+        static const std::uint8_t UnknownFreqId = 0xff;
+        static const double CnrExtScale = 1.0 / 16.0;
+
+        std::size_t cell = 0U;
+        unsigned bit = satCount * sigCount;
+        for (unsigned sat = 0U; sat < satCount; ++sat) {
+            for (unsigned sig = 0U; sig < sigCount; ++sig) {
+                --bit;
+                if ((cellMask & (static_cast<std::uint64_t>(1U) << bit)) == 0U) {
+                    continue;
+                }
+
+                auto& obs = out.m_obs[cell];
+                obs.m_gnssId = static_cast<std::uint8_t>(gnssId);
+                obs.m_svId = static_cast<std::uint8_t>(details::rtcmSvId(gnssId, satIds[sat]));
+                obs.m_sigId = static_cast<std::uint8_t>(sigIds[sig]);
+                obs.m_freqId = UnknownFreqId;
+                if (msm7 && (gnssId == GnssId::Glonass)) {
+                    obs.m_freqId = static_cast<std::uint8_t>(extInfo[sat]);
+                }
+
+                obs.m_flags = 0U;
+                obs.m_pr = 0.0;
+                obs.m_phaseRange = 0.0;
+                obs.m_cp = 0.0;
+                obs.m_doppler = 0.0;
+
+                auto roughRangeMs = static_cast<double>(roughMs[sat]) + (static_cast<double>(roughMod[sat]) / 1024.0);
+                if ((roughMs[sat] != InvalidRoughMs) && (finePr[cell] != prInvalid)) {
+                    obs.m_pr = (roughRangeMs + (finePr[cell] * prScale)) * details::RtcmRangeMs;
+                    obs.m_flags |= RtcmMsmObs::PrValid;
+                }
+
+                auto freqKnown =
+                    (sigIds[sig] == KnownSignalId) &&
+                    ((gnssId != GnssId::Glonass) || (obs.m_freqId != UnknownFreqId));
+
+                if ((roughMs[sat] != InvalidRoughMs) && (finePhase[cell] != phaseInvalid)) {
+                    auto phaseMs = roughRangeMs + (finePhase[cell] * phaseScale);
+                    obs.m_phaseRange = phaseMs * details::RtcmRangeMs;
+                    obs.m_flags |= RtcmMsmObs::PhaseValid;
+                    if (freqKnown) {
+                        obs.m_cp = (phaseMs * details::rtcmCarrierFreq(gnssId, obs.m_freqId)) / 1000.0;
+                        obs.m_flags |= RtcmMsmObs::CpValid;
+                    }
+                }
+
+                if (msm7 && freqKnown && (roughRate[sat] != InvalidRoughRate) && (fineRate[cell] != InvalidFineRate)) {
+                    auto rate = roughRate[sat] + (fineRate[cell] * 1.0e-4);
+                    obs.m_doppler = -rate * (details::rtcmCarrierFreq(gnssId, obs.m_freqId) / details::RtcmSpeedOfLight);
+                    obs.m_flags |= RtcmMsmObs::DopplerValid;
+                }
+
+                if (halfCycle[cell] != 0U) {
+                    obs.m_flags |= RtcmMsmObs::HalfCycle;
+                }
+
+                obs.m_locktime =
+                    msm7 ? details::rtcmLockFromIndicatorExt(lock[cell]) : details::rtcmLockFromIndicator(lock[cell]);
+                obs.m_cno = msm7 ? (cnr[cell] * CnrExtScale) : static_cast<double>(cnr[cell]);
+                ++cell;
+            }
+        }
+
+        out.m_count = cell;
+        return true;
+    }
+
+private:
+    static void readColumn(details::RtcmBitReader& reader, std::uint32_t* values, std::size_t count, unsigned len)
+    {
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            values[idx] = static_cast<std::uint32_t>(reader.read(len));
+        }
+    }
+
+    static void readSignedColumn(details::RtcmBitReader& reader, std::int32_t* values, std::size_t count, unsigned len)
+    {
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            values[idx] = static_cast<std::int32_t>(reader.readSigned(len));
+        }
+    }
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,425 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::SatelliteTable class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include "ublox/field/common.h"
+#include "ublox/message/NavSat.h"
+#include "ublox/message/NavSvinfo.h"
+#include "ublox/message/NavOrb.h"
+#include "ublox/message/RxmSvsi.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Bits of @ref SatelliteState::sources member, reporting which
+///     messages have updated the satellite.
+enum SatelliteSource : std::uint8_t
+{
+    SatelliteSource_NavSat = 0x1, ///< NAV-SAT
+    SatelliteSource_NavSvinfo = 0x2, ///< NAV-SVINFO
+    SatelliteSource_RxmSvsi = 0x4, ///< RXM-SVSI
+    SatelliteSource_NavOrb = 0x8 ///< NAV-ORB
+};
+
+/// @brief State of the single satellite.
+/// @details All the values are in units of the protocol (not scaled) unless
+///     stated otherwise, the bitfields are stored serialised.
+struct SatelliteState
+{
+    std::uint8_t gnssId; ///< GNSS identifier (see ublox::field::common::GnssId)
+    std::uint8_t svId; ///< Satellite identifier within the GNSS
+    std::uint8_t sources; ///< Reporting messages, see @ref SatelliteSource
+    std::uint8_t cno; ///< Carrier to noise ratio, dBHz
+    std::int8_t elev; ///< Elevation, deg
+    std::uint8_t svinfoFlags; ///< @b flags of NAV-SVINFO
+    std::int16_t azim; ///< Azimuth, deg
+    std::int32_t prRes; ///< Pseudo range residual, cm
+    std::uint32_t satFlags; ///< @b flags of NAV-SAT
+    std::uint8_t svinfoQuality; ///< @b quality of NAV-SVINFO
+    std::uint8_t svsiFlag; ///< @b svFlag of RXM-SVSI
+    std::uint8_t svsiAge; ///< @b age of RXM-SVSI
+    std::uint8_t orbSvFlag; ///< @b svFlag of NAV-ORB
+    std::uint8_t orbEph; ///< @b eph of NAV-ORB
+    std::uint8_t orbAlm; ///< @b alm of NAV-ORB
+    std::uint8_t orbOtherOrb; ///< @b otherOrb of NAV-ORB
+    std::uint8_t reserved; ///< Reserved, always 0
+    std::uint32_t iTOW; ///< iTOW (or time of week for RXM-SVSI) of the last update, ms
+};
+
+/// @brief Flat table of the satellites states indexed by GNSS and
+///     satellite identifiers.
+/// @details Has a fixed slot for every satellite of every GNSS supported
+///     by the protocol. The NAV-SAT, NAV-SVINFO, RXM-SVSI and NAV-ORB
+///     messages update the relevant entries in place (the legacy
+///     satellite numbering of NAV-SVINFO and RXM-SVSI is mapped to the
+///     GNSS and satellite identifiers). Every change of the entry marks
+///     it as dirty and increments its version, which allows the consumers
+///     to iterate over the changed satellites only: either the single
+///     consumer using @ref forEachDirty(), or multiple consumers, each
+///     keeping its own cursor, using @ref forEachChangedSince().
+///
+///     Intended to be used as a handler of the input messages in a single
+///     thread, the messages other than the supported ones are ignored.
+class SatelliteTable
+{
+    typedef field::common::GnssId GnssId;
+
+public:
+    /// @brief Number of the GNSS systems.
+    static const std::size_t GnssCount = static_cast<std::size_t>(GnssId::NumOfValues);
+
+    /// @brief Total number of the satellite slots.
+    static const std::size_t Capacity = 32U + 39U + 36U + 63U + 10U + 10U + 32U;
+
+    /// @brief Default constructor
+    SatelliteTable()
+    {
+        clear();
+    }
+
+    /// @brief Clear all the entries.
+    void clear()
+    {
+        std::memset(&m_entries[0], 0, sizeof(m_entries));
+        std::memset(&m_versions[0], 0, sizeof(m_versions));
+        std::memset(&m_dirty[0], 0, sizeof(m_dirty));
+        for (std::size_t gnss = 0U; gnss < GnssCount; ++gnss) {
+            auto& range = ranges()[gnss];
+            for (std::size_t idx = 0U; idx < range.m_count; ++idx) {
+                auto& entry = m_entries[range.m_base + idx];
+                entry.gnssId = static_cast<std::uint8_t>(gnss);
+                entry.svId = static_cast<std::uint8_t>(range.m_first + idx);
+            }
+        }
+    }
+
+    /// @brief Get index of the entry.
+    /// @return Index of the entry or @ref Capacity in case the satellite
+    ///     is not supported.
+    static std::size_t indexOf(GnssId gnssId, unsigned svId)
+    {
+        auto gnss = static_cast<std::size_t>(gnssId);
+        if (GnssCount <= gnss) {
+            return Capacity;
+        }
+
+        auto& range = ranges()[gnss];
+        if ((svId < range.m_first) || ((range.m_first + range.m_count) <= svId)) {
+            return Capacity;
+        }
+
+        return range.m_base + (svId - range.m_first);
+    }
+
+    /// @brief Map legacy satellite numbering (used by NAV-SVINFO and
+    ///     RXM-SVSI) to GNSS and satellite identifiers.
+    /// @return @b false in case the number is unknown.
+    static bool fromLegacySvid(unsigned svid, GnssId& gnssId, unsigned& svId)
+    {
+        struct Mapping
+        {
+            unsigned m_from;
+            unsigned m_to;
+            GnssId m_gnssId;
+            unsigned m_firstSvId;
+        };
+
+        static const Mapping Map[] = {
+            {1, 32, GnssId::Gps, 1},
+            {33, 64, GnssId::BeiDou, 6},
+            {65, 96, GnssId::Glonass, 1},
+            {120, 158, GnssId::Sbas, 120},
+            {159, 163, GnssId::BeiDou, 1},
+            {173, 182, GnssId::Imes, 1},
+            {193, 197, GnssId::Qzss, 1},
+            {211, 246, GnssId::Galileo, 1}
+        };
+
+        for (auto& mapping : Map) {
+            if ((mapping.m_from <= svid) && (svid <= mapping.m_to)) {
+                gnssId = mapping.m_gnssId;
+                svId = mapping.m_firstSvId + (svid - mapping.m_from);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Access the entry.
+    const SatelliteState& entry(std::size_t idx) const
+    {
+        return m_entries[idx];
+    }
+
+    /// @brief Find the entry.
+    /// @return Pointer to the entry or @b nullptr in case the satellite
+    ///     is not supported.
+    const SatelliteState* find(GnssId gnssId, unsigned svId) const
+    {
+        auto idx = indexOf(gnssId, svId);
+        if (Capacity <= idx) {
+            return nullptr;
+        }
+        return &m_entries[idx];
+    }
+
+    /// @brief Version of the entry, incremented on every change.
+    std::uint32_t version(std::size_t idx) const
+    {
+        return m_versions[idx];
+    }
+
+    /// @brief Total number of the changes of all the entries.
+    std::uint32_t changesCount() const
+    {
+        return m_changes;
+    }
+
+    /// @brief Check whether the entry has been changed since the last
+    ///     @ref forEachDirty() or @ref clearDirty().
+    bool isDirty(std::size_t idx) const
+    {
+        return (m_dirty[idx / DirtyWordBits] & (static_cast<DirtyWord>(1U) << (idx % DirtyWordBits))) != 0U;
+    }
+
+    /// @brief Clear all the dirty bits.
+    void clearDirty()
+    {
+        std::memset(&m_dirty[0], 0, sizeof(m_dirty));
+    }
+
+    /// @brief Invoke the function for every dirty entry and clear the dirty bits.
+    /// @param[in] func Function with <b>void (std::size_t idx, const SatelliteState&)</b>
+    ///     signature.
+    template <typename TFunc>
+    void forEachDirty(TFunc&& func)
+    {
+        for (std::size_t word = 0U; word < DirtyWordsCount; ++word) {
+            auto bits = m_dirty[word];
+            m_dirty[word] = 0U;
+            while (bits != 0U) {
+                auto bit = lowestBit(bits);
+                bits &= bits - 1U;
+                auto idx = (word * DirtyWordBits) + bit;
+                func(idx, m_entries[idx]);
+            }
+        }
+    }
+
+    /// @brief Invoke the function for every entry changed after the
+    ///     specified cursor and update the cursor.
+    /// @details Allows multiple independent consumers, each keeping its
+    ///     own cursor (initially 0).
+    /// @param[in, out] cursor Consumer's cursor.
+    /// @param[in] func Function with <b>void (std::size_t idx, const SatelliteState&)</b>
+    ///     signature.
+    template <typename TFunc>
+    void forEachChangedSince(std::uint32_t& cursor, TFunc&& func) const
+    {
+        if (cursor == m_changes) {
+            return;
+        }
+
+        for (std::size_t idx = 0U; idx < Capacity; ++idx) {
+            if (static_cast<std::int32_t>(m_versions[idx] - cursor) > 0) {
+                func(idx, m_entries[idx]);
+            }
+        }
+        cursor = m_changes;
+    }
+
+    /// @brief Handle NAV-SAT message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::NavSat<TMsgBase, TDataOpt>& msg)
+    {
+        auto iTOW = msg.field_iTOW().value();
+        for (auto& block : msg.field_data().value()) {
+            auto idx = indexOf(block.field_gnssId().value(), block.field_svId().value());
+            if (Capacity <= idx) {
+                continue;
+            }
+
+            auto& entry = m_entries[idx];
+            auto prev = entry;
+            entry.sources |= SatelliteSource_NavSat;
+            entry.cno = block.field_cno().value();
+            entry.elev = block.field_elev().value();
+            entry.azim = block.field_azim().value();
+            entry.prRes = static_cast<std::int32_t>(block.field_prRes().value()) * 10;
+            entry.satFlags = details::packedValue(block.field_flags());
+            commit(idx, prev, iTOW);
+        }
+    }
+
+    /// @brief Handle NAV-SVINFO message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::NavSvinfo<TMsgBase, TDataOpt>& msg)
+    {
+        auto iTOW = msg.field_iTOW().value();
+        for (auto& block : msg.field_data().value()) {
+            auto idx = legacyIndexOf(block.field_svid().value());
+            if (Capacity <= idx) {
+                continue;
+            }
+
+            auto& entry = m_entries[idx];
+            auto prev = entry;
+            entry.sources |= SatelliteSource_NavSvinfo;
+            entry.svinfoFlags = static_cast<std::uint8_t>(block.field_flags().value());
+            entry.svinfoQuality = static_cast<std::uint8_t>(block.field_quality().value());
+            entry.cno = block.field_cno().value();
+            entry.elev = block.field_elev().value();
+            entry.azim = block.field_azim().value();
+            entry.prRes = block.field_prRes().value();
+            commit(idx, prev, iTOW);
+        }
+    }
+
+    /// @brief Handle RXM-SVSI message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::RxmSvsi<TMsgBase, TDataOpt>& msg)
+    {
+        auto iTOW = static_cast<std::uint32_t>(msg.field_iTOW().value());
+        for (auto& block : msg.field_data().value()) {
+            auto idx = legacyIndexOf(block.field_svid().value());
+            if (Capacity <= idx) {
+                continue;
+            }
+
+            auto& entry = m_entries[idx];
+            auto prev = entry;
+            entry.sources |= SatelliteSource_RxmSvsi;
+            entry.svsiFlag = static_cast<std::uint8_t>(details::packedValue(block.field_svFlag()));
+            entry.azim = block.field_azim().value();
+            entry.elev = block.field_elev().value();
+            entry.svsiAge = static_cast<std::uint8_t>(details::packedValue(block.field_age()));
+            commit(idx, prev, iTOW);
+        }
+    }
+
+    /// @brief Handle NAV-ORB message.
+    template <typename TMsgBase, typename TDataOpt>
+    void handle(const message::NavOrb<TMsgBase, TDataOpt>& msg)
+    {
+        auto iTOW = msg.field_iTOW().value();
+        for (auto& block : msg.field_data().value()) {
+            auto idx = indexOf(block.field_gnssId().value(), block.field_svId().value());
+            if (Capacity <= idx) {
+                continue;
+            }
+
+            auto& entry = m_entries[idx];
+            auto prev = entry;
+            entry.sources |= SatelliteSource_NavOrb;
+            entry.orbSvFlag = static_cast<std::uint8_t>(details::packedValue(block.field_svFlag()));
+            entry.orbEph = static_cast<std::uint8_t>(details::packedValue(block.field_eph()));
+            entry.orbAlm = static_cast<std::uint8_t>(details::packedValue(block.field_alm()));
+            entry.orbOtherOrb = static_cast<std::uint8_t>(details::packedValue(block.field_otherOrb()));
+            commit(idx, prev, iTOW);
+        }
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+private:
+    struct Range
+    {
+        std::size_t m_base;
+        unsigned m_first;
+        std::size_t m_count;
+    };
+
+    typedef std::uint64_t DirtyWord;
+    static const std::size_t DirtyWordBits = sizeof(DirtyWord) * 8U;
+    static const std::size_t DirtyWordsCount = (Capacity + DirtyWordBits - 1) / DirtyWordBits;
+
+    static const Range* ranges()
+    {
+        // Must follow the order of GnssId values
+        static const Range Ranges[GnssCount] = {
+            {0U, 1U, 32U}, // GPS
+            {32U, 120U, 39U}, // SBAS
+            {71U, 1U, 36U}, // Galileo
+            {107U, 1U, 63U}, // BeiDou
+            {170U, 1U, 10U}, // IMES
+            {180U, 1U, 10U}, // QZSS
+            {190U, 1U, 32U} // GLONASS
+        };
+        static_assert((190U + 32U) == Capacity, "Invalid ranges");
+        return &Ranges[0];
+    }
+
+    static std::size_t legacyIndexOf(unsigned svid)
+    {
+        GnssId gnssId = GnssId::Gps;
+        unsigned svId = 0U;
+        if (!fromLegacySvid(svid, gnssId, svId)) {
+            return Capacity;
+        }
+        return indexOf(gnssId, svId);
+    }
+
+    static std::size_t lowestBit(DirtyWord bits)
+    {
+        std::size_t bit = 0U;
+        while ((bits & 0x1) == 0U) {
+            bits >>= 1;
+            ++bit;
+        }
+        return bit;
+    }
+
+    void commit(std::size_t idx, const SatelliteState& prev, std::uint32_t iTOW)
+    {
+        auto& entry = m_entries[idx];
+        entry.iTOW = iTOW;
+        if (std::memcmp(&prev, &entry, offsetof(SatelliteState, iTOW)) == 0) {
+            return;
+        }
+
+        ++m_changes;
+        m_versions[idx] = m_changes;
+        m_dirty[idx / DirtyWordBits] |= static_cast<DirtyWord>(1U) << (idx % DirtyWordBits);
+    }
+
+    SatelliteState m_entries[Capacity];
+    std::uint32_t m_versions[Capacity];
+    DirtyWord m_dirty[DirtyWordsCount];
+    std::uint32_t m_changes = 0U;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,177 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::SeqLock class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <type_traits>
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Sequence counter of the sequence lock.
+/// @details Protects arbitrary data updated by single writer and read by
+///     multiple readers. The writer brackets the update with @ref beginWrite()
+///     and @ref endWrite(), the readers copy the data between @ref beginRead()
+///     and @ref endRead() and retry if the latter fails.
+class SeqCounter
+{
+public:
+    /// @brief Default constructor
+    SeqCounter() = default;
+
+    SeqCounter(const SeqCounter&) = delete;
+    SeqCounter& operator=(const SeqCounter&) = delete;
+
+    /// @brief Mark the beginning of the update.
+    void beginWrite()
+    {
+        auto seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /// @brief Mark the end of the update.
+    void endWrite()
+    {
+        auto seq = m_seq.load(std::memory_order_relaxed);
+        m_seq.store(seq + 1, std::memory_order_release);
+    }
+
+    /// @brief Mark the beginning of the read.
+    /// @param[out] seq Sequence number to be passed to @ref endRead().
+    /// @return @b false in case the update is in progress.
+    bool beginRead(std::uint32_t& seq) const
+    {
+        seq = m_seq.load(std::memory_order_acquire);
+        return (seq & 0x1) == 0U;
+    }
+
+    /// @brief Check that the data copied after @ref beginRead() is consistent.
+    bool endRead(std::uint32_t seq) const
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return m_seq.load(std::memory_order_relaxed) == seq;
+    }
+
+    /// @brief Sequence number of the last complete update.
+    /// @details Incremented by 2 on every update, 0 means no update
+    ///     has been performed yet.
+    std::uint32_t sequence() const
+    {
+        return m_seq.load(std::memory_order_acquire) & ~static_cast<std::uint32_t>(0x1);
+    }
+
+private:
+    std::atomic<std::uint32_t> m_seq{0};
+};
+
+/// @brief Single writer, multiple readers publication of the value using
+///     sequence lock.
+/// @details The writer never blocks, the readers never block the writer
+///     and retry the copy in case it overlapped with the update. The readers
+///     always get complete value as it was published by single @ref store()
+///     call.
+/// @tparam T Type of the published value, must be trivially copyable.
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+        "The published value must be trivially copyable");
+
+public:
+    /// @brief Type of the published value.
+    typedef T ValueType;
+
+    /// @brief Default constructor, value is zero initialised.
+    SeqLock()
+    {
+        std::memset(&m_value, 0, sizeof(m_value));
+    }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /// @brief Publish new value.
+    /// @details Must be called from single (writer) thread only.
+    void store(const T& value)
+    {
+        m_seq.beginWrite();
+        std::memcpy(&m_value, &value, sizeof(T));
+        m_seq.endWrite();
+    }
+
+    /// @brief Try to get copy of the published value.
+    /// @details Fails if the copy overlapped with the update.
+    /// @param[out] value Copy of the value.
+    /// @param[out] seq Optional sequence number the copied value has been
+    ///     published with.
+    /// @return @b true in case of success.
+    bool tryLoad(T& value, std::uint32_t* seq = nullptr) const
+    {
+        std::uint32_t before = 0U;
+        if (!m_seq.beginRead(before)) {
+            return false;
+        }
+
+        std::memcpy(&value, &m_value, sizeof(T));
+        if (!m_seq.endRead(before)) {
+            return false;
+        }
+
+        if (seq != nullptr) {
+            *seq = before;
+        }
+        return true;
+    }
+
+    /// @brief Get copy of the published value, retrying until success.
+    /// @param[out] seq Optional sequence number the copied value has been
+    ///     published with.
+    T load(std::uint32_t* seq = nullptr) const
+    {
+        T value;
+        while (!tryLoad(value, seq)) {}
+        return value;
+    }
+
+    /// @brief Sequence number of the last published value.
+    /// @details Incremented by 2 on every @ref store(), can be used to
+    ///     check whether new value has been published without copying it.
+    std::uint32_t sequence() const
+    {
+        return m_seq.sequence();
+    }
+
+private:
+    SeqCounter m_seq;
+    T m_value;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,555 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::TextBuffer class.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Text output into caller supplied buffer.
+/// @details Provides fast formatting of numbers without usage of
+///     @b printf() family functions, streams or any dynamic memory allocation.
+///     When the buffer capacity is exhausted, the buffer is marked as
+///     overflown and all the subsequent output is ignored.
+class TextBuffer
+{
+public:
+    /// @brief Constructor
+    /// @param[in] buf Output buffer.
+    /// @param[in] capacity Capacity of the output buffer.
+    TextBuffer(char* buf, std::size_t capacity)
+      : m_begin(buf),
+        m_cur(buf),
+        m_end(buf + capacity)
+    {
+    }
+
+    /// @brief Pointer to the beginning of the written text.
+    const char* data() const
+    {
+        return m_begin;
+    }
+
+    /// @brief Number of written characters.
+    std::size_t size() const
+    {
+        return static_cast<std::size_t>(m_cur - m_begin);
+    }
+
+    /// @brief Number of characters that can still be written.
+    std::size_t remaining() const
+    {
+        return static_cast<std::size_t>(m_end - m_cur);
+    }
+
+    /// @brief Check whether some output was dropped due to lack of space.
+    bool overflow() const
+    {
+        return m_overflow;
+    }
+
+    /// @brief Discard all the written text and clear the overflow indication.
+    void clear()
+    {
+        m_cur = m_begin;
+        m_overflow = false;
+    }
+
+    /// @brief Discard text written after the specified position.
+    void truncate(std::size_t len)
+    {
+        if (len < size()) {
+            m_cur = m_begin + len;
+        }
+    }
+
+    /// @brief Append single character.
+    void append(char ch)
+    {
+        if (m_cur == m_end) {
+            m_overflow = true;
+            return;
+        }
+
+        *m_cur = ch;
+        ++m_cur;
+    }
+
+    /// @brief Append sequence of characters.
+    void append(const char* str, std::size_t len)
+    {
+        if (remaining() < len) {
+            m_overflow = true;
+            return;
+        }
+
+        std::memcpy(m_cur, str, len);
+        m_cur += len;
+    }
+
+    /// @brief Append zero terminated string.
+    void append(const char* str)
+    {
+        append(str, std::strlen(str));
+    }
+
+    /// @brief Append the same character multiple times.
+    void appendFill(char ch, std::size_t count)
+    {
+        if (remaining() < count) {
+            m_overflow = true;
+            return;
+        }
+
+        std::memset(m_cur, ch, count);
+        m_cur += count;
+    }
+
+    /// @brief Append decimal representation of unsigned integer.
+    void appendUnsigned(std::uint64_t value)
+    {
+        char digits[MaxDigits];
+        auto len = formatUnsigned(value, digits);
+        append(&digits[MaxDigits - len], len);
+    }
+
+    /// @brief Append decimal representation of signed integer.
+    void appendSigned(std::int64_t value)
+    {
+        if (value < 0) {
+            append('-');
+            appendUnsigned(static_cast<std::uint64_t>(-(value + 1)) + 1U);
+            return;
+        }
+
+        appendUnsigned(static_cast<std::uint64_t>(value));
+    }
+
+    /// @brief Append fixed point decimal number.
+    /// @details Appends value of <b>value / 10^decimals</b> with exactly
+    ///     @b decimals digits after the decimal point.
+    void appendFixed(std::int64_t value, unsigned decimals)
+    {
+        if (decimals == 0U) {
+            appendSigned(value);
+            return;
+        }
+
+        std::uint64_t absValue = 0U;
+        if (value < 0) {
+            append('-');
+            absValue = static_cast<std::uint64_t>(-(value + 1)) + 1U;
+        }
+        else {
+            absValue = static_cast<std::uint64_t>(value);
+        }
+
+        char digits[MaxDigits];
+        auto len = formatUnsigned(absValue, digits);
+        if (len <= decimals) {
+            append('0');
+            append('.');
+            appendFill('0', decimals - len);
+            append(&digits[MaxDigits - len], len);
+            return;
+        }
+
+        auto intLen = len - decimals;
+        append(&digits[MaxDigits - len], intLen);
+        append('.');
+        append(&digits[MaxDigits - decimals], decimals);
+    }
+
+    /// @brief Append floating point number.
+    /// @details Uses plain notation for moderate exponents and scientific
+    ///     one otherwise, with at most @b precision significant digits and
+    ///     without trailing zeroes. Non-finite values are written as
+    ///     @b nonFinite string. The digits of precisions up to 15 are
+    ///     produced by scaling, the last digit may be off by one on the
+    ///     rounding boundaries. Higher precisions use correctly rounded
+    ///     conversion of the standard library, 17 digits are guaranteed
+    ///     to read back as the same value.
+    void appendDouble(double value, unsigned precision = 10U, const char* nonFinite = "null")
+    {
+        if (!std::isfinite(value)) {
+            append(nonFinite);
+            return;
+        }
+
+        if (value == 0.0) {
+            append('0');
+            return;
+        }
+
+        if (value < 0.0) {
+            append('-');
+            value = -value;
+        }
+
+        if (precision == 0U) {
+            precision = 1U;
+        }
+
+        if (MaxPrecision < precision) {
+            precision = MaxPrecision;
+        }
+
+        int exp = 0;
+        std::uint64_t mantissa = 0U;
+        if (MaxFastPrecision < precision) {
+            exactDigits(value, precision, mantissa, exp);
+        }
+        else {
+            fastDigits(value, precision, mantissa, exp);
+        }
+
+        char digits[MaxDigits];
+        auto len = formatUnsigned(mantissa, digits);
+        const char* digitsBegin = &digits[MaxDigits - len];
+        while ((1U < len) && (digitsBegin[len - 1] == '0')) {
+            --len;
+        }
+
+        if ((exp < -5) || (static_cast<int>(precision) <= exp)) {
+            append(digitsBegin[0]);
+            if (1U < len) {
+                append('.');
+                append(digitsBegin + 1, len - 1);
+            }
+            append('e');
+            appendSigned(exp);
+            return;
+        }
+
+        if (exp < 0) {
+            append('0');
+            append('.');
+            appendFill('0', static_cast<std::size_t>(-exp - 1));
+            append(digitsBegin, len);
+            return;
+        }
+
+        auto intLen = static_cast<std::size_t>(exp) + 1U;
+        if (len <= intLen) {
+            append(digitsBegin, len);
+            appendFill('0', intLen - len);
+            return;
+        }
+
+        append(digitsBegin, intLen);
+        append('.');
+        append(digitsBegin + intLen, len - intLen);
+    }
+
+    /// @brief Append unsigned integer right aligned in the field of
+    ///     specified width.
+    void appendUnsignedPadded(std::uint64_t value, std::size_t width, char pad = ' ')
+    {
+        char digits[MaxDigits];
+        auto len = formatUnsigned(value, digits);
+        if (len < width) {
+            appendFill(pad, width - len);
+        }
+        append(&digits[MaxDigits - len], len);
+    }
+
+    /// @brief Append floating point number in fixed point notation right
+    ///     aligned in the field of specified width (FORTRAN @b Fw.d format).
+    /// @details The field is filled with '*' characters when the value
+    ///     doesn't fit.
+    void appendFixedWidth(double value, std::size_t width, unsigned decimals)
+    {
+        static const double MaxScaled = 9e18;
+
+        auto scaled = value * pow10(static_cast<int>(decimals));
+        if ((!std::isfinite(scaled)) || (MaxScaled < std::fabs(scaled))) {
+            appendFill('*', width);
+            return;
+        }
+
+        auto rounded = std::llround(scaled);
+        auto negative = (rounded < 0);
+        auto absValue = static_cast<std::uint64_t>(negative ? -rounded : rounded);
+
+        char digits[MaxDigits];
+        auto len = formatUnsigned(absValue, digits);
+        auto intLen = (decimals < len) ? (len - decimals) : 1U;
+        auto total = (negative ? 1U : 0U) + intLen + ((decimals == 0U) ? 0U : (decimals + 1U));
+        if (width < total) {
+            appendFill('*', width);
+            return;
+        }
+
+        if (remaining() < width) {
+            m_overflow = true;
+            return;
+        }
+
+        appendFill(' ', width - total);
+        if (negative) {
+            append('-');
+        }
+
+        if (len <= decimals) {
+            append('0');
+        }
+        else {
+            append(&digits[MaxDigits - len], intLen);
+        }
+
+        if (decimals == 0U) {
+            return;
+        }
+
+        append('.');
+        if (len < decimals) {
+            appendFill('0', decimals - len);
+            append(&digits[MaxDigits - len], len);
+            return;
+        }
+
+        append(&digits[MaxDigits - decimals], decimals);
+    }
+
+    /// @brief Append floating point number in scientific notation right
+    ///     aligned in the field of specified width (FORTRAN @b Ew.d format
+    ///     with single leading digit and two digit exponent, e.g.
+    ///     @b -1.234500000000E-05).
+    /// @details The field is filled with '*' characters when the value
+    ///     doesn't fit.
+    void appendExponentWidth(double value, std::size_t width, unsigned decimals, char expChar = 'E')
+    {
+        static const std::size_t ExpLen = 4U; // E+dd
+
+        auto total = 1U + 1U + 1U + decimals + ExpLen; // sign, digit, point
+        if ((!std::isfinite(value)) || (width < total) || (MaxPrecision <= decimals)) {
+            appendFill('*', width);
+            return;
+        }
+
+        if (remaining() < width) {
+            m_overflow = true;
+            return;
+        }
+
+        static const int MinExp = -99;
+
+        auto negative = (value < 0.0);
+        auto absValue = std::fabs(value);
+        int exp = 0;
+        std::uint64_t mantissa = 0U;
+        if ((absValue != 0.0) && (MinExp <= static_cast<int>(std::floor(std::log10(absValue))))) {
+            // Values not representable with two digits exponent are written as zero
+            exp = static_cast<int>(std::floor(std::log10(absValue)));
+            mantissa =
+                static_cast<std::uint64_t>(
+                    std::llround(absValue * pow10(static_cast<int>(decimals) - exp)));
+            if (mantissa < pow10u(decimals)) {
+                --exp;
+                mantissa =
+                    static_cast<std::uint64_t>(
+                        std::llround(absValue * pow10(static_cast<int>(decimals) - exp)));
+            }
+
+            if (pow10u(decimals + 1U) <= mantissa) {
+                ++exp;
+                mantissa /= 10U;
+            }
+        }
+
+        if (mantissa == 0U) {
+            negative = false;
+        }
+
+        auto absExp = static_cast<unsigned>((exp < 0) ? -exp : exp);
+        if (99U < absExp) {
+            appendFill('*', width);
+            return;
+        }
+
+        char digits[MaxDigits];
+        auto len = formatUnsigned(mantissa, digits);
+        appendFill(' ', width - total);
+        append(negative ? '-' : ' ');
+        if (len <= decimals) {
+            append('0');
+            append('.');
+            appendFill('0', decimals + 1U - len - 1U);
+            append(&digits[MaxDigits - len], len);
+        }
+        else {
+            append(digits[MaxDigits - len]);
+            append('.');
+            append(&digits[MaxDigits - len + 1U], decimals);
+        }
+
+        append(expChar);
+        append((exp < 0) ? '-' : '+');
+        append(static_cast<char>('0' + (absExp / 10U)));
+        append(static_cast<char>('0' + (absExp % 10U)));
+    }
+
+    /// @brief Append string left aligned in the field of specified width.
+    /// @details Longer string is truncated.
+    void appendPadded(const char* str, std::size_t width)
+    {
+        auto len = std::strlen(str);
+        if (width < len) {
+            len = width;
+        }
+
+        append(str, len);
+        appendFill(' ', width - len);
+    }
+
+    /// @brief Append lower case hexadecimal representation of the bytes.
+    void appendHex(const std::uint8_t* bytes, std::size_t len)
+    {
+        static const char HexChars[] = "0123456789abcdef";
+        if (remaining() < (len * 2U)) {
+            m_overflow = true;
+            return;
+        }
+
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            *m_cur = HexChars[bytes[idx] >> 4];
+            ++m_cur;
+            *m_cur = HexChars[bytes[idx] & 0xf];
+            ++m_cur;
+        }
+    }
+
+private:
+    static const std::size_t MaxDigits = std::numeric_limits<std::uint64_t>::digits10 + 1;
+    static const unsigned MaxPrecision = 17U;
+    static const unsigned MaxFastPrecision = 15U;
+
+    static std::size_t formatUnsigned(std::uint64_t value, char (&digits)[MaxDigits])
+    {
+        std::size_t len = 0U;
+        do {
+            ++len;
+            digits[MaxDigits - len] = static_cast<char>('0' + (value % 10U));
+            value /= 10U;
+        } while (value != 0U);
+        return len;
+    }
+
+    static double pow10(int exp)
+    {
+        static const double Powers[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+            1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        static const int MaxTabled = static_cast<int>(sizeof(Powers) / sizeof(Powers[0])) - 1;
+
+        if ((0 <= exp) && (exp <= MaxTabled)) {
+            return Powers[exp];
+        }
+
+        if ((exp < 0) && (-MaxTabled <= exp)) {
+            return 1.0 / Powers[-exp];
+        }
+
+        return std::pow(10.0, exp);
+    }
+
+    // Multiplies by power of 10 in two steps when the power itself is not
+    // representable, as needed by the denormal values.
+    static double scalePow10(double value, int exp)
+    {
+        static const int MaxStep = 300;
+        if (MaxStep < exp) {
+            value *= pow10(MaxStep);
+            exp -= MaxStep;
+        }
+        return value * pow10(exp);
+    }
+
+    // Computes "precision" significant digits of the positive value and
+    // decimal exponent of the first one by scaling with power of 10.
+    static void fastDigits(double value, unsigned precision, std::uint64_t& mantissa, int& exp)
+    {
+        exp = static_cast<int>(std::floor(std::log10(value)));
+        mantissa =
+            static_cast<std::uint64_t>(
+                std::llround(scalePow10(value, static_cast<int>(precision) - 1 - exp)));
+        if (mantissa < pow10u(precision - 1U)) {
+            --exp;
+            mantissa =
+                static_cast<std::uint64_t>(
+                    std::llround(scalePow10(value, static_cast<int>(precision) - 1 - exp)));
+        }
+
+        if (pow10u(precision) <= mantissa) {
+            ++exp;
+            mantissa /= 10U;
+        }
+    }
+
+    // Same as fastDigits(), but correctly rounded, parses output of
+    // the "%.*e" conversion.
+    static void exactDigits(double value, unsigned precision, std::uint64_t& mantissa, int& exp)
+    {
+        char str[MaxPrecision + 16];
+        std::snprintf(str, sizeof(str), "%.*e", static_cast<int>(precision) - 1, value);
+
+        mantissa = 0U;
+        const char* pos = str;
+        for (; *pos != 'e'; ++pos) {
+            if (*pos != '.') {
+                mantissa = (mantissa * 10U) + static_cast<unsigned>(*pos - '0');
+            }
+        }
+
+        exp = static_cast<int>(std::strtol(pos + 1, nullptr, 10));
+    }
+
+    static std::uint64_t pow10u(unsigned exp)
+    {
+        std::uint64_t result = 1U;
+        for (auto idx = 0U; idx < exp; ++idx) {
+            result *= 10U;
+        }
+        return result;
+    }
+
+    char* m_begin = nullptr;
+    char* m_cur = nullptr;
+    char* m_end = nullptr;
+    bool m_overflow = false;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,664 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains definition of ublox::util::TimeService class and
+///     conversions between GNSS time scales.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "ublox/message/NavTimegps.h"
+#include "ublox/message/NavTimeutc.h"
+#include "ublox/message/NavTimels.h"
+#include "ublox/message/NavTimeglo.h"
+#include "ublox/message/NavTimebds.h"
+#include "ublox/message/NavTimegal.h"
+#include "ublox/util/SeqLock.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+/// @brief Time scale.
+/// @details Every time scale is expressed as number of nanoseconds since
+///     its own epoch:
+///     @li @b Gps - since 1980-01-06 00:00:00 (GPS week 0).
+///     @li @b Utc - since 1970-01-01 00:00:00 UTC (POSIX time, the leap
+///         seconds are not counted).
+///     @li @b Glonass - since 1996-01-01 00:00:00 of GLONASS time (UTC(SU) + 3h),
+///         i.e. start of the first four year interval (N4 = 1).
+///     @li @b BeiDou - since 2006-01-01 00:00:00 UTC (BDT week 0).
+///     @li @b Galileo - since 1999-08-22 00:00:00 GST (Galileo week 0).
+enum class TimeSystem : std::uint8_t
+{
+    Gps, ///< GPS time
+    Utc, ///< UTC
+    Glonass, ///< GLONASS time
+    BeiDou, ///< BeiDou time
+    Galileo, ///< Galileo system time
+    NumOfValues ///< number of available values
+};
+
+/// @brief Number of nanoseconds in second.
+static const std::int64_t NsPerSec = 1000000000LL;
+
+/// @brief Number of seconds in week.
+static const std::int64_t SecPerWeek = 604800LL;
+
+/// @brief Number of seconds in day.
+static const std::int64_t SecPerDay = 86400LL;
+
+/// @brief POSIX time of GPS epoch (1980-01-06 00:00:00 UTC).
+static const std::int64_t GpsEpochUnixSec = 315964800LL;
+
+/// @brief POSIX time of GLONASS epoch (1996-01-01 00:00:00 UTC).
+static const std::int64_t GlonassEpochUnixSec = 820454400LL;
+
+/// @brief Offset of GLONASS time from UTC, seconds.
+static const std::int64_t GlonassUtcOffsetSec = 3LL * 3600LL;
+
+/// @brief GPS week of BeiDou epoch.
+static const std::int64_t BeiDouEpochGpsWeek = 1356LL;
+
+/// @brief Offset of GPS time from BeiDou time, seconds.
+static const std::int64_t BeiDouGpsOffsetSec = 14LL;
+
+/// @brief GPS week of Galileo epoch.
+static const std::int64_t GalileoEpochGpsWeek = 1024LL;
+
+/// @brief Broken down UTC date and time.
+struct UtcDateTime
+{
+    std::int32_t year; ///< Year
+    std::uint8_t month; ///< Month, 1..12
+    std::uint8_t day; ///< Day of month, 1..31
+    std::uint8_t hour; ///< Hour of day, 0..23
+    std::uint8_t min; ///< Minute of hour, 0..59
+    std::uint8_t sec; ///< Seconds of minute, 0..59
+    std::int32_t nano; ///< Fraction of second, 0..999999999 ns
+};
+
+namespace details
+{
+
+/// @brief Number of days since 1970-01-01 of the civil date.
+inline std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day)
+{
+    year -= (month <= 2U) ? 1 : 0;
+    auto era = ((0 <= year) ? year : (year - 399)) / 400;
+    auto yoe = static_cast<unsigned>(year - (era * 400));
+    auto doy = ((153U * (month + ((2U < month) ? -3 : 9))) + 2U) / 5U + day - 1U;
+    auto doe = (yoe * 365U) + (yoe / 4U) - (yoe / 100U) + doy;
+    return (era * 146097) + static_cast<std::int64_t>(doe) - 719468;
+}
+
+/// @brief Civil date of the number of days since 1970-01-01.
+inline void civilFromDays(std::int64_t days, std::int32_t& year, std::uint8_t& month, std::uint8_t& day)
+{
+    days += 719468;
+    auto era = ((0 <= days) ? days : (days - 146096)) / 146097;
+    auto doe = static_cast<unsigned>(days - (era * 146097));
+    auto yoe = (doe - (doe / 1460U) + (doe / 36524U) - (doe / 146096U)) / 365U;
+    auto doy = doe - ((365U * yoe) + (yoe / 4U) - (yoe / 100U));
+    auto mp = ((5U * doy) + 2U) / 153U;
+    auto d = doy - (((153U * mp) + 2U) / 5U) + 1U;
+    auto m = (mp < 10U) ? (mp + 3U) : (mp - 9U);
+    year = static_cast<std::int32_t>(static_cast<std::int64_t>(yoe) + (era * 400) + ((m <= 2U) ? 1 : 0));
+    month = static_cast<std::uint8_t>(m);
+    day = static_cast<std::uint8_t>(d);
+}
+
+/// @brief Floor division.
+inline std::int64_t floorDiv(std::int64_t value, std::int64_t divisor)
+{
+    auto result = value / divisor;
+    if (((value % divisor) != 0) && ((value < 0) != (divisor < 0))) {
+        --result;
+    }
+    return result;
+}
+
+/// @brief Round to the closest whole number of seconds.
+inline std::int64_t roundSec(std::int64_t ns)
+{
+    return floorDiv(ns + (NsPerSec / 2), NsPerSec);
+}
+
+}  // namespace details
+
+/// @brief Convert POSIX time (ns) into broken down UTC date and time.
+inline UtcDateTime toUtcDateTime(std::int64_t utcNs)
+{
+    UtcDateTime result;
+    auto secs = details::floorDiv(utcNs, NsPerSec);
+    auto days = details::floorDiv(secs, SecPerDay);
+    auto secOfDay = secs - (days * SecPerDay);
+    details::civilFromDays(days, result.year, result.month, result.day);
+    result.hour = static_cast<std::uint8_t>(secOfDay / 3600);
+    result.min = static_cast<std::uint8_t>((secOfDay / 60) % 60);
+    result.sec = static_cast<std::uint8_t>(secOfDay % 60);
+    result.nano = static_cast<std::int32_t>(utcNs - (secs * NsPerSec));
+    return result;
+}
+
+/// @brief Convert broken down UTC date and time into POSIX time (ns).
+/// @details The leap second (sec = 60) is folded into the first second
+///     of the following minute, @b nano may be negative.
+inline std::int64_t fromUtcDateTime(
+    std::int32_t year,
+    unsigned month,
+    unsigned day,
+    unsigned hour,
+    unsigned min,
+    unsigned sec,
+    std::int32_t nano = 0)
+{
+    auto secs =
+        (details::daysFromCivil(year, month, day) * SecPerDay) +
+        (static_cast<std::int64_t>(hour) * 3600) +
+        (static_cast<std::int64_t>(min) * 60) +
+        static_cast<std::int64_t>(sec);
+    return (secs * NsPerSec) + nano;
+}
+
+/// @brief Convert broken down UTC date and time into POSIX time (ns).
+inline std::int64_t fromUtcDateTime(const UtcDateTime& dateTime)
+{
+    return
+        fromUtcDateTime(
+            dateTime.year,
+            dateTime.month,
+            dateTime.day,
+            dateTime.hour,
+            dateTime.min,
+            dateTime.sec,
+            dateTime.nano);
+}
+
+/// @brief Snapshot of the state required to convert between time scales.
+/// @details Trivially copyable, published by @ref TimeService. All the
+///     conversions are performed in constant time via GPS time. Between
+///     GPS, Galileo, and BeiDou time scales the nominal offsets are used,
+///     corrected by the offsets measured by the receiver (if reported).
+///     UTC and GLONASS time require known number of leap seconds. The
+///     scheduled leap second event is taken into account, during the
+///     inserted leap second the UTC time repeats the last second of the day.
+struct TimeConversion
+{
+    /// @brief Bits of @ref m_validMask
+    enum ValidBit
+    {
+        ValidBit_leapS, ///< Number of leap seconds is known
+        ValidBit_lsEvent, ///< Leap second event is scheduled
+        ValidBit_utcBias, ///< UTC offset is measured
+        ValidBit_glonassBias, ///< GLONASS time offset is measured
+        ValidBit_beiDouBias, ///< BeiDou time offset is measured
+        ValidBit_galileoBias, ///< Galileo time offset is measured
+        ValidBit_numOfValues ///< number of available values
+    };
+
+    std::int64_t m_lsEventGpsNs; ///< GPS time since which @ref m_lsChange is applied
+    std::int64_t m_biasNs[static_cast<std::size_t>(TimeSystem::NumOfValues)]; ///< Measured offsets from nominal
+    std::int8_t m_leapS; ///< Number of leap seconds (GPS - UTC)
+    std::int8_t m_lsChange; ///< Scheduled change of leap seconds
+    std::uint8_t m_validMask; ///< Validity bits, see @ref ValidBit
+
+    /// @brief Check validity bit.
+    bool isValid(ValidBit bit) const
+    {
+        return (m_validMask & (1U << bit)) != 0U;
+    }
+
+    /// @brief Check whether conversions to / from the time scale are available.
+    bool available(TimeSystem system) const
+    {
+        if ((system == TimeSystem::Utc) || (system == TimeSystem::Glonass)) {
+            return isValid(ValidBit_leapS);
+        }
+
+        return system < TimeSystem::NumOfValues;
+    }
+
+    /// @brief Number of leap seconds (GPS - UTC) at specified GPS time.
+    std::int64_t leapSeconds(std::int64_t gpsNs) const
+    {
+        if (isValid(ValidBit_lsEvent) && (m_lsEventGpsNs <= gpsNs)) {
+            return static_cast<std::int64_t>(m_leapS) + m_lsChange;
+        }
+
+        return m_leapS;
+    }
+
+    /// @brief Convert GPS time into UTC (POSIX time).
+    /// @details Requires known number of leap seconds.
+    std::int64_t gpsToUtc(std::int64_t gpsNs) const
+    {
+        return nominalFromGps(TimeSystem::Utc, gpsNs) + bias(TimeSystem::Utc);
+    }
+
+    /// @brief Convert UTC (POSIX time) into GPS time.
+    /// @details Requires known number of leap seconds.
+    std::int64_t utcToGps(std::int64_t utcNs) const
+    {
+        return nominalToGps(TimeSystem::Utc, utcNs - bias(TimeSystem::Utc));
+    }
+
+    /// @brief Convert time from one time scale into another.
+    /// @return @b false in case the conversion is not available.
+    bool convert(TimeSystem from, std::int64_t value, TimeSystem to, std::int64_t& result) const
+    {
+        if ((!available(from)) || (!available(to))) {
+            return false;
+        }
+
+        auto gpsNs = nominalToGps(from, value - bias(from));
+        result = nominalFromGps(to, gpsNs) + bias(to);
+        return true;
+    }
+
+    /// @brief Measured offset of the time scale from its nominal relation
+    ///     to GPS time, 0 if not measured.
+    std::int64_t bias(TimeSystem system) const
+    {
+        if (TimeSystem::NumOfValues <= system) {
+            return 0;
+        }
+        return m_biasNs[static_cast<std::size_t>(system)];
+    }
+
+    /// @brief Convert GPS time into time of other scale using nominal offsets.
+    std::int64_t nominalFromGps(TimeSystem system, std::int64_t gpsNs) const
+    {
+        switch (system) {
+        case TimeSystem::Utc:
+            return gpsNs + ((GpsEpochUnixSec - leapSeconds(gpsNs)) * NsPerSec);
+        case TimeSystem::Glonass:
+            return
+                gpsNs +
+                ((GpsEpochUnixSec - leapSeconds(gpsNs) + GlonassUtcOffsetSec - GlonassEpochUnixSec) * NsPerSec);
+        case TimeSystem::BeiDou:
+            return gpsNs - (((BeiDouEpochGpsWeek * SecPerWeek) + BeiDouGpsOffsetSec) * NsPerSec);
+        case TimeSystem::Galileo:
+            return gpsNs - (GalileoEpochGpsWeek * SecPerWeek * NsPerSec);
+        default:
+            break;
+        }
+        return gpsNs;
+    }
+
+    /// @brief Convert time of other scale into GPS time using nominal offsets.
+    std::int64_t nominalToGps(TimeSystem system, std::int64_t value) const
+    {
+        switch (system) {
+        case TimeSystem::Utc:
+            return utcToGpsNominal(value);
+        case TimeSystem::Glonass:
+            return utcToGpsNominal(value - ((GlonassUtcOffsetSec - GlonassEpochUnixSec) * NsPerSec));
+        case TimeSystem::BeiDou:
+            return value + (((BeiDouEpochGpsWeek * SecPerWeek) + BeiDouGpsOffsetSec) * NsPerSec);
+        case TimeSystem::Galileo:
+            return value + (GalileoEpochGpsWeek * SecPerWeek * NsPerSec);
+        default:
+            break;
+        }
+        return value;
+    }
+
+private:
+    std::int64_t utcToGpsNominal(std::int64_t utcNs) const
+    {
+        auto gpsNs = utcNs + ((static_cast<std::int64_t>(m_leapS) - GpsEpochUnixSec) * NsPerSec);
+        if ((!isValid(ValidBit_lsEvent)) || (m_lsChange == 0)) {
+            return gpsNs;
+        }
+
+        auto changedNs = gpsNs + (static_cast<std::int64_t>(m_lsChange) * NsPerSec);
+        if (0 < m_lsChange) {
+            // The repeated second (changedNs within the first second after
+            // the event) is mapped to its first occurrence (before the event)
+            return ((m_lsEventGpsNs + NsPerSec) <= changedNs) ? changedNs : gpsNs;
+        }
+
+        return (m_lsEventGpsNs <= changedNs) ? changedNs : gpsNs;
+    }
+};
+
+/// @brief Conversion service between GPS, UTC, GLONASS, BeiDou, and
+///     Galileo time scales.
+/// @details Intended to be used as a handler of the input messages. Keeps
+///     the number of leap seconds and scheduled leap second event reported
+///     by @b NAV-TIMEGPS, @b NAV-TIMELS, @b NAV-TIMEBDS, and @b NAV-TIMEGAL
+///     messages as well as offsets between the time scales measured by
+///     comparing @b NAV-TIMEUTC, @b NAV-TIMEGLO, @b NAV-TIMEBDS, and
+///     @b NAV-TIMEGAL with @b NAV-TIMEGPS of the same epoch. Other messages
+///     are ignored. The state is published as @ref TimeConversion via
+///     @ref SeqLock, so the conversions may be performed by any number of
+///     threads without locking, while the messages are handled by single
+///     (reading) thread.
+class TimeService
+{
+public:
+    /// @brief Constructor
+    TimeService()
+    {
+        std::memset(&m_state, 0, sizeof(m_state));
+        std::memset(&m_measured[0], 0, sizeof(m_measured));
+        m_published.store(m_state);
+    }
+
+    TimeService(const TimeService&) = delete;
+    TimeService& operator=(const TimeService&) = delete;
+
+    /// @brief Handle NAV-TIMEGPS message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimegps<TMsgBase>& msg)
+    {
+        static const std::uint32_t TowValidMask = 0x1;
+        static const std::uint32_t WeekValidMask = 0x2;
+        static const std::uint32_t LeapSValidMask = 0x4;
+
+        auto valid = static_cast<std::uint32_t>(msg.field_valid().value());
+        if ((valid & LeapSValidMask) != 0U) {
+            setLeapSeconds(msg.field_leapS().value());
+        }
+
+        if (((valid & TowValidMask) != 0U) && ((valid & WeekValidMask) != 0U)) {
+            auto& ref = m_measured[static_cast<std::size_t>(TimeSystem::Gps)];
+            ref.m_iTOW = msg.field_iTOW().value();
+            ref.m_ns =
+                (static_cast<std::int64_t>(msg.field_week().value()) * SecPerWeek * NsPerSec) +
+                (static_cast<std::int64_t>(msg.field_iTOW().value()) * 1000000LL) +
+                msg.field_fTOW().value();
+            ref.m_valid = true;
+
+            for (auto idx = static_cast<std::size_t>(TimeSystem::Utc); idx < MeasuredCount; ++idx) {
+                resolveBias(static_cast<TimeSystem>(idx));
+            }
+        }
+
+        publish();
+    }
+
+    /// @brief Handle NAV-TIMEUTC message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimeutc<TMsgBase>& msg)
+    {
+        static const std::uint32_t ValidUtcMask = 0x4;
+        if ((details::packedValue(msg.field_valid()) & ValidUtcMask) == 0U) {
+            return;
+        }
+
+        auto utcNs =
+            fromUtcDateTime(
+                msg.field_year().value(),
+                msg.field_month().value(),
+                msg.field_day().value(),
+                msg.field_hour().value(),
+                msg.field_min().value(),
+                msg.field_sec().value(),
+                msg.field_nano().value());
+        measure(TimeSystem::Utc, msg.field_iTOW().value(), utcNs);
+    }
+
+    /// @brief Handle NAV-TIMELS message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimels<TMsgBase>& msg)
+    {
+        static const std::uint32_t ValidCurrLsMask = 0x1;
+        static const std::uint32_t ValidTimeToLsEventMask = 0x2;
+
+        auto valid = static_cast<std::uint32_t>(msg.field_valid().value());
+        if ((valid & ValidCurrLsMask) == 0U) {
+            return;
+        }
+
+        auto leapS = msg.field_currLs().value();
+        m_state.m_leapS = static_cast<std::int8_t>(leapS);
+        m_state.m_validMask =
+            static_cast<std::uint8_t>(m_state.m_validMask | (1U << TimeConversion::ValidBit_leapS));
+
+        auto lsChange = msg.field_lsChange().value();
+        auto eventBit = static_cast<std::uint8_t>(1U << TimeConversion::ValidBit_lsEvent);
+        m_state.m_validMask = static_cast<std::uint8_t>(m_state.m_validMask & ~eventBit);
+        m_state.m_lsChange = 0;
+        if (((valid & ValidTimeToLsEventMask) != 0U) &&
+            (lsChange != 0) &&
+            (0 <= msg.field_timeToLsEvent().value())) {
+            // The leap second is applied at the end of UTC day DN of week WN,
+            // the new offset takes effect from the start of the inserted
+            // (or the end of the deleted) second.
+            auto endOfDaySec =
+                ((static_cast<std::int64_t>(msg.field_dateOfLsGpsWn().value()) * 7) +
+                 static_cast<std::int64_t>(msg.field_dateOfLsGpsDn().value())) * SecPerDay;
+            auto eventSec = endOfDaySec + leapS + ((lsChange < 0) ? lsChange : 0);
+            m_state.m_lsEventGpsNs = eventSec * NsPerSec;
+            m_state.m_lsChange = static_cast<std::int8_t>(lsChange);
+            m_state.m_validMask = static_cast<std::uint8_t>(m_state.m_validMask | eventBit);
+        }
+
+        publish();
+    }
+
+    /// @brief Handle NAV-TIMEGLO message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimeglo<TMsgBase>& msg)
+    {
+        static const std::uint32_t TodValidMask = 0x1;
+        static const std::uint32_t DateValidMask = 0x2;
+
+        auto valid = static_cast<std::uint32_t>(msg.field_valid().value());
+        if (((valid & TodValidMask) == 0U) || ((valid & DateValidMask) == 0U) ||
+            (msg.field_N4().value() == 0U) || (msg.field_Nt().value() == 0U)) {
+            return;
+        }
+
+        auto days =
+            ((static_cast<std::int64_t>(msg.field_N4().value()) - 1) * 1461) +
+            (static_cast<std::int64_t>(msg.field_Nt().value()) - 1);
+        auto gloNs =
+            (((days * SecPerDay) + static_cast<std::int64_t>(msg.field_TOD().value())) * NsPerSec) +
+            msg.field_fTOD().value();
+        measure(TimeSystem::Glonass, msg.field_iTOW().value(), gloNs);
+    }
+
+    /// @brief Handle NAV-TIMEBDS message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimebds<TMsgBase>& msg)
+    {
+        static const std::uint32_t SowValidMask = 0x1;
+        static const std::uint32_t WeekValidMask = 0x2;
+        static const std::uint32_t LeapSValidMask = 0x4;
+
+        auto valid = static_cast<std::uint32_t>(msg.field_valid().value());
+        if (((valid & LeapSValidMask) != 0U) && (!m_state.isValid(TimeConversion::ValidBit_leapS))) {
+            setLeapSeconds(msg.field_leapS().value() + BeiDouGpsOffsetSec);
+            publish();
+        }
+
+        if (((valid & SowValidMask) == 0U) || ((valid & WeekValidMask) == 0U)) {
+            return;
+        }
+
+        auto bdsNs =
+            (((static_cast<std::int64_t>(msg.field_week().value()) * SecPerWeek) +
+              static_cast<std::int64_t>(msg.field_SOW().value())) * NsPerSec) +
+            msg.field_fSOW().value();
+        measure(TimeSystem::BeiDou, msg.field_iTOW().value(), bdsNs);
+    }
+
+    /// @brief Handle NAV-TIMEGAL message.
+    template <typename TMsgBase>
+    void handle(const message::NavTimegal<TMsgBase>& msg)
+    {
+        static const std::uint32_t TowValidMask = 0x1;
+        static const std::uint32_t WnoValidMask = 0x2;
+        static const std::uint32_t LeapSValidMask = 0x4;
+
+        auto valid = static_cast<std::uint32_t>(msg.field_valid().value());
+        if (((valid & LeapSValidMask) != 0U) && (!m_state.isValid(TimeConversion::ValidBit_leapS))) {
+            setLeapSeconds(msg.field_leapS().value());
+            publish();
+        }
+
+        if (((valid & TowValidMask) == 0U) || ((valid & WnoValidMask) == 0U)) {
+            return;
+        }
+
+        auto galNs =
+            (((static_cast<std::int64_t>(msg.field_galWno().value()) * SecPerWeek) +
+              static_cast<std::int64_t>(msg.field_galTOW().value())) * NsPerSec) +
+            msg.field_fGalTOW().value();
+        measure(TimeSystem::Galileo, msg.field_iTOW().value(), galNs);
+    }
+
+    /// @brief Ignore all other messages.
+    template <typename TMsg>
+    void handle(const TMsg&)
+    {
+    }
+
+    /// @brief Get snapshot of the conversion state.
+    /// @details The snapshot may be used for multiple conversions
+    ///     without accessing the shared state.
+    TimeConversion conversion() const
+    {
+        return m_published.load();
+    }
+
+    /// @brief Convert time from one time scale into another.
+    /// @return @b false in case the conversion is not available.
+    bool convert(TimeSystem from, std::int64_t value, TimeSystem to, std::int64_t& result) const
+    {
+        return conversion().convert(from, value, to, result);
+    }
+
+    /// @brief Convert GPS time into UTC (POSIX time).
+    /// @return @b false in case the number of leap seconds is not known yet.
+    bool gpsToUtc(std::int64_t gpsNs, std::int64_t& utcNs) const
+    {
+        return convert(TimeSystem::Gps, gpsNs, TimeSystem::Utc, utcNs);
+    }
+
+    /// @brief Convert UTC (POSIX time) into GPS time.
+    /// @return @b false in case the number of leap seconds is not known yet.
+    bool utcToGps(std::int64_t utcNs, std::int64_t& gpsNs) const
+    {
+        return convert(TimeSystem::Utc, utcNs, TimeSystem::Gps, gpsNs);
+    }
+
+    /// @brief Sequence number of the published state.
+    /// @details Changes on every update of the state.
+    std::uint32_t sequence() const
+    {
+        return m_published.sequence();
+    }
+
+private:
+    static const std::size_t MeasuredCount = static_cast<std::size_t>(TimeSystem::NumOfValues);
+
+    struct Measurement
+    {
+        std::int64_t m_ns;
+        std::uint32_t m_iTOW;
+        bool m_valid;
+    };
+
+    /// @brief Update number of leap seconds reported for the current epoch.
+    /// @details The value reported after the scheduled event already
+    ///     includes the change, which is applied by @ref TimeConversion
+    ///     itself, so the state is kept intact. Any other value overrides
+    ///     the number of leap seconds and drops the scheduled event, which
+    ///     is announced again by the next NAV-TIMELS.
+    void setLeapSeconds(std::int64_t leapS)
+    {
+        auto eventBit = static_cast<std::uint8_t>(1U << TimeConversion::ValidBit_lsEvent);
+        if (m_state.isValid(TimeConversion::ValidBit_lsEvent)) {
+            if (leapS == (static_cast<std::int64_t>(m_state.m_leapS) + m_state.m_lsChange)) {
+                return;
+            }
+
+            if (leapS != m_state.m_leapS) {
+                m_state.m_validMask = static_cast<std::uint8_t>(m_state.m_validMask & ~eventBit);
+                m_state.m_lsChange = 0;
+            }
+        }
+
+        m_state.m_leapS = static_cast<std::int8_t>(leapS);
+        m_state.m_validMask =
+            static_cast<std::uint8_t>(m_state.m_validMask | (1U << TimeConversion::ValidBit_leapS));
+    }
+
+    void measure(TimeSystem system, std::uint32_t iTOW, std::int64_t ns)
+    {
+        auto& measurement = m_measured[static_cast<std::size_t>(system)];
+        measurement.m_ns = ns;
+        measurement.m_iTOW = iTOW;
+        measurement.m_valid = true;
+        if (resolveBias(system)) {
+            publish();
+        }
+    }
+
+    bool resolveBias(TimeSystem system)
+    {
+        auto& ref = m_measured[static_cast<std::size_t>(TimeSystem::Gps)];
+        auto& measurement = m_measured[static_cast<std::size_t>(system)];
+        if ((!ref.m_valid) || (!measurement.m_valid) || (ref.m_iTOW != measurement.m_iTOW)) {
+            return false;
+        }
+
+        auto bias = measurement.m_ns - m_state.nominalFromGps(system, ref.m_ns);
+        bool usesLeapS = (system == TimeSystem::Utc) || (system == TimeSystem::Glonass);
+        if (usesLeapS && (!m_state.isValid(TimeConversion::ValidBit_leapS))) {
+            // Derive number of leap seconds from the difference with GPS time
+            m_state.m_validMask = static_cast<std::uint8_t>(m_state.m_validMask | (1U << TimeConversion::ValidBit_leapS));
+            bias = measurement.m_ns - m_state.nominalFromGps(system, ref.m_ns);
+            auto wholeSec = details::roundSec(bias);
+            m_state.m_leapS = static_cast<std::int8_t>(m_state.m_leapS - wholeSec);
+            bias -= wholeSec * NsPerSec;
+        }
+
+        m_state.m_biasNs[static_cast<std::size_t>(system)] = bias;
+        auto bit = TimeConversion::ValidBit_utcBias + (static_cast<unsigned>(system) - static_cast<unsigned>(TimeSystem::Utc));
+        m_state.m_validMask = static_cast<std::uint8_t>(m_state.m_validMask | (1U << bit));
+        measurement.m_valid = false;
+        return true;
+    }
+
+    void publish()
+    {
+        m_published.store(m_state);
+    }
+
+    TimeConversion m_state;
+    Measurement m_measured[MeasuredCount];
+    SeqLock<TimeConversion> m_published;
+};
+
+}  // namespace util
+
+}  // namespace ublox
+
+
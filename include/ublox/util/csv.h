@@ -0,0 +1,474 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains functions serialising message fields into CSV.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "comms/comms.h"
+
+#include "ublox/util/TextBuffer.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Writes names of the CSV columns, expanding bundles and bitfields
+///     into separate columns.
+class CsvHeaderWriter
+{
+public:
+    CsvHeaderWriter(TextBuffer& buf, char separator)
+      : m_buf(buf),
+        m_separator(separator)
+    {
+    }
+
+    template <typename TTuple>
+    void writeMembers(const TTuple& members, const NamesTable& names, const char* prefix, std::size_t prefixLen)
+    {
+        MembersWriter membersWriter(*this, names, prefix, prefixLen);
+        tupleForEach(members, membersWriter);
+    }
+
+    std::size_t columns() const
+    {
+        return m_columns;
+    }
+
+private:
+    class MembersWriter
+    {
+    public:
+        MembersWriter(CsvHeaderWriter& writer, const NamesTable& names, const char* prefix, std::size_t prefixLen)
+          : m_writer(writer),
+            m_names(names),
+            m_prefix(prefix),
+            m_prefixLen(prefixLen)
+        {
+        }
+
+        template <std::size_t TIdx, typename TField>
+        void apply(const TField& field)
+        {
+            if (m_names.isReserved(TIdx)) {
+                return;
+            }
+
+            char nameBuf[MaxNameLen];
+            TextBuffer name(nameBuf, sizeof(nameBuf));
+            name.append(m_prefix, m_prefixLen);
+            if (0U < m_prefixLen) {
+                name.append('.');
+            }
+            m_names.write(name, TIdx, "f");
+            m_writer.writeColumns(field, name.data(), name.size(), FieldTag<TField>());
+        }
+
+    private:
+        CsvHeaderWriter& m_writer;
+        const NamesTable& m_names;
+        const char* m_prefix;
+        std::size_t m_prefixLen;
+    };
+
+    static const std::size_t MaxNameLen = 128U;
+
+    template <typename TField, typename TTag>
+    void writeColumns(const TField&, const char* name, std::size_t nameLen, TTag)
+    {
+        if (0U < m_columns) {
+            m_buf.append(m_separator);
+        }
+        m_buf.append(name, nameLen);
+        ++m_columns;
+    }
+
+    template <typename TField>
+    void writeColumns(const TField& field, const char* name, std::size_t nameLen, BundleTag)
+    {
+        writeMembers(field.value(), fieldMembersNames<TField>(), name, nameLen);
+    }
+
+    template <typename TField>
+    void writeColumns(const TField& field, const char* name, std::size_t nameLen, BitfieldTag)
+    {
+        writeMembers(field.value(), fieldMembersNames<TField>(), name, nameLen);
+    }
+
+    template <typename TField>
+    void writeColumns(const TField& field, const char* name, std::size_t nameLen, OptionalTag)
+    {
+        typedef typename std::decay<decltype(field.field())>::type InnerField;
+        writeColumns(field.field(), name, nameLen, FieldTag<InnerField>());
+    }
+
+    TextBuffer& m_buf;
+    char m_separator = ',';
+    std::size_t m_columns = 0U;
+};
+
+/// @brief Number of CSV columns the field occupies, computed once per field
+///     type by the header writer, i.e. with the same reserved members
+///     skipped as in the header.
+template <typename TField>
+std::size_t csvColumnsCount()
+{
+    static const std::size_t Count =
+        []() -> std::size_t
+        {
+            char dummy[1];
+            TextBuffer dummyBuf(dummy, 0U);
+            CsvHeaderWriter counter(dummyBuf, ',');
+            std::tuple<TField> field;
+            counter.writeMembers(field, NamesTable(nullptr), "", 0U);
+            return counter.columns();
+        }();
+    return Count;
+}
+
+/// @brief Writes values of the fields as CSV cells.
+class CsvRowWriter
+{
+public:
+    CsvRowWriter(TextBuffer& buf, char separator)
+      : m_buf(buf),
+        m_separator(separator)
+    {
+    }
+
+    template <typename TTuple>
+    void writeMembers(const TTuple& members, const NamesTable& names)
+    {
+        MembersWriter membersWriter(*this, names);
+        tupleForEach(members, membersWriter);
+    }
+
+private:
+    class MembersWriter
+    {
+    public:
+        MembersWriter(CsvRowWriter& writer, const NamesTable& names)
+          : m_writer(writer),
+            m_names(names)
+        {
+        }
+
+        template <std::size_t TIdx, typename TField>
+        void apply(const TField& field)
+        {
+            if (m_names.isReserved(TIdx)) {
+                return;
+            }
+
+            m_writer.writeCells(field, FieldTag<TField>());
+        }
+
+    private:
+        CsvRowWriter& m_writer;
+        const NamesTable& m_names;
+    };
+
+    /// @brief Writes fields of the list elements compactly into a single cell.
+    class ElemMembersWriter
+    {
+    public:
+        ElemMembersWriter(CsvRowWriter& writer, const NamesTable& names)
+          : m_writer(writer),
+            m_names(names)
+        {
+        }
+
+        template <std::size_t TIdx, typename TField>
+        void apply(const TField& field)
+        {
+            if (m_names.isReserved(TIdx)) {
+                return;
+            }
+
+            if (!m_first) {
+                m_writer.m_buf.append(' ');
+            }
+            m_first = false;
+            m_writer.writeValue(field, FieldTag<TField>());
+        }
+
+    private:
+        CsvRowWriter& m_writer;
+        const NamesTable& m_names;
+        bool m_first = true;
+    };
+
+    void startCell()
+    {
+        if (!m_first) {
+            m_buf.append(m_separator);
+        }
+        m_first = false;
+    }
+
+    template <typename TField, typename TTag>
+    void writeCells(const TField& field, TTag tag)
+    {
+        startCell();
+        writeValue(field, tag);
+    }
+
+    template <typename TField>
+    void writeCells(const TField& field, BundleTag)
+    {
+        writeMembers(field.value(), fieldMembersNames<TField>());
+    }
+
+    template <typename TField>
+    void writeCells(const TField& field, BitfieldTag)
+    {
+        writeMembers(field.value(), fieldMembersNames<TField>());
+    }
+
+    template <typename TField>
+    void writeCells(const TField& field, OptionalTag)
+    {
+        typedef typename std::decay<decltype(field.field())>::type InnerField;
+        if (field.getMode() != comms::field::OptionalMode::Missing) {
+            writeCells(field.field(), FieldTag<InnerField>());
+            return;
+        }
+
+        auto columns = csvColumnsCount<InnerField>();
+        for (std::size_t idx = 0U; idx < columns; ++idx) {
+            startCell();
+        }
+    }
+
+    template <typename TField, typename TValue, typename TScaling>
+    void writeValue(const TField& field, IntValueTag<TValue, TScaling>)
+    {
+        writeIntValue<TValue, TScaling>(m_buf, field.value(), "");
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, FloatValueTag)
+    {
+        typedef typename std::decay<decltype(field.value())>::type ValueType;
+        m_buf.appendDouble(
+            static_cast<double>(field.value()),
+            static_cast<unsigned>(std::numeric_limits<ValueType>::max_digits10),
+            "");
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, EnumValueTag)
+    {
+        typedef typename std::underlying_type<typename TField::ValueType>::type UnderlyingType;
+        auto value = static_cast<UnderlyingType>(field.value());
+        if (std::is_signed<UnderlyingType>::value) {
+            m_buf.appendSigned(static_cast<std::int64_t>(value));
+            return;
+        }
+        m_buf.appendUnsigned(static_cast<std::uint64_t>(value));
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, BitmaskValueTag)
+    {
+        auto& names = fieldBitsNames<TField>();
+        if (names.count() == 0U) {
+            m_buf.appendUnsigned(static_cast<std::uint64_t>(field.value()));
+            return;
+        }
+
+        auto value = static_cast<std::uint64_t>(field.value());
+        bool first = true;
+        for (std::size_t idx = 0U; (idx < 64U) && (value != 0U); ++idx) {
+            auto mask = static_cast<std::uint64_t>(1U) << idx;
+            if ((value & mask) == 0U) {
+                continue;
+            }
+
+            value &= ~mask;
+            if (!first) {
+                m_buf.append('|');
+            }
+            first = false;
+            names.write(m_buf, idx, "bit");
+        }
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, ArrayListTag)
+    {
+        typedef typename std::decay<decltype(field.value())>::type StorageType;
+        typedef typename StorageType::value_type ElemType;
+        writeList(
+            field.value(),
+            std::integral_constant<bool, std::is_integral<ElemType>::value && (sizeof(ElemType) == 1U)>());
+    }
+
+    template <typename TStorage>
+    void writeList(const TStorage& storage, std::true_type)
+    {
+        if (!storage.empty()) {
+            m_buf.appendHex(reinterpret_cast<const std::uint8_t*>(&storage[0]), storage.size());
+        }
+    }
+
+    template <typename TStorage>
+    void writeList(const TStorage& storage, std::false_type)
+    {
+        typedef typename TStorage::value_type ElemType;
+        bool first = true;
+        for (auto& elem : storage) {
+            if (!first) {
+                m_buf.append(';');
+            }
+            first = false;
+            writeElem(elem, std::is_integral<ElemType>());
+        }
+    }
+
+    template <typename TElem>
+    void writeElem(const TElem& elem, std::true_type)
+    {
+        if (std::is_signed<TElem>::value) {
+            m_buf.appendSigned(static_cast<std::int64_t>(elem));
+            return;
+        }
+        m_buf.appendUnsigned(static_cast<std::uint64_t>(elem));
+    }
+
+    template <typename TElem>
+    void writeElem(const TElem& elem, std::false_type)
+    {
+        writeValue(elem, FieldTag<TElem>());
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, StringTag)
+    {
+        auto& str = field.value();
+        m_buf.append('"');
+        for (std::size_t idx = 0U; idx < str.size(); ++idx) {
+            if (str[idx] == '"') {
+                m_buf.append('"');
+            }
+            m_buf.append(str[idx]);
+        }
+        m_buf.append('"');
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, BundleTag)
+    {
+        ElemMembersWriter membersWriter(*this, fieldMembersNames<TField>());
+        tupleForEach(field.value(), membersWriter);
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, BitfieldTag)
+    {
+        ElemMembersWriter membersWriter(*this, fieldMembersNames<TField>());
+        tupleForEach(field.value(), membersWriter);
+    }
+
+    template <typename TField>
+    void writeValue(const TField& field, OptionalTag)
+    {
+        typedef typename std::decay<decltype(field.field())>::type InnerField;
+        if (field.getMode() != comms::field::OptionalMode::Missing) {
+            writeValue(field.field(), FieldTag<InnerField>());
+        }
+    }
+
+    TextBuffer& m_buf;
+    char m_separator = ',';
+    bool m_first = true;
+};
+
+}  // namespace details
+
+/// @brief Write CSV header line for the message type.
+/// @details The columns are named after the fields of the message (see
+///     UBLOX_MSG_FIELDS_ACCESS() in names.h). The members of bundles and
+///     bitfields occupy separate columns named @b "field.member". The
+///     reserved fields are skipped. The line is terminated with new line
+///     character.
+/// @tparam TMsg Message type.
+/// @param[in, out] buf Output buffer.
+/// @param[in] separator Separator of the columns.
+/// @return @b true on success, @b false in case the buffer has been overflown.
+template <typename TMsg>
+bool writeCsvHeader(TextBuffer& buf, char separator = ',')
+{
+    typedef typename std::decay<decltype(std::declval<const TMsg&>().fields())>::type AllFields;
+    auto startLen = buf.size();
+    AllFields fields;
+    details::CsvHeaderWriter writer(buf, separator);
+    writer.writeMembers(fields, details::msgFieldsNames<TMsg>(), "", 0U);
+    buf.append('\n');
+    if (buf.overflow()) {
+        buf.truncate(startLen);
+        return false;
+    }
+    return true;
+}
+
+/// @brief Write values of the message fields as CSV line.
+/// @details The columns match the ones written by @ref writeCsvHeader().
+///     The scaled integral values are written in scaled units, the bitmasks
+///     as @b '|' separated names of the set bits, the lists of raw bytes as
+///     hexadecimal strings, and the lists of other fields as @b ';' separated
+///     elements inside single cell (with members of every element separated
+///     by space). Missing optional fields result in empty cells. No dynamic
+///     memory allocation is performed. The line is terminated with new line
+///     character.
+/// @param[in] msg Message object.
+/// @param[in, out] buf Output buffer.
+/// @param[in] separator Separator of the columns.
+/// @return @b true on success, @b false in case the buffer has been overflown.
+template <typename TMsg>
+bool writeCsv(const TMsg& msg, TextBuffer& buf, char separator = ',')
+{
+    auto startLen = buf.size();
+    details::CsvRowWriter writer(buf, separator);
+    writer.writeMembers(msg.fields(), details::msgFieldsNames<TMsg>());
+    buf.append('\n');
+    if (buf.overflow()) {
+        buf.truncate(startLen);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace util
+
+}  // namespace ublox
+
+
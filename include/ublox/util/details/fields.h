@@ -0,0 +1,490 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains compile time fields inspection helpers used by
+///     the serialisers.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <ratio>
+#include <tuple>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "ublox/util/TextBuffer.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Table of names split out of the comma separated list produced by
+///     the UBLOX_*() macros (see names.h).
+/// @details Every name is recorded with its index, which is its position in
+///     the list unless it is given explicitly as in @b UBLOX_BITMASK_BITS()
+///     (@b name=N), the following names continue from there.
+class NamesTable
+{
+public:
+    static const std::size_t MaxNames = 64U;
+
+    explicit NamesTable(const char* names)
+    {
+        if (names == nullptr) {
+            return;
+        }
+
+        auto isSpace =
+            [](char ch) -> bool
+            {
+                return (ch == ' ') || (ch == '\t') || (ch == '\n');
+            };
+
+        std::size_t nextIdx = 0U;
+        auto* pos = names;
+        while ((*pos != '\0') && (m_count < MaxNames)) {
+            while (isSpace(*pos) || (*pos == ',')) {
+                ++pos;
+            }
+
+            if (*pos == '\0') {
+                break;
+            }
+
+            auto* nameBegin = pos;
+            while ((*pos != '\0') && (*pos != ',') && (*pos != '=') && (!isSpace(*pos))) {
+                ++pos;
+            }
+
+            auto& name = m_names[m_count];
+            name.m_str = nameBegin;
+            name.m_len = static_cast<std::size_t>(pos - nameBegin);
+
+            while (isSpace(*pos)) {
+                ++pos;
+            }
+
+            if (*pos == '=') {
+                ++pos;
+                char* valueEnd = nullptr;
+                nextIdx = static_cast<std::size_t>(std::strtoul(pos, &valueEnd, 0));
+                pos = valueEnd;
+                while ((*pos != '\0') && (*pos != ',')) {
+                    ++pos;
+                }
+            }
+
+            name.m_idx = nextIdx;
+            ++nextIdx;
+            ++m_count;
+        }
+    }
+
+    std::size_t count() const
+    {
+        return m_count;
+    }
+
+    /// @brief Write name with specified index, falls back to @b prefix
+    ///     followed by index when there is no such name.
+    void write(TextBuffer& buf, std::size_t idx, const char* prefix) const
+    {
+        auto* name = find(idx);
+        if (name != nullptr) {
+            buf.append(name->m_str, name->m_len);
+            return;
+        }
+
+        buf.append(prefix);
+        buf.appendUnsigned(idx);
+    }
+
+    bool isReserved(std::size_t idx) const
+    {
+        static const char Prefix[] = "reserved";
+        static const std::size_t PrefixLen = sizeof(Prefix) - 1;
+        auto* name = find(idx);
+        return
+            (name != nullptr) &&
+            (PrefixLen <= name->m_len) &&
+            (std::memcmp(name->m_str, Prefix, PrefixLen) == 0);
+    }
+
+private:
+    struct Name
+    {
+        const char* m_str = nullptr;
+        std::size_t m_len = 0U;
+        std::size_t m_idx = 0U;
+    };
+
+    const Name* find(std::size_t idx) const
+    {
+        // Common case, no explicit indices
+        if ((idx < m_count) && (m_names[idx].m_idx == idx)) {
+            return &m_names[idx];
+        }
+
+        for (std::size_t pos = 0U; pos < m_count; ++pos) {
+            if (m_names[pos].m_idx == idx) {
+                return &m_names[pos];
+            }
+        }
+        return nullptr;
+    }
+
+    Name m_names[MaxNames];
+    std::size_t m_count = 0U;
+};
+
+template <typename T>
+struct HasFieldsNames
+{
+    template <typename U>
+    static std::true_type test(decltype(U::fieldsNames())*);
+
+    template <typename U>
+    static std::false_type test(...);
+
+    static const bool Value = decltype(test<T>(nullptr))::value;
+};
+
+template <typename T>
+struct HasMembersNames
+{
+    template <typename U>
+    static std::true_type test(decltype(U::membersNames())*);
+
+    template <typename U>
+    static std::false_type test(...);
+
+    static const bool Value = decltype(test<T>(nullptr))::value;
+};
+
+template <typename T>
+struct HasBitsNames
+{
+    template <typename U>
+    static std::true_type test(decltype(U::bitsNames())*);
+
+    template <typename U>
+    static std::false_type test(...);
+
+    static const bool Value = decltype(test<T>(nullptr))::value;
+};
+
+template <typename T>
+const char* fieldsNamesOf(std::true_type)
+{
+    return T::fieldsNames();
+}
+
+template <typename T>
+const char* fieldsNamesOf(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename T>
+const char* membersNamesOf(std::true_type)
+{
+    return T::membersNames();
+}
+
+template <typename T>
+const char* membersNamesOf(std::false_type)
+{
+    return nullptr;
+}
+
+template <typename T>
+const char* bitsNamesOf(std::true_type)
+{
+    return T::bitsNames();
+}
+
+template <typename T>
+const char* bitsNamesOf(std::false_type)
+{
+    return nullptr;
+}
+
+/// @brief Names of the message fields, parsed once per message type.
+template <typename TMsg>
+const NamesTable& msgFieldsNames()
+{
+    static const NamesTable Table(
+        fieldsNamesOf<TMsg>(std::integral_constant<bool, HasFieldsNames<TMsg>::Value>()));
+    return Table;
+}
+
+/// @brief Names of the bundle / bitfield members, parsed once per field type.
+template <typename TField>
+const NamesTable& fieldMembersNames()
+{
+    static const NamesTable Table(
+        membersNamesOf<TField>(std::integral_constant<bool, HasMembersNames<TField>::Value>()));
+    return Table;
+}
+
+/// @brief Names of the bitmask bits, parsed once per field type.
+template <typename TField>
+const NamesTable& fieldBitsNames()
+{
+    static const NamesTable Table(
+        bitsNamesOf<TField>(std::integral_constant<bool, HasBitsNames<TField>::Value>()));
+    return Table;
+}
+
+template <typename... TOptions>
+struct ScalingOf
+{
+    static const bool HasScaling = false;
+    typedef std::ratio<1, 1> Ratio;
+};
+
+template <std::intmax_t TNum, std::intmax_t TDenom, typename... TOptions>
+struct ScalingOf<comms::option::ScalingRatio<TNum, TDenom>, TOptions...>
+{
+    static const bool HasScaling = true;
+    typedef std::ratio<TNum, TDenom> Ratio;
+};
+
+template <typename TOpt, typename... TOptions>
+struct ScalingOf<TOpt, TOptions...> : public ScalingOf<TOptions...>
+{
+};
+
+template <std::intmax_t TValue>
+struct DecimalExponent
+{
+    static const int Value =
+        ((TValue % 10) != 0) ? -1 :
+            ((DecimalExponent<TValue / 10>::Value < 0) ? -1 : (DecimalExponent<TValue / 10>::Value + 1));
+};
+
+template <>
+struct DecimalExponent<1>
+{
+    static const int Value = 0;
+};
+
+template <>
+struct DecimalExponent<0>
+{
+    static const int Value = -1;
+};
+
+/// @brief Tag of integral value field.
+template <typename TValue, typename TScaling>
+struct IntValueTag {};
+
+/// @brief Tag of floating point value field.
+struct FloatValueTag {};
+
+/// @brief Tag of enum value field.
+struct EnumValueTag {};
+
+/// @brief Tag of bitmask value field.
+struct BitmaskValueTag {};
+
+/// @brief Tag of list field.
+struct ArrayListTag {};
+
+/// @brief Tag of string field.
+struct StringTag {};
+
+/// @brief Tag of bundle field.
+struct BundleTag {};
+
+/// @brief Tag of bitfield field.
+struct BitfieldTag {};
+
+/// @brief Tag of optional field.
+struct OptionalTag {};
+
+template <typename TBase, typename T, typename... TOptions>
+IntValueTag<T, ScalingOf<TOptions...> > fieldTagOf(const comms::field::IntValue<TBase, T, TOptions...>*);
+
+template <typename TBase, typename T, typename... TOptions>
+FloatValueTag fieldTagOf(const comms::field::FloatValue<TBase, T, TOptions...>*);
+
+template <typename TBase, typename T, typename... TOptions>
+EnumValueTag fieldTagOf(const comms::field::EnumValue<TBase, T, TOptions...>*);
+
+template <typename TBase, typename... TOptions>
+BitmaskValueTag fieldTagOf(const comms::field::BitmaskValue<TBase, TOptions...>*);
+
+template <typename TBase, typename TElem, typename... TOptions>
+ArrayListTag fieldTagOf(const comms::field::ArrayList<TBase, TElem, TOptions...>*);
+
+template <typename TBase, typename... TOptions>
+StringTag fieldTagOf(const comms::field::String<TBase, TOptions...>*);
+
+template <typename TBase, typename TMembers, typename... TOptions>
+BundleTag fieldTagOf(const comms::field::Bundle<TBase, TMembers, TOptions...>*);
+
+template <typename TBase, typename TMembers, typename... TOptions>
+BitfieldTag fieldTagOf(const comms::field::Bitfield<TBase, TMembers, TOptions...>*);
+
+template <typename TField, typename... TOptions>
+OptionalTag fieldTagOf(const comms::field::Optional<TField, TOptions...>*);
+
+/// @brief Tag of the field kind.
+template <typename TField>
+using FieldTag = decltype(fieldTagOf(static_cast<const TField*>(nullptr)));
+
+/// @brief Write value of integral field applying its scaling.
+/// @details Values scaled by negative power of 10 are written exactly as
+///     fixed point decimals, other scaled values as floating point ones.
+template <typename TValue, typename TScaling>
+void writeIntValue(TextBuffer& buf, TValue value, const char* nonFinite = "null")
+{
+    typedef typename TScaling::Ratio Ratio;
+    static const int DenomExp = DecimalExponent<Ratio::den>::Value;
+    static const bool IsDecimal = (Ratio::num == 1) && (0 <= DenomExp);
+
+    if (!TScaling::HasScaling) {
+        if (std::is_signed<TValue>::value) {
+            buf.appendSigned(static_cast<std::int64_t>(value));
+        }
+        else {
+            buf.appendUnsigned(static_cast<std::uint64_t>(value));
+        }
+        return;
+    }
+
+    if (IsDecimal) {
+        buf.appendFixed(static_cast<std::int64_t>(value), static_cast<unsigned>(DenomExp));
+        return;
+    }
+
+    buf.appendDouble(
+        (static_cast<double>(value) * Ratio::num) / Ratio::den, 10U, nonFinite);
+}
+
+/// @brief Get serialised (little endian) value of the field of up to
+///     4 bytes long, such as bitfield, as single integer.
+template <typename TField>
+std::uint32_t packedValue(const TField& field)
+{
+    static_assert(TField::maxLength() <= sizeof(std::uint32_t), "The field is too long");
+    std::uint8_t buf[sizeof(std::uint32_t)] = {0};
+    auto* iter = &buf[0];
+    field.write(iter, sizeof(buf));
+    return
+        static_cast<std::uint32_t>(buf[0]) |
+        (static_cast<std::uint32_t>(buf[1]) << 8) |
+        (static_cast<std::uint32_t>(buf[2]) << 16) |
+        (static_cast<std::uint32_t>(buf[3]) << 24);
+}
+
+/// @brief Maximal serialisation length of all the fields bundled in the tuple.
+template <typename TFields>
+struct FieldsMaxLength;
+
+template <>
+struct FieldsMaxLength<std::tuple<> >
+{
+    static const std::size_t Value = 0U;
+};
+
+template <typename TField, typename... TFields>
+struct FieldsMaxLength<std::tuple<TField, TFields...> >
+{
+    static const std::size_t Rest = FieldsMaxLength<std::tuple<TFields...> >::Value;
+
+    // Saturates instead of wrapping around for unlimited lists
+    static const std::size_t Value =
+        (Rest <= (std::numeric_limits<std::size_t>::max() - TField::maxLength())) ?
+            TField::maxLength() + Rest :
+            std::numeric_limits<std::size_t>::max();
+};
+
+/// @brief Index of the type in the tuple.
+/// @details @b Found member reports whether the type is present.
+template <typename T, typename TTuple>
+struct TupleIndexOf;
+
+template <typename T>
+struct TupleIndexOf<T, std::tuple<> >
+{
+    static const bool Found = false;
+    static const std::size_t Value = 0U;
+};
+
+template <typename T, typename... TTypes>
+struct TupleIndexOf<T, std::tuple<T, TTypes...> >
+{
+    static const bool Found = true;
+    static const std::size_t Value = 0U;
+};
+
+template <typename T, typename TFirst, typename... TTypes>
+struct TupleIndexOf<T, std::tuple<TFirst, TTypes...> >
+{
+    static const bool Found = TupleIndexOf<T, std::tuple<TTypes...> >::Found;
+    static const std::size_t Value = TupleIndexOf<T, std::tuple<TTypes...> >::Value + 1U;
+};
+
+/// @brief Compile time iteration over the tuple elements.
+template <std::size_t TIdx, std::size_t TCount>
+struct TupleForEach
+{
+    template <typename TTuple, typename TFunc>
+    static void exec(TTuple& tuple, TFunc& func)
+    {
+        func.template apply<TIdx>(std::get<TIdx>(tuple));
+        TupleForEach<TIdx + 1, TCount>::exec(tuple, func);
+    }
+};
+
+template <std::size_t TCount>
+struct TupleForEach<TCount, TCount>
+{
+    template <typename TTuple, typename TFunc>
+    static void exec(TTuple&, TFunc&)
+    {
+    }
+};
+
+/// @brief Invoke @b func.apply<Idx>(elem) for every element of the tuple.
+template <typename TTuple, typename TFunc>
+void tupleForEach(TTuple& tuple, TFunc& func)
+{
+    typedef typename std::decay<TTuple>::type TupleType;
+    TupleForEach<0, std::tuple_size<TupleType>::value>::exec(tuple, func);
+}
+
+}  // namespace details
+
+}  // namespace util
+
+}  // namespace ublox
+
+
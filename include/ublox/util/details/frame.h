@@ -0,0 +1,74 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains UBX framing helpers used by the utilities keeping
+///     pre-serialised frames.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "comms/comms.h"
+
+#include "ublox/MsgId.h"
+#include "ublox/protocol/Frame.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Append complete UBX frame to the buffer.
+inline void appendFrame(
+    MsgId id,
+    const std::uint8_t* payload,
+    std::size_t len,
+    std::vector<std::uint8_t>& buf)
+{
+    auto begin = buf.size();
+    buf.resize(begin + protocol::frameLength(len));
+    protocol::writeFrame(id, payload, len, &buf[begin]);
+}
+
+/// @brief Serialise payload of the message.
+/// @return @b true on success.
+template <typename TMsg>
+bool writePayload(const TMsg& msg, std::vector<std::uint8_t>& payload)
+{
+    payload.resize(msg.doLength());
+    if (payload.empty()) {
+        return true;
+    }
+
+    std::uint8_t* iter = &payload[0];
+    return msg.doWrite(iter, payload.size()) == comms::ErrorStatus::Success;
+}
+
+}  // namespace details
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,359 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains internal helpers of ublox::util::NavDataDecoder.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Encoding of the signed navigation data fields.
+enum class NavSign : std::uint8_t
+{
+    Unsigned, ///< Unsigned value
+    TwosComplement, ///< Two's complement
+    SignMagnitude ///< Sign bit followed by magnitude (GLONASS)
+};
+
+/// @brief Precomputed location of the field (up to two segments, up to
+///     32 bits in total) in the navigation data stream.
+/// @details The stream is a sequence of 32 bit words, bits numbered from
+///     the most significant bit of the first word. Every segment is read
+///     with single 64 bit shift and mask of two consecutive words, so the
+///     stream must have one spare word at its end.
+struct NavField
+{
+    /// @brief Single segment field.
+    constexpr NavField(unsigned pos, unsigned len, NavSign sign = NavSign::Unsigned)
+      : m_word1(pos / 32U),
+        m_shift1(64U - (pos % 32U) - len),
+        m_mask1(maskOf(len)),
+        m_word2(0U),
+        m_shift2(0U),
+        m_mask2(0U),
+        m_len2(0U),
+        m_signBit(1U << (len - 1U)),
+        m_sign(sign)
+    {
+    }
+
+    /// @brief Field split into two segments, the first one holds the most
+    ///     significant bits.
+    constexpr NavField(unsigned pos1, unsigned len1, unsigned pos2, unsigned len2, NavSign sign = NavSign::Unsigned)
+      : m_word1(pos1 / 32U),
+        m_shift1(64U - (pos1 % 32U) - len1),
+        m_mask1(maskOf(len1)),
+        m_word2(pos2 / 32U),
+        m_shift2(64U - (pos2 % 32U) - len2),
+        m_mask2(maskOf(len2)),
+        m_len2(len2),
+        m_signBit(1U << (len1 + len2 - 1U)),
+        m_sign(sign)
+    {
+    }
+
+    /// @brief Mask of the specified number of least significant bits.
+    static constexpr std::uint32_t maskOf(unsigned len)
+    {
+        return (32U <= len) ? 0xffffffffU : ((1U << len) - 1U);
+    }
+
+    std::uint8_t m_word1;
+    std::uint8_t m_shift1;
+    std::uint32_t m_mask1;
+    std::uint8_t m_word2;
+    std::uint8_t m_shift2;
+    std::uint32_t m_mask2;
+    std::uint8_t m_len2;
+    std::uint32_t m_signBit;
+    NavSign m_sign;
+};
+
+/// @brief Read raw (unsigned) bits of single segment.
+inline std::uint32_t navSegment(const std::uint32_t* stream, unsigned word, unsigned shift, std::uint32_t mask)
+{
+    auto pair =
+        (static_cast<std::uint64_t>(stream[word]) << 32) |
+        static_cast<std::uint64_t>(stream[word + 1]);
+    return static_cast<std::uint32_t>(pair >> shift) & mask;
+}
+
+/// @brief Read raw (unsigned) bits of the field.
+inline std::uint32_t navBits(const std::uint32_t* stream, const NavField& field)
+{
+    auto value = navSegment(stream, field.m_word1, field.m_shift1, field.m_mask1);
+    if (field.m_len2 != 0U) {
+        value =
+            (value << field.m_len2) |
+            navSegment(stream, field.m_word2, field.m_shift2, field.m_mask2);
+    }
+    return value;
+}
+
+/// @brief Read value of the field.
+inline std::int64_t navValue(const std::uint32_t* stream, const NavField& field)
+{
+    auto raw = navBits(stream, field);
+    if ((field.m_sign == NavSign::Unsigned) || ((raw & field.m_signBit) == 0U)) {
+        return static_cast<std::int64_t>(raw);
+    }
+
+    if (field.m_sign == NavSign::SignMagnitude) {
+        return -static_cast<std::int64_t>(raw & (field.m_signBit - 1U));
+    }
+
+    return static_cast<std::int64_t>(raw) - (static_cast<std::int64_t>(field.m_signBit) << 1);
+}
+
+/// @brief Power of 2.
+constexpr double navPow2(int exp)
+{
+    return (exp == 0) ? 1.0 : ((0 < exp) ? (2.0 * navPow2(exp - 1)) : (0.5 * navPow2(exp + 1)));
+}
+
+/// @brief Semi-circle in radians.
+static const double NavSemiCircle = 3.1415926535898;
+
+/// @brief Scaled floating point field of the decoded structure.
+template <typename TObj>
+struct NavFieldSpec
+{
+    NavField m_field; ///< Location
+    double m_scale; ///< Scaling factor
+    double TObj::* m_member; ///< Destination member
+};
+
+/// @brief Decode all the fields listed in the table.
+template <typename TObj, std::size_t TSize>
+void navApply(const std::uint32_t* stream, const NavFieldSpec<TObj> (&table)[TSize], TObj& obj)
+{
+    for (auto& spec : table) {
+        obj.*(spec.m_member) = static_cast<double>(navValue(stream, spec.m_field)) * spec.m_scale;
+    }
+}
+
+/// @brief Writer of MSB first bit stream.
+class NavBitWriter
+{
+public:
+    /// @brief Constructor
+    /// @param[out] stream Output stream, must be zero initialised.
+    explicit NavBitWriter(std::uint32_t* stream) : m_stream(stream) {}
+
+    /// @brief Append up to 32 least significant bits of the value.
+    void append(std::uint32_t value, unsigned len)
+    {
+        m_acc = (m_acc << len) | (static_cast<std::uint64_t>(value) & NavField::maskOf(len));
+        m_bits += len;
+        if (32U <= m_bits) {
+            m_bits -= 32U;
+            *m_stream = static_cast<std::uint32_t>(m_acc >> m_bits);
+            ++m_stream;
+        }
+    }
+
+    /// @brief Write remaining bits.
+    void flush()
+    {
+        if (m_bits != 0U) {
+            *m_stream = static_cast<std::uint32_t>(m_acc << (32U - m_bits));
+            m_bits = 0U;
+        }
+    }
+
+private:
+    std::uint32_t* m_stream = nullptr;
+    std::uint64_t m_acc = 0U;
+    unsigned m_bits = 0U;
+};
+
+/// @brief Number of set bits.
+inline unsigned popCount(std::uint32_t value)
+{
+    value = value - ((value >> 1) & 0x55555555U);
+    value = (value & 0x33333333U) + ((value >> 2) & 0x33333333U);
+    value = (value + (value >> 4)) & 0x0f0f0f0fU;
+    return static_cast<unsigned>((value * 0x01010101U) >> 24);
+}
+
+/// @brief Check parity of GPS / QZSS LNAV word (IS-GPS-200, 20.3.5.2).
+/// @param[in] word Word with D29* and D30* of the previous word in bits
+///     31-30, source data bits d1-d24 in bits 29-6, and parity in bits 5-0.
+inline bool gpsParityOk(std::uint32_t word)
+{
+    static const std::uint32_t Masks[] = {
+        0xbb1f3480U, 0x5d8f9a40U, 0xaec7cd00U, 0x5763e680U, 0x6bb1f340U, 0x8b7a89c0U
+    };
+
+    std::uint32_t parity = 0U;
+    for (auto mask : Masks) {
+        parity = (parity << 1) | (popCount(word & mask) & 0x1U);
+    }
+    return parity == (word & 0x3fU);
+}
+
+/// @brief Remainder of BCH(15,11) code word (BeiDou ICD, 5.1.3),
+///     0 for valid code word.
+inline std::uint32_t bch1511Syndrome(std::uint32_t codeWord)
+{
+    // Generator x^4 + x + 1, remainders of the contributions of every byte
+    struct Table
+    {
+        Table()
+        {
+            for (std::uint32_t value = 0U; value < 256U; ++value) {
+                m_low[value] = remainder(value);
+                m_high[value] = remainder(value << 8);
+            }
+        }
+
+        static std::uint8_t remainder(std::uint32_t value)
+        {
+            for (int bit = 14; 4 <= bit; --bit) {
+                if ((value & (1U << bit)) != 0U) {
+                    value ^= (0x13U << (bit - 4));
+                }
+            }
+            return static_cast<std::uint8_t>(value);
+        }
+
+        std::uint8_t m_low[256];
+        std::uint8_t m_high[256];
+    };
+
+    static const Table Tab;
+    return static_cast<std::uint32_t>(Tab.m_low[codeWord & 0xffU] ^ Tab.m_high[(codeWord >> 8) & 0x7fU]);
+}
+
+/// @brief Check Hamming code of GLONASS string (GLONASS ICD, 4.7).
+/// @details Accepts the string without errors or with single error in
+///     the check bits.
+/// @param[in] stream String, MSB first, bit 85 of the string (idle bit)
+///     being the most significant bit of the first word.
+inline bool glonassHammingOk(const std::uint32_t* stream)
+{
+    static const unsigned ChecksCount = 7U;
+    static const unsigned WordsCount = 3U;
+
+    // Data bits b9-b85 are assigned to the Hamming positions 3, 5, 6, 7, 9, ...
+    // (skipping powers of two), check bit Ck covers the data bits with
+    // bit (k - 1) set in its position.
+    struct Masks
+    {
+        Masks()
+        {
+            for (auto& masks : m_checks) {
+                for (auto& mask : masks) {
+                    mask = 0U;
+                }
+            }
+
+            unsigned position = 2U;
+            for (unsigned bitNum = 9U; bitNum <= 85U; ++bitNum) {
+                do {
+                    ++position;
+                } while ((position & (position - 1U)) == 0U);
+
+                auto streamPos = 85U - bitNum;
+                for (unsigned check = 0U; check < ChecksCount; ++check) {
+                    if ((position & (1U << check)) != 0U) {
+                        m_checks[check][streamPos / 32U] |= (0x80000000U >> (streamPos % 32U));
+                    }
+                }
+            }
+        }
+
+        std::uint32_t m_checks[ChecksCount][WordsCount];
+    };
+
+    static const Masks Tab;
+    static const std::uint32_t LastWordMask = 0xfffff800U; // b21-b1 in the last word
+
+    unsigned failedCount = 0U;
+    for (unsigned check = 0U; check < ChecksCount; ++check) {
+        unsigned count = 0U;
+        for (unsigned word = 0U; word < WordsCount; ++word) {
+            count += popCount(stream[word] & Tab.m_checks[check][word]);
+        }
+
+        auto checkPos = 85U - (check + 1U);
+        auto checkBit = (stream[checkPos / 32U] >> (31U - (checkPos % 32U))) & 0x1U;
+        if (((count + checkBit) & 0x1U) != 0U) {
+            ++failedCount;
+        }
+    }
+
+    auto overall =
+        (popCount(stream[0]) + popCount(stream[1]) + popCount(stream[2] & LastWordMask)) & 0x1U;
+
+    if (failedCount == 0U) {
+        return overall == 0U;
+    }
+
+    return (failedCount == 1U) && (overall == 1U);
+}
+
+/// @brief Calculate CRC-24Q (used by Galileo I/NAV and RTCM 3).
+/// @param[in] data Data bytes.
+/// @param[in] len Number of bytes.
+/// @param[in] crc Initial value.
+inline std::uint32_t crc24q(const std::uint8_t* data, std::size_t len, std::uint32_t crc = 0U)
+{
+    struct Table
+    {
+        Table()
+        {
+            for (std::uint32_t value = 0U; value < 256U; ++value) {
+                auto entry = value << 16;
+                for (unsigned bit = 0U; bit < 8U; ++bit) {
+                    entry <<= 1;
+                    if ((entry & 0x1000000U) != 0U) {
+                        entry ^= 0x1864cfbU;
+                    }
+                }
+                m_values[value] = entry & 0xffffffU;
+            }
+        }
+
+        std::uint32_t m_values[256];
+    };
+
+    static const Table Tab;
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        crc = ((crc << 8) & 0xffffffU) ^ Tab.m_values[((crc >> 16) ^ data[idx]) & 0xffU];
+    }
+    return crc;
+}
+
+}  // namespace details
+
+}  // namespace util
+
+}  // namespace ublox
+
+
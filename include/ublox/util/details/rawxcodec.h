@@ -0,0 +1,411 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains internal helpers of ublox::util::RawxArchiveEncoder and
+///     ublox::util::RawxArchiveDecoder.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+
+#include "ublox/field/common.h"
+#include "ublox/util/SatelliteTable.h"
+#include "ublox/util/details/rtcm.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Length of RXM-RAWX payload header.
+static const std::size_t RawxHeaderLen = 16U;
+
+/// @brief Length of single measurement block of RXM-RAWX payload.
+static const std::size_t RawxMeasLen = 32U;
+
+/// @brief Maximal number of measurements of RXM-RAWX.
+static const std::size_t RawxMaxMeas = 255U;
+
+/// @brief Maximal length of RXM-RAWX payload.
+static const std::size_t RawxMaxPayloadLen = RawxHeaderLen + (RawxMaxMeas * RawxMeasLen);
+
+/// @brief Offsets of the measurement bytes copied without prediction
+///     (cno, prStdev, cpStdev, doStdev, trkStat, reserved3).
+static const std::size_t RawxAuxOffsets[] = {26U, 27U, 28U, 29U, 30U, 31U};
+
+/// @brief Number of @ref RawxAuxOffsets.
+static const std::size_t RawxAuxCount = sizeof(RawxAuxOffsets) / sizeof(RawxAuxOffsets[0]);
+
+/// @brief Offsets of the measurement identity bytes (gnssId, svId,
+///     reserved2, freqId).
+static const std::size_t RawxIdOffsets[] = {20U, 21U, 22U, 23U};
+
+/// @brief Number of @ref RawxIdOffsets.
+static const std::size_t RawxIdCount = sizeof(RawxIdOffsets) / sizeof(RawxIdOffsets[0]);
+
+/// @brief Offsets of the header bytes coded as "same as previous" flag
+///     followed by optional literal (leapS, recStat, version, reserved1).
+static const std::size_t RawxHeaderMiscOffsets[] = {10U, 12U, 13U, 14U, 15U};
+
+/// @brief Read little endian value.
+template <typename T>
+T rawxLoad(const std::uint8_t* data)
+{
+    T value = 0U;
+    for (std::size_t idx = sizeof(T); 0U < idx; --idx) {
+        value = static_cast<T>((value << 8) | data[idx - 1U]);
+    }
+    return value;
+}
+
+/// @brief Write little endian value.
+template <typename T>
+void rawxStore(std::uint8_t* data, T value)
+{
+    for (std::size_t idx = 0U; idx < sizeof(T); ++idx) {
+        data[idx] = static_cast<std::uint8_t>(value);
+        value = static_cast<T>(value >> 8);
+    }
+}
+
+/// @brief Map signed value into unsigned one with small magnitude values
+///     being small.
+inline std::uint64_t rawxZigZag(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(-static_cast<std::int64_t>(value < 0));
+}
+
+/// @brief Inverse of @ref rawxZigZag().
+inline std::int64_t rawxUnZigZag(std::uint64_t value)
+{
+    return static_cast<std::int64_t>((value >> 1) ^ (~(value & 0x1U) + 1U));
+}
+
+/// @brief Number of significant bits.
+inline unsigned rawxBitLength(std::uint64_t value)
+{
+    unsigned len = 0U;
+    while (value != 0U) {
+        ++len;
+        value >>= 1;
+    }
+    return len;
+}
+
+/// @brief Add the delta expressed as @b numerator * 2^-fracBits / divisor
+///     to the IEEE 754 double by integer arithmetic on its representation.
+/// @details Used for the predictions, which must be reproduced bit
+///     exactly by the decoder regardless of the floating point
+///     environment. The delta too large (or too small) to be represented
+///     is ignored.
+inline std::uint64_t rawxAddDelta(std::uint64_t bits, std::int64_t numerator, int fracBits, std::int64_t divisor)
+{
+    static const unsigned MantissaBits = 52U;
+    static const std::uint64_t ExpMask = 0x7ff;
+    static const int ExpBias = 1023;
+    static const int MaxShift = 40;
+
+    auto exp = static_cast<int>((bits >> MantissaBits) & ExpMask);
+    if ((exp == 0) || (exp == static_cast<int>(ExpMask))) {
+        return bits; // Zero, denormal, or not finite
+    }
+
+    // Value of ULP is 2^(exp - bias - 52)
+    auto shift = -fracBits - (exp - ExpBias - static_cast<int>(MantissaBits));
+    std::int64_t ulps = 0;
+    if (0 <= shift) {
+        if ((MaxShift < shift) ||
+            ((static_cast<std::int64_t>(1) << (62 - shift)) <= ((numerator < 0) ? -numerator : numerator))) {
+            return bits;
+        }
+        ulps = (numerator * (static_cast<std::int64_t>(1) << shift)) / divisor;
+    }
+    else {
+        if (MaxShift < -shift) {
+            return bits;
+        }
+        ulps = numerator / (divisor * (static_cast<std::int64_t>(1) << (-shift)));
+    }
+
+    if ((bits >> 63) != 0U) {
+        ulps = -ulps; // Representation grows with magnitude
+    }
+    return bits + static_cast<std::uint64_t>(ulps);
+}
+
+/// @brief Prediction model shared by RXM-RAWX archive encoder and
+///     decoder.
+/// @details Keeps the previous measurement of every signal in a flat table
+///     indexed by the satellite (@ref SatelliteTable::indexOf()) and the
+///     signal slot (reserved2 byte), and the identities of the previous
+///     epoch measurements.
+class RawxCodecModel
+{
+public:
+    /// @brief Measurement values in their binary representation.
+    struct Meas
+    {
+        std::uint64_t m_pr;
+        std::uint64_t m_cp;
+        std::uint32_t m_doppler;
+        std::uint16_t m_locktime;
+        std::uint8_t m_ids[RawxIdCount];
+        std::uint8_t m_aux[RawxAuxCount];
+    };
+
+    /// @brief Predicted values of the measurement.
+    struct Prediction
+    {
+        std::uint64_t m_pr;
+        std::uint64_t m_cp;
+        std::uint16_t m_locktime;
+        std::uint8_t m_aux[RawxAuxCount];
+    };
+
+    RawxCodecModel()
+    {
+        static const int FreqIdCount = 14;
+        static const double WavelengthScale = 1048576.0; // 2^20
+        for (std::size_t gnss = 0U; gnss < GnssCount; ++gnss) {
+            for (int freqId = 0; freqId < FreqIdCount; ++freqId) {
+                auto freq = rtcmCarrierFreq(static_cast<field::common::GnssId>(gnss), static_cast<unsigned>(freqId));
+                m_wavelength[gnss][freqId] = std::llround((RtcmSpeedOfLight / freq) * WavelengthScale);
+            }
+        }
+
+        std::memset(&m_states[0], 0, sizeof(m_states));
+        std::memset(&m_prevIds[0][0], 0, sizeof(m_prevIds));
+        reset();
+    }
+
+    /// @brief Forget all the previous values.
+    void reset()
+    {
+        ++m_generation;
+        m_prevCount = 0U;
+        m_hasTow = false;
+        m_hasTowDelta = false;
+        m_prevWeek = 0U;
+        std::memset(&m_prevHeader[0], 0, sizeof(m_prevHeader));
+    }
+
+    /// @brief Predicted representation of rcvTow.
+    std::uint64_t predictTow() const
+    {
+        if (!m_hasTow) {
+            return 0U;
+        }
+
+        if (!m_hasTowDelta) {
+            return m_prevTow;
+        }
+        return m_prevTow + m_towDelta;
+    }
+
+    /// @brief Previous value of week.
+    std::uint16_t prevWeek() const
+    {
+        return m_prevWeek;
+    }
+
+    /// @brief Previous value of the header byte.
+    std::uint8_t prevHeaderByte(std::size_t offset) const
+    {
+        return m_prevHeader[offset];
+    }
+
+    /// @brief Start the epoch (after the header is known).
+    void beginEpoch(const std::uint8_t* header)
+    {
+        static const std::int64_t MsPerWeek = 604800000;
+
+        auto tow = rawxLoad<std::uint64_t>(&header[0]);
+        auto week = rawxLoad<std::uint16_t>(&header[8]);
+        double towSec = 0.0;
+        std::memcpy(&towSec, &tow, sizeof(towSec));
+        m_nowMs = static_cast<std::int64_t>(week) * MsPerWeek;
+        if (std::isfinite(towSec) && (std::fabs(towSec) < MsPerWeek)) {
+            m_nowMs += std::llround(towSec * 1000.0);
+        }
+
+        m_hasTowDelta = m_hasTow;
+        m_towDelta = tow - m_prevTow;
+        m_prevTow = tow;
+        m_hasTow = true;
+        m_prevWeek = week;
+        std::memcpy(&m_prevHeader[0], header, sizeof(m_prevHeader));
+    }
+
+    /// @brief Reference identity of the measurement (the one at the same
+    ///     position in the previous epoch).
+    std::uint8_t prevId(std::size_t meas, std::size_t id) const
+    {
+        if (m_prevCount <= meas) {
+            return 0U;
+        }
+        return m_prevIds[meas][id];
+    }
+
+    /// @brief Index of the state of the measurement with the identity.
+    static std::size_t keyOf(const std::uint8_t* ids)
+    {
+        static const std::size_t SigSlots = 8U;
+        auto satIdx = SatelliteTable::indexOf(static_cast<field::common::GnssId>(ids[0]), ids[1]);
+        return (satIdx * SigSlots) + (ids[2] % SigSlots);
+    }
+
+    /// @brief Predict the Doppler of the measurement.
+    std::uint32_t predictDoppler(std::size_t key) const
+    {
+        auto& state = m_states[key];
+        if (state.m_generation != m_generation) {
+            return 0U;
+        }
+        return state.m_doppler + (state.m_hasDopplerDelta ? state.m_dopplerDelta : 0U);
+    }
+
+    /// @brief Predict the values of the measurement other than Doppler
+    ///     (see @ref predictDoppler()), using the actual Doppler.
+    /// @param[in] key Key of the measurement (see @ref keyOf()).
+    /// @param[in] ids Identity bytes.
+    /// @param[in] doppler Actual Doppler (not used by its own prediction).
+    /// @param[out] pred Predictions.
+    void predict(std::size_t key, const std::uint8_t* ids, std::uint32_t doppler, Prediction& pred) const
+    {
+        static const std::int64_t MaxLocktime = 64500;
+        static const std::int64_t MaxPredictMs = 60000;
+
+        auto& state = m_states[key];
+        if (state.m_generation != m_generation) {
+            std::memset(&pred, 0, sizeof(pred));
+            return;
+        }
+
+        std::memcpy(&pred.m_aux[0], &state.m_aux[0], sizeof(pred.m_aux));
+
+        auto dtMs = m_nowMs - state.m_timeMs;
+        auto lock = static_cast<std::int64_t>(state.m_locktime) + dtMs;
+        pred.m_locktime = static_cast<std::uint16_t>(
+            (lock < 0) ? 0 : ((MaxLocktime < lock) ? MaxLocktime : lock));
+
+        pred.m_pr = state.m_pr;
+        pred.m_cp = state.m_cp;
+        if ((dtMs <= 0) || (MaxPredictMs < dtMs)) {
+            return;
+        }
+
+        // Mean Doppler (2^-10 Hz) times the interval (ms), positive for approaching satellites
+        auto dopplerSum = dopplerUnits(state.m_doppler) + dopplerUnits(doppler);
+        auto cycles = -dopplerSum * dtMs;
+        pred.m_cp = rawxAddDelta(state.m_cp, cycles, DopplerFracBits, 2000);
+        pred.m_pr = rawxAddDelta(state.m_pr, cycles * wavelength(ids), DopplerFracBits + WavelengthFracBits, 2000);
+    }
+
+    /// @brief Record the actual values of the measurement.
+    void update(std::size_t key, const Meas& meas)
+    {
+        auto& state = m_states[key];
+        auto known = (state.m_generation == m_generation);
+        state.m_hasDopplerDelta = known;
+        state.m_dopplerDelta = meas.m_doppler - state.m_doppler;
+        state.m_generation = m_generation;
+        state.m_timeMs = m_nowMs;
+        state.m_pr = meas.m_pr;
+        state.m_cp = meas.m_cp;
+        state.m_doppler = meas.m_doppler;
+        state.m_locktime = meas.m_locktime;
+        std::memcpy(&state.m_aux[0], &meas.m_aux[0], sizeof(state.m_aux));
+    }
+
+    /// @brief Record identities of the epoch measurements.
+    void endEpoch(const Meas* meas, std::size_t count)
+    {
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            std::memcpy(&m_prevIds[idx][0], &meas[idx].m_ids[0], RawxIdCount);
+        }
+        m_prevCount = count;
+    }
+
+private:
+    static const std::size_t GnssCount = static_cast<std::size_t>(field::common::GnssId::NumOfValues);
+    static const std::size_t StatesCount = (SatelliteTable::Capacity + 1U) * 8U;
+    static const int DopplerFracBits = 10;
+    static const int WavelengthFracBits = 20;
+
+    struct State
+    {
+        std::uint32_t m_generation;
+        std::int64_t m_timeMs;
+        std::uint64_t m_pr;
+        std::uint64_t m_cp;
+        std::uint32_t m_doppler;
+        std::uint32_t m_dopplerDelta;
+        bool m_hasDopplerDelta;
+        std::uint16_t m_locktime;
+        std::uint8_t m_aux[RawxAuxCount];
+    };
+
+    // Doppler in 2^-10 Hz, the conversion of the single precision value is exact
+    static std::int64_t dopplerUnits(std::uint32_t bits)
+    {
+        static const double MaxDoppler = 1.0e5;
+        float value = 0.0f;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!(std::fabs(value) < MaxDoppler)) {
+            return 0;
+        }
+        return std::llround(static_cast<double>(value) * (1 << DopplerFracBits));
+    }
+
+    std::int64_t wavelength(const std::uint8_t* ids) const
+    {
+        static const std::uint8_t FreqIdCount = 14U;
+        if ((GnssCount <= ids[0]) || (FreqIdCount <= ids[3])) {
+            return m_wavelength[ids[0] % GnssCount][0];
+        }
+        return m_wavelength[ids[0]][ids[3]];
+    }
+
+    State m_states[StatesCount];
+    std::int64_t m_wavelength[GnssCount][14];
+    std::uint8_t m_prevIds[RawxMaxMeas][RawxIdCount];
+    std::uint8_t m_prevHeader[RawxHeaderLen];
+    std::size_t m_prevCount = 0U;
+    std::uint32_t m_generation = 1U;
+    std::int64_t m_nowMs = 0;
+    std::uint64_t m_prevTow = 0U;
+    std::uint64_t m_towDelta = 0U;
+    bool m_hasTow = false;
+    bool m_hasTowDelta = false;
+    std::uint16_t m_prevWeek = 0U;
+};
+
+}  // namespace details
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,326 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains internal helpers of ublox::util::RtcmMsmEncoder and
+///     ublox::util::RtcmMsmDecoder.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "ublox/field/common.h"
+#include "ublox/util/details/navdata.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Preamble of RTCM 3 frame.
+static const std::uint8_t RtcmPreamble = 0xd3;
+
+/// @brief Length of RTCM 3 frame header (preamble, reserved bits, length).
+static const std::size_t RtcmHeaderLen = 3U;
+
+/// @brief Length of RTCM 3 frame CRC.
+static const std::size_t RtcmCrcLen = 3U;
+
+/// @brief Maximal length of RTCM 3 message (frame payload).
+static const std::size_t RtcmMaxPayloadLen = 1023U;
+
+/// @brief Maximal length of RTCM 3 frame.
+static const std::size_t RtcmMaxFrameLen = RtcmHeaderLen + RtcmMaxPayloadLen + RtcmCrcLen;
+
+/// @brief Speed of light, m/s.
+static const double RtcmSpeedOfLight = 299792458.0;
+
+/// @brief Distance travelled by light in 1 ms, m.
+static const double RtcmRangeMs = RtcmSpeedOfLight / 1000.0;
+
+/// @brief Writer of MSB first bit stream into the bytes buffer.
+/// @details Does not check the buffer boundaries, the caller is expected
+///     to provide buffer of sufficient length.
+class RtcmBitWriter
+{
+public:
+    /// @brief Constructor
+    /// @param[out] buf Output buffer.
+    explicit RtcmBitWriter(std::uint8_t* buf) : m_buf(buf) {}
+
+    /// @brief Append up to 57 least significant bits of the value.
+    void append(std::uint64_t value, unsigned len)
+    {
+        m_acc = (m_acc << len) | (value & mask(len));
+        m_bits += len;
+        while (8U <= m_bits) {
+            m_bits -= 8U;
+            m_buf[m_pos] = static_cast<std::uint8_t>(m_acc >> m_bits);
+            ++m_pos;
+        }
+    }
+
+    /// @brief Append two's complement signed value.
+    void appendSigned(std::int64_t value, unsigned len)
+    {
+        append(static_cast<std::uint64_t>(value), len);
+    }
+
+    /// @brief Pad the last byte with zeroes.
+    void flush()
+    {
+        if (m_bits != 0U) {
+            m_buf[m_pos] = static_cast<std::uint8_t>(m_acc << (8U - m_bits));
+            ++m_pos;
+            m_bits = 0U;
+        }
+    }
+
+    /// @brief Number of written bits.
+    std::size_t bits() const
+    {
+        return (m_pos * 8U) + m_bits;
+    }
+
+    /// @brief Number of the completely written bytes.
+    std::size_t bytes() const
+    {
+        return m_pos;
+    }
+
+private:
+    static std::uint64_t mask(unsigned len)
+    {
+        return (64U <= len) ? ~static_cast<std::uint64_t>(0U) : ((static_cast<std::uint64_t>(1U) << len) - 1U);
+    }
+
+    std::uint8_t* m_buf = nullptr;
+    std::size_t m_pos = 0U;
+    std::uint64_t m_acc = 0U;
+    unsigned m_bits = 0U;
+};
+
+/// @brief Reader of MSB first bit stream from the bytes buffer.
+class RtcmBitReader
+{
+public:
+    /// @brief Constructor
+    /// @param[in] buf Input buffer.
+    /// @param[in] len Length of the buffer in bytes.
+    RtcmBitReader(const std::uint8_t* buf, std::size_t len) : m_buf(buf), m_len(len * 8U) {}
+
+    /// @brief Read unsigned value of up to 64 bits.
+    std::uint64_t read(unsigned len)
+    {
+        std::uint64_t value = 0U;
+        if (m_len < (m_pos + len)) {
+            m_pos = m_len;
+            m_overflow = true;
+            return value;
+        }
+
+        while (len != 0U) {
+            auto bitPos = static_cast<unsigned>(m_pos % 8U);
+            auto count = 8U - bitPos;
+            if (len < count) {
+                count = len;
+            }
+
+            auto bits = (m_buf[m_pos / 8U] >> (8U - bitPos - count)) & ((1U << count) - 1U);
+            value = (value << count) | bits;
+            m_pos += count;
+            len -= count;
+        }
+        return value;
+    }
+
+    /// @brief Read two's complement signed value.
+    std::int64_t readSigned(unsigned len)
+    {
+        auto value = read(len);
+        auto signBit = static_cast<std::uint64_t>(1U) << (len - 1U);
+        if ((value & signBit) == 0U) {
+            return static_cast<std::int64_t>(value);
+        }
+        return static_cast<std::int64_t>(value) - static_cast<std::int64_t>(signBit << 1);
+    }
+
+    /// @brief Whether the attempt to read beyond the buffer has been made.
+    bool overflow() const
+    {
+        return m_overflow;
+    }
+
+private:
+    const std::uint8_t* m_buf = nullptr;
+    std::size_t m_len = 0U;
+    std::size_t m_pos = 0U;
+    bool m_overflow = false;
+};
+
+/// @brief Finish the frame, which payload has been written after the
+///     header space, returns the length of the frame.
+inline std::size_t rtcmFinishFrame(std::uint8_t* frame, std::size_t payloadLen)
+{
+    frame[0] = RtcmPreamble;
+    frame[1] = static_cast<std::uint8_t>((payloadLen >> 8) & 0x3U);
+    frame[2] = static_cast<std::uint8_t>(payloadLen);
+    auto crcPos = RtcmHeaderLen + payloadLen;
+    auto crc = crc24q(frame, crcPos);
+    frame[crcPos] = static_cast<std::uint8_t>(crc >> 16);
+    frame[crcPos + 1] = static_cast<std::uint8_t>(crc >> 8);
+    frame[crcPos + 2] = static_cast<std::uint8_t>(crc);
+    return crcPos + RtcmCrcLen;
+}
+
+/// @brief Message number of MSM1 (the others follow) of the system, 0
+///     if not supported.
+inline unsigned rtcmMsmBase(field::common::GnssId gnssId)
+{
+    static const unsigned Numbers[] = {
+        /* Gps */ 1071U, /* Sbas */ 1101U, /* Galileo */ 1091U, /* BeiDou */ 1121U,
+        /* Imes */ 0U, /* Qzss */ 1111U, /* Glonass */ 1081U
+    };
+
+    auto idx = static_cast<std::size_t>(gnssId);
+    if ((sizeof(Numbers) / sizeof(Numbers[0])) <= idx) {
+        return 0U;
+    }
+    return Numbers[idx];
+}
+
+/// @brief Satellite ID (1 - 64) of the MSM satellite mask, 0 if not
+///     supported.
+inline unsigned rtcmSatId(field::common::GnssId gnssId, unsigned svId)
+{
+    static const unsigned MaxSatId = 64U;
+    static const unsigned SbasFirstPrn = 120U;
+
+    if (gnssId == field::common::GnssId::Sbas) {
+        svId = (SbasFirstPrn <= svId) ? (svId - SbasFirstPrn + 1U) : 0U;
+    }
+
+    if (MaxSatId < svId) {
+        return 0U;
+    }
+    return svId;
+}
+
+/// @brief Satellite (u-blox) ID of the MSM satellite ID.
+inline unsigned rtcmSvId(field::common::GnssId gnssId, unsigned satId)
+{
+    static const unsigned SbasFirstPrn = 120U;
+
+    if (gnssId == field::common::GnssId::Sbas) {
+        return satId + SbasFirstPrn - 1U;
+    }
+    return satId;
+}
+
+/// @brief Carrier frequency (Hz) of the signal tracked by RXM-RAWX.
+/// @param[in] gnssId GNSS identifier.
+/// @param[in] freqId GLONASS frequency slot + 7.
+inline double rtcmCarrierFreq(field::common::GnssId gnssId, unsigned freqId)
+{
+    static const double L1Freq = 1575.42e6;
+    static const double B1Freq = 1561.098e6;
+    static const double G1Freq = 1602.0e6;
+    static const double G1FreqStep = 0.5625e6;
+    static const int FreqIdOffset = 7;
+
+    if (gnssId == field::common::GnssId::Glonass) {
+        return G1Freq + (G1FreqStep * (static_cast<int>(freqId) - FreqIdOffset));
+    }
+
+    if (gnssId == field::common::GnssId::BeiDou) {
+        return B1Freq;
+    }
+    return L1Freq;
+}
+
+/// @brief MSM lock time indicator (DF402) of the lock time.
+inline unsigned rtcmLockIndicator(std::uint32_t lockMs)
+{
+    static const std::uint32_t FirstStepMs = 32U;
+    static const unsigned MaxIndicator = 15U;
+
+    unsigned indicator = 0U;
+    while ((indicator < MaxIndicator) && ((FirstStepMs << indicator) <= lockMs)) {
+        ++indicator;
+    }
+    return indicator;
+}
+
+/// @brief Minimal lock time (ms) of the MSM lock time indicator (DF402).
+inline std::uint32_t rtcmLockFromIndicator(unsigned indicator)
+{
+    static const std::uint32_t FirstStepMs = 32U;
+    if (indicator == 0U) {
+        return 0U;
+    }
+    return FirstStepMs << (indicator - 1U);
+}
+
+/// @brief MSM extended lock time indicator (DF407) of the lock time.
+/// @details The resolution is 1 ms up to 64 ms and halved with every
+///     doubling of the lock time afterwards.
+inline unsigned rtcmLockIndicatorExt(std::uint32_t lockMs)
+{
+    static const std::uint32_t LinearMs = 64U;
+    static const unsigned IndicatorsPerStep = 32U;
+    static const unsigned MaxIndicator = 704U;
+
+    if (lockMs < LinearMs) {
+        return lockMs;
+    }
+
+    unsigned step = 1U;
+    while ((LinearMs << step) <= lockMs) {
+        ++step;
+    }
+
+    auto indicator = (lockMs >> step) + (IndicatorsPerStep * step);
+    return (MaxIndicator < indicator) ? MaxIndicator : indicator;
+}
+
+/// @brief Minimal lock time (ms) of the MSM extended lock time indicator
+///     (DF407).
+inline std::uint32_t rtcmLockFromIndicatorExt(unsigned indicator)
+{
+    static const unsigned LinearMs = 64U;
+    static const unsigned IndicatorsPerStep = 32U;
+
+    if (indicator < LinearMs) {
+        return indicator;
+    }
+
+    auto step = (indicator / IndicatorsPerStep) - 1U;
+    return static_cast<std::uint32_t>(indicator - (IndicatorsPerStep * step)) << step;
+}
+
+}  // namespace details
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,175 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains mathematical functions suitable for vectorised loops.
+/// @details The functions consist of arithmetic operations, selections,
+///     and bit manipulations only. There are no library calls (including
+///     @b std::sqrt(), which is a call with error handling unless
+///     @b -fno-math-errno is used) and no data dependent branches, so
+///     the loops calling them are vectorised by GCC at @b -O3 with the
+///     default floating point options.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+/// @brief Pi.
+static const double VecPi = 3.14159265358979323846;
+
+/// @brief Maximal magnitude of the argument of @ref vecSinCos().
+static const double VecMaxAngle = 1.0e6;
+
+/// @brief Round to the nearest integer (half away from zero).
+/// @details The magnitude of the value must be below 2^31.
+inline double vecRound(double value)
+{
+    auto half = (value < 0.0) ? -0.5 : 0.5;
+    return static_cast<double>(static_cast<std::int32_t>(value + half));
+}
+
+/// @brief Calculate square root of non-negative value.
+/// @details Refines the estimate of the reciprocal square root obtained
+///     by manipulation of the exponent bits by four Newton iterations,
+///     followed by the correction of the square root itself. The relative
+///     error is within 1 unit in the last place for the arguments above
+///     1e-280. The tiny bias added to the argument keeps it normal (the
+///     zero argument results in 1e-150) without any selection, which GCC
+///     would turn into a branch.
+inline double vecSqrt(double value)
+{
+    static const std::uint64_t Magic = 0x5fe6eb50c7b537a9ULL;
+    static const double Bias = 1e-300;
+
+    auto arg = value + Bias;
+    std::uint64_t bits = 0U;
+    std::memcpy(&bits, &arg, sizeof(bits));
+    bits = Magic - (bits >> 1);
+    double y = 0.0;
+    std::memcpy(&y, &bits, sizeof(y));
+
+    auto half = 0.5 * arg;
+    y = y * (1.5 - (half * y * y));
+    y = y * (1.5 - (half * y * y));
+    y = y * (1.5 - (half * y * y));
+    y = y * (1.5 - (half * y * y));
+
+    auto root = arg * y;
+    return root + ((0.5 * y) * (arg - (root * root)));
+}
+
+/// @brief Calculate sine and cosine of the angle.
+/// @details Reduces the angle to [-pi/4, pi/4] by three part
+///     representation of pi/2 and evaluates the minimax polynomials (same
+///     as fdlibm kernels). The absolute error is below 1e-15 for the angles
+///     up to @ref VecMaxAngle.
+/// @param[in] angle Angle, rad.
+/// @param[out] sinValue Sine.
+/// @param[out] cosValue Cosine.
+inline void vecSinCos(double angle, double& sinValue, double& cosValue)
+{
+    static const double TwoOverPi = 2.0 / VecPi;
+    static const double PiOver2Hi = 1.57079632673412561417e+00;
+    static const double PiOver2Mid = 6.07710050630396597660e-11;
+    static const double PiOver2Lo = 2.02226624879595063154e-21;
+    static const double S1 = -1.66666666666666324348e-01;
+    static const double S2 = 8.33333333332248946124e-03;
+    static const double S3 = -1.98412698298579493134e-04;
+    static const double S4 = 2.75573137070700676789e-06;
+    static const double S5 = -2.50507602534068634195e-08;
+    static const double S6 = 1.58969099521155010221e-10;
+    static const double C1 = 4.16666666666666019037e-02;
+    static const double C2 = -1.38888888888741095749e-03;
+    static const double C3 = 2.48015872894767294178e-05;
+    static const double C4 = -2.75573143513906633035e-07;
+    static const double C5 = 2.08757232129817482790e-09;
+    static const double C6 = -1.13596475577881948265e-11;
+
+    auto k = vecRound(angle * TwoOverPi);
+    auto r = ((angle - (k * PiOver2Hi)) - (k * PiOver2Mid)) - (k * PiOver2Lo);
+    auto r2 = r * r;
+    auto sinR = r + ((r * r2) * (S1 + (r2 * (S2 + (r2 * (S3 + (r2 * (S4 + (r2 * (S5 + (r2 * S6)))))))))));
+    auto cosR = 1.0 - (0.5 * r2) + ((r2 * r2) * (C1 + (r2 * (C2 + (r2 * (C3 + (r2 * (C4 + (r2 * (C5 + (r2 * C6)))))))))));
+
+    // Quadrants (0 - 3) of sine and cosine, selected arithmetically so that
+    // no computation is moved into a conditional branch
+    auto quadrant = k - (4.0 * vecRound((k - 1.5) * 0.25));
+    auto cosQuadrant = (quadrant + 1.0) - (4.0 * vecRound((quadrant - 0.5) * 0.25));
+    auto odd = quadrant - (2.0 * vecRound((quadrant - 0.5) * 0.5));
+    auto sinNegative = vecRound((quadrant - 0.5) * 0.5);
+    auto cosNegative = vecRound((cosQuadrant - 0.5) * 0.5);
+    sinValue = (sinR + (odd * (cosR - sinR))) * (1.0 - (2.0 * sinNegative));
+    cosValue = (cosR + (odd * (sinR - cosR))) * (1.0 - (2.0 * cosNegative));
+}
+
+/// @brief Calculate arc tangent of y / x in the range [-pi, pi].
+/// @details Reduces the ratio of the smaller and the larger magnitude
+///     (angle in [0, pi/4]) to [0, tan(pi/16)] by two half angle steps
+///     and evaluates the Taylor series up to the term of degree 21, the
+///     absolute error is below 1e-15 rad. The octant is restored by sign
+///     manipulations instead of selections of the computed values.
+inline double vecAtan2(double y, double x)
+{
+    static const double Tiny = 1e-300;
+    static const double HalfPi = VecPi / 2.0;
+    static const double QuarterPi = VecPi / 4.0;
+
+    auto ax = std::fabs(x);
+    auto ay = std::fabs(y);
+    auto num = (ax < ay) ? ax : ay;
+    auto den = (ax < ay) ? ay : ax;
+    auto t = num / ((den < Tiny) ? Tiny : den);
+    t = t / (1.0 + vecSqrt(1.0 + (t * t)));
+    t = t / (1.0 + vecSqrt(1.0 + (t * t)));
+
+    auto t2 = t * t;
+    auto poly = 1.0 / 21.0;
+    poly = (poly * t2) - (1.0 / 19.0);
+    poly = (poly * t2) + (1.0 / 17.0);
+    poly = (poly * t2) - (1.0 / 15.0);
+    poly = (poly * t2) + (1.0 / 13.0);
+    poly = (poly * t2) - (1.0 / 11.0);
+    poly = (poly * t2) + (1.0 / 9.0);
+    poly = (poly * t2) - (1.0 / 7.0);
+    poly = (poly * t2) + (1.0 / 5.0);
+    poly = (poly * t2) - (1.0 / 3.0);
+    poly = (poly * t2) + 1.0;
+    auto angle = 4.0 * t * poly; // [0, pi/4]
+
+    angle = QuarterPi - std::copysign(QuarterPi - angle, ax - ay); // [0, pi/2]
+    angle = HalfPi - std::copysign(HalfPi - angle, x); // [0, pi]
+    return std::copysign(angle, y);
+}
+
+}  // namespace details
+
+}  // namespace util
+
+}  // namespace ublox
+
@@ -0,0 +1,323 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Contains functions serialising message fields into JSON.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "comms/comms.h"
+
+#include "ublox/util/TextBuffer.h"
+#include "ublox/util/details/fields.h"
+
+namespace ublox
+{
+
+namespace util
+{
+
+namespace details
+{
+
+class JsonFieldWriter
+{
+public:
+    explicit JsonFieldWriter(TextBuffer& buf)
+      : m_buf(buf)
+    {
+    }
+
+    template <typename TField>
+    void write(const TField& field)
+    {
+        writeInternal(field, FieldTag<TField>());
+    }
+
+    void writeString(const char* str, std::size_t len)
+    {
+        m_buf.append('"');
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            auto ch = str[idx];
+            if ((ch == '"') || (ch == '\\')) {
+                m_buf.append('\\');
+                m_buf.append(ch);
+                continue;
+            }
+
+            if (static_cast<unsigned char>(ch) < 0x20) {
+                static const char HexChars[] = "0123456789abcdef";
+                m_buf.append("\\u00", 4);
+                m_buf.append(HexChars[(ch >> 4) & 0xf]);
+                m_buf.append(HexChars[ch & 0xf]);
+                continue;
+            }
+
+            m_buf.append(ch);
+        }
+        m_buf.append('"');
+    }
+
+    template <typename TTuple>
+    void writeMembers(const TTuple& members, const NamesTable& names, bool first = true)
+    {
+        MembersWriter membersWriter(*this, names, first);
+        tupleForEach(members, membersWriter);
+    }
+
+private:
+    class MembersWriter
+    {
+    public:
+        MembersWriter(JsonFieldWriter& writer, const NamesTable& names, bool first)
+          : m_writer(writer),
+            m_names(names),
+            m_first(first)
+        {
+        }
+
+        template <std::size_t TIdx, typename TField>
+        void apply(const TField& field)
+        {
+            if (m_names.isReserved(TIdx) || (!m_writer.exists(field, FieldTag<TField>()))) {
+                return;
+            }
+
+            if (!m_first) {
+                m_writer.m_buf.append(',');
+            }
+            m_first = false;
+
+            m_writer.m_buf.append('"');
+            m_names.write(m_writer.m_buf, TIdx, "f");
+            m_writer.m_buf.append("\":", 2);
+            m_writer.write(field);
+        }
+
+    private:
+        JsonFieldWriter& m_writer;
+        const NamesTable& m_names;
+        bool m_first;
+    };
+
+    template <typename TField, typename TTag>
+    bool exists(const TField&, TTag)
+    {
+        return true;
+    }
+
+    template <typename TField>
+    bool exists(const TField& field, OptionalTag)
+    {
+        return field.getMode() != comms::field::OptionalMode::Missing;
+    }
+
+    template <typename TField, typename TValue, typename TScaling>
+    void writeInternal(const TField& field, IntValueTag<TValue, TScaling>)
+    {
+        writeIntValue<TValue, TScaling>(m_buf, field.value());
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, FloatValueTag)
+    {
+        typedef typename std::decay<decltype(field.value())>::type ValueType;
+        m_buf.appendDouble(
+            static_cast<double>(field.value()),
+            static_cast<unsigned>(std::numeric_limits<ValueType>::max_digits10));
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, EnumValueTag)
+    {
+        typedef typename std::underlying_type<typename TField::ValueType>::type UnderlyingType;
+        auto value = static_cast<UnderlyingType>(field.value());
+        if (std::is_signed<UnderlyingType>::value) {
+            m_buf.appendSigned(static_cast<std::int64_t>(value));
+            return;
+        }
+        m_buf.appendUnsigned(static_cast<std::uint64_t>(value));
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, BitmaskValueTag)
+    {
+        auto& names = fieldBitsNames<TField>();
+        if (names.count() == 0U) {
+            m_buf.appendUnsigned(static_cast<std::uint64_t>(field.value()));
+            return;
+        }
+
+        auto value = static_cast<std::uint64_t>(field.value());
+        m_buf.append('[');
+        bool first = true;
+        for (std::size_t idx = 0U; (idx < 64U) && (value != 0U); ++idx) {
+            auto mask = static_cast<std::uint64_t>(1U) << idx;
+            if ((value & mask) == 0U) {
+                continue;
+            }
+
+            value &= ~mask;
+            if (!first) {
+                m_buf.append(',');
+            }
+            first = false;
+            m_buf.append('"');
+            names.write(m_buf, idx, "bit");
+            m_buf.append('"');
+        }
+        m_buf.append(']');
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, ArrayListTag)
+    {
+        typedef typename std::decay<decltype(field.value())>::type StorageType;
+        typedef typename StorageType::value_type ElemType;
+        writeList(
+            field.value(),
+            std::integral_constant<bool, std::is_integral<ElemType>::value && (sizeof(ElemType) == 1U)>());
+    }
+
+    template <typename TStorage>
+    void writeList(const TStorage& storage, std::true_type)
+    {
+        m_buf.append('"');
+        if (!storage.empty()) {
+            m_buf.appendHex(reinterpret_cast<const std::uint8_t*>(&storage[0]), storage.size());
+        }
+        m_buf.append('"');
+    }
+
+    template <typename TStorage>
+    void writeList(const TStorage& storage, std::false_type)
+    {
+        typedef typename TStorage::value_type ElemType;
+        m_buf.append('[');
+        bool first = true;
+        for (auto& elem : storage) {
+            if (!first) {
+                m_buf.append(',');
+            }
+            first = false;
+            writeElem(elem, std::is_integral<ElemType>());
+        }
+        m_buf.append(']');
+    }
+
+    template <typename TElem>
+    void writeElem(const TElem& elem, std::true_type)
+    {
+        if (std::is_signed<TElem>::value) {
+            m_buf.appendSigned(static_cast<std::int64_t>(elem));
+            return;
+        }
+        m_buf.appendUnsigned(static_cast<std::uint64_t>(elem));
+    }
+
+    template <typename TElem>
+    void writeElem(const TElem& elem, std::false_type)
+    {
+        write(elem);
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, StringTag)
+    {
+        auto& str = field.value();
+        writeString(str.size() == 0U ? "" : &str[0], str.size());
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, BundleTag)
+    {
+        m_buf.append('{');
+        writeMembers(field.value(), fieldMembersNames<TField>());
+        m_buf.append('}');
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, BitfieldTag)
+    {
+        m_buf.append('{');
+        writeMembers(field.value(), fieldMembersNames<TField>());
+        m_buf.append('}');
+    }
+
+    template <typename TField>
+    void writeInternal(const TField& field, OptionalTag)
+    {
+        if (field.getMode() == comms::field::OptionalMode::Missing) {
+            m_buf.append("null", 4);
+            return;
+        }
+
+        write(field.field());
+    }
+
+    TextBuffer& m_buf;
+};
+
+}  // namespace details
+
+/// @brief Serialise message fields as single line JSON object.
+/// @details Walks over all the fields of the message at compile time and
+///     writes them into the provided buffer without any dynamic memory
+///     allocation. The names of the fields are the ones passed to
+///     UBLOX_MSG_FIELDS_ACCESS() and UBLOX_FIELD_MEMBERS_ACCESS() macros
+///     (see names.h), the reserved fields are skipped. The scaled integral
+///     values (such as ones having @b ublox::field::common::Scaling_mm2m option)
+///     are written in scaled units, the bitmasks as arrays of the names of
+///     the set bits, the lists of raw bytes as hexadecimal strings.
+///     The object is terminated with new line character.
+/// @param[in] msg Message object.
+/// @param[in, out] buf Output buffer.
+/// @param[in] msgName Optional name of the message. When provided, it is
+///     written as value of @b "msg" member preceding the fields.
+/// @return @b true on success, @b false in case the buffer has been overflown.
+template <typename TMsg>
+bool writeJson(const TMsg& msg, TextBuffer& buf, const char* msgName = nullptr)
+{
+    auto startLen = buf.size();
+    details::JsonFieldWriter writer(buf);
+    buf.append('{');
+    if (msgName != nullptr) {
+        buf.append("\"msg\":", 6);
+        writer.writeString(msgName, std::strlen(msgName));
+    }
+
+    auto& names = details::msgFieldsNames<TMsg>();
+    writer.writeMembers(msg.fields(), names, msgName == nullptr);
+    buf.append("}\n", 2);
+    if (buf.overflow()) {
+        buf.truncate(startLen);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace util
+
+}  // namespace ublox
+
+
@@ -0,0 +1,190 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the output bandwidth prediction: bytes per second of the known
+// set of messages configured by CFG-MSG, the load status of the UART port
+// at 115200 baud and the recommended baud rate and decimation.
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+
+#include "ublox/util/BandwidthPlanner.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+static const std::size_t Uart1 = 1U;
+static const std::size_t Usb = 3U;
+static const std::uint32_t Baud = 115200U;
+static const double Tolerance = 1e-9;
+
+// Per second: frame overhead and payload of NAV-PVT (8 + 92), NAV-SAT with
+// 20 satellites (8 + 8 + 12 * 20), RXM-RAWX with 30 signals (8 + 16 + 32 * 30),
+// and MON-HW (8 + 60); NMEA GGA (82) and GSV of 20 satellites (5 sentences of 82)
+static const double NavPvtBytes = 100.0;
+static const double NavSatBytes = 256.0;
+static const double RxmRawxBytes = 984.0;
+static const double MonHwBytes = 68.0;
+static const double GgaBytes = 82.0;
+static const double GsvBytes = 420.0;
+
+void setRate(util::BandwidthPlanner& planner, ublox::MsgId id, unsigned rate)
+{
+    message::CfgMsg<> msg;
+    msg.field_id().value() = id;
+    msg.field_rate().value().resize(util::BandwidthPlanner::PortsCount);
+    msg.field_rate().value()[Uart1].value() = static_cast<std::uint8_t>(rate);
+    planner.handle(msg);
+}
+
+void configure(util::BandwidthPlanner& planner)
+{
+    message::CfgPrtUart<> prt;
+    prt.field_portID().value() = message::CfgPrtUartFields::PortId::UART;
+    prt.field_baudRate().value() = Baud;
+    planner.handle(prt);
+    planner.setSatellites(20U, 30U);
+
+    setRate(planner, ublox::MsgId_NAV_PVT, 1U);
+    setRate(planner, ublox::MsgId_NAV_SAT, 1U);
+    setRate(planner, ublox::MsgId_RXM_RAWX, 1U);
+    setRate(planner, ublox::MsgId_MON_HW, 1U);
+    setRate(planner, static_cast<ublox::MsgId>(0xf000), 1U); // GGA
+    setRate(planner, static_cast<ublox::MsgId>(0xf003), 1U); // GSV
+}
+
+void setMeasRate(util::BandwidthPlanner& planner, unsigned measRateMs, unsigned navRate = 1U)
+{
+    message::CfgRate<> msg;
+    msg.field_measRate().value() = static_cast<std::uint16_t>(measRateMs);
+    msg.field_navRate().value() = static_cast<std::uint16_t>(navRate);
+    planner.handle(msg);
+}
+
+void testKnownSet()
+{
+    util::BandwidthPlanner planner;
+    configure(planner);
+
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_NAV_PVT, Uart1), NavPvtBytes, Tolerance);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_NAV_SAT, Uart1), NavSatBytes, Tolerance);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_RXM_RAWX, Uart1), RxmRawxBytes, Tolerance);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_MON_HW, Uart1), MonHwBytes, Tolerance);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(static_cast<ublox::MsgId>(0xf003), Uart1), GsvBytes, Tolerance);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_NAV_PVT, Usb), 0.0, Tolerance);
+
+    static const double Total = NavPvtBytes + NavSatBytes + RxmRawxBytes + MonHwBytes + GgaBytes + GsvBytes;
+    auto report = planner.report(Uart1);
+    UBLOX_TEST_NEAR(report.m_bytesPerSec, Total, Tolerance);
+    UBLOX_TEST_NEAR(report.m_capacityBytesPerSec, 11520.0, Tolerance);
+    UBLOX_TEST_NEAR(report.m_utilisation, Total / 11520.0, Tolerance);
+    UBLOX_TEST_ASSERT(report.m_status == util::BandwidthStatus::Ok);
+    UBLOX_TEST_ASSERT(report.m_recommendedBaud == 38400U);
+    UBLOX_TEST_ASSERT(report.m_recommendedDecimation == 1U);
+
+    // Sum of the messages output on the port
+    std::map<ublox::MsgId, double> loads;
+    planner.forEachLoad(
+        Uart1,
+        [&loads](ublox::MsgId id, double bytesPerSec)
+        {
+            loads[id] = bytesPerSec;
+        });
+    UBLOX_TEST_ASSERT(loads.size() == 6U);
+    double sum = 0.0;
+    for (auto& load : loads) {
+        sum += load.second;
+    }
+    UBLOX_TEST_NEAR(sum, Total, Tolerance);
+
+    // Port without baud rate
+    auto usbReport = planner.report(Usb);
+    UBLOX_TEST_ASSERT(usbReport.m_status == util::BandwidthStatus::Unknown);
+    UBLOX_TEST_NEAR(usbReport.m_bytesPerSec, 0.0, Tolerance);
+}
+
+void testRates()
+{
+    util::BandwidthPlanner planner;
+    configure(planner);
+
+    // 5 Hz: everything but MON-HW five times
+    setMeasRate(planner, 200U);
+    auto report = planner.report(Uart1);
+    auto fiveHz = (5.0 * (NavPvtBytes + NavSatBytes + RxmRawxBytes + GgaBytes + GsvBytes)) + MonHwBytes;
+    UBLOX_TEST_NEAR(report.m_bytesPerSec, fiveHz, Tolerance);
+    UBLOX_TEST_ASSERT(report.m_status == util::BandwidthStatus::Warning);
+    UBLOX_TEST_ASSERT(report.m_recommendedBaud == 230400U);
+    UBLOX_TEST_ASSERT(report.m_recommendedDecimation == 2U);
+
+    // 10 Hz
+    setMeasRate(planner, 100U);
+    report = planner.report(Uart1);
+    UBLOX_TEST_ASSERT(report.m_status == util::BandwidthStatus::Saturated);
+    UBLOX_TEST_ASSERT(1.0 < report.m_utilisation);
+    UBLOX_TEST_ASSERT(report.m_recommendedBaud == 460800U);
+    UBLOX_TEST_ASSERT(report.m_recommendedDecimation == 3U);
+
+    // Navigation solution every other measurement, RXM-RAWX still at 10 Hz
+    setMeasRate(planner, 100U, 2U);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_NAV_PVT, Uart1), 5.0 * NavPvtBytes, Tolerance);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_RXM_RAWX, Uart1), 10.0 * RxmRawxBytes, Tolerance);
+
+    // Output every other event
+    setRate(planner, ublox::MsgId_RXM_RAWX, 2U);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_RXM_RAWX, Uart1), 5.0 * RxmRawxBytes, Tolerance);
+
+    // Disabled
+    message::CfgMsgCurrent<> current;
+    current.field_id().value() = ublox::MsgId_RXM_RAWX;
+    current.field_rate().value() = 0U;
+    planner.handle(current);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_RXM_RAWX, Uart1), 0.0, Tolerance);
+}
+
+void testUnknownMessage()
+{
+    util::BandwidthPlanner planner;
+    configure(planner);
+    auto before = planner.report(Uart1).m_bytesPerSec;
+
+    setRate(planner, ublox::MsgId_NAV_SBAS, 1U);
+    UBLOX_TEST_ASSERT(planner.unknownRates() == 1U);
+    UBLOX_TEST_NEAR(planner.report(Uart1).m_bytesPerSec, before, Tolerance);
+
+    // 12 bytes and 12 per satellite
+    planner.setMessageSize(ublox::MsgId_NAV_SBAS, 12U, 12U, util::BandwidthItems::Satellites);
+    UBLOX_TEST_ASSERT(planner.unknownRates() == 0U);
+    UBLOX_TEST_NEAR(planner.bytesPerSec(ublox::MsgId_NAV_SBAS, Uart1), 8.0 + 12.0 + (12.0 * 20.0), Tolerance);
+    UBLOX_TEST_NEAR(planner.report(Uart1).m_bytesPerSec, before + 260.0, Tolerance);
+}
+
+}  // namespace
+
+int main()
+{
+    testKnownSet();
+    testRates();
+    testUnknownMessage();
+    return 0;
+}
@@ -0,0 +1,350 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the pipelined configuration writer against the simulated
+// receiver: acknowledgements, rejection, retransmission of the lost and
+// corrupted frames, and the rollback of the original configuration.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+
+#include "ublox/util/CfgTransactionEngine.h"
+#include "ublox/message/CfgMsg.h"
+#include "ublox/message/CfgRate.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+namespace protocol = ublox::protocol;
+
+typedef message::CfgMsg<> CfgMsg;
+typedef message::CfgRate<> CfgRate;
+
+struct Link;
+
+struct ToReceiver
+{
+    void operator()(const std::uint8_t* data, std::size_t len);
+
+    Link* m_link;
+};
+
+struct ToEngine
+{
+    void operator()(const std::uint8_t* data, std::size_t len);
+
+    Link* m_link;
+};
+
+typedef util::CfgTransactionEngine<ToReceiver> Engine;
+typedef util::CfgSimulatedReceiver<ToEngine> Receiver;
+
+struct Sent
+{
+    ublox::MsgId m_id;
+    std::size_t m_outstanding;
+};
+
+// Engine and receiver connected to each other
+struct Link
+{
+    Link(std::size_t window, std::int64_t latencyMs, std::int64_t timeoutMs = 500, unsigned attempts = 3U)
+      : m_engine(ToReceiver{this}, window, timeoutMs, attempts),
+        m_receiver(ToEngine{this}, latencyMs)
+    {
+    }
+
+    // Advances the time until the engine is done
+    void run(std::int64_t stepMs = 1)
+    {
+        static const std::int64_t MaxMs = 60000;
+
+        m_engine.start(0);
+        for (std::int64_t nowMs = 0; (!m_engine.done()) && (nowMs < MaxMs); nowMs += stepMs) {
+            m_receiver.tick(nowMs);
+            m_engine.tick(nowMs);
+        }
+        UBLOX_TEST_ASSERT(m_engine.done());
+    }
+
+    Engine m_engine;
+    Receiver m_receiver;
+    std::vector<Sent> m_sent;
+    std::size_t m_corrupt = 0U; // Number of frames to corrupt
+    bool m_rejectRollback = false;
+};
+
+void ToReceiver::operator()(const std::uint8_t* data, std::size_t len)
+{
+    m_link->m_sent.push_back(Sent{protocol::frameMsgId(data), m_link->m_engine.outstanding()});
+    if (m_link->m_rejectRollback && (m_link->m_engine.state() == util::CfgEngineState::RollingBack)) {
+        m_link->m_receiver.reject(protocol::frameMsgId(data));
+    }
+
+    std::vector<std::uint8_t> frame(data, data + len);
+    if (m_link->m_corrupt != 0U) {
+        --m_link->m_corrupt;
+        frame[protocol::FrameHeaderLen] ^= 0x1U;
+    }
+    m_link->m_receiver.feed(frame.data(), frame.size());
+}
+
+void ToEngine::operator()(const std::uint8_t* data, std::size_t len)
+{
+    UBLOX_TEST_ASSERT(len == protocol::frameLength(2U));
+    auto* payload = data + protocol::FrameHeaderLen;
+    auto id = static_cast<ublox::MsgId>((payload[0] << 8) | payload[1]);
+    if (protocol::frameMsgId(data) == ublox::MsgId_ACK_ACK) {
+        message::AckAck<> msg;
+        msg.field_id().value() = id;
+        m_link->m_engine.handle(msg);
+    }
+    else {
+        message::AckNak<> msg;
+        msg.field_id().value() = id;
+        m_link->m_engine.handle(msg);
+    }
+}
+
+CfgMsg cfgMsg(ublox::MsgId id, std::uint8_t rate)
+{
+    CfgMsg msg;
+    msg.field_id().value() = id;
+    msg.field_rate().value() = rate;
+    return msg;
+}
+
+CfgRate cfgRate(std::uint16_t measRate)
+{
+    CfgRate msg;
+    msg.field_measRate().value() = measRate;
+    msg.field_navRate().value() = 1U;
+    return msg;
+}
+
+template <typename TMsg>
+std::vector<std::uint8_t> payloadOf(const TMsg& msg)
+{
+    std::vector<std::uint8_t> payload;
+    UBLOX_TEST_ASSERT(util::details::writePayload(msg, payload));
+    return payload;
+}
+
+void testAck()
+{
+    static const std::size_t Window = 4U;
+    static const std::uint8_t Rates[] = {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+
+    for (auto latencyMs : {0, 20}) {
+        Link link(Window, latencyMs);
+        for (auto rate : Rates) {
+            UBLOX_TEST_ASSERT(link.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, rate)) != Engine::InvalidTransaction);
+        }
+        auto barrier = link.m_engine.addBarrier(cfgRate(200U));
+        link.m_engine.add(cfgMsg(ublox::MsgId_NAV_SAT, 1U));
+        UBLOX_TEST_ASSERT(link.m_engine.add(CfgRate()) != Engine::InvalidTransaction);
+        UBLOX_TEST_ASSERT(link.m_engine.count() == 11U);
+        link.run();
+
+        UBLOX_TEST_ASSERT(link.m_engine.state() == util::CfgEngineState::Completed);
+        UBLOX_TEST_ASSERT(link.m_engine.failedTransaction() == Engine::InvalidTransaction);
+        for (std::size_t idx = 0U; idx < link.m_engine.count(); ++idx) {
+            UBLOX_TEST_ASSERT(link.m_engine.status(idx) == util::CfgTransactionStatus::Acked);
+            UBLOX_TEST_ASSERT(link.m_engine.transmissions(idx) == 1U);
+        }
+
+        auto& stats = link.m_engine.stats();
+        UBLOX_TEST_ASSERT(stats.m_frames == 11U);
+        UBLOX_TEST_ASSERT(stats.m_acks == 11U);
+        UBLOX_TEST_ASSERT(stats.m_retries == 0U);
+        UBLOX_TEST_ASSERT(stats.m_naks == 0U);
+        UBLOX_TEST_ASSERT(stats.m_unexpected == 0U);
+        UBLOX_TEST_ASSERT(link.m_receiver.accepted() == 11U);
+
+        // Frames sent in order, the barrier alone
+        UBLOX_TEST_ASSERT(link.m_sent.size() == 11U);
+        std::size_t maxOutstanding = 0U;
+        for (auto& sent : link.m_sent) {
+            maxOutstanding = std::max(maxOutstanding, sent.m_outstanding);
+        }
+        UBLOX_TEST_ASSERT(maxOutstanding == Window);
+        UBLOX_TEST_ASSERT(link.m_sent[barrier].m_id == ublox::MsgId_CFG_RATE);
+        UBLOX_TEST_ASSERT(link.m_sent[barrier].m_outstanding == 1U);
+        UBLOX_TEST_ASSERT(link.m_sent[barrier + 1U].m_outstanding == 1U);
+
+        // The last message of the ID applied last
+        UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_MSG) == payloadOf(cfgMsg(ublox::MsgId_NAV_SAT, 1U)));
+        UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_RATE) == payloadOf(CfgRate()));
+    }
+
+    // Not a configuration message
+    Link link(1U, 0);
+    UBLOX_TEST_ASSERT(link.m_engine.addRaw(ublox::MsgId_NAV_PVT, nullptr, 0U) == Engine::InvalidTransaction);
+    UBLOX_TEST_ASSERT(link.m_engine.add(cfgRate(100U), cfgMsg(ublox::MsgId_NAV_PVT, 1U)) == Engine::InvalidTransaction);
+}
+
+void testNak()
+{
+    Link link(1U, 0);
+    link.m_receiver.reject(ublox::MsgId_CFG_RATE);
+    link.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, 1U), cfgMsg(ublox::MsgId_NAV_PVT, 0U));
+    link.m_engine.add(cfgRate(100U), cfgRate(1000U));
+    link.m_engine.add(cfgMsg(ublox::MsgId_NAV_SAT, 1U), cfgMsg(ublox::MsgId_NAV_SAT, 0U));
+    link.run();
+
+    UBLOX_TEST_ASSERT(link.m_engine.state() == util::CfgEngineState::RolledBack);
+    UBLOX_TEST_ASSERT(link.m_engine.failedTransaction() == 1U);
+    UBLOX_TEST_ASSERT(link.m_engine.status(0U) == util::CfgTransactionStatus::Acked);
+    UBLOX_TEST_ASSERT(link.m_engine.status(1U) == util::CfgTransactionStatus::Nacked);
+    UBLOX_TEST_ASSERT(link.m_engine.status(2U) == util::CfgTransactionStatus::Skipped);
+    UBLOX_TEST_ASSERT(link.m_engine.stats().m_naks == 1U);
+
+    // Only the acknowledged message is rolled back
+    UBLOX_TEST_ASSERT(link.m_sent.size() == 3U);
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_MSG) == payloadOf(cfgMsg(ublox::MsgId_NAV_PVT, 0U)));
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_RATE).empty());
+}
+
+void testTimeoutRetry()
+{
+    static const std::int64_t TimeoutMs = 50;
+    static const unsigned Attempts = 3U;
+
+    // Every third frame lost
+    Link link(4U, 10, TimeoutMs, Attempts);
+    link.m_receiver.dropEvery(3U);
+    for (std::uint8_t rate = 1U; rate <= 10U; ++rate) {
+        link.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, rate));
+    }
+    link.m_engine.add(cfgRate(100U));
+    link.run();
+
+    UBLOX_TEST_ASSERT(link.m_engine.state() == util::CfgEngineState::Completed);
+    UBLOX_TEST_ASSERT(0U < link.m_engine.stats().m_retries);
+    UBLOX_TEST_ASSERT(link.m_engine.stats().m_frames == link.m_receiver.received());
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_MSG) == payloadOf(cfgMsg(ublox::MsgId_NAV_PVT, 10U)));
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_RATE) == payloadOf(cfgRate(100U)));
+
+    // All frames lost, the rollback times out as well
+    Link lost(4U, 10, TimeoutMs, Attempts);
+    lost.m_receiver.dropEvery(1U);
+    lost.m_engine.add(cfgRate(100U), cfgRate(1000U));
+    lost.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, 1U));
+    lost.run();
+
+    UBLOX_TEST_ASSERT(lost.m_engine.state() == util::CfgEngineState::Failed);
+    UBLOX_TEST_ASSERT(lost.m_engine.failedTransaction() == 0U);
+    UBLOX_TEST_ASSERT(lost.m_engine.status(0U) == util::CfgTransactionStatus::TimedOut);
+    UBLOX_TEST_ASSERT(lost.m_engine.status(1U) == util::CfgTransactionStatus::TimedOut);
+    UBLOX_TEST_ASSERT(lost.m_engine.transmissions(0U) == Attempts);
+    UBLOX_TEST_ASSERT(lost.m_engine.transmissions(1U) == Attempts);
+    UBLOX_TEST_ASSERT(lost.m_sent.size() == (3U * Attempts));
+    UBLOX_TEST_ASSERT(lost.m_receiver.accepted() == 0U);
+}
+
+void testChecksumResync()
+{
+    // False frame header followed by the valid frame
+    std::vector<std::uint8_t> data = {protocol::FrameSyncChar1, protocol::FrameSyncChar2, 0x06, 0x01, 0x04, 0x00};
+    auto payload = payloadOf(cfgRate(100U));
+    util::details::appendFrame(ublox::MsgId_CFG_RATE, payload.data(), payload.size(), data);
+
+    Link link(1U, 0);
+    for (std::size_t idx = 0U; idx < data.size(); ++idx) {
+        link.m_receiver.feed(&data[idx], 1U);
+    }
+    UBLOX_TEST_ASSERT(link.m_receiver.checksumErrors() == 1U);
+    UBLOX_TEST_ASSERT(link.m_receiver.received() == 1U);
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_RATE) == payload);
+
+    // Corrupted frame isn't acknowledged and is retransmitted
+    Link corrupt(4U, 10, 50);
+    corrupt.m_corrupt = 1U;
+    corrupt.m_engine.add(cfgRate(100U));
+    corrupt.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, 1U));
+    corrupt.run();
+
+    UBLOX_TEST_ASSERT(corrupt.m_engine.state() == util::CfgEngineState::Completed);
+    UBLOX_TEST_ASSERT(corrupt.m_receiver.checksumErrors() == 1U);
+    UBLOX_TEST_ASSERT(corrupt.m_engine.transmissions(0U) == 2U);
+    UBLOX_TEST_ASSERT(corrupt.m_engine.transmissions(1U) == 1U);
+    UBLOX_TEST_ASSERT(corrupt.m_engine.stats().m_retries == 1U);
+    UBLOX_TEST_ASSERT(corrupt.m_receiver.payload(ublox::MsgId_CFG_RATE) == payloadOf(cfgRate(100U)));
+}
+
+void testRollback()
+{
+    static const std::uint8_t Nav5Payload[] = {0x01, 0x00};
+
+    Link link(8U, 10);
+    link.m_receiver.reject(ublox::MsgId_CFG_NAV5);
+    link.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, 1U), cfgMsg(ublox::MsgId_NAV_PVT, 0U));
+    link.m_engine.addBarrier(cfgRate(100U), cfgRate(1000U));
+    link.m_engine.add(cfgMsg(ublox::MsgId_NAV_SAT, 1U), cfgMsg(ublox::MsgId_NAV_SAT, 0U));
+    link.m_engine.add(cfgMsg(ublox::MsgId_NAV_DOP, 1U));
+    link.m_engine.addRaw(ublox::MsgId_CFG_NAV5, &Nav5Payload[0], sizeof(Nav5Payload));
+    link.run();
+
+    UBLOX_TEST_ASSERT(link.m_engine.state() == util::CfgEngineState::RolledBack);
+    UBLOX_TEST_ASSERT(link.m_engine.failedTransaction() == 4U);
+    UBLOX_TEST_ASSERT(link.m_sent.size() == 8U);
+
+    // Transactions following the barrier pipelined
+    UBLOX_TEST_ASSERT(link.m_sent[4U].m_outstanding == 3U);
+
+    // Rolled back in reverse order, the barrier alone
+    UBLOX_TEST_ASSERT(link.m_sent[5U].m_id == ublox::MsgId_CFG_MSG);
+    UBLOX_TEST_ASSERT(link.m_sent[6U].m_id == ublox::MsgId_CFG_RATE);
+    UBLOX_TEST_ASSERT(link.m_sent[6U].m_outstanding == 1U);
+    UBLOX_TEST_ASSERT(link.m_sent[7U].m_id == ublox::MsgId_CFG_MSG);
+    UBLOX_TEST_ASSERT(link.m_sent[7U].m_outstanding == 1U);
+
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_MSG) == payloadOf(cfgMsg(ublox::MsgId_NAV_PVT, 0U)));
+    UBLOX_TEST_ASSERT(link.m_receiver.payload(ublox::MsgId_CFG_RATE) == payloadOf(cfgRate(1000U)));
+
+    // Rejected rollback
+    Link failed(8U, 10);
+    failed.m_rejectRollback = true;
+    failed.m_receiver.reject(ublox::MsgId_CFG_NAV5);
+    failed.m_engine.add(cfgMsg(ublox::MsgId_NAV_PVT, 1U), cfgMsg(ublox::MsgId_NAV_PVT, 0U));
+    failed.m_engine.add(cfgRate(100U), cfgRate(1000U));
+    failed.m_engine.addRaw(ublox::MsgId_CFG_NAV5, &Nav5Payload[0], sizeof(Nav5Payload));
+    failed.run();
+
+    UBLOX_TEST_ASSERT(failed.m_engine.state() == util::CfgEngineState::Failed);
+    UBLOX_TEST_ASSERT(failed.m_engine.failedTransaction() == 2U);
+    UBLOX_TEST_ASSERT(failed.m_engine.stats().m_naks == 3U);
+    UBLOX_TEST_ASSERT(failed.m_receiver.payload(ublox::MsgId_CFG_RATE) == payloadOf(cfgRate(100U)));
+}
+
+}  // namespace
+
+int main()
+{
+    testAck();
+    testNak();
+    testTimeoutRetry();
+    testChecksumResync();
+    testRollback();
+    return 0;
+}
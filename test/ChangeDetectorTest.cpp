@@ -0,0 +1,204 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the payload change detection. The protocol stack is replaced by
+// minimal UBX frame parser counting the decoded frames.
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ublox/protocol/ChangeDetector.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace protocol = ublox::protocol;
+
+struct TestMessage
+{
+    ublox::MsgId m_id;
+};
+
+typedef std::unique_ptr<TestMessage> TestMsgPtr;
+
+class TestStack
+{
+public:
+    comms::ErrorStatus read(
+        TestMsgPtr& msgPtr,
+        const std::uint8_t*& iter,
+        std::size_t len,
+        std::size_t* missingSize)
+    {
+        static_cast<void>(missingSize);
+        msgPtr.reset();
+        if ((len < protocol::FrameHeaderLen) ||
+            (len < protocol::frameLength(protocol::framePayloadLength(iter)))) {
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        auto payloadLen = protocol::framePayloadLength(iter);
+        if (!protocol::frameChecksumValid(iter, payloadLen)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        msgPtr.reset(new TestMessage);
+        msgPtr->m_id = protocol::frameMsgId(iter);
+        iter += protocol::frameLength(payloadLen);
+        ++m_decoded;
+        return comms::ErrorStatus::Success;
+    }
+
+    unsigned decoded() const
+    {
+        return m_decoded;
+    }
+
+private:
+    unsigned m_decoded = 0U;
+};
+
+std::vector<std::uint8_t> makePayload(std::size_t len, std::uint8_t seed)
+{
+    std::vector<std::uint8_t> payload(len);
+    for (std::size_t idx = 0U; idx < len; ++idx) {
+        payload[idx] = static_cast<std::uint8_t>(seed + idx);
+    }
+    return payload;
+}
+
+std::vector<std::uint8_t> makeFrame(ublox::MsgId id, const std::vector<std::uint8_t>& payload)
+{
+    std::vector<std::uint8_t> frame(protocol::frameLength(payload.size()));
+    protocol::writeFrame(id, payload.data(), payload.size(), frame.data());
+    return frame;
+}
+
+void testTracking()
+{
+    static const ublox::MsgId Ids[] = {
+        ublox::MsgId_NAV_TIMELS,
+        ublox::MsgId_ACK_ACK,
+        ublox::MsgId_MON_VER,
+        ublox::MsgId_CFG_GNSS,
+        ublox::MsgId_NAV_PVT,
+        ublox::MsgId_AID_ALM,
+    };
+
+    protocol::PayloadChangeDetector<5U> detector;
+    for (std::size_t idx = 0U; idx < 5U; ++idx) {
+        UBLOX_TEST_ASSERT(detector.track(Ids[idx]));
+        UBLOX_TEST_ASSERT(detector.track(Ids[idx]));
+    }
+    UBLOX_TEST_ASSERT(!detector.track(Ids[5]));
+
+    for (std::size_t idx = 0U; idx < 5U; ++idx) {
+        UBLOX_TEST_ASSERT(detector.isTracked(Ids[idx]));
+    }
+    UBLOX_TEST_ASSERT(!detector.isTracked(Ids[5]));
+    UBLOX_TEST_ASSERT(!detector.isTracked(ublox::MsgId_NAV_SAT));
+
+    // Records must stay attached to their IDs after sorted insertion
+    auto payload = makePayload(16U, 0U);
+    auto payloadHash = detector.hash(payload.data(), payload.size());
+    detector.record(ublox::MsgId_MON_VER, payload.data(), payload.size(), payloadHash);
+    for (std::size_t idx = 0U; idx < 5U; ++idx) {
+        auto expected = (Ids[idx] == ublox::MsgId_MON_VER);
+        UBLOX_TEST_ASSERT(detector.isUnchanged(Ids[idx], payload.data(), payload.size(), payloadHash) == expected);
+    }
+}
+
+void testComparison()
+{
+    protocol::PayloadChangeDetector<4U, 128U> detector;
+    UBLOX_TEST_ASSERT(detector.track(ublox::MsgId_MON_VER));
+
+    for (auto len : {4U, 100U}) {
+        auto payload = makePayload(len, 1U);
+        auto other = payload;
+        other[len / 2] ^= 0x1U;
+        auto payloadHash = detector.hash(payload.data(), payload.size());
+        detector.record(ublox::MsgId_MON_VER, payload.data(), payload.size(), payloadHash);
+        UBLOX_TEST_ASSERT(detector.isUnchanged(ublox::MsgId_MON_VER, payload.data(), payload.size(), payloadHash));
+
+        // Matching hash alone mustn't be enough
+        UBLOX_TEST_ASSERT(!detector.isUnchanged(ublox::MsgId_MON_VER, other.data(), other.size(), payloadHash));
+
+        detector.invalidate(ublox::MsgId_MON_VER);
+        UBLOX_TEST_ASSERT(!detector.isUnchanged(ublox::MsgId_MON_VER, payload.data(), payload.size(), payloadHash));
+    }
+
+    // Too long payloads are never reported unchanged
+    auto longPayload = makePayload(200U, 2U);
+    auto longHash = detector.hash(longPayload.data(), longPayload.size());
+    detector.record(ublox::MsgId_MON_VER, longPayload.data(), longPayload.size(), longHash);
+    UBLOX_TEST_ASSERT(!detector.isUnchanged(ublox::MsgId_MON_VER, longPayload.data(), longPayload.size(), longHash));
+}
+
+void testReadIfChanged()
+{
+    protocol::PayloadChangeDetector<> detector;
+    UBLOX_TEST_ASSERT(detector.track(ublox::MsgId_MON_VER));
+
+    auto version = makeFrame(ublox::MsgId_MON_VER, makePayload(160U, 3U));
+    auto updated = makeFrame(ublox::MsgId_MON_VER, makePayload(160U, 4U));
+    auto pvt = makeFrame(ublox::MsgId_NAV_PVT, makePayload(92U, 5U));
+
+    std::vector<std::uint8_t> buf;
+    for (auto* frame : {&version, &pvt, &version, &pvt, &updated, &updated}) {
+        buf.insert(buf.end(), frame->begin(), frame->end());
+    }
+
+    static const bool Expected[] = {false, false, true, false, false, true};
+
+    TestStack stack;
+    TestMsgPtr msgPtr;
+    const std::uint8_t* iter = buf.data();
+    for (auto expected : Expected) {
+        bool unchanged = false;
+        auto remaining = static_cast<std::size_t>(buf.data() + buf.size() - iter);
+        auto es = protocol::readIfChanged(stack, detector, msgPtr, iter, remaining, unchanged);
+        UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+        UBLOX_TEST_ASSERT(unchanged == expected);
+        UBLOX_TEST_ASSERT(static_cast<bool>(msgPtr) != expected);
+    }
+    UBLOX_TEST_ASSERT(iter == buf.data() + buf.size());
+    UBLOX_TEST_ASSERT(stack.decoded() == 4U);
+
+    // Incomplete frame is passed to the stack
+    detector.invalidateAll();
+    bool unchanged = true;
+    iter = version.data();
+    auto es = protocol::readIfChanged(stack, detector, msgPtr, iter, version.size() - 1U, unchanged);
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_ASSERT(!unchanged);
+    UBLOX_TEST_ASSERT(iter == version.data());
+}
+
+}  // namespace
+
+int main()
+{
+    testTracking();
+    testComparison();
+    testReadIfChanged();
+    return 0;
+}
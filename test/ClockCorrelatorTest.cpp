@@ -0,0 +1,213 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Tests of the host clock correlator: GPS week tracking from TIM-TP of
+// different time bases, pulse and arrival observations, drift fitting and
+// outliers rejection.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+
+#include "ublox/util/ClockCorrelator.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef message::TimTpFields::TimeRefGnss TimeRefGnss;
+
+static const std::int64_t NsPerMs = 1000000LL;
+static const std::int64_t NsPerSec = 1000000000LL;
+static const std::int64_t WeekNs = 604800LL * NsPerSec;
+static const std::int64_t HostStartNs = 1000000000000LL;
+
+message::TimTp<> makeTimTp(std::uint16_t week, std::uint32_t towMs, bool utcBase, TimeRefGnss timeRef)
+{
+    message::TimTp<> msg;
+    msg.field_week().value() = week;
+    msg.field_towMS().value() = towMs;
+    msg.field_flags().field_flagsBits().setBitValue(message::TimTpFields::flagsBits::BitIdx_timeBase, utcBase);
+    msg.field_refInfo().field_timeRefGnss().value() = timeRef;
+    return msg;
+}
+
+std::int64_t toGps(const util::ClockCorrelator& correlator, std::int64_t hostNs)
+{
+    std::int64_t gpsNs = 0;
+    UBLOX_TEST_ASSERT(correlator.hostToGps(hostNs, gpsNs));
+    return gpsNs;
+}
+
+void testWeekFromGnssTimeBaseOnly()
+{
+    util::ClockCorrelator correlator;
+
+    // UTC aligned pulse doesn't provide GPS week
+    correlator.handle(makeTimTp(2000U, 5000U, true, TimeRefGnss::Gps));
+    correlator.epoch(6000U, HostStartNs);
+    std::int64_t gpsNs = 0;
+    UBLOX_TEST_ASSERT(!correlator.hostToGps(HostStartNs, gpsNs));
+
+    correlator.handle(makeTimTp(2000U, 5000U, false, TimeRefGnss::Gps));
+    correlator.epoch(6000U, HostStartNs);
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs) == ((2000 * WeekNs) + (6 * NsPerSec)));
+
+    // UTC week and time of week (here at the end of the week) must not be
+    // mixed with GPS time
+    correlator.handle(makeTimTp(1999U, 604000000U, true, TimeRefGnss::Gps));
+    correlator.epoch(7000U, HostStartNs + NsPerSec);
+    UBLOX_TEST_ASSERT(correlator.stats().m_accepted == 2U);
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs + NsPerSec) == ((2000 * WeekNs) + (7 * NsPerSec)));
+
+    // GLONASS reference doesn't provide GPS week either
+    correlator.handle(makeTimTp(1500U, 8000U, false, TimeRefGnss::Glonass));
+    correlator.epoch(8000U, HostStartNs + (2 * NsPerSec));
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs + (2 * NsPerSec)) == ((2000 * WeekNs) + (8 * NsPerSec)));
+}
+
+void testBeiDouWeek()
+{
+    util::ClockCorrelator correlator;
+
+    // BDT week 700 + 1356 = GPS week 2056, BDT = GPS - 14 s
+    correlator.handle(makeTimTp(700U, 100000U, false, TimeRefGnss::BeiDou));
+
+    // Only GPS aligned pulses are used
+    correlator.pulse(HostStartNs);
+    UBLOX_TEST_ASSERT(!correlator.correlation().m_valid);
+
+    correlator.epoch(115000U, HostStartNs);
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs) == ((2056 * WeekNs) + (115 * NsPerSec)));
+
+    // Week rollover of BeiDou time of week converted into GPS time
+    util::ClockCorrelator rollover;
+    rollover.handle(makeTimTp(700U, 604790000U, false, TimeRefGnss::BeiDou));
+    rollover.epoch(5000U, HostStartNs);
+    UBLOX_TEST_ASSERT(toGps(rollover, HostStartNs) == ((2057 * WeekNs) + (5 * NsPerSec)));
+}
+
+void testPulseAndNavClock()
+{
+    util::ClockCorrelator correlator;
+    message::NavClock<> clock;
+    clock.field_iTOW().value() = 9000U;
+    clock.field_clkB().value() = 250000;
+    clock.field_clkD().value() = 0;
+
+    // Arrival time of the epoch output when the receiver clock reaches it
+    correlator.handle(makeTimTp(2000U, 9000U, false, TimeRefGnss::Gps));
+    correlator.handle(clock, HostStartNs);
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs) == ((2000 * WeekNs) + (9 * NsPerSec) - 250000));
+
+    auto msg = makeTimTp(2000U, 10000U, false, TimeRefGnss::Gps);
+    msg.field_qErr().value() = -3000; // ps
+    correlator.handle(msg);
+    correlator.pulse(HostStartNs + (NsPerSec / 2));
+    UBLOX_TEST_ASSERT(correlator.stats().m_accepted == 2U);
+
+    // Pulse reported twice is ignored
+    correlator.pulse(HostStartNs + NsPerSec);
+    UBLOX_TEST_ASSERT(correlator.stats().m_accepted == 2U);
+
+    // Arrival observations are ignored once the pulses are used
+    clock.field_iTOW().value() = 11000U;
+    correlator.handle(clock, HostStartNs + (2 * NsPerSec));
+    UBLOX_TEST_ASSERT(correlator.stats().m_accepted == 2U);
+
+    auto pulseGpsNs = (2000 * WeekNs) + (10 * NsPerSec) - 3;
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs + (NsPerSec / 2)) == pulseGpsNs);
+}
+
+void testDrift()
+{
+    static const double DriftPpb = 50.0;
+    static const std::int64_t OffsetNs = (2000 * WeekNs) - HostStartNs + 123456789LL;
+    util::ClockCorrelator correlator;
+    for (std::int64_t sec = 0; sec < 100; ++sec) {
+        auto hostNs = HostStartNs + (sec * NsPerSec);
+        auto gpsNs = hostNs + OffsetNs + static_cast<std::int64_t>(std::llround(DriftPpb * static_cast<double>(sec)));
+        correlator.observe(hostNs, gpsNs);
+    }
+
+    auto corr = correlator.correlation();
+    UBLOX_TEST_ASSERT(corr.m_valid);
+    UBLOX_TEST_NEAR(corr.m_driftPpb, DriftPpb, 0.01);
+    UBLOX_TEST_ASSERT(corr.m_stats.m_accepted == 100U);
+    UBLOX_TEST_ASSERT(corr.m_stats.m_rejected == 0U);
+
+    // Extrapolation by 100 s
+    auto hostNs = HostStartNs + (200 * NsPerSec);
+    auto expectedNs = hostNs + OffsetNs + static_cast<std::int64_t>(DriftPpb * 200.0);
+    auto gpsNs = toGps(correlator, hostNs);
+    UBLOX_TEST_ASSERT(std::abs(gpsNs - expectedNs) <= 2);
+
+    std::int64_t backNs = 0;
+    UBLOX_TEST_ASSERT(correlator.gpsToHost(gpsNs, backNs));
+    UBLOX_TEST_ASSERT(std::abs(backNs - hostNs) <= 1);
+}
+
+void testOutliers()
+{
+    static const std::int64_t OffsetNs = 1000000;
+    util::ClockCorrelator correlator;
+    std::int64_t sec = 0;
+    for (; sec < 20; ++sec) {
+        correlator.observe(HostStartNs + (sec * NsPerSec), HostStartNs + (sec * NsPerSec) + OffsetNs);
+    }
+
+    // Single outlier is rejected
+    correlator.observe(HostStartNs + (sec * NsPerSec), HostStartNs + (sec * NsPerSec) + OffsetNs + 10000000);
+    ++sec;
+    auto stats = correlator.stats();
+    UBLOX_TEST_ASSERT(stats.m_accepted == 20U);
+    UBLOX_TEST_ASSERT(stats.m_rejected == 1U);
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs + (sec * NsPerSec)) == (HostStartNs + (sec * NsPerSec) + OffsetNs));
+
+    // Accepted observation resets the consecutive outliers count
+    correlator.observe(HostStartNs + (sec * NsPerSec), HostStartNs + (sec * NsPerSec) + OffsetNs);
+    ++sec;
+    UBLOX_TEST_ASSERT(correlator.stats().m_accepted == 21U);
+
+    // Host clock step restarts the fit
+    static const std::int64_t StepNs = 50000000;
+    for (unsigned idx = 0U; idx < util::ClockCorrelator::MaxConsecutiveOutliers; ++idx, ++sec) {
+        correlator.observe(HostStartNs + (sec * NsPerSec), HostStartNs + (sec * NsPerSec) + OffsetNs + StepNs);
+    }
+
+    stats = correlator.stats();
+    UBLOX_TEST_ASSERT(stats.m_resets == 1U);
+    UBLOX_TEST_ASSERT(stats.m_accepted == 1U);
+    UBLOX_TEST_ASSERT(toGps(correlator, HostStartNs + (sec * NsPerSec)) == (HostStartNs + (sec * NsPerSec) + OffsetNs + StepNs));
+}
+
+}  // namespace
+
+int main()
+{
+    testWeekFromGnssTimeBaseOnly();
+    testBeiDouWeek();
+    testPulseAndNavClock();
+    testDrift();
+    testOutliers();
+    return 0;
+}
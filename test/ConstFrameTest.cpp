@@ -0,0 +1,180 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the frames serialised at compile time: every frame is compared
+// with the output of the protocol stack writing the same message.
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "ublox/Stack.h"
+#include "ublox/OutputMessages.h"
+#include "ublox/protocol/ConstFrame.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace message = ublox::message;
+namespace protocol = ublox::protocol;
+
+typedef ublox::Stack<ublox::Message, ublox::OutputMessages<> > Stack;
+typedef message::CfgRstFields::ResetMode ResetMode;
+
+template <typename TFrame, typename TMsg>
+bool matches(const TMsg& msg = TMsg())
+{
+    Stack stack;
+    return protocol::matchesStackWrite<TFrame>(stack, msg);
+}
+
+message::CfgRst<> cfgRst(std::uint16_t navBbrMask, ResetMode resetMode)
+{
+    message::CfgRst<> msg;
+    msg.field_navBbrMask().value() = navBbrMask;
+    msg.field_resetMode().value() = resetMode;
+    return msg;
+}
+
+void testPolls()
+{
+    UBLOX_TEST_ASSERT((matches<protocol::AidAlmPollFrame, message::AidAlmPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::AidAopPollFrame, message::AidAopPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::AidEphPollFrame, message::AidEphPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::AidHuiPollFrame, message::AidHuiPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::AidIniPollFrame, message::AidIniPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgAntPollFrame, message::CfgAntPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgDatPollFrame, message::CfgDatPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgDoscPollFrame, message::CfgDoscPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgEkfPollFrame, message::CfgEkfPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgEsfgwtPollFrame, message::CfgEsfgwtPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgEsrcPollFrame, message::CfgEsrcPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgFxnPollFrame, message::CfgFxnPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgGeofencePollFrame, message::CfgGeofencePoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgGnssPollFrame, message::CfgGnssPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgItfmPollFrame, message::CfgItfmPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgLogfilterPollFrame, message::CfgLogfilterPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgNav5PollFrame, message::CfgNav5Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgNavx5PollFrame, message::CfgNavx5Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgNmeaPollFrame, message::CfgNmeaPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgOdoPollFrame, message::CfgOdoPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgPm2PollFrame, message::CfgPm2Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgPmPollFrame, message::CfgPmPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgPmsPollFrame, message::CfgPmsPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgPrtPollFrame, message::CfgPrtPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRatePollFrame, message::CfgRatePoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRinvPollFrame, message::CfgRinvPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRxmPollFrame, message::CfgRxmPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgSbasPollFrame, message::CfgSbasPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgSmgrPollFrame, message::CfgSmgrPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgTmode2PollFrame, message::CfgTmode2Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgTmodePollFrame, message::CfgTmodePoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgTp5PollFrame, message::CfgTp5Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgTpPollFrame, message::CfgTpPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgUsbPollFrame, message::CfgUsbPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::EsfStatusPollFrame, message::EsfStatusPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::LogInfoPollFrame, message::LogInfoPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MgaDbdPollFrame, message::MgaDbdPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonGnssPollFrame, message::MonGnssPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonHw2PollFrame, message::MonHw2Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonHwPollFrame, message::MonHwPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonIoPollFrame, message::MonIoPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonMsgppPollFrame, message::MonMsgppPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonPatchPollFrame, message::MonPatchPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonRxbufPollFrame, message::MonRxbufPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonTxbufPollFrame, message::MonTxbufPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::MonVerPollFrame, message::MonVerPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavAopstatusPollFrame, message::NavAopstatusPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavClockPollFrame, message::NavClockPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavDgpsPollFrame, message::NavDgpsPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavDopPollFrame, message::NavDopPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavEkfstatusPollFrame, message::NavEkfstatusPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavGeofencePollFrame, message::NavGeofencePoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavOdoPollFrame, message::NavOdoPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavOrbPollFrame, message::NavOrbPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavPosecefPollFrame, message::NavPosecefPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavPosllhPollFrame, message::NavPosllhPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavPvtPollFrame, message::NavPvtPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavSatPollFrame, message::NavSatPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavSbasPollFrame, message::NavSbasPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavSolPollFrame, message::NavSolPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavStatusPollFrame, message::NavStatusPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavSvinfoPollFrame, message::NavSvinfoPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavTimebdsPollFrame, message::NavTimebdsPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavTimegalPollFrame, message::NavTimegalPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavTimegloPollFrame, message::NavTimegloPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavTimegpsPollFrame, message::NavTimegpsPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavTimelsPollFrame, message::NavTimelsPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavTimeutcPollFrame, message::NavTimeutcPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavVelecefPollFrame, message::NavVelecefPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::NavVelnedPollFrame, message::NavVelnedPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::RxmAlmPollFrame, message::RxmAlmPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::RxmEphPollFrame, message::RxmEphPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::RxmImesPollFrame, message::RxmImesPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::RxmRawPollFrame, message::RxmRawPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::RxmRawxPollFrame, message::RxmRawxPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::RxmSvsiPollFrame, message::RxmSvsiPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::TimFchgPollFrame, message::TimFchgPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::TimSvinPollFrame, message::TimSvinPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::TimTm2PollFrame, message::TimTm2Poll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::TimTpPollFrame, message::TimTpPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::TimVcocalPollFrame, message::TimVcocalPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::TimVrfyPollFrame, message::TimVrfyPoll<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::UpdSosPollFrame, message::UpdSosPoll<> >()));
+}
+
+void testFixedContents()
+{
+    UBLOX_TEST_ASSERT((matches<protocol::NavResetodoFrame, message::NavResetodo<> >()));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRstHotStartFrame>(cfgRst(0x0000, ResetMode::GnssOnly))));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRstWarmStartFrame>(cfgRst(0x0001, ResetMode::GnssOnly))));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRstColdStartFrame>(cfgRst(0xffff, ResetMode::GnssOnly))));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRstGnssStopFrame>(cfgRst(0x0000, ResetMode::GnssStop))));
+    UBLOX_TEST_ASSERT((matches<protocol::CfgRstGnssStartFrame>(cfgRst(0x0000, ResetMode::GnssStart))));
+
+    // Different contents or ID
+    UBLOX_TEST_ASSERT((!matches<protocol::CfgRstWarmStartFrame>(cfgRst(0x0000, ResetMode::GnssOnly))));
+    UBLOX_TEST_ASSERT((!matches<protocol::CfgRstHotStartFrame>(cfgRst(0x0000, ResetMode::Software))));
+    UBLOX_TEST_ASSERT((!matches<protocol::MonVerPollFrame, message::MonHwPoll<> >()));
+    UBLOX_TEST_ASSERT((!matches<protocol::NavPvtPollFrame>(cfgRst(0x0000, ResetMode::GnssOnly))));
+}
+
+void testReferenceFrames()
+{
+    // From the protocol specification
+    static const std::uint8_t NavPvtPoll[] = {0xb5, 0x62, 0x01, 0x07, 0x00, 0x00, 0x08, 0x19};
+    static const std::uint8_t HotStart[] = {0xb5, 0x62, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x68};
+
+    UBLOX_TEST_ASSERT(protocol::NavPvtPollFrame::size() == sizeof(NavPvtPoll));
+    UBLOX_TEST_ASSERT(std::equal(&NavPvtPoll[0], &NavPvtPoll[sizeof(NavPvtPoll)], protocol::NavPvtPollFrame::data()));
+
+    std::uint8_t buf[sizeof(HotStart)] = {0};
+    UBLOX_TEST_ASSERT(protocol::CfgRstHotStartFrame::copyTo(&buf[0]) == sizeof(HotStart));
+    UBLOX_TEST_ASSERT(std::equal(&HotStart[0], &HotStart[sizeof(HotStart)], &buf[0]));
+}
+
+}  // namespace
+
+int main()
+{
+    testPolls();
+    testFixedContents();
+    testReferenceFrames();
+    return 0;
+}
@@ -0,0 +1,208 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the cycle slip detection in sequences of RXM-RAWX epochs.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "ublox/message/RxmRawx.h"
+#include "ublox/util/CycleSlipDetector.h"
+
+#include "common.h"
+
+namespace
+{
+
+typedef ublox::message::RxmRawx<> RxmRawx;
+typedef ublox::field::common::GnssId GnssId;
+typedef ublox::util::CycleSlipDetector CycleSlipDetector;
+
+static const double StartTow = 100000.0;
+static const std::uint32_t TrkStatOk = 0x7; // pr, cp valid, half cycle resolved
+static const std::uint32_t TrkStatNoPhase = 0x1;
+static const std::uint32_t TrkStatUnresolved = 0x3;
+static const std::uint32_t SubHalfCyc = 0x8;
+
+struct Meas
+{
+    GnssId m_gnssId;
+    unsigned m_svId;
+    double m_cp;
+    float m_doppler;
+    unsigned m_lockMs;
+    std::uint32_t m_trkStat;
+    unsigned m_freqId;
+};
+
+RxmRawx makeEpoch(double tow, const std::vector<Meas>& meas)
+{
+    RxmRawx msg;
+    msg.field_rcvTow().value() = tow;
+    msg.field_week().value() = 2300U;
+
+    auto& blocks = msg.field_data().value();
+    blocks.resize(meas.size());
+    for (std::size_t idx = 0U; idx < meas.size(); ++idx) {
+        auto& block = blocks[idx];
+        block.field_prMes().value() = 2.0e7;
+        block.field_cpMes().value() = meas[idx].m_cp;
+        block.field_doMes().value() = meas[idx].m_doppler;
+        block.field_gnssId().value() = meas[idx].m_gnssId;
+        block.field_svId().value() = static_cast<std::uint8_t>(meas[idx].m_svId);
+        block.field_freqId().value() = static_cast<std::uint8_t>(meas[idx].m_freqId);
+        block.field_locktime().value() = static_cast<std::uint16_t>(meas[idx].m_lockMs);
+        block.field_trkStat().value() = static_cast<std::uint8_t>(meas[idx].m_trkStat);
+    }
+    return msg;
+}
+
+// Carrier phase consistent with the constant Doppler
+double phaseAt(double sec, float doppler)
+{
+    return 1.0e8 - (static_cast<double>(doppler) * sec);
+}
+
+void testSingleSatellite()
+{
+    CycleSlipDetector detector;
+    static const float Doppler = -1500.25f;
+    Meas gps = {GnssId::Gps, 5U, phaseAt(0.0, Doppler), Doppler, 10000U, TrkStatOk, 0U};
+    Meas noPhase = {GnssId::Gps, 6U, 0.0, 0.0f, 10000U, TrkStatNoPhase, 0U};
+    Meas unresolved = {GnssId::Galileo, 7U, 5.0e7, 0.0f, 10000U, TrkStatUnresolved, 0U};
+
+    detector.handle(makeEpoch(StartTow, {gps, noPhase, unresolved}));
+    UBLOX_TEST_ASSERT(detector.count() == 3U);
+    UBLOX_TEST_ASSERT(detector.flags()[0] == ublox::util::CycleSlip_NewTrack);
+    UBLOX_TEST_ASSERT(detector.flags()[1] == ublox::util::CycleSlip_NoPhase);
+    UBLOX_TEST_ASSERT(
+        detector.flags()[2] ==
+        (ublox::util::CycleSlip_NewTrack | ublox::util::CycleSlip_HalfCycleUnresolved));
+    UBLOX_TEST_ASSERT(!detector.slipped(1U));
+
+    // Continuous tracking
+    gps.m_cp = phaseAt(1.0, Doppler);
+    gps.m_lockMs += 1000U;
+    unresolved.m_lockMs += 1000U;
+    detector.handle(makeEpoch(StartTow + 1.0, {gps, noPhase, unresolved}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == 0U);
+    UBLOX_TEST_NEAR(detector.residuals()[0], 0.0, 1e-6);
+    UBLOX_TEST_ASSERT(detector.flags()[1] == ublox::util::CycleSlip_NoPhase);
+    UBLOX_TEST_NEAR(detector.residuals()[1], 0.0, 0.0);
+    UBLOX_TEST_ASSERT(detector.flags()[2] == ublox::util::CycleSlip_HalfCycleUnresolved);
+
+    // Carrier phase jump
+    gps.m_cp = phaseAt(2.0, Doppler) + 10.0;
+    gps.m_lockMs += 1000U;
+    detector.handle(makeEpoch(StartTow + 2.0, {gps}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == ublox::util::CycleSlip_PhaseJump);
+    UBLOX_TEST_NEAR(detector.residuals()[0], 10.0, 1e-6);
+
+    // Lock time reset
+    gps.m_cp = phaseAt(3.0, Doppler) + 10.0;
+    gps.m_lockMs = 500U;
+    detector.handle(makeEpoch(StartTow + 3.0, {gps}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == ublox::util::CycleSlip_LockReset);
+
+    // Half cycle subtraction change
+    gps.m_cp = phaseAt(4.0, Doppler) + 10.0;
+    gps.m_lockMs += 1000U;
+    gps.m_trkStat |= SubHalfCyc;
+    detector.handle(makeEpoch(StartTow + 4.0, {gps}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == ublox::util::CycleSlip_HalfCycle);
+
+    // Gap longer than the configured maximum
+    gps.m_cp = phaseAt(20.0, Doppler) + 10.0;
+    gps.m_lockMs += 16000U;
+    detector.handle(makeEpoch(StartTow + 20.0, {gps}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == ublox::util::CycleSlip_NewTrack);
+    UBLOX_TEST_NEAR(detector.residuals()[0], 0.0, 0.0);
+
+    auto& stats = detector.stats();
+    UBLOX_TEST_ASSERT(stats.m_epochs == 6U);
+    UBLOX_TEST_ASSERT(stats.m_measurements == 10U);
+    UBLOX_TEST_ASSERT(stats.m_slips == 6U);
+}
+
+void testGlonassFrequencyChange()
+{
+    CycleSlipDetector detector;
+    Meas glo = {GnssId::Glonass, 3U, 1.0e8, 0.0f, 10000U, TrkStatOk, 5U};
+    detector.handle(makeEpoch(StartTow, {glo}));
+
+    glo.m_lockMs += 1000U;
+    detector.handle(makeEpoch(StartTow + 1.0, {glo}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == 0U);
+
+    glo.m_lockMs += 1000U;
+    glo.m_freqId = 6U;
+    detector.handle(makeEpoch(StartTow + 2.0, {glo}));
+    UBLOX_TEST_ASSERT(detector.flags()[0] == ublox::util::CycleSlip_NewTrack);
+}
+
+void testManySatellites()
+{
+    // Number of the measurements not multiple of any vector size
+    std::vector<Meas> meas;
+    for (unsigned svId = 1U; svId <= 32U; ++svId) {
+        auto doppler = -3000.0f + (static_cast<float>(svId) * 150.5f);
+        meas.push_back(Meas{GnssId::Gps, svId, phaseAt(0.0, doppler), doppler, 20000U, TrkStatOk, 0U});
+    }
+    for (unsigned svId = 1U; svId <= 5U; ++svId) {
+        meas.push_back(Meas{GnssId::Galileo, svId, phaseAt(0.0, 100.0f), 100.0f, 20000U, TrkStatOk, 0U});
+    }
+
+    CycleSlipDetector detector;
+    detector.handle(makeEpoch(StartTow, meas));
+    for (std::size_t idx = 0U; idx < meas.size(); ++idx) {
+        UBLOX_TEST_ASSERT(detector.flags()[idx] == ublox::util::CycleSlip_NewTrack);
+    }
+
+    static const std::size_t JumpIdx = 35U;
+    static const std::size_t ResetIdx = 17U;
+    for (std::size_t idx = 0U; idx < meas.size(); ++idx) {
+        meas[idx].m_cp = phaseAt(1.0, meas[idx].m_doppler);
+        meas[idx].m_lockMs += 1000U;
+    }
+    meas[JumpIdx].m_cp += 2.0;
+    meas[ResetIdx].m_lockMs = 0U;
+
+    detector.handle(makeEpoch(StartTow + 1.0, meas));
+    UBLOX_TEST_ASSERT(detector.count() == meas.size());
+    for (std::size_t idx = 0U; idx < meas.size(); ++idx) {
+        std::uint8_t expected = 0U;
+        if (idx == JumpIdx) {
+            expected = ublox::util::CycleSlip_PhaseJump;
+        }
+        else if (idx == ResetIdx) {
+            expected = ublox::util::CycleSlip_LockReset;
+        }
+        UBLOX_TEST_ASSERT(detector.flags()[idx] == expected);
+    }
+    UBLOX_TEST_ASSERT(detector.stats().m_slips == (meas.size() + 2U));
+}
+
+}  // namespace
+
+int main()
+{
+    testSingleSatellite();
+    testGlonassFrequencyChange();
+    testManySatellites();
+    return 0;
+}
@@ -0,0 +1,349 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Tests of the ephemeris store: skipping of the duplicates received from
+// multiple receivers and sources, replacement by newer data sets only,
+// GLONASS ephemerides and almanacs.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+
+#include "ublox/util/EphemerisStore.h"
+
+#include "common.h"
+#include "NavDataFrames.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef ublox::test::NavBits NavBits;
+
+static const unsigned SvId = 5U;
+static const std::int64_t M0 = -1234567890;
+static const std::int64_t SqrtA = 2702034944LL;
+static const std::size_t ReceiversCount = 200U;
+
+std::uint64_t twos(std::int64_t value)
+{
+    return static_cast<std::uint64_t>(value);
+}
+
+NavBits gpsHeader(unsigned subframe, unsigned tow)
+{
+    NavBits bits;
+    bits.append(0x8bU, 8U).append(0U, 16U);
+    bits.append(tow, 17U).append(0U, 2U).append(subframe, 3U).append(0U, 2U);
+    return bits;
+}
+
+// GPS LNAV subframes 1 - 3 of the data set
+std::vector<NavBits> gpsDataSet(unsigned iode, unsigned toe, unsigned tow)
+{
+    std::vector<NavBits> subframes;
+    auto sf1 = gpsHeader(1U, tow);
+    sf1.append(152U, 10U).append(1U, 2U).append(2U, 4U).append(0U, 6U).append(0U, 2U).padTo(160U);
+    sf1.append(0U, 8U).append(iode, 8U).append(toe / 16U, 16U).append(0U, 8U).append(twos(-123), 16U);
+    sf1.append(twos(-1234567), 22U).append(0U, 2U);
+    subframes.push_back(sf1);
+
+    auto sf2 = gpsHeader(2U, tow + 1U);
+    sf2.append(iode, 8U).append(0U, 32U).append(twos(M0), 32U).append(0U, 16U).append(83886080U, 32U);
+    sf2.append(0U, 16U).append(SqrtA, 32U).append(toe / 16U, 16U).append(0U, 8U);
+    subframes.push_back(sf2);
+
+    auto sf3 = gpsHeader(3U, tow + 2U);
+    sf3.append(0U, 16U).append(987654321U, 32U).append(0U, 16U).append(660000000U, 32U).append(0U, 16U);
+    sf3.append(twos(-456789012), 32U).append(twos(-22000), 24U).append(iode, 8U).append(0U, 16U);
+    subframes.push_back(sf3);
+    return subframes;
+}
+
+message::RxmSfrbx<> makeSfrbx(GnssId gnssId, unsigned svId, unsigned freqId, const std::uint32_t* words, std::size_t count)
+{
+    message::RxmSfrbx<> msg;
+    msg.field_gnssId().value() = gnssId;
+    msg.field_svId().value() = static_cast<std::uint8_t>(svId);
+    msg.field_freqId().value() = static_cast<std::uint8_t>(freqId);
+    auto& list = msg.field_dwrd().value();
+    list.resize(count);
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        list[idx].value() = words[idx];
+    }
+    return msg;
+}
+
+message::RxmSfrbx<> gpsSfrbx(const NavBits& subframe, unsigned svId = SvId)
+{
+    std::uint32_t words[10];
+    ublox::test::gpsLnavWords(subframe, words);
+    return makeSfrbx(GnssId::Gps, svId, 0U, &words[0], 10U);
+}
+
+void feed(util::EphemerisStore& store, const std::vector<NavBits>& subframes)
+{
+    for (auto& subframe : subframes) {
+        store.handle(gpsSfrbx(subframe));
+    }
+}
+
+util::KeplerEphemeris stored(const util::EphemerisStore& store, GnssId gnssId, unsigned svId)
+{
+    util::KeplerEphemeris eph = util::KeplerEphemeris();
+    UBLOX_TEST_ASSERT(store.ephemeris(gnssId, svId, eph));
+    return eph;
+}
+
+void testDuplicates()
+{
+    util::EphemerisStore store;
+    util::KeplerEphemeris eph = util::KeplerEphemeris();
+    UBLOX_TEST_ASSERT(!store.ephemeris(GnssId::Gps, SvId, eph));
+    UBLOX_TEST_ASSERT(store.sequence() == 0U);
+
+    // The same subframes received by all the receivers
+    auto subframes = gpsDataSet(0x55U, 345600U, 100U);
+    for (std::size_t rx = 0U; rx < ReceiversCount; ++rx) {
+        feed(store, subframes);
+    }
+
+    auto stats = store.stats();
+    UBLOX_TEST_ASSERT(stats.m_received == (ReceiversCount * 3U));
+    UBLOX_TEST_ASSERT(stats.m_decoded == 3U);
+    UBLOX_TEST_ASSERT(stats.m_duplicates == ((ReceiversCount - 1U) * 3U));
+    UBLOX_TEST_ASSERT(stats.m_stored == 1U);
+    UBLOX_TEST_ASSERT(store.sequence() == 1U);
+
+    eph = stored(store, GnssId::Gps, SvId);
+    UBLOX_TEST_ASSERT(eph.m_gnssId == static_cast<std::uint8_t>(GnssId::Gps));
+    UBLOX_TEST_ASSERT(eph.m_svId == SvId);
+    UBLOX_TEST_ASSERT(eph.m_iode == 0x55U);
+    UBLOX_TEST_ASSERT(eph.m_toe == 345600.0);
+    UBLOX_TEST_ASSERT(eph.m_m0 == (std::ldexp(static_cast<double>(M0), -31) * 3.1415926535898));
+    UBLOX_TEST_ASSERT(eph.m_sqrtA == std::ldexp(static_cast<double>(SqrtA), -19));
+
+    // Same data of other satellite is not a duplicate
+    for (auto& subframe : subframes) {
+        store.handle(gpsSfrbx(subframe, SvId + 1U));
+    }
+    UBLOX_TEST_ASSERT(store.stats().m_decoded == 6U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+    UBLOX_TEST_ASSERT(stored(store, GnssId::Gps, SvId + 1U).m_svId == (SvId + 1U));
+
+    std::size_t count = 0U;
+    store.forEachEphemeris(
+        [&count](const util::KeplerEphemeris&)
+        {
+            ++count;
+        });
+    UBLOX_TEST_ASSERT(count == 2U);
+}
+
+void testNewerDataSet()
+{
+    util::EphemerisStore store;
+    feed(store, gpsDataSet(0x55U, 345600U, 100U));
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+
+    // Same data set retransmitted 30 s later (other HOW) is decoded but not stored again
+    feed(store, gpsDataSet(0x55U, 345600U, 105U));
+    UBLOX_TEST_ASSERT(store.stats().m_decoded == 6U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+    UBLOX_TEST_ASSERT(store.sequence() == 1U);
+
+    feed(store, gpsDataSet(0x56U, 352800U, 1200U));
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+    UBLOX_TEST_ASSERT(store.sequence() == 2U);
+    auto eph = stored(store, GnssId::Gps, SvId);
+    UBLOX_TEST_ASSERT(eph.m_iode == 0x56U);
+    UBLOX_TEST_ASSERT(eph.m_toe == 352800.0);
+
+    // Older data set (for example from a receiver which has not updated it yet)
+    feed(store, gpsDataSet(0x57U, 338400U, 1300U));
+    UBLOX_TEST_ASSERT(store.stats().m_stale == 1U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+    UBLOX_TEST_ASSERT(stored(store, GnssId::Gps, SvId).m_iode == 0x56U);
+
+    // Week rollover of the reference time
+    feed(store, gpsDataSet(0x58U, 0U, 2000U));
+    UBLOX_TEST_ASSERT(store.stats().m_stale == 1U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 3U);
+    UBLOX_TEST_ASSERT(stored(store, GnssId::Gps, SvId).m_iode == 0x58U);
+}
+
+void testOtherSources()
+{
+    util::EphemerisStore store;
+    auto subframes = gpsDataSet(0x55U, 345600U, 100U);
+    feed(store, subframes);
+
+    // RXM-EPH carries words 3 - 10 of the subframes without parity
+    message::RxmEph<> rxmEph;
+    rxmEph.field_svid().value() = SvId;
+    message::RxmEph<>::Sf* fields[] = {&rxmEph.field_sf1d(), &rxmEph.field_sf2d(), &rxmEph.field_sf3d()};
+    for (std::size_t idx = 0U; idx < 3U; ++idx) {
+        auto& list = fields[idx]->field().value();
+        list.resize(8U);
+        for (std::size_t word = 0U; word < 8U; ++word) {
+            list[word].value() = subframes[idx].get(48U + (word * 24U), 24U);
+        }
+    }
+
+    store.handle(rxmEph);
+    store.handle(rxmEph);
+    UBLOX_TEST_ASSERT(store.stats().m_received == 5U);
+    UBLOX_TEST_ASSERT(store.stats().m_decoded == 4U);
+    UBLOX_TEST_ASSERT(store.stats().m_duplicates == 1U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+
+    rxmEph.field_svid().value() = SvId + 1U;
+    store.handle(rxmEph);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+    auto eph = stored(store, GnssId::Gps, SvId + 1U);
+    UBLOX_TEST_ASSERT(eph.m_iode == 0x55U);
+    UBLOX_TEST_ASSERT(eph.m_toe == 345600.0);
+    UBLOX_TEST_ASSERT(eph.m_m0 == stored(store, GnssId::Gps, SvId).m_m0);
+
+    // Poll response without ephemeris
+    message::AidEph<> aidEph;
+    aidEph.field_svid().value() = SvId;
+    aidEph.field_sf1d().setMode(comms::field::OptionalMode::Missing);
+    store.handle(aidEph);
+    UBLOX_TEST_ASSERT(store.stats().m_received == 6U);
+
+    // Assistance data of the same data set
+    message::MgaGpsEph<> mga;
+    mga.field_svId().value() = SvId;
+    mga.field_iodc().value() = 0x55U;
+    mga.field_toe().value() = 345600U / 16U;
+    mga.field_m0().value() = static_cast<std::int32_t>(M0);
+    store.handle(mga);
+    store.handle(mga);
+    UBLOX_TEST_ASSERT(store.stats().m_received == 8U);
+    UBLOX_TEST_ASSERT(store.stats().m_duplicates == 2U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+
+    mga.field_iodc().value() = 0x56U;
+    mga.field_toe().value() = 352800U / 16U;
+    store.handle(mga);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 3U);
+    eph = stored(store, GnssId::Gps, SvId);
+    UBLOX_TEST_ASSERT(eph.m_iode == 0x56U);
+    UBLOX_TEST_ASSERT(eph.m_toe == 352800.0);
+}
+
+NavBits gloString(unsigned string, unsigned tb)
+{
+    NavBits bits;
+    // Frame time tk, coordinates and age En differ between the frames of
+    // different tb
+    bits.append(0U, 1U).append(string, 4U);
+    if (string == 1U) {
+        bits.append(0U, 4U).append(tb / 3600U, 5U).append((tb / 60U) % 60U, 6U);
+    }
+    else if (string == 2U) {
+        bits.append(0U, 4U).append(tb / 900U, 7U);
+    }
+    else if (string == 3U) {
+        bits.padTo(50U).append(tb, 27U);
+    }
+    else if (string == 4U) {
+        bits.append(0U, 27U).append((tb / 900U) % 32U, 5U).padTo(70U).append(3U, 5U);
+    }
+    bits.padTo(77U);
+    return bits;
+}
+
+void feedGlonass(util::EphemerisStore& store, unsigned tb)
+{
+    for (unsigned string = 1U; string <= 4U; ++string) {
+        std::uint32_t words[4];
+        ublox::test::glonassWords(gloString(string, tb), words);
+        store.handle(makeSfrbx(GnssId::Glonass, 3U, 7U, &words[0], 4U));
+    }
+}
+
+void testGlonass()
+{
+    util::EphemerisStore store;
+    util::GlonassEphemeris eph = util::GlonassEphemeris();
+    UBLOX_TEST_ASSERT(!store.glonassEphemeris(3U, eph));
+    feedGlonass(store, 36000U);
+    UBLOX_TEST_ASSERT(store.glonassEphemeris(3U, eph));
+    UBLOX_TEST_ASSERT(eph.m_tb == 36000.0);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+
+    feedGlonass(store, 36000U);
+    UBLOX_TEST_ASSERT(store.stats().m_duplicates == 4U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+
+    feedGlonass(store, 34200U);
+    UBLOX_TEST_ASSERT(store.stats().m_stale == 1U);
+    feedGlonass(store, 37800U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+    UBLOX_TEST_ASSERT(store.glonassEphemeris(3U, eph));
+    UBLOX_TEST_ASSERT(eph.m_tb == 37800.0);
+    UBLOX_TEST_ASSERT(!store.glonassEphemeris(0U, eph));
+    UBLOX_TEST_ASSERT(!store.glonassEphemeris(util::EphemerisStore::GlonassCount + 1U, eph));
+}
+
+NavBits almanacPage(unsigned tow, unsigned e)
+{
+    auto bits = gpsHeader(5U, tow);
+    bits.append(1U, 2U).append(7U, 6U).append(e, 16U).append(144U, 8U).append(0U, 24U);
+    bits.append(10554432U, 24U).padTo(240U);
+    return bits;
+}
+
+void testAlmanac()
+{
+    util::EphemerisStore store;
+    util::KeplerAlmanac alm = util::KeplerAlmanac();
+    UBLOX_TEST_ASSERT(!store.almanac(GnssId::Gps, 7U, alm));
+    store.handle(gpsSfrbx(almanacPage(100U, 20000U)));
+    UBLOX_TEST_ASSERT(store.almanac(GnssId::Gps, 7U, alm));
+    UBLOX_TEST_ASSERT(alm.m_toa == 589824.0);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+
+    // The same almanac from the next frame (other HOW) is not stored again
+    store.handle(gpsSfrbx(almanacPage(125U, 20000U)));
+    UBLOX_TEST_ASSERT(store.stats().m_decoded == 2U);
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 1U);
+
+    store.handle(gpsSfrbx(almanacPage(150U, 20001U)));
+    UBLOX_TEST_ASSERT(store.stats().m_stored == 2U);
+    UBLOX_TEST_ASSERT(store.almanac(GnssId::Gps, 7U, alm));
+    UBLOX_TEST_ASSERT(alm.m_e == std::ldexp(20001.0, -21));
+}
+
+}  // namespace
+
+int main()
+{
+    testDuplicates();
+    testNewerDataSet();
+    testOtherSources();
+    testGlonass();
+    testAlmanac();
+    return 0;
+}
@@ -0,0 +1,219 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the navigation epoch assembly and of its sequence lock
+// publication.
+
+#include <cstdint>
+#include <cstddef>
+
+#include "ublox/util/EpochAssembler.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef util::EpochAssembler<> Assembler;
+
+message::NavPvt<> makePvt(std::uint32_t iTOW)
+{
+    message::NavPvt<> msg;
+    msg.field_iTOW().value() = iTOW;
+    msg.field_numSV().value() = 12U;
+    msg.field_lon().value() = 1512093450;
+    msg.field_lat().value() = -338688170;
+    return msg;
+}
+
+message::NavPosllh<> makePosllh(std::uint32_t iTOW)
+{
+    message::NavPosllh<> msg;
+    msg.field_iTOW().value() = iTOW;
+    msg.field_height().value() = 58230;
+    return msg;
+}
+
+void testEoe()
+{
+    Assembler assembler;
+    Assembler::Epoch epoch;
+    UBLOX_TEST_ASSERT(!assembler.latest(epoch));
+
+    assembler.handle(makePvt(1000U));
+    assembler.handle(makePosllh(1000U));
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 0U);
+
+    assembler.handle(message::NavEoe<>());
+    UBLOX_TEST_ASSERT(assembler.eoeReported());
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 1U);
+    UBLOX_TEST_ASSERT(assembler.latest(epoch));
+    UBLOX_TEST_ASSERT(epoch.iTOW == 1000U);
+    UBLOX_TEST_ASSERT(epoch.end == util::NavEpochEnd::Eoe);
+    UBLOX_TEST_ASSERT(epoch.present == (util::NavEpochPart_Pvt | util::NavEpochPart_Posllh));
+    UBLOX_TEST_ASSERT(epoch.has(util::NavEpochPart_Pvt));
+    UBLOX_TEST_ASSERT(!epoch.has(util::NavEpochPart_Sat));
+    UBLOX_TEST_ASSERT(epoch.pvt.numSV == 12U);
+    UBLOX_TEST_ASSERT(epoch.pvt.lat == -338688170);
+    UBLOX_TEST_ASSERT(epoch.posllh.height == 58230);
+    UBLOX_TEST_ASSERT(epoch.dop.pDOP == 0U);
+
+    // Repeated EOE doesn't publish empty epoch
+    assembler.handle(message::NavEoe<>());
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 1U);
+}
+
+void testITowChange()
+{
+    Assembler assembler;
+    assembler.handle(makePvt(1000U));
+    assembler.handle(makePosllh(2000U));
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 1U);
+
+    Assembler::Epoch epoch;
+    UBLOX_TEST_ASSERT(assembler.latest(epoch));
+    UBLOX_TEST_ASSERT(epoch.iTOW == 1000U);
+    UBLOX_TEST_ASSERT(epoch.end == util::NavEpochEnd::ITowChange);
+    UBLOX_TEST_ASSERT(epoch.present == util::NavEpochPart_Pvt);
+
+    // Parts of the new epoch don't inherit values of the previous one
+    assembler.flush();
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 2U);
+    UBLOX_TEST_ASSERT(assembler.latest(epoch));
+    UBLOX_TEST_ASSERT(epoch.iTOW == 2000U);
+    UBLOX_TEST_ASSERT(epoch.end == util::NavEpochEnd::Flush);
+    UBLOX_TEST_ASSERT(epoch.present == util::NavEpochPart_Posllh);
+    UBLOX_TEST_ASSERT(epoch.pvt.lat == 0);
+
+    assembler.flush();
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 2U);
+    UBLOX_TEST_ASSERT(!assembler.eoeReported());
+}
+
+void testTimeout()
+{
+    Assembler assembler(100U);
+    assembler.poll(0U);
+    assembler.handle(makePvt(1000U));
+
+    // The activity is time stamped by the first poll() following it
+    assembler.poll(5000U);
+    assembler.poll(5099U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 0U);
+
+    // New message restarts the timeout
+    assembler.handle(makePosllh(1000U));
+    assembler.poll(5150U);
+    assembler.poll(5249U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 0U);
+    assembler.poll(5250U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 1U);
+
+    Assembler::Epoch epoch;
+    UBLOX_TEST_ASSERT(assembler.latest(epoch));
+    UBLOX_TEST_ASSERT(epoch.end == util::NavEpochEnd::Timeout);
+    UBLOX_TEST_ASSERT(epoch.present == (util::NavEpochPart_Pvt | util::NavEpochPart_Posllh));
+
+    // Nothing is open, nothing to complete
+    assembler.poll(10000U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 1U);
+
+    // Wrap around of the monotonic time
+    assembler.handle(makePvt(2000U));
+    assembler.poll(0xffffffc0U);
+    assembler.poll(0x23U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 1U);
+    assembler.poll(0x24U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 2U);
+}
+
+void testTimeoutDisabled()
+{
+    Assembler assembler;
+    assembler.handle(makePvt(1000U));
+    assembler.poll(0U);
+    assembler.poll(1000000U);
+    assembler.poll(2000000U);
+    UBLOX_TEST_ASSERT(assembler.publishedCount() == 0U);
+}
+
+void testSatCapacity()
+{
+    message::NavSat<> msg;
+    msg.field_iTOW().value() = 1000U;
+    msg.field_numSvs().value() = 3U;
+    auto& list = msg.field_data().value();
+    list.resize(3U);
+    for (std::size_t idx = 0U; idx < list.size(); ++idx) {
+        list[idx].field_svId().value() = static_cast<std::uint8_t>(idx + 1U);
+        list[idx].field_cno().value() = static_cast<std::uint8_t>(30U + idx);
+    }
+
+    util::EpochAssembler<2U> assembler;
+    assembler.handle(msg);
+    assembler.flush();
+
+    util::EpochAssembler<2U>::Epoch epoch;
+    UBLOX_TEST_ASSERT(assembler.latest(epoch));
+    UBLOX_TEST_ASSERT(epoch.has(util::NavEpochPart_Sat));
+    UBLOX_TEST_ASSERT(epoch.numSvs == 3U);
+    UBLOX_TEST_ASSERT(epoch.numSats == 2U);
+    UBLOX_TEST_ASSERT(epoch.sats[0].svId == 1U);
+    UBLOX_TEST_ASSERT(epoch.sats[1].svId == 2U);
+    UBLOX_TEST_ASSERT(epoch.sats[1].cno == 31U);
+}
+
+void testSeqLock()
+{
+    util::SeqCounter counter;
+    std::uint32_t seq = 0U;
+    UBLOX_TEST_ASSERT(counter.beginRead(seq));
+    UBLOX_TEST_ASSERT(counter.endRead(seq));
+
+    // Read overlapping the update must be retried
+    counter.beginWrite();
+    std::uint32_t writeSeq = 0U;
+    UBLOX_TEST_ASSERT(!counter.beginRead(writeSeq));
+    counter.endWrite();
+    UBLOX_TEST_ASSERT(!counter.endRead(seq));
+    UBLOX_TEST_ASSERT(counter.sequence() == 2U);
+
+    util::SeqLock<std::uint64_t> lock;
+    UBLOX_TEST_ASSERT(lock.load() == 0U);
+    lock.store(0x0123456789abcdefULL);
+    lock.store(0xfedcba9876543210ULL);
+    std::uint32_t loadSeq = 0U;
+    UBLOX_TEST_ASSERT(lock.load(&loadSeq) == 0xfedcba9876543210ULL);
+    UBLOX_TEST_ASSERT(loadSeq == 4U);
+    UBLOX_TEST_ASSERT(lock.sequence() == 4U);
+}
+
+}  // namespace
+
+int main()
+{
+    testEoe();
+    testITowChange();
+    testTimeout();
+    testTimeoutDisabled();
+    testSatCapacity();
+    testSeqLock();
+    return 0;
+}
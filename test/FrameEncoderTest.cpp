@@ -0,0 +1,113 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the single pass frame encoding: the frames are compared with
+// the output of the protocol stack and with the frames serialised at
+// compile time.
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "ublox/Stack.h"
+#include "ublox/OutputMessages.h"
+#include "ublox/protocol/ConstFrame.h"
+#include "ublox/protocol/FrameEncoder.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace message = ublox::message;
+namespace protocol = ublox::protocol;
+
+typedef ublox::Stack<ublox::Message, ublox::OutputMessages<> > Stack;
+typedef message::CfgRstFields::ResetMode ResetMode;
+
+static const std::size_t MaxFrameLen = 64U;
+
+template <typename TMsg>
+bool matchesStack(const TMsg& msg)
+{
+    std::uint8_t encoded[MaxFrameLen] = {0};
+    std::size_t len = 0U;
+    if (protocol::encodeFrame(msg, encoded, len) != comms::ErrorStatus::Success) {
+        return false;
+    }
+
+    Stack stack;
+    std::uint8_t written[MaxFrameLen] = {0};
+    std::uint8_t* iter = &written[0];
+    auto es = stack.write(msg, iter, sizeof(written));
+    return
+        (es == comms::ErrorStatus::Success) &&
+        (static_cast<std::size_t>(iter - &written[0]) == len) &&
+        std::equal(&encoded[0], &encoded[len], &written[0]);
+}
+
+message::CfgRst<> cfgRst(std::uint16_t navBbrMask, ResetMode resetMode)
+{
+    message::CfgRst<> msg;
+    msg.field_navBbrMask().value() = navBbrMask;
+    msg.field_resetMode().value() = resetMode;
+    return msg;
+}
+
+void testStackWrite()
+{
+    UBLOX_TEST_ASSERT(matchesStack(message::NavPvtPoll<>()));
+    UBLOX_TEST_ASSERT(matchesStack(message::MonVerPoll<>()));
+    UBLOX_TEST_ASSERT(matchesStack(cfgRst(0x0000, ResetMode::GnssOnly)));
+    UBLOX_TEST_ASSERT(matchesStack(cfgRst(0xffff, ResetMode::Hardware)));
+    UBLOX_TEST_ASSERT(matchesStack(cfgRst(0x8001, ResetMode::GnssStop)));
+}
+
+void testConstFrame()
+{
+    std::uint8_t buf[protocol::CfgRstHotStartFrame::Size + 1U] = {0};
+    std::size_t len = 0U;
+    auto es = protocol::encodeFrame(cfgRst(0x0000, ResetMode::GnssOnly), buf, len);
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_ASSERT(len == protocol::CfgRstHotStartFrame::Size);
+    UBLOX_TEST_ASSERT(std::equal(&buf[0], &buf[len], protocol::CfgRstHotStartFrame::data()));
+
+    es = protocol::encodeFrame(message::NavPvtPoll<>(), &buf[0], protocol::NavPvtPollFrame::Size, len);
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_ASSERT(len == protocol::NavPvtPollFrame::Size);
+    UBLOX_TEST_ASSERT(std::equal(&buf[0], &buf[len], protocol::NavPvtPollFrame::data()));
+}
+
+void testBufferOverflow()
+{
+    std::uint8_t buf[protocol::CfgRstHotStartFrame::Size] = {0};
+    std::size_t len = 1U;
+    auto es = protocol::encodeFrame(cfgRst(0x0000, ResetMode::GnssOnly), &buf[0], sizeof(buf) - 1U, len);
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::BufferOverflow);
+    UBLOX_TEST_ASSERT(len == 0U);
+    UBLOX_TEST_ASSERT(std::all_of(&buf[0], &buf[sizeof(buf)], [](std::uint8_t byte) { return byte == 0U; }));
+}
+
+}  // namespace
+
+int main()
+{
+    testStackWrite();
+    testConstFrame();
+    testBufferOverflow();
+    return 0;
+}
@@ -0,0 +1,164 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures throughput of the batch ECEF <-> geodetic conversions and
+// compares it with the same formulas evaluated by the library functions.
+
+#include <cstddef>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <iostream>
+
+#include "ublox/util/geodesy.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace geodesy = ublox::util::geodesy;
+
+static const std::size_t Count = 4096U;
+static const unsigned Iterations = 200U;
+static const double Pi = 3.14159265358979323846;
+
+struct Arrays
+{
+    explicit Arrays(std::size_t count)
+      : a(count), b(count), c(count)
+    {
+    }
+
+    std::vector<double> a;
+    std::vector<double> b;
+    std::vector<double> c;
+};
+
+void libmToEcef(const Arrays& in, Arrays& out)
+{
+    for (std::size_t idx = 0U; idx < in.a.size(); ++idx) {
+        auto lat = in.a[idx] * Pi / 180.0;
+        auto lon = in.b[idx] * Pi / 180.0;
+        auto n = geodesy::WgsA / std::sqrt(1.0 - (geodesy::WgsE2 * std::sin(lat) * std::sin(lat)));
+        auto r = (n + in.c[idx]) * std::cos(lat);
+        out.a[idx] = r * std::cos(lon);
+        out.b[idx] = r * std::sin(lon);
+        out.c[idx] = ((n * (1.0 - geodesy::WgsE2)) + in.c[idx]) * std::sin(lat);
+    }
+}
+
+void libmToGeodetic(const Arrays& in, Arrays& out)
+{
+    using namespace geodesy;
+    for (std::size_t idx = 0U; idx < in.a.size(); ++idx) {
+        auto x = in.a[idx];
+        auto y = in.b[idx];
+        auto z = in.c[idx];
+        auto p = std::sqrt((x * x) + (y * y));
+        auto beta = std::atan2(z, (1.0 - WgsF) * p);
+        double lat = 0.0;
+        for (unsigned iter = 0U; iter < BowringIterations; ++iter) {
+            auto sinB = std::sin(beta);
+            auto cosB = std::cos(beta);
+            lat = std::atan2(
+                z + (WgsEp2 * WgsB * sinB * sinB * sinB),
+                p - (WgsE2 * WgsA * cosB * cosB * cosB));
+            beta = std::atan((1.0 - WgsF) * std::tan(lat));
+        }
+        auto sinLat = std::sin(lat);
+        out.a[idx] = lat * 180.0 / Pi;
+        out.b[idx] = std::atan2(y, x) * 180.0 / Pi;
+        out.c[idx] =
+            (p * std::cos(lat)) + (z * sinLat) -
+            (WgsA * std::sqrt(1.0 - (WgsE2 * sinLat * sinLat)));
+    }
+}
+
+template <typename TFunc>
+void report(const char* name, TFunc&& func)
+{
+    auto ns =
+        ublox::test::measureNs(
+            [&func]()
+            {
+                for (auto iter = 0U; iter < Iterations; ++iter) {
+                    func();
+                }
+            });
+
+    std::cout << name << ": " << ns / (static_cast<double>(Iterations) * Count)
+              << " ns/point" << std::endl;
+}
+
+}  // namespace
+
+int main()
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> latDist(-90.0, 90.0);
+    std::uniform_real_distribution<double> lonDist(-180.0, 180.0);
+    std::uniform_real_distribution<double> heightDist(-100.0, 20000.0);
+
+    Arrays geodetic(Count);
+    for (std::size_t idx = 0U; idx < Count; ++idx) {
+        geodetic.a[idx] = latDist(gen);
+        geodetic.b[idx] = lonDist(gen);
+        geodetic.c[idx] = heightDist(gen);
+    }
+
+    Arrays ecef(Count);
+    Arrays result(Count);
+    libmToEcef(geodetic, ecef);
+
+    report("geodeticToEcef (libm)",
+        [&geodetic, &result]()
+        {
+            libmToEcef(geodetic, result);
+            ublox::test::doNotOptimise(result);
+        });
+
+    report("geodeticToEcef",
+        [&geodetic, &result]()
+        {
+            geodesy::geodeticToEcef(
+                &geodetic.a[0], &geodetic.b[0], &geodetic.c[0], Count,
+                &result.a[0], &result.b[0], &result.c[0]);
+            ublox::test::doNotOptimise(result);
+        });
+
+    report("ecefToGeodetic (libm)",
+        [&ecef, &result]()
+        {
+            libmToGeodetic(ecef, result);
+            ublox::test::doNotOptimise(result);
+        });
+
+    report("ecefToGeodetic",
+        [&ecef, &result]()
+        {
+            geodesy::ecefToGeodetic(
+                &ecef.a[0], &ecef.b[0], &ecef.c[0], Count,
+                &result.a[0], &result.b[0], &result.c[0]);
+            ublox::test::doNotOptimise(result);
+        });
+
+    for (std::size_t idx = 0U; idx < Count; ++idx) {
+        UBLOX_TEST_NEAR(result.c[idx], geodetic.c[idx], 1e-3);
+    }
+    return 0;
+}
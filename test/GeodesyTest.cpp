@@ -0,0 +1,251 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the accuracy of the batch ECEF <-> geodetic conversions against
+// the reference computed by the library functions in extended precision.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "ublox/util/geodesy.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace geodesy = ublox::util::geodesy;
+
+typedef long double Real;
+
+static const Real Pi = 3.141592653589793238462643383279502884L;
+static const std::size_t Count = 10000U; // not multiple of the chunk size
+static const double MinHeight = -1000.0;
+static const double MaxHeight = 36000000.0;
+
+struct Points
+{
+    std::vector<double> lat;
+    std::vector<double> lon;
+    std::vector<double> height;
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+};
+
+void referenceToEcef(Real lat, Real lon, Real height, Real& x, Real& y, Real& z)
+{
+    Real a = geodesy::WgsA;
+    Real e2 = geodesy::WgsE2;
+    auto latRad = lat * Pi / 180;
+    auto lonRad = lon * Pi / 180;
+    auto n = a / std::sqrt(1 - (e2 * std::sin(latRad) * std::sin(latRad)));
+    x = (n + height) * std::cos(latRad) * std::cos(lonRad);
+    y = (n + height) * std::cos(latRad) * std::sin(lonRad);
+    z = ((n * (1 - e2)) + height) * std::sin(latRad);
+}
+
+Points makePoints()
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> latDist(-90.0, 90.0);
+    std::uniform_real_distribution<double> lonDist(-180.0, 180.0);
+    std::uniform_real_distribution<double> logHeightDist(0.0, std::log(MaxHeight - MinHeight));
+
+    Points points;
+    for (std::size_t idx = 0U; idx < Count; ++idx) {
+        auto lat = latDist(gen);
+        auto lon = lonDist(gen);
+        // Heights distributed evenly in the logarithmic scale, so that
+        // the points near the surface are tested as well
+        auto height = MinHeight + std::exp(logHeightDist(gen));
+        Real x = 0;
+        Real y = 0;
+        Real z = 0;
+        referenceToEcef(lat, lon, height, x, y, z);
+        points.lat.push_back(lat);
+        points.lon.push_back(lon);
+        points.height.push_back(height);
+        points.x.push_back(static_cast<double>(x));
+        points.y.push_back(static_cast<double>(y));
+        points.z.push_back(static_cast<double>(z));
+    }
+
+    // Poles, equator and the centre of the Earth
+    static const double Special[][3] = {
+        {90.0, 0.0, 0.0},
+        {-90.0, 45.0, 100.0},
+        {0.0, 180.0, 0.0},
+        {0.0, -90.0, MaxHeight}
+    };
+
+    for (auto& point : Special) {
+        Real x = 0;
+        Real y = 0;
+        Real z = 0;
+        referenceToEcef(point[0], point[1], point[2], x, y, z);
+        points.lat.push_back(point[0]);
+        points.lon.push_back(point[1]);
+        points.height.push_back(point[2]);
+        points.x.push_back(static_cast<double>(x));
+        points.y.push_back(static_cast<double>(y));
+        points.z.push_back(static_cast<double>(z));
+    }
+    return points;
+}
+
+void testGeodeticToEcef(const Points& points)
+{
+    auto count = points.lat.size();
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    geodesy::geodeticToEcef(
+        &points.lat[0], &points.lon[0], &points.height[0], count, &x[0], &y[0], &z[0]);
+
+    static const double Tolerance = 1e-6; // m
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        UBLOX_TEST_NEAR(x[idx], points.x[idx], Tolerance);
+        UBLOX_TEST_NEAR(y[idx], points.y[idx], Tolerance);
+        UBLOX_TEST_NEAR(z[idx], points.z[idx], Tolerance);
+    }
+}
+
+void testEcefToGeodetic(const Points& points)
+{
+    auto count = points.lat.size();
+    std::vector<double> lat(count);
+    std::vector<double> lon(count);
+    std::vector<double> height(count);
+    geodesy::ecefToGeodetic(
+        &points.x[0], &points.y[0], &points.z[0], count, &lat[0], &lon[0], &height[0]);
+
+    static const double Tolerance = 1e-3; // m
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        UBLOX_TEST_NEAR(height[idx], points.height[idx], Tolerance);
+
+        // Errors of the angles as distances on the surface at the point's height
+        auto radius = geodesy::WgsA + points.height[idx];
+        auto latRad = points.lat[idx] * static_cast<double>(Pi) / 180.0;
+        auto latErr = (lat[idx] - points.lat[idx]) * static_cast<double>(Pi) / 180.0 * radius;
+        UBLOX_TEST_NEAR(latErr, 0.0, Tolerance);
+
+        if (std::abs(points.lat[idx]) == 90.0) {
+            continue; // longitude is undefined
+        }
+
+        auto lonDiff = lon[idx] - points.lon[idx];
+        lonDiff -= 360.0 * std::round(lonDiff / 360.0);
+        auto lonErr = lonDiff * static_cast<double>(Pi) / 180.0 * radius * std::cos(latRad);
+        UBLOX_TEST_NEAR(lonErr, 0.0, Tolerance);
+    }
+}
+
+void testProtocolUnits(const Points& points)
+{
+    // The height field (mm) limits the points to ~2147 km above ellipsoid
+    static const double MaxFieldHeight = 2000000.0;
+
+    std::vector<std::int32_t> lat;
+    std::vector<std::int32_t> lon;
+    std::vector<std::int32_t> heightMm;
+    for (std::size_t idx = 0U; idx < points.lat.size(); ++idx) {
+        if (MaxFieldHeight < points.height[idx]) {
+            continue;
+        }
+
+        lat.push_back(static_cast<std::int32_t>(std::lround(points.lat[idx] * 1e7)));
+        lon.push_back(static_cast<std::int32_t>(std::lround(points.lon[idx] * 1e7)));
+        heightMm.push_back(static_cast<std::int32_t>(std::lround(points.height[idx] * 1e3)));
+    }
+
+    auto count = lat.size();
+    UBLOX_TEST_ASSERT(Count / 2U < count);
+    std::vector<std::int32_t> xCm(count);
+    std::vector<std::int32_t> yCm(count);
+    std::vector<std::int32_t> zCm(count);
+    auto clamped = geodesy::geodeticToEcef(&lat[0], &lon[0], &heightMm[0], count, &xCm[0], &yCm[0], &zCm[0]);
+    UBLOX_TEST_ASSERT(clamped == 0U);
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        Real x = 0;
+        Real y = 0;
+        Real z = 0;
+        referenceToEcef(lat[idx] * 1e-7L, lon[idx] * 1e-7L, heightMm[idx] * 1e-3L, x, y, z);
+        UBLOX_TEST_NEAR(xCm[idx], std::lround(x * 100), 1);
+        UBLOX_TEST_NEAR(yCm[idx], std::lround(y * 100), 1);
+        UBLOX_TEST_NEAR(zCm[idx], std::lround(z * 100), 1);
+    }
+
+    std::vector<std::int32_t> latOut(count);
+    std::vector<std::int32_t> lonOut(count);
+    std::vector<std::int32_t> heightOut(count);
+    clamped = geodesy::ecefToGeodetic(&xCm[0], &yCm[0], &zCm[0], count, &latOut[0], &lonOut[0], &heightOut[0]);
+    UBLOX_TEST_ASSERT(clamped == 0U);
+    for (std::size_t idx = 0U; idx < count; ++idx) {
+        // Rounding of ECEF to centimetres dominates
+        UBLOX_TEST_NEAR(heightOut[idx], heightMm[idx], 10);
+    }
+}
+
+void testProtocolUnitsClamping()
+{
+    // Geostationary orbit: the height fits into the field, ECEF X doesn't
+    static const double GeoRadius = 42164000.0;
+    std::int32_t xCm[] = {std::numeric_limits<std::int32_t>::max(), 0};
+    std::int32_t yCm[] = {0, std::numeric_limits<std::int32_t>::min()};
+    std::int32_t zCm[] = {0, 0};
+    std::int32_t lat[2] = {0};
+    std::int32_t lon[2] = {0};
+    std::int32_t heightMm[2] = {0};
+    auto clamped = geodesy::ecefToGeodetic(xCm, yCm, zCm, 2U, lat, lon, heightMm);
+    UBLOX_TEST_ASSERT(clamped == 2U);
+    UBLOX_TEST_ASSERT(heightMm[0] == std::numeric_limits<std::int32_t>::max());
+    UBLOX_TEST_ASSERT(heightMm[1] == std::numeric_limits<std::int32_t>::max());
+    UBLOX_TEST_ASSERT(lon[1] == -900000000);
+
+    lat[0] = 0;
+    lon[0] = 0;
+    heightMm[0] = 2000000000;
+    clamped = geodesy::geodeticToEcef(lat, lon, heightMm, 1U, xCm, yCm, zCm);
+    UBLOX_TEST_ASSERT(clamped == 0U);
+    UBLOX_TEST_NEAR(xCm[0], 837813700, 1);
+
+    std::size_t count = 0U;
+    UBLOX_TEST_ASSERT(geodesy::roundToInt32(GeoRadius * 100.0, count) == std::numeric_limits<std::int32_t>::max());
+    UBLOX_TEST_ASSERT(geodesy::roundToInt32(-GeoRadius * 100.0, count) == std::numeric_limits<std::int32_t>::min());
+    UBLOX_TEST_ASSERT(geodesy::roundToInt32(std::nan(""), count) == std::numeric_limits<std::int32_t>::min());
+    UBLOX_TEST_ASSERT(geodesy::roundToInt32(-2147483648.0, count) == std::numeric_limits<std::int32_t>::min());
+    UBLOX_TEST_ASSERT(geodesy::roundToInt32(2147483647.0, count) == std::numeric_limits<std::int32_t>::max());
+    UBLOX_TEST_ASSERT(geodesy::roundToInt32(-1.5, count) == -2);
+    UBLOX_TEST_ASSERT(count == 3U);
+}
+
+}  // namespace
+
+int main()
+{
+    auto points = makePoints();
+    testGeodeticToEcef(points);
+    testEcefToGeodetic(points);
+    testProtocolUnits(points);
+    testProtocolUnitsClamping();
+    return 0;
+}
@@ -0,0 +1,131 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Measures fix-to-decision latency of the geofence engine with tens of
+// thousands of circular and polygonal fences and compares it with the
+// exhaustive evaluation of all the fences.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <iostream>
+
+#include "ublox/util/GeofenceEngine.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+
+static const std::size_t CirclesCount = 20000U;
+static const std::size_t PolygonsCount = 20000U;
+static const std::size_t ReceiversCount = 100U;
+static const std::size_t FixesCount = 1000U;
+static const double AreaDeg = 2.0;
+
+struct Position
+{
+    double m_lat;
+    double m_lon;
+};
+
+void report(const char* name, std::size_t fixesCount, std::uint64_t ns)
+{
+    std::cout << name << ": " << static_cast<double>(ns) / static_cast<double>(fixesCount) / 1000.0 << " us/fix" << std::endl;
+}
+
+}  // namespace
+
+int main()
+{
+    std::mt19937 gen(4242U);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    util::GeofenceEngine engine;
+    for (std::size_t idx = 0U; idx < CirclesCount; ++idx) {
+        engine.addCircle(48.0 + (AreaDeg * dist(gen)), 11.0 + (AreaDeg * dist(gen)), 50.0 + (500.0 * dist(gen)));
+    }
+
+    for (std::size_t idx = 0U; idx < PolygonsCount; ++idx) {
+        static const std::size_t VerticesCount = 8U;
+        auto lat = 48.0 + (AreaDeg * dist(gen));
+        auto lon = 11.0 + (AreaDeg * dist(gen));
+        auto size = 0.001 + (0.005 * dist(gen));
+        double lats[VerticesCount];
+        double lons[VerticesCount];
+        for (std::size_t vertex = 0U; vertex < VerticesCount; ++vertex) {
+            auto angle = (2.0 * 3.14159265358979323846 * vertex) / VerticesCount;
+            auto scale = 0.5 + (0.5 * dist(gen));
+            lats[vertex] = lat + (size * scale * std::sin(angle));
+            lons[vertex] = lon + (size * scale * std::cos(angle));
+        }
+        engine.addPolygon(lats, lons, VerticesCount);
+    }
+    engine.setConfidenceLevel(2U);
+    engine.setHysteresis(5.0, 2U);
+    engine.build(0.005);
+
+    std::vector<Position> track(ReceiversCount * FixesCount);
+    for (std::size_t rx = 0U; rx < ReceiversCount; ++rx) {
+        Position pos = {48.0 + (AreaDeg * dist(gen)), 11.0 + (AreaDeg * dist(gen))};
+        for (std::size_t fix = 0U; fix < FixesCount; ++fix) {
+            // About 15 m/s drive
+            pos.m_lat += (dist(gen) - 0.5) * 0.0003;
+            pos.m_lon += (dist(gen) - 0.5) * 0.0003;
+            track[(fix * ReceiversCount) + rx] = pos;
+        }
+    }
+
+    std::vector<util::GeofenceTracker> trackers(ReceiversCount);
+    std::size_t changes = 0U;
+    auto ns = ublox::test::measureNs(
+        [&]()
+        {
+            for (std::size_t idx = 0U; idx < track.size(); ++idx) {
+                engine.update(trackers[idx % ReceiversCount], true, track[idx].m_lat, track[idx].m_lon, 3.0,
+                    [&changes](std::size_t, util::GeofenceState, util::GeofenceState)
+                    {
+                        ++changes;
+                    });
+            }
+        });
+    report("update (indexed)", track.size(), ns);
+    std::cout << "state changes: " << changes << std::endl;
+    ublox::test::doNotOptimise(changes);
+
+    // Index covering the whole area by single cell evaluates all the fences
+    engine.build(AreaDeg * 2.0, 1U);
+    std::vector<util::GeofenceTracker> exhaustive(ReceiversCount);
+    static const std::size_t ExhaustiveFixes = 2U * ReceiversCount;
+    ns = ublox::test::measureNs(
+        [&]()
+        {
+            for (std::size_t idx = 0U; idx < ExhaustiveFixes; ++idx) {
+                engine.update(exhaustive[idx % ReceiversCount], true, track[idx].m_lat, track[idx].m_lon, 3.0);
+            }
+        });
+    report("update (exhaustive)", ExhaustiveFixes, ns);
+
+    for (std::size_t rx = 0U; rx < ReceiversCount; ++rx) {
+        UBLOX_TEST_ASSERT(exhaustive[rx].available());
+    }
+    return 0;
+}
@@ -0,0 +1,355 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Tests of the geofence engine: NAV-GEOFENCE state semantics, hysteresis,
+// fix validation and consistency of the spatial index with the exhaustive
+// evaluation of all the fences.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "ublox/util/GeofenceEngine.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef util::GeofenceState State;
+typedef ublox::field::nav::GpsFix GpsFix;
+
+static const double MetresPerDeg = 6371008.8 * 3.14159265358979323846 / 180.0;
+
+struct Change
+{
+    std::size_t m_fenceIdx;
+    State m_prev;
+    State m_cur;
+};
+
+typedef std::vector<Change> Changes;
+
+// Position displaced from the reference point by given metres
+double northOf(double latDeg, double metres)
+{
+    return latDeg + (metres / MetresPerDeg);
+}
+
+double eastOf(double lonDeg, double latDeg, double metres)
+{
+    return lonDeg + (metres / (MetresPerDeg * std::cos(latDeg * 3.14159265358979323846 / 180.0)));
+}
+
+Changes update(
+    const util::GeofenceEngine& engine,
+    util::GeofenceTracker& tracker,
+    bool valid,
+    double latDeg,
+    double lonDeg,
+    double hAccM)
+{
+    Changes changes;
+    engine.update(tracker, valid, latDeg, lonDeg, hAccM,
+        [&changes](std::size_t fenceIdx, State prev, State cur)
+        {
+            changes.push_back(Change{fenceIdx, prev, cur});
+        });
+    return changes;
+}
+
+bool hasChange(const Changes& changes, std::size_t fenceIdx, State prev, State cur)
+{
+    for (auto& change : changes) {
+        if ((change.m_fenceIdx == fenceIdx) && (change.m_prev == prev) && (change.m_cur == cur)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+message::NavPvt<> makeNavPvt(GpsFix fixType, bool gnssFixOk, double latDeg, double lonDeg, double hAccM)
+{
+    message::NavPvt<> msg;
+    msg.field_fixType().value() = fixType;
+    msg.field_flags().field_flagsLow().setBitValue(
+        message::NavPvtFields::flagsLow::BitIdx_gnssFixOK, gnssFixOk);
+    msg.field_lat().value() = static_cast<std::int32_t>(std::lround(latDeg * 1e7));
+    msg.field_lon().value() = static_cast<std::int32_t>(std::lround(lonDeg * 1e7));
+    msg.field_hAcc().value() = static_cast<std::uint32_t>(std::lround(hAccM * 1e3));
+    return msg;
+}
+
+void testFixValidation()
+{
+    UBLOX_TEST_ASSERT(util::GeofenceEngine::validFix(GpsFix::Fix_2D, true));
+    UBLOX_TEST_ASSERT(util::GeofenceEngine::validFix(GpsFix::Fix_3D, true));
+    UBLOX_TEST_ASSERT(util::GeofenceEngine::validFix(GpsFix::GPS_DeadReckoning, true));
+    UBLOX_TEST_ASSERT(!util::GeofenceEngine::validFix(GpsFix::NoFix, true));
+    UBLOX_TEST_ASSERT(!util::GeofenceEngine::validFix(GpsFix::DeadReckoningOnly, true));
+    UBLOX_TEST_ASSERT(!util::GeofenceEngine::validFix(GpsFix::TimeOnlyFix, true));
+    UBLOX_TEST_ASSERT(!util::GeofenceEngine::validFix(GpsFix::Fix_3D, false));
+    UBLOX_TEST_ASSERT(!util::GeofenceEngine::validFix(GpsFix::GPS_DeadReckoning, false));
+
+    util::GeofenceEngine engine;
+    engine.addCircle(47.0, 8.0, 100.0);
+    engine.build();
+
+    util::GeofenceTracker tracker;
+    engine.update(tracker, makeNavPvt(GpsFix::DeadReckoningOnly, true, 47.0, 8.0, 1.0));
+    UBLOX_TEST_ASSERT(!tracker.available());
+    UBLOX_TEST_ASSERT(tracker.state(0U) == State::Unknown);
+
+    engine.update(tracker, makeNavPvt(GpsFix::Fix_3D, false, 47.0, 8.0, 1.0));
+    UBLOX_TEST_ASSERT(!tracker.available());
+
+    engine.update(tracker, makeNavPvt(GpsFix::Fix_3D, true, 47.0, 8.0, 1.0));
+    UBLOX_TEST_ASSERT(tracker.available());
+    UBLOX_TEST_ASSERT(tracker.state(0U) == State::Inside);
+
+    engine.update(tracker, makeNavPvt(GpsFix::GPS_DeadReckoning, true, 47.0, 8.0, 1.0));
+    UBLOX_TEST_ASSERT(tracker.available());
+    UBLOX_TEST_ASSERT(tracker.state(0U) == State::Inside);
+
+    // Dead reckoned position far away must not move the fence outside
+    Changes changes;
+    engine.update(tracker, makeNavPvt(GpsFix::DeadReckoningOnly, true, 48.0, 8.0, 1.0),
+        [&changes](std::size_t fenceIdx, State prev, State cur)
+        {
+            changes.push_back(Change{fenceIdx, prev, cur});
+        });
+    UBLOX_TEST_ASSERT(changes.empty());
+    UBLOX_TEST_ASSERT(!tracker.available());
+    UBLOX_TEST_ASSERT(tracker.state(0U) == State::Unknown);
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Unknown);
+}
+
+void testCircleStates()
+{
+    static const double Lat = 47.0;
+    static const double Lon = 8.0;
+    util::GeofenceEngine engine;
+    auto inner = engine.addCircle(Lat, Lon, 100.0);
+    auto outer = engine.addCircle(Lat, Lon, 1000.0);
+    auto remote = engine.addCircle(Lat + 1.0, Lon, 100.0);
+    engine.setConfidenceLevel(2U);
+    engine.build();
+
+    util::GeofenceTracker tracker;
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Unknown);
+
+    // First fix reports only the fences which are not outside
+    auto changes = update(engine, tracker, true, Lat, Lon, 10.0);
+    UBLOX_TEST_ASSERT(changes.size() == 2U);
+    UBLOX_TEST_ASSERT(hasChange(changes, inner, State::Unknown, State::Inside));
+    UBLOX_TEST_ASSERT(hasChange(changes, outer, State::Unknown, State::Inside));
+    UBLOX_TEST_ASSERT(tracker.state(remote) == State::Outside);
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Inside);
+    UBLOX_TEST_ASSERT(tracker.activeFences().size() == 2U);
+
+    // 95 m from the centre with 1.96 * 10 m uncertainty crosses the boundary
+    changes = update(engine, tracker, true, northOf(Lat, 95.0), Lon, 10.0);
+    UBLOX_TEST_ASSERT(changes.size() == 1U);
+    UBLOX_TEST_ASSERT(hasChange(changes, inner, State::Inside, State::Unknown));
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Inside);
+
+    changes = update(engine, tracker, true, northOf(Lat, 200.0), Lon, 10.0);
+    UBLOX_TEST_ASSERT(changes.size() == 1U);
+    UBLOX_TEST_ASSERT(hasChange(changes, inner, State::Unknown, State::Outside));
+    UBLOX_TEST_ASSERT(tracker.activeFences().size() == 1U);
+
+    changes = update(engine, tracker, true, northOf(Lat, 5000.0), Lon, 10.0);
+    UBLOX_TEST_ASSERT(changes.size() == 1U);
+    UBLOX_TEST_ASSERT(hasChange(changes, outer, State::Inside, State::Outside));
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Outside);
+    UBLOX_TEST_ASSERT(tracker.activeFences().empty());
+
+    // Large uncertainty leaves the state unknown
+    changes = update(engine, tracker, true, Lat, eastOf(Lon, Lat, 50.0), 100.0);
+    UBLOX_TEST_ASSERT(hasChange(changes, inner, State::Outside, State::Unknown));
+    UBLOX_TEST_ASSERT(hasChange(changes, outer, State::Outside, State::Inside));
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Inside);
+
+    // Losing the fix makes everything unknown without reporting
+    changes = update(engine, tracker, false, Lat, Lon, 1.0);
+    UBLOX_TEST_ASSERT(changes.empty());
+    UBLOX_TEST_ASSERT(!tracker.available());
+    UBLOX_TEST_ASSERT(tracker.state(inner) == State::Unknown);
+    UBLOX_TEST_ASSERT(tracker.state(remote) == State::Unknown);
+    UBLOX_TEST_ASSERT(tracker.combinedState() == State::Unknown);
+
+    changes = update(engine, tracker, true, northOf(Lat + 1.0, 10.0), Lon, 1.0);
+    UBLOX_TEST_ASSERT(changes.size() == 1U);
+    UBLOX_TEST_ASSERT(hasChange(changes, remote, State::Unknown, State::Inside));
+}
+
+void testPolygon()
+{
+    static const double Lat = -33.9;
+    static const double Lon = 151.2;
+    // L shaped polygon, about 1 km wide arms
+    static const double Step = 0.01;
+    const double lat[] = {Lat, Lat, Lat + (2 * Step), Lat + (2 * Step), Lat + Step, Lat + Step};
+    const double lon[] = {Lon, Lon + (2 * Step), Lon + (2 * Step), Lon + Step, Lon + Step, Lon};
+
+    util::GeofenceEngine engine;
+    UBLOX_TEST_ASSERT(engine.addPolygon(lat, lon, 2U) == std::numeric_limits<std::size_t>::max());
+    auto fence = engine.addPolygon(lat, lon, sizeof(lat) / sizeof(lat[0]));
+    UBLOX_TEST_ASSERT(fence == 0U);
+    UBLOX_TEST_ASSERT(engine.fencesCount() == 1U);
+    engine.build(0.005);
+
+    util::GeofenceTracker tracker;
+    engine.update(tracker, true, Lat + (0.5 * Step), Lon + (0.5 * Step), 1.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Inside);
+
+    engine.update(tracker, true, Lat + (1.5 * Step), Lon + (1.5 * Step), 1.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Inside);
+
+    // The notch of the L shape
+    engine.update(tracker, true, Lat + (1.5 * Step), Lon + (0.5 * Step), 1.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Outside);
+
+    // 10 m south of the southern edge with 20 m uncertainty
+    engine.setConfidenceLevel(1U);
+    engine.update(tracker, true, northOf(Lat, -10.0), Lon + Step, 20.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Unknown);
+
+    engine.update(tracker, true, northOf(Lat, -30.0), Lon + Step, 20.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Outside);
+}
+
+void testHysteresis()
+{
+    static const double Lat = 51.5;
+    static const double Lon = -0.1;
+    util::GeofenceEngine engine;
+    auto fence = engine.addCircle(Lat, Lon, 100.0);
+    engine.setHysteresis(10.0, 3U);
+    engine.build();
+
+    util::GeofenceTracker tracker;
+    auto changes = update(engine, tracker, true, northOf(Lat, 95.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(hasChange(changes, fence, State::Unknown, State::Inside));
+
+    // Crossing the boundary by less than the margin keeps the state
+    for (auto idx = 0; idx < 10; ++idx) {
+        changes = update(engine, tracker, true, northOf(Lat, 105.0), Lon, 0.0);
+        UBLOX_TEST_ASSERT(changes.empty());
+        UBLOX_TEST_ASSERT(tracker.state(fence) == State::Inside);
+    }
+
+    // Required number of consecutive fixes
+    changes = update(engine, tracker, true, northOf(Lat, 120.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(changes.empty());
+    changes = update(engine, tracker, true, northOf(Lat, 120.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(changes.empty());
+    UBLOX_TEST_ASSERT(tracker.activeFences().size() == 1U);
+    changes = update(engine, tracker, true, northOf(Lat, 120.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(changes.size() == 1U);
+    UBLOX_TEST_ASSERT(hasChange(changes, fence, State::Inside, State::Outside));
+    UBLOX_TEST_ASSERT(tracker.activeFences().empty());
+
+    // Interrupted sequence restarts the counting
+    update(engine, tracker, true, northOf(Lat, 50.0), Lon, 0.0);
+    update(engine, tracker, true, northOf(Lat, 50.0), Lon, 0.0);
+    update(engine, tracker, true, northOf(Lat, 200.0), Lon, 0.0);
+    update(engine, tracker, true, northOf(Lat, 50.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Outside);
+    update(engine, tracker, true, northOf(Lat, 50.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(tracker.state(fence) == State::Outside);
+    changes = update(engine, tracker, true, northOf(Lat, 50.0), Lon, 0.0);
+    UBLOX_TEST_ASSERT(hasChange(changes, fence, State::Outside, State::Inside));
+}
+
+// Without hysteresis and uncertainty the state of every fence is defined
+// by the position alone, the indexed evaluation must agree with the
+// exhaustive one.
+void testIndexConsistency()
+{
+    static const std::size_t FencesCount = 2000U;
+    static const std::size_t FixesCount = 2000U;
+    std::mt19937 gen(777U);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    util::GeofenceEngine engine;
+    std::vector<double> centreLat;
+    std::vector<double> centreLon;
+    std::vector<double> radius;
+    for (std::size_t idx = 0U; idx < FencesCount; ++idx) {
+        centreLat.push_back(45.0 + (0.5 * dist(gen)));
+        centreLon.push_back(7.0 + (0.5 * dist(gen)));
+        radius.push_back(50.0 + (2000.0 * dist(gen)));
+        engine.addCircle(centreLat.back(), centreLon.back(), radius.back());
+    }
+    engine.build(0.01);
+
+    util::GeofenceTracker tracker;
+    auto lat = 45.25;
+    auto lon = 7.25;
+    for (std::size_t fix = 0U; fix < FixesCount; ++fix) {
+        // Random walk with occasional jumps
+        if ((fix % 100U) == 0U) {
+            lat = 44.9 + (0.7 * dist(gen));
+            lon = 6.9 + (0.7 * dist(gen));
+        }
+        else {
+            lat += (dist(gen) - 0.5) * 0.002;
+            lon += (dist(gen) - 0.5) * 0.002;
+        }
+
+        engine.update(tracker, true, lat, lon, 0.0);
+        std::size_t insideCount = 0U;
+        auto cosLat = std::cos(lat * 3.14159265358979323846 / 180.0);
+        for (std::size_t idx = 0U; idx < FencesCount; ++idx) {
+            auto dy = (centreLat[idx] - lat) * MetresPerDeg;
+            auto dx = (centreLon[idx] - lon) * MetresPerDeg * cosLat;
+            auto distM = std::sqrt((dx * dx) + (dy * dy)) - radius[idx];
+            if (std::abs(distM) < 1e-3) {
+                continue;
+            }
+
+            auto expected = (distM < 0.0) ? State::Inside : State::Outside;
+            UBLOX_TEST_ASSERT(tracker.state(idx) == expected);
+            if (expected == State::Inside) {
+                ++insideCount;
+            }
+        }
+
+        UBLOX_TEST_ASSERT(tracker.activeFences().size() == insideCount);
+        UBLOX_TEST_ASSERT(tracker.combinedState() == ((0U < insideCount) ? State::Inside : State::Outside));
+    }
+}
+
+}  // namespace
+
+int main()
+{
+    testFixValidation();
+    testCircleStates();
+    testPolygon();
+    testHysteresis();
+    testIndexConsistency();
+    return 0;
+}
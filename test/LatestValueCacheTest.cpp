@@ -0,0 +1,185 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the latest value cache: slots of the messages sharing the same
+// ID, capacity of the slots and handling of the oversized payloads.
+
+#include <cstdint>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/CfgPrtUart.h"
+#include "ublox/message/CfgPrtUsb.h"
+#include "ublox/message/MonVer.h"
+#include "ublox/util/LatestValueCache.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace message = ublox::message;
+
+typedef message::NavPvt<> NavPvt;
+typedef message::CfgPrtUart<> CfgPrtUart;
+typedef message::CfgPrtUsb<> CfgPrtUsb;
+typedef message::MonVer<> MonVer;
+
+typedef std::tuple<NavPvt, CfgPrtUart, CfgPrtUsb, MonVer> CachedMessages;
+typedef ublox::util::LatestValueCache<CachedMessages> Cache;
+typedef ublox::util::LatestValueCache<CachedMessages, 100U> LimitedCache;
+
+Cache cache;
+LimitedCache limitedCache;
+
+template <typename TMsg>
+std::vector<std::uint8_t> payloadOf(const TMsg& msg)
+{
+    std::vector<std::uint8_t> payload(msg.doLength());
+    std::uint8_t* iter = &payload[0];
+    auto es = msg.doWrite(iter, payload.size());
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+    return payload;
+}
+
+MonVer makeMonVer(std::size_t extensionsCount)
+{
+    MonVer msg;
+    msg.field_swVersion().value() = "ROM CORE 3.01";
+    msg.field_hwVersion().value() = "00080000";
+    msg.field_extensions().value().resize(extensionsCount);
+    return msg;
+}
+
+void testCapacity()
+{
+    UBLOX_TEST_ASSERT(Cache::capacity<NavPvt>() == 92U);
+    UBLOX_TEST_ASSERT(Cache::capacity<CfgPrtUart>() == 20U);
+    UBLOX_TEST_ASSERT(Cache::capacity<MonVer>() == 0xffffU);
+    UBLOX_TEST_ASSERT(LimitedCache::capacity<NavPvt>() == 92U);
+    UBLOX_TEST_ASSERT(LimitedCache::capacity<MonVer>() == 100U);
+}
+
+void testSharedId()
+{
+    CfgPrtUart uart;
+    uart.field_baudRate().value() = 115200U;
+    CfgPrtUsb usb;
+    usb.field_outProtoMask().value() = 0x1U;
+
+    cache.handle(uart);
+    cache.handle(usb);
+
+    CfgPrtUart uartLoaded;
+    CfgPrtUsb usbLoaded;
+    UBLOX_TEST_ASSERT(cache.load(uartLoaded));
+    UBLOX_TEST_ASSERT(cache.load(usbLoaded));
+    UBLOX_TEST_ASSERT(uartLoaded.field_baudRate().value() == 115200U);
+    UBLOX_TEST_ASSERT(usbLoaded.field_outProtoMask().value() == 0x1U);
+
+    // Raw access by the shared ID is ambiguous
+    auto usbPayload = payloadOf(usb);
+    UBLOX_TEST_ASSERT(!cache.store(ublox::MsgId_CFG_PRT, &usbPayload[0], usbPayload.size()));
+    std::uint8_t buf[64];
+    std::size_t len = 0U;
+    UBLOX_TEST_ASSERT(!cache.tryLoadPayload(ublox::MsgId_CFG_PRT, buf, sizeof(buf), len));
+
+    // Raw access by the type selects the right slot
+    uart.field_baudRate().value() = 9600U;
+    auto uartPayload = payloadOf(uart);
+    auto usbSeq = cache.sequence<CfgPrtUsb>();
+    UBLOX_TEST_ASSERT(cache.store<CfgPrtUart>(&uartPayload[0], uartPayload.size()));
+    UBLOX_TEST_ASSERT(cache.sequence<CfgPrtUsb>() == usbSeq);
+    UBLOX_TEST_ASSERT(cache.load(uartLoaded));
+    UBLOX_TEST_ASSERT(uartLoaded.field_baudRate().value() == 9600U);
+
+    UBLOX_TEST_ASSERT(cache.tryLoadPayload<CfgPrtUsb>(buf, sizeof(buf), len));
+    UBLOX_TEST_ASSERT(std::vector<std::uint8_t>(&buf[0], &buf[len]) == usbPayload);
+}
+
+void testUniqueId()
+{
+    NavPvt pvt;
+    pvt.field_iTOW().value() = 345600000U;
+    pvt.field_numSV().value() = 12U;
+    auto payload = payloadOf(pvt);
+    UBLOX_TEST_ASSERT(cache.store(ublox::MsgId_NAV_PVT, &payload[0], payload.size()));
+
+    NavPvt loaded;
+    std::uint32_t seq = 0U;
+    UBLOX_TEST_ASSERT(cache.load(loaded, &seq));
+    UBLOX_TEST_ASSERT(seq == 2U);
+    UBLOX_TEST_ASSERT(loaded.field_iTOW().value() == 345600000U);
+    UBLOX_TEST_ASSERT(loaded.field_numSV().value() == 12U);
+
+    std::uint8_t buf[128];
+    std::size_t len = 0U;
+    UBLOX_TEST_ASSERT(cache.tryLoadPayload(ublox::MsgId_NAV_PVT, buf, sizeof(buf), len));
+    UBLOX_TEST_ASSERT(len == payload.size());
+
+    // Too small output buffer
+    UBLOX_TEST_ASSERT(!cache.tryLoadPayload(ublox::MsgId_NAV_PVT, buf, 10U, len));
+
+    // Not cached
+    UBLOX_TEST_ASSERT(!cache.store(ublox::MsgId_NAV_SAT, &payload[0], payload.size()));
+}
+
+void testOversized()
+{
+    auto version = makeMonVer(4U);
+    UBLOX_TEST_ASSERT(version.doLength() == 160U);
+
+    cache.handle(version);
+    MonVer loaded;
+    UBLOX_TEST_ASSERT(cache.load(loaded));
+    UBLOX_TEST_ASSERT(loaded.field_extensions().value().size() == 4U);
+    UBLOX_TEST_ASSERT(cache.overflows() == 0U);
+
+    auto shortVersion = makeMonVer(1U);
+    limitedCache.handle(shortVersion);
+    UBLOX_TEST_ASSERT(limitedCache.load(loaded));
+    UBLOX_TEST_ASSERT(loaded.field_extensions().value().size() == 1U);
+
+    // Oversized value invalidates the slot instead of keeping the stale one
+    limitedCache.handle(version);
+    UBLOX_TEST_ASSERT(limitedCache.overflows() == 1U);
+    UBLOX_TEST_ASSERT(limitedCache.sequence<MonVer>() != 0U);
+    UBLOX_TEST_ASSERT(!limitedCache.load(loaded));
+    UBLOX_TEST_ASSERT(!limitedCache.tryLoad(loaded));
+
+    auto payload = payloadOf(version);
+    UBLOX_TEST_ASSERT(!limitedCache.store<MonVer>(&payload[0], payload.size()));
+    UBLOX_TEST_ASSERT(!limitedCache.store(ublox::MsgId_MON_VER, &payload[0], payload.size()));
+    UBLOX_TEST_ASSERT(limitedCache.overflows() == 3U);
+
+    auto shortPayload = payloadOf(shortVersion);
+    UBLOX_TEST_ASSERT(limitedCache.store(ublox::MsgId_MON_VER, &shortPayload[0], shortPayload.size()));
+    UBLOX_TEST_ASSERT(limitedCache.load(loaded));
+}
+
+}  // namespace
+
+int main()
+{
+    testCapacity();
+    testSharedId();
+    testUniqueId();
+    testOversized();
+    return 0;
+}
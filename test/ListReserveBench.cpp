@@ -0,0 +1,156 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Compares number of allocations and read time of the NAV-SAT list
+// when its element count is forced with and without reserving the
+// storage up front (ublox::field::common::forceReadElemCount()).
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <initializer_list>
+#include <vector>
+#include <iostream>
+
+#include "ublox/message/NavSat.h"
+
+#include "common.h"
+
+namespace
+{
+
+std::size_t allocCount = 0U;
+
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocCount;
+    auto* ptr = std::malloc(size == 0U ? 1U : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+namespace
+{
+
+typedef ublox::message::NavSatFields::data<> DataList;
+
+static const unsigned Iterations = 20000U;
+
+template <typename TForceFunc>
+void readLists(
+    const std::vector<std::uint8_t>& buf,
+    std::size_t count,
+    TForceFunc&& forceFunc,
+    std::size_t& allocs,
+    double& ns)
+{
+    auto allocsBefore = allocCount;
+    ns =
+        ublox::test::measureNs(
+            [&buf, count, &forceFunc]()
+            {
+                for (auto idx = 0U; idx < Iterations; ++idx) {
+                    DataList list;
+                    forceFunc(list, count, buf.size());
+                    const std::uint8_t* iter = &buf[0];
+                    auto es = list.read(iter, buf.size());
+                    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+                    UBLOX_TEST_ASSERT(list.value().size() == count);
+                    ublox::test::doNotOptimise(list);
+                }
+            });
+    allocs = allocCount - allocsBefore;
+}
+
+void benchmark(std::size_t count)
+{
+    DataList src;
+    src.value().resize(count);
+    std::vector<std::uint8_t> buf(src.length());
+    std::uint8_t* writeIter = &buf[0];
+    auto es = src.write(writeIter, buf.size());
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+
+    std::size_t plainAllocs = 0U;
+    double plainNs = 0.0;
+    readLists(
+        buf, count,
+        [](DataList& list, std::size_t elemCount, std::size_t)
+        {
+            list.forceReadElemCount(elemCount);
+        },
+        plainAllocs, plainNs);
+
+    std::size_t reservedAllocs = 0U;
+    double reservedNs = 0.0;
+    readLists(
+        buf, count,
+        [](DataList& list, std::size_t elemCount, std::size_t len)
+        {
+            ublox::field::common::forceReadElemCount(list, elemCount, len);
+        },
+        reservedAllocs, reservedNs);
+
+    std::cout << "NAV-SAT " << count << " satellites: "
+              << "push_back growth " << static_cast<double>(plainAllocs) / Iterations << " allocs, "
+              << plainNs / Iterations << " ns; "
+              << "reserved " << static_cast<double>(reservedAllocs) / Iterations << " allocs, "
+              << reservedNs / Iterations << " ns" << std::endl;
+
+    UBLOX_TEST_ASSERT(reservedAllocs == Iterations);
+    UBLOX_TEST_ASSERT(reservedAllocs < plainAllocs);
+}
+
+void checkMessageRead(std::size_t count)
+{
+    ublox::message::NavSat<> src;
+    src.field_data().value().resize(count);
+    src.doRefresh();
+    std::vector<std::uint8_t> buf(src.length());
+    std::uint8_t* writeIter = &buf[0];
+    auto es = src.write(writeIter, buf.size());
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+
+    ublox::message::NavSat<> msg;
+    auto allocsBefore = allocCount;
+    const std::uint8_t* readIter = &buf[0];
+    es = msg.read(readIter, buf.size());
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_ASSERT(msg.field_data().value().size() == count);
+    UBLOX_TEST_ASSERT((allocCount - allocsBefore) == 1U);
+}
+
+}  // namespace
+
+int main()
+{
+    for (auto count : {40U, 48U, 64U}) {
+        benchmark(count);
+        checkMessageRead(count);
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Measures throughput of the navigation data decoder with the subframes,
+// pages and strings of all the supported systems as reported by RXM-SFRBX
+// for the tracked satellites of a receiver.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <iostream>
+
+#include "ublox/util/NavDataDecoder.h"
+
+#include "common.h"
+#include "NavDataFrames.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef ublox::test::NavBits NavBits;
+
+static const unsigned Iterations = 2000U;
+
+struct Counter
+{
+    template <typename T>
+    void handle(const T&)
+    {
+        ++m_count;
+    }
+
+    std::size_t m_count = 0U;
+};
+
+struct Subframe
+{
+    GnssId m_gnssId;
+    std::uint8_t m_svId;
+    std::uint8_t m_freqId;
+    std::uint8_t m_count;
+    std::uint32_t m_words[10];
+};
+
+// Pseudo-random data bits
+NavBits randomBits(std::uint32_t& seed, std::size_t len)
+{
+    NavBits bits;
+    while (bits.size() < len) {
+        seed = (seed * 1103515245U) + 12345U;
+        bits.append(seed >> 16, 16U);
+    }
+    bits.padTo(len);
+    return bits;
+}
+
+void addGps(std::vector<Subframe>& subframes, std::uint32_t& seed, unsigned svId, unsigned subframe)
+{
+    NavBits bits;
+    bits.append(0x8bU, 8U).append(0U, 16U).append(1000U, 17U).append(0U, 2U).append(subframe, 3U).append(0U, 2U);
+    if (subframe <= 3U) {
+        // Consistent IODC / IODE of the data set
+        auto body = randomBits(seed, 192U);
+        if (subframe == 1U) {
+            bits.append(body, 0U, 22U).append(0U, 2U).append(body, 24U, 96U).append(0U, 8U).append(body, 128U, 64U);
+        }
+        else if (subframe == 2U) {
+            bits.append(0U, 8U).append(body, 8U, 184U);
+        }
+        else {
+            bits.append(body, 0U, 168U).append(0U, 8U).append(body, 176U, 16U);
+        }
+    }
+    else {
+        bits.append(1U, 2U).append(56U, 6U).append(randomBits(seed, 184U), 0U, 184U);
+    }
+
+    Subframe data = {GnssId::Gps, static_cast<std::uint8_t>(svId), 0U, 10U, {0}};
+    ublox::test::gpsLnavWords(bits, data.m_words);
+    subframes.push_back(data);
+}
+
+void addGalileo(std::vector<Subframe>& subframes, std::uint32_t& seed, unsigned svId, unsigned type)
+{
+    NavBits bits;
+    bits.append(type, 6U).append(0U, 10U).append(randomBits(seed, 112U), 0U, 112U);
+    Subframe data = {GnssId::Galileo, static_cast<std::uint8_t>(svId), 0U, 8U, {0}};
+    ublox::test::galileoInavWords(bits, data.m_words);
+    subframes.push_back(data);
+}
+
+void addBeiDou(std::vector<Subframe>& subframes, std::uint32_t& seed, unsigned svId, unsigned subframe)
+{
+    NavBits bits;
+    bits.append(0x712U, 11U).append(0U, 4U).append(subframe, 3U).append(345600U + (subframe * 6U), 20U);
+    bits.append(randomBits(seed, 186U), 0U, 186U);
+    Subframe data = {GnssId::BeiDou, static_cast<std::uint8_t>(svId), 0U, 10U, {0}};
+    ublox::test::beiDouD1Words(bits, data.m_words);
+    subframes.push_back(data);
+}
+
+void addGlonass(std::vector<Subframe>& subframes, std::uint32_t& seed, unsigned svId, unsigned string)
+{
+    NavBits bits;
+    bits.append(0U, 1U).append(string, 4U).append(randomBits(seed, 72U), 0U, 72U);
+    Subframe data = {GnssId::Glonass, static_cast<std::uint8_t>(svId), 7U, 4U, {0}};
+    ublox::test::glonassWords(bits, data.m_words);
+    subframes.push_back(data);
+}
+
+}  // namespace
+
+int main()
+{
+    // Typical sky of 40 tracked satellites: one frame of every satellite
+    std::uint32_t seed = 2017U;
+    std::vector<Subframe> subframes;
+    for (unsigned svId = 1U; svId <= 12U; ++svId) {
+        for (unsigned subframe = 1U; subframe <= 4U; ++subframe) {
+            addGps(subframes, seed, svId, subframe);
+        }
+    }
+
+    for (unsigned svId = 1U; svId <= 10U; ++svId) {
+        for (unsigned type = 1U; type <= 6U; ++type) {
+            addGalileo(subframes, seed, svId, type);
+        }
+    }
+
+    for (unsigned svId = 19U; svId <= 26U; ++svId) {
+        for (unsigned subframe = 1U; subframe <= 3U; ++subframe) {
+            addBeiDou(subframes, seed, svId, subframe);
+        }
+    }
+
+    for (unsigned svId = 1U; svId <= 10U; ++svId) {
+        for (unsigned string = 1U; string <= 5U; ++string) {
+            addGlonass(subframes, seed, svId, string);
+        }
+    }
+
+    Counter counter;
+    util::NavDataDecoder<Counter> decoder(counter);
+    auto ns = ublox::test::measureNs(
+        [&]()
+        {
+            for (unsigned iter = 0U; iter < Iterations; ++iter) {
+                for (auto& subframe : subframes) {
+                    decoder.decode(
+                        subframe.m_gnssId, subframe.m_svId, subframe.m_freqId, &subframe.m_words[0], subframe.m_count);
+                }
+            }
+        });
+    ublox::test::doNotOptimise(counter.m_count);
+
+    auto count = static_cast<double>(Iterations * subframes.size());
+    std::cout << "decode: " << ns / count << " ns/subframe, " << count * 1e9 / ns << " subframes/s" << std::endl;
+    std::cout << "reported: " << counter.m_count << std::endl;
+    UBLOX_TEST_ASSERT(decoder.stats().m_subframes == (Iterations * subframes.size()));
+    UBLOX_TEST_ASSERT(decoder.stats().m_parityErrors == 0U);
+    return 0;
+}
@@ -0,0 +1,860 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Tests of the navigation data decoder with subframes, pages and strings
+// encoded from known parameters according to the interface control
+// documents: decoded values, parity / CRC checks, data set consistency and
+// reporting of the unchanged ionospheric and time parameters.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+
+#include "ublox/util/NavDataDecoder.h"
+
+#include "common.h"
+#include "NavDataFrames.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef ublox::test::NavBits NavBits;
+
+static const double Pi = 3.1415926535898;
+
+struct Recorder
+{
+    void handle(const util::KeplerEphemeris& eph)
+    {
+        m_kepler.push_back(eph);
+    }
+
+    void handle(const util::GlonassEphemeris& eph)
+    {
+        m_glonass.push_back(eph);
+    }
+
+    void handle(const util::KeplerAlmanac& alm)
+    {
+        m_almanac.push_back(alm);
+    }
+
+    void handle(const util::KlobucharIono& iono)
+    {
+        m_klobuchar.push_back(iono);
+    }
+
+    void handle(const util::NequickIono& iono)
+    {
+        m_nequick.push_back(iono);
+    }
+
+    void handle(const util::GnssUtcParams& utc)
+    {
+        m_utc.push_back(utc);
+    }
+
+    void handle(const util::GlonassTimeParams& params)
+    {
+        m_glonassTime.push_back(params);
+    }
+
+    std::vector<util::KeplerEphemeris> m_kepler;
+    std::vector<util::GlonassEphemeris> m_glonass;
+    std::vector<util::KeplerAlmanac> m_almanac;
+    std::vector<util::KlobucharIono> m_klobuchar;
+    std::vector<util::NequickIono> m_nequick;
+    std::vector<util::GnssUtcParams> m_utc;
+    std::vector<util::GlonassTimeParams> m_glonassTime;
+};
+
+typedef util::NavDataDecoder<Recorder> Decoder;
+
+// Broadcast value with the scale factor 2^exp
+double p2(std::int64_t raw, int exp)
+{
+    return std::ldexp(static_cast<double>(raw), exp);
+}
+
+// Broadcast angle with the scale factor 2^exp semi-circles
+double sc(std::int64_t raw, int exp)
+{
+    return p2(raw, exp) * Pi;
+}
+
+double tol(double exp)
+{
+    return std::abs(exp) * 1e-15;
+}
+
+// Sign-magnitude representation (GLONASS)
+std::uint64_t signMag(std::int64_t value, unsigned len)
+{
+    if (value < 0) {
+        return (1ULL << (len - 1U)) | static_cast<std::uint64_t>(-value);
+    }
+    return static_cast<std::uint64_t>(value);
+}
+
+std::uint64_t twos(std::int64_t value)
+{
+    return static_cast<std::uint64_t>(value);
+}
+
+// GPS LNAV parameters (raw broadcast values)
+static const unsigned GpsWeek = 152U;
+static const unsigned GpsIodc = 0x155U;
+static const unsigned GpsIode = 0x55U;
+static const std::int64_t GpsTgd = -12;
+static const std::int64_t GpsToc = 21600;
+static const std::int64_t GpsAf1 = -123;
+static const std::int64_t GpsAf0 = -1234567;
+static const std::int64_t GpsCrs = -1234;
+static const std::int64_t GpsDeltaN = 12345;
+static const std::int64_t GpsM0 = -1234567890;
+static const std::int64_t GpsCuc = -2345;
+static const std::int64_t GpsE = 83886080;
+static const std::int64_t GpsCus = 3456;
+static const std::int64_t GpsSqrtA = 2702034944LL;
+static const std::int64_t GpsToe = 21600;
+static const std::int64_t GpsCic = -23;
+static const std::int64_t GpsOmega0 = 987654321;
+static const std::int64_t GpsCis = 45;
+static const std::int64_t GpsI0 = 660000000;
+static const std::int64_t GpsCrc = 7654;
+static const std::int64_t GpsOmega = -456789012;
+static const std::int64_t GpsOmegaDot = -22000;
+static const std::int64_t GpsIDot = -1234;
+
+NavBits gpsHeader(unsigned subframe, unsigned tow)
+{
+    NavBits bits;
+    bits.append(0x8bU, 8U).append(0U, 16U); // TLM
+    bits.append(tow, 17U).append(0U, 2U).append(subframe, 3U).append(0U, 2U); // HOW
+    return bits;
+}
+
+NavBits gpsSubframe1(unsigned tow)
+{
+    auto bits = gpsHeader(1U, tow);
+    bits.append(GpsWeek, 10U).append(1U, 2U).append(2U, 4U).append(0U, 6U).append(GpsIodc >> 8, 2U);
+    bits.padTo(160U);
+    bits.append(twos(GpsTgd), 8U).append(GpsIodc & 0xffU, 8U).append(GpsToc, 16U);
+    bits.append(0U, 8U).append(twos(GpsAf1), 16U).append(twos(GpsAf0), 22U).append(0U, 2U);
+    return bits;
+}
+
+NavBits gpsSubframe2(unsigned tow, unsigned iode = GpsIode)
+{
+    auto bits = gpsHeader(2U, tow);
+    bits.append(iode, 8U).append(twos(GpsCrs), 16U).append(twos(GpsDeltaN), 16U).append(twos(GpsM0), 32U);
+    bits.append(twos(GpsCuc), 16U).append(GpsE, 32U).append(twos(GpsCus), 16U).append(GpsSqrtA, 32U);
+    bits.append(GpsToe, 16U).append(0U, 8U);
+    return bits;
+}
+
+NavBits gpsSubframe3(unsigned tow, unsigned iode = GpsIode)
+{
+    auto bits = gpsHeader(3U, tow);
+    bits.append(twos(GpsCic), 16U).append(twos(GpsOmega0), 32U).append(twos(GpsCis), 16U);
+    bits.append(twos(GpsI0), 32U).append(twos(GpsCrc), 16U).append(twos(GpsOmega), 32U);
+    bits.append(twos(GpsOmegaDot), 24U).append(iode, 8U).append(twos(GpsIDot), 14U).append(0U, 2U);
+    return bits;
+}
+
+// Subframe 4 page 18 (SV ID 56)
+NavBits gpsIonoUtcPage(unsigned tow, std::int64_t alpha0)
+{
+    auto bits = gpsHeader(4U, tow);
+    bits.append(1U, 2U).append(56U, 6U);
+    bits.append(twos(alpha0), 8U).append(twos(-3), 8U).append(twos(-1), 8U).append(twos(2), 8U);
+    bits.append(twos(100), 8U).append(twos(-2), 8U).append(twos(-64), 8U).append(twos(1), 8U);
+    bits.append(twos(-12), 24U).append(twos(-123456), 32U).append(144U, 8U).append(GpsWeek, 8U);
+    bits.append(18U, 8U).append(137U, 8U).append(7U, 8U).append(18U, 8U);
+    bits.padTo(240U);
+    return bits;
+}
+
+// Subframe 5 almanac page of SV 7
+NavBits gpsAlmanacPage(unsigned tow)
+{
+    auto bits = gpsHeader(5U, tow);
+    bits.append(1U, 2U).append(7U, 6U);
+    bits.append(20000U, 16U).append(144U, 8U).append(twos(-1000), 16U).append(twos(-300), 16U);
+    bits.append(0U, 8U).append(10554432U, 24U).append(twos(-2000000), 24U).append(twos(3000000), 24U);
+    bits.append(twos(-4000000), 24U);
+    auto af0 = twos(-1000);
+    bits.append((af0 >> 3) & 0xffU, 8U).append(twos(-7), 11U).append(af0 & 0x7U, 3U).append(0U, 2U);
+    return bits;
+}
+
+bool decodeGps(Decoder& decoder, const NavBits& bits, bool transmitted = false)
+{
+    std::uint32_t words[10];
+    ublox::test::gpsLnavWords(bits, words, transmitted);
+    return decoder.decode(GnssId::Gps, 5U, 0U, &words[0], 10U);
+}
+
+void checkGpsEphemeris(const util::KeplerEphemeris& eph)
+{
+    UBLOX_TEST_ASSERT(eph.m_gnssId == static_cast<std::uint8_t>(GnssId::Gps));
+    UBLOX_TEST_ASSERT(eph.m_svId == 5U);
+    UBLOX_TEST_ASSERT(eph.m_week == GpsWeek);
+    UBLOX_TEST_ASSERT(eph.m_iodc == GpsIodc);
+    UBLOX_TEST_ASSERT(eph.m_iode == GpsIode);
+    UBLOX_TEST_ASSERT(eph.m_accuracy == 2U);
+    UBLOX_TEST_ASSERT(eph.m_health == 0U);
+    UBLOX_TEST_ASSERT(eph.m_toc == 345600.0);
+    UBLOX_TEST_ASSERT(eph.m_toe == 345600.0);
+    UBLOX_TEST_NEAR(eph.m_tgd, p2(GpsTgd, -31), tol(eph.m_tgd));
+    UBLOX_TEST_ASSERT(eph.m_af2 == 0.0);
+    UBLOX_TEST_NEAR(eph.m_af1, p2(GpsAf1, -43), tol(eph.m_af1));
+    UBLOX_TEST_NEAR(eph.m_af0, p2(GpsAf0, -31), tol(eph.m_af0));
+    UBLOX_TEST_NEAR(eph.m_crs, p2(GpsCrs, -5), tol(eph.m_crs));
+    UBLOX_TEST_NEAR(eph.m_deltaN, sc(GpsDeltaN, -43), tol(eph.m_deltaN));
+    UBLOX_TEST_NEAR(eph.m_m0, sc(GpsM0, -31), tol(eph.m_m0));
+    UBLOX_TEST_NEAR(eph.m_cuc, p2(GpsCuc, -29), tol(eph.m_cuc));
+    UBLOX_TEST_NEAR(eph.m_e, p2(GpsE, -33), tol(eph.m_e));
+    UBLOX_TEST_NEAR(eph.m_cus, p2(GpsCus, -29), tol(eph.m_cus));
+    UBLOX_TEST_NEAR(eph.m_sqrtA, p2(GpsSqrtA, -19), tol(eph.m_sqrtA));
+    UBLOX_TEST_NEAR(eph.m_cic, p2(GpsCic, -29), tol(eph.m_cic));
+    UBLOX_TEST_NEAR(eph.m_omega0, sc(GpsOmega0, -31), tol(eph.m_omega0));
+    UBLOX_TEST_NEAR(eph.m_cis, p2(GpsCis, -29), tol(eph.m_cis));
+    UBLOX_TEST_NEAR(eph.m_i0, sc(GpsI0, -31), tol(eph.m_i0));
+    UBLOX_TEST_NEAR(eph.m_crc, p2(GpsCrc, -5), tol(eph.m_crc));
+    UBLOX_TEST_NEAR(eph.m_omega, sc(GpsOmega, -31), tol(eph.m_omega));
+    UBLOX_TEST_NEAR(eph.m_omegaDot, sc(GpsOmegaDot, -43), tol(eph.m_omegaDot));
+    UBLOX_TEST_NEAR(eph.m_iDot, sc(GpsIDot, -43), tol(eph.m_iDot));
+}
+
+void testGpsEphemeris()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe1(100U)));
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe2(101U)));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.empty());
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe3(102U)));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 1U);
+    checkGpsEphemeris(recorder.m_kepler[0]);
+
+    // Data bits reported as transmitted (inverted after the words ending with D30 set)
+    std::uint32_t source[10];
+    std::uint32_t transmitted[10];
+    ublox::test::gpsLnavWords(gpsSubframe2(104U), source);
+    ublox::test::gpsLnavWords(gpsSubframe2(104U), transmitted, true);
+    bool inverted = false;
+    for (std::size_t idx = 0U; idx < 10U; ++idx) {
+        inverted = inverted || (source[idx] != transmitted[idx]);
+    }
+    UBLOX_TEST_ASSERT(inverted);
+
+    decoder.clear();
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe1(103U), true));
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe2(104U), true));
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe3(105U), true));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 2U);
+    checkGpsEphemeris(recorder.m_kepler[1]);
+
+    // Subframes of different data sets
+    decoder.clear();
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe1(106U)));
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe2(107U)));
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe3(108U, GpsIode + 1U)));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 2U);
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe2(109U, GpsIode + 1U)));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 2U);
+    UBLOX_TEST_ASSERT(decoder.stats().m_subframes == 4U);
+}
+
+void testGpsParity()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe1(100U)));
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsSubframe2(101U)));
+
+    std::uint32_t words[10];
+    ublox::test::gpsLnavWords(gpsSubframe3(102U), words);
+    for (unsigned bit = 0U; bit < 30U; ++bit) {
+        words[4] ^= (1U << bit);
+        UBLOX_TEST_ASSERT(!decoder.decode(GnssId::Gps, 5U, 0U, &words[0], 10U));
+        words[4] ^= (1U << bit);
+    }
+
+    UBLOX_TEST_ASSERT(recorder.m_kepler.empty());
+    UBLOX_TEST_ASSERT(decoder.stats().m_parityErrors == 30U);
+    UBLOX_TEST_ASSERT(decoder.decode(GnssId::Gps, 5U, 0U, &words[0], 10U));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 1U);
+
+    // Unsupported satellite and incomplete subframe
+    UBLOX_TEST_ASSERT(!decoder.decode(GnssId::Gps, 200U, 0U, &words[0], 10U));
+    UBLOX_TEST_ASSERT(!decoder.decode(GnssId::Gps, 5U, 0U, &words[0], 9U));
+    UBLOX_TEST_ASSERT(decoder.stats().m_unsupported == 2U);
+    UBLOX_TEST_ASSERT(decoder.stats().m_subframes == 3U);
+}
+
+void testGpsIonoUtc()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsIonoUtcPage(100U, 12)));
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar.size() == 1U);
+    UBLOX_TEST_ASSERT(recorder.m_utc.size() == 1U);
+
+    auto& iono = recorder.m_klobuchar[0];
+    UBLOX_TEST_ASSERT(iono.m_gnssId == static_cast<std::uint8_t>(GnssId::Gps));
+    UBLOX_TEST_ASSERT(iono.m_alpha0 == p2(12, -30));
+    UBLOX_TEST_ASSERT(iono.m_alpha1 == p2(-3, -27));
+    UBLOX_TEST_ASSERT(iono.m_alpha2 == p2(-1, -24));
+    UBLOX_TEST_ASSERT(iono.m_alpha3 == p2(2, -24));
+    UBLOX_TEST_ASSERT(iono.m_beta0 == p2(100, 11));
+    UBLOX_TEST_ASSERT(iono.m_beta1 == p2(-2, 14));
+    UBLOX_TEST_ASSERT(iono.m_beta2 == p2(-64, 16));
+    UBLOX_TEST_ASSERT(iono.m_beta3 == p2(1, 16));
+
+    auto& utc = recorder.m_utc[0];
+    UBLOX_TEST_ASSERT(utc.m_gnssId == static_cast<std::uint8_t>(GnssId::Gps));
+    UBLOX_TEST_ASSERT(utc.m_a1 == p2(-12, -50));
+    UBLOX_TEST_ASSERT(utc.m_a0 == p2(-123456, -30));
+    UBLOX_TEST_ASSERT(utc.m_tot == 589824.0);
+    UBLOX_TEST_ASSERT(utc.m_wnt == GpsWeek);
+    UBLOX_TEST_ASSERT(utc.m_dtLs == 18);
+    UBLOX_TEST_ASSERT(utc.m_wnLsf == 137U);
+    UBLOX_TEST_ASSERT(utc.m_dn == 7U);
+    UBLOX_TEST_ASSERT(utc.m_dtLsf == 18);
+
+    // Unchanged parameters are not reported again
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsIonoUtcPage(125U, 12)));
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar.size() == 1U);
+    UBLOX_TEST_ASSERT(recorder.m_utc.size() == 1U);
+
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsIonoUtcPage(150U, -12)));
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar.size() == 2U);
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar[1].m_alpha0 == p2(-12, -30));
+    UBLOX_TEST_ASSERT(recorder.m_utc.size() == 1U);
+
+    // Reported again after clear
+    decoder.clear();
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsIonoUtcPage(175U, -12)));
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar.size() == 3U);
+    UBLOX_TEST_ASSERT(recorder.m_utc.size() == 2U);
+}
+
+void testGpsAlmanac()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    UBLOX_TEST_ASSERT(decodeGps(decoder, gpsAlmanacPage(100U)));
+    UBLOX_TEST_ASSERT(recorder.m_almanac.size() == 1U);
+
+    auto& alm = recorder.m_almanac[0];
+    UBLOX_TEST_ASSERT(alm.m_svId == 7U);
+    UBLOX_TEST_ASSERT(alm.m_health == 0U);
+    UBLOX_TEST_ASSERT(alm.m_toa == 589824.0);
+    UBLOX_TEST_NEAR(alm.m_e, p2(20000, -21), tol(alm.m_e));
+    UBLOX_TEST_NEAR(alm.m_i0, sc(-1000, -19) + (0.3 * Pi), 1e-15);
+    UBLOX_TEST_NEAR(alm.m_omegaDot, sc(-300, -38), tol(alm.m_omegaDot));
+    UBLOX_TEST_NEAR(alm.m_sqrtA, p2(10554432, -11), tol(alm.m_sqrtA));
+    UBLOX_TEST_NEAR(alm.m_omega0, sc(-2000000, -23), tol(alm.m_omega0));
+    UBLOX_TEST_NEAR(alm.m_omega, sc(3000000, -23), tol(alm.m_omega));
+    UBLOX_TEST_NEAR(alm.m_m0, sc(-4000000, -23), tol(alm.m_m0));
+    UBLOX_TEST_NEAR(alm.m_af0, p2(-1000, -20), tol(alm.m_af0));
+    UBLOX_TEST_NEAR(alm.m_af1, p2(-7, -38), tol(alm.m_af1));
+}
+
+void testRxmSfrbx()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    NavBits subframes[] = {gpsSubframe1(100U), gpsSubframe2(101U), gpsSubframe3(102U)};
+    for (auto& subframe : subframes) {
+        std::uint32_t words[10];
+        ublox::test::gpsLnavWords(subframe, words);
+        message::RxmSfrbx<> msg;
+        msg.field_gnssId().value() = GnssId::Gps;
+        msg.field_svId().value() = 5U;
+        auto& list = msg.field_dwrd().value();
+        list.resize(10U);
+        for (std::size_t idx = 0U; idx < list.size(); ++idx) {
+            list[idx].value() = words[idx];
+        }
+        decoder.handle(msg);
+    }
+
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 1U);
+    checkGpsEphemeris(recorder.m_kepler[0]);
+}
+
+// Galileo I/NAV parameters (raw broadcast values)
+static const unsigned GalIod = 77U;
+static const unsigned GalSvId = 11U;
+static const std::int64_t GalToe = 5760;
+static const std::int64_t GalM0 = 1987654321;
+static const std::int64_t GalE = 1717986;
+static const std::int64_t GalSqrtA = 2852126720LL;
+static const std::int64_t GalOmega0 = -1456789012;
+static const std::int64_t GalI0 = 671088640;
+static const std::int64_t GalOmega = 123456789;
+static const std::int64_t GalIDot = 567;
+static const std::int64_t GalOmegaDot = -5678;
+static const std::int64_t GalDeltaN = 9876;
+static const std::int64_t GalCuc = -333;
+static const std::int64_t GalCus = 4444;
+static const std::int64_t GalCrc = 5555;
+static const std::int64_t GalCrs = -666;
+static const std::int64_t GalCic = 77;
+static const std::int64_t GalCis = -88;
+static const std::int64_t GalToc = 5760;
+static const std::int64_t GalAf0 = -987654321;
+static const std::int64_t GalAf1 = 654321;
+static const std::int64_t GalAf2 = -5;
+
+NavBits galWord(unsigned type)
+{
+    NavBits bits;
+    bits.append(type, 6U);
+    switch (type) {
+    case 1U:
+        bits.append(GalIod, 10U).append(GalToe, 14U).append(twos(GalM0), 32U).append(GalE, 32U);
+        bits.append(GalSqrtA, 32U);
+        break;
+    case 2U:
+        bits.append(GalIod, 10U).append(twos(GalOmega0), 32U).append(twos(GalI0), 32U);
+        bits.append(twos(GalOmega), 32U).append(twos(GalIDot), 14U);
+        break;
+    case 3U:
+        bits.append(GalIod, 10U).append(twos(GalOmegaDot), 24U).append(twos(GalDeltaN), 16U);
+        bits.append(twos(GalCuc), 16U).append(twos(GalCus), 16U).append(twos(GalCrc), 16U);
+        bits.append(twos(GalCrs), 16U).append(107U, 8U);
+        break;
+    case 4U:
+        bits.append(GalIod, 10U).append(GalSvId, 6U).append(twos(GalCic), 16U).append(twos(GalCis), 16U);
+        bits.append(GalToc, 14U).append(twos(GalAf0), 31U).append(twos(GalAf1), 21U).append(twos(GalAf2), 6U);
+        break;
+    case 5U:
+        bits.append(300U, 11U).append(twos(-100), 11U).append(twos(200), 14U).append(0x5U, 5U);
+        bits.append(twos(-9), 10U).append(twos(-11), 10U); // BGD E1-E5a, E1-E5b
+        bits.append(2U, 2U).append(1U, 2U).append(1U, 1U).append(0U, 1U); // HS E5b, E1-B, DVS E5b, E1-B
+        bits.append(1176U, 12U).append(345600U, 20U);
+        break;
+    case 6U:
+        bits.append(twos(-1234), 32U).append(twos(56), 24U).append(18U, 8U).append(96U, 8U);
+        bits.append(152U, 8U).append(137U, 8U).append(7U, 3U).append(18U, 8U).append(345606U, 20U);
+        break;
+    default:
+        break;
+    }
+
+    bits.padTo(128U);
+    return bits;
+}
+
+void galileoPage(const NavBits& word, std::uint32_t* words)
+{
+    ublox::test::galileoInavWords(word, words);
+}
+
+bool decodeGalileo(Decoder& decoder, unsigned type)
+{
+    std::uint32_t words[8];
+    galileoPage(galWord(type), words);
+    return decoder.decode(GnssId::Galileo, GalSvId, 0U, &words[0], 8U);
+}
+
+void testCrc24q()
+{
+    static const std::uint8_t Data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    UBLOX_TEST_ASSERT(util::details::crc24q(&Data[0], sizeof(Data)) == 0xcde703U);
+
+    NavBits bits;
+    for (auto byte : Data) {
+        bits.append(byte, 8U);
+    }
+    UBLOX_TEST_ASSERT(ublox::test::navCrc24q(bits) == 0xcde703U);
+}
+
+void testGalileo()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    UBLOX_TEST_ASSERT(decodeGalileo(decoder, 5U));
+    UBLOX_TEST_ASSERT(recorder.m_nequick.size() == 1U);
+    auto& iono = recorder.m_nequick[0];
+    UBLOX_TEST_ASSERT(iono.m_regions == 0x5U);
+    UBLOX_TEST_ASSERT(iono.m_ai0 == p2(300, -2));
+    UBLOX_TEST_ASSERT(iono.m_ai1 == p2(-100, -8));
+    UBLOX_TEST_ASSERT(iono.m_ai2 == p2(200, -15));
+
+    UBLOX_TEST_ASSERT(decodeGalileo(decoder, 6U));
+    UBLOX_TEST_ASSERT(recorder.m_utc.size() == 1U);
+    auto& utc = recorder.m_utc[0];
+    UBLOX_TEST_ASSERT(utc.m_gnssId == static_cast<std::uint8_t>(GnssId::Galileo));
+    UBLOX_TEST_ASSERT(utc.m_a0 == p2(-1234, -30));
+    UBLOX_TEST_ASSERT(utc.m_a1 == p2(56, -50));
+    UBLOX_TEST_ASSERT(utc.m_dtLs == 18);
+    UBLOX_TEST_ASSERT(utc.m_tot == 345600.0);
+    UBLOX_TEST_ASSERT(utc.m_wnt == 152U);
+    UBLOX_TEST_ASSERT(utc.m_wnLsf == 137U);
+    UBLOX_TEST_ASSERT(utc.m_dn == 7U);
+    UBLOX_TEST_ASSERT(utc.m_dtLsf == 18);
+
+    for (unsigned type = 1U; type <= 4U; ++type) {
+        UBLOX_TEST_ASSERT(recorder.m_kepler.empty());
+        UBLOX_TEST_ASSERT(decodeGalileo(decoder, type));
+    }
+
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 1U);
+    auto& eph = recorder.m_kepler[0];
+    UBLOX_TEST_ASSERT(eph.m_gnssId == static_cast<std::uint8_t>(GnssId::Galileo));
+    UBLOX_TEST_ASSERT(eph.m_svId == GalSvId);
+    UBLOX_TEST_ASSERT(eph.m_week == 1176U);
+    UBLOX_TEST_ASSERT(eph.m_iode == GalIod);
+    UBLOX_TEST_ASSERT(eph.m_iodc == GalIod);
+    UBLOX_TEST_ASSERT(eph.m_accuracy == 107U);
+    UBLOX_TEST_ASSERT(eph.m_health == ((1U << 1) | (1U << 6) | (2U << 7)));
+    UBLOX_TEST_ASSERT(eph.m_toe == 345600.0);
+    UBLOX_TEST_ASSERT(eph.m_toc == 345600.0);
+    UBLOX_TEST_NEAR(eph.m_m0, sc(GalM0, -31), tol(eph.m_m0));
+    UBLOX_TEST_NEAR(eph.m_e, p2(GalE, -33), tol(eph.m_e));
+    UBLOX_TEST_NEAR(eph.m_sqrtA, p2(GalSqrtA, -19), tol(eph.m_sqrtA));
+    UBLOX_TEST_NEAR(eph.m_omega0, sc(GalOmega0, -31), tol(eph.m_omega0));
+    UBLOX_TEST_NEAR(eph.m_i0, sc(GalI0, -31), tol(eph.m_i0));
+    UBLOX_TEST_NEAR(eph.m_omega, sc(GalOmega, -31), tol(eph.m_omega));
+    UBLOX_TEST_NEAR(eph.m_iDot, sc(GalIDot, -43), tol(eph.m_iDot));
+    UBLOX_TEST_NEAR(eph.m_omegaDot, sc(GalOmegaDot, -43), tol(eph.m_omegaDot));
+    UBLOX_TEST_NEAR(eph.m_deltaN, sc(GalDeltaN, -43), tol(eph.m_deltaN));
+    UBLOX_TEST_NEAR(eph.m_cuc, p2(GalCuc, -29), tol(eph.m_cuc));
+    UBLOX_TEST_NEAR(eph.m_cus, p2(GalCus, -29), tol(eph.m_cus));
+    UBLOX_TEST_NEAR(eph.m_crc, p2(GalCrc, -5), tol(eph.m_crc));
+    UBLOX_TEST_NEAR(eph.m_crs, p2(GalCrs, -5), tol(eph.m_crs));
+    UBLOX_TEST_NEAR(eph.m_cic, p2(GalCic, -29), tol(eph.m_cic));
+    UBLOX_TEST_NEAR(eph.m_cis, p2(GalCis, -29), tol(eph.m_cis));
+    UBLOX_TEST_NEAR(eph.m_af0, p2(GalAf0, -34), tol(eph.m_af0));
+    UBLOX_TEST_NEAR(eph.m_af1, p2(GalAf1, -46), tol(eph.m_af1));
+    UBLOX_TEST_NEAR(eph.m_af2, p2(GalAf2, -59), tol(eph.m_af2));
+    UBLOX_TEST_NEAR(eph.m_tgd, p2(-9, -32), tol(eph.m_tgd));
+    UBLOX_TEST_NEAR(eph.m_tgd2, p2(-11, -32), tol(eph.m_tgd2));
+
+    // Unchanged parameters are not reported again
+    UBLOX_TEST_ASSERT(decodeGalileo(decoder, 5U));
+    UBLOX_TEST_ASSERT(decodeGalileo(decoder, 6U));
+    UBLOX_TEST_ASSERT(recorder.m_nequick.size() == 1U);
+    UBLOX_TEST_ASSERT(recorder.m_utc.size() == 1U);
+
+    // Single bit errors are detected by CRC
+    std::uint32_t words[8];
+    galileoPage(galWord(1U), words);
+    for (unsigned bit = 2U; bit < 114U; ++bit) {
+        words[bit / 32U] ^= (1U << (31U - (bit % 32U)));
+        UBLOX_TEST_ASSERT(!decoder.decode(GnssId::Galileo, GalSvId, 0U, &words[0], 8U));
+        words[bit / 32U] ^= (1U << (31U - (bit % 32U)));
+    }
+    UBLOX_TEST_ASSERT(decoder.stats().m_parityErrors == 112U);
+    UBLOX_TEST_ASSERT(decoder.stats().m_subframes == 8U);
+
+    // Alert page
+    words[0] |= 0x40000000U;
+    UBLOX_TEST_ASSERT(!decoder.decode(GnssId::Galileo, GalSvId, 0U, &words[0], 8U));
+    UBLOX_TEST_ASSERT(decoder.stats().m_unsupported == 1U);
+}
+
+// BeiDou D1 parameters (raw broadcast values)
+static const unsigned BdsSvId = 19U;
+static const unsigned BdsSow = 345600U;
+static const std::int64_t BdsToe = 43200;
+static const std::int64_t BdsDeltaN = 11111;
+static const std::int64_t BdsCuc = -22222;
+static const std::int64_t BdsM0 = 1333333333;
+static const std::int64_t BdsE = 4444444;
+static const std::int64_t BdsCus = 55555;
+static const std::int64_t BdsCrc = -66666;
+static const std::int64_t BdsCrs = 77777;
+static const std::int64_t BdsSqrtA = 2822240256LL;
+static const std::int64_t BdsI0 = -888888888;
+static const std::int64_t BdsCic = -99999;
+static const std::int64_t BdsOmegaDot = -1111111;
+static const std::int64_t BdsCis = 12121;
+static const std::int64_t BdsIDot = -2323;
+static const std::int64_t BdsOmega0 = 1414141414;
+static const std::int64_t BdsOmega = -1515151515;
+
+NavBits bdsSubframe(unsigned subframe, unsigned sow)
+{
+    NavBits bits;
+    bits.append(0x712U, 11U).append(0U, 4U).append(subframe, 3U).append(sow, 20U);
+    switch (subframe) {
+    case 1U:
+        bits.append(1U, 1U).append(17U, 5U).append(3U, 4U).append(820U, 13U).append(BdsToe, 17U);
+        bits.append(twos(-33), 10U).append(twos(44), 10U);
+        bits.append(twos(5), 8U).append(twos(-6), 8U).append(twos(7), 8U).append(twos(-8), 8U);
+        bits.append(twos(90), 8U).append(twos(-10), 8U).append(twos(-11), 8U).append(twos(12), 8U);
+        bits.append(twos(-13), 11U).append(twos(-1414141), 24U).append(twos(151515), 22U).append(21U, 5U);
+        break;
+    case 2U:
+        bits.append(twos(BdsDeltaN), 16U).append(twos(BdsCuc), 18U).append(twos(BdsM0), 32U);
+        bits.append(BdsE, 32U).append(twos(BdsCus), 18U).append(twos(BdsCrc), 18U).append(twos(BdsCrs), 18U);
+        bits.append(BdsSqrtA, 32U).append(BdsToe >> 15, 2U);
+        break;
+    case 3U:
+        bits.append(BdsToe & 0x7fff, 15U).append(twos(BdsI0), 32U).append(twos(BdsCic), 18U);
+        bits.append(twos(BdsOmegaDot), 24U).append(twos(BdsCis), 18U).append(twos(BdsIDot), 14U);
+        bits.append(twos(BdsOmega0), 32U).append(twos(BdsOmega), 32U);
+        break;
+    default:
+        break;
+    }
+
+    bits.padTo(224U);
+    return bits;
+}
+
+bool decodeBeiDou(Decoder& decoder, unsigned subframe, unsigned sow)
+{
+    std::uint32_t words[10];
+    ublox::test::beiDouD1Words(bdsSubframe(subframe, sow), words);
+    return decoder.decode(GnssId::BeiDou, BdsSvId, 0U, &words[0], 10U);
+}
+
+void testBeiDou()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    UBLOX_TEST_ASSERT(decodeBeiDou(decoder, 1U, BdsSow));
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar.size() == 1U);
+    auto& iono = recorder.m_klobuchar[0];
+    UBLOX_TEST_ASSERT(iono.m_gnssId == static_cast<std::uint8_t>(GnssId::BeiDou));
+    UBLOX_TEST_ASSERT(iono.m_alpha0 == p2(5, -30));
+    UBLOX_TEST_ASSERT(iono.m_alpha1 == p2(-6, -27));
+    UBLOX_TEST_ASSERT(iono.m_alpha2 == p2(7, -24));
+    UBLOX_TEST_ASSERT(iono.m_alpha3 == p2(-8, -24));
+    UBLOX_TEST_ASSERT(iono.m_beta0 == p2(90, 11));
+    UBLOX_TEST_ASSERT(iono.m_beta1 == p2(-10, 14));
+    UBLOX_TEST_ASSERT(iono.m_beta2 == p2(-11, 16));
+    UBLOX_TEST_ASSERT(iono.m_beta3 == p2(12, 16));
+
+    UBLOX_TEST_ASSERT(decodeBeiDou(decoder, 2U, BdsSow + 6U));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.empty());
+    UBLOX_TEST_ASSERT(decodeBeiDou(decoder, 3U, BdsSow + 12U));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 1U);
+
+    auto& eph = recorder.m_kepler[0];
+    UBLOX_TEST_ASSERT(eph.m_gnssId == static_cast<std::uint8_t>(GnssId::BeiDou));
+    UBLOX_TEST_ASSERT(eph.m_svId == BdsSvId);
+    UBLOX_TEST_ASSERT(eph.m_health == 1U);
+    UBLOX_TEST_ASSERT(eph.m_iodc == 17U);
+    UBLOX_TEST_ASSERT(eph.m_accuracy == 3U);
+    UBLOX_TEST_ASSERT(eph.m_week == 820U);
+    UBLOX_TEST_ASSERT(eph.m_iode == 21U);
+    UBLOX_TEST_ASSERT(eph.m_toc == 345600.0);
+    UBLOX_TEST_ASSERT(eph.m_toe == 345600.0);
+    UBLOX_TEST_NEAR(eph.m_tgd, -33e-10, 1e-22);
+    UBLOX_TEST_NEAR(eph.m_tgd2, 44e-10, 1e-22);
+    UBLOX_TEST_NEAR(eph.m_af2, p2(-13, -66), tol(eph.m_af2));
+    UBLOX_TEST_NEAR(eph.m_af0, p2(-1414141, -33), tol(eph.m_af0));
+    UBLOX_TEST_NEAR(eph.m_af1, p2(151515, -50), tol(eph.m_af1));
+    UBLOX_TEST_NEAR(eph.m_deltaN, sc(BdsDeltaN, -43), tol(eph.m_deltaN));
+    UBLOX_TEST_NEAR(eph.m_cuc, p2(BdsCuc, -31), tol(eph.m_cuc));
+    UBLOX_TEST_NEAR(eph.m_m0, sc(BdsM0, -31), tol(eph.m_m0));
+    UBLOX_TEST_NEAR(eph.m_e, p2(BdsE, -33), tol(eph.m_e));
+    UBLOX_TEST_NEAR(eph.m_cus, p2(BdsCus, -31), tol(eph.m_cus));
+    UBLOX_TEST_NEAR(eph.m_crc, p2(BdsCrc, -6), tol(eph.m_crc));
+    UBLOX_TEST_NEAR(eph.m_crs, p2(BdsCrs, -6), tol(eph.m_crs));
+    UBLOX_TEST_NEAR(eph.m_sqrtA, p2(BdsSqrtA, -19), tol(eph.m_sqrtA));
+    UBLOX_TEST_NEAR(eph.m_i0, sc(BdsI0, -31), tol(eph.m_i0));
+    UBLOX_TEST_NEAR(eph.m_cic, p2(BdsCic, -31), tol(eph.m_cic));
+    UBLOX_TEST_NEAR(eph.m_omegaDot, sc(BdsOmegaDot, -43), tol(eph.m_omegaDot));
+    UBLOX_TEST_NEAR(eph.m_cis, p2(BdsCis, -31), tol(eph.m_cis));
+    UBLOX_TEST_NEAR(eph.m_iDot, sc(BdsIDot, -43), tol(eph.m_iDot));
+    UBLOX_TEST_NEAR(eph.m_omega0, sc(BdsOmega0, -31), tol(eph.m_omega0));
+    UBLOX_TEST_NEAR(eph.m_omega, sc(BdsOmega, -31), tol(eph.m_omega));
+
+    // Subframes not of the same frame
+    UBLOX_TEST_ASSERT(decodeBeiDou(decoder, 1U, BdsSow + 30U));
+    UBLOX_TEST_ASSERT(decodeBeiDou(decoder, 2U, BdsSow + 36U));
+    UBLOX_TEST_ASSERT(decodeBeiDou(decoder, 3U, BdsSow + 72U));
+    UBLOX_TEST_ASSERT(recorder.m_kepler.size() == 1U);
+    UBLOX_TEST_ASSERT(recorder.m_klobuchar.size() == 1U);
+
+    // Single bit errors are detected by BCH code
+    std::uint32_t words[10];
+    ublox::test::beiDouD1Words(bdsSubframe(2U, BdsSow), words);
+    for (std::size_t idx = 0U; idx < 10U; ++idx) {
+        for (unsigned bit = 0U; bit < ((idx == 0U) ? 15U : 30U); ++bit) {
+            words[idx] ^= (1U << bit);
+            UBLOX_TEST_ASSERT(!decoder.decode(GnssId::BeiDou, BdsSvId, 0U, &words[0], 10U));
+            words[idx] ^= (1U << bit);
+        }
+    }
+    UBLOX_TEST_ASSERT(decoder.stats().m_parityErrors == (15U + (9U * 30U)));
+
+    // D2 message of GEO satellites
+    UBLOX_TEST_ASSERT(!decoder.decode(GnssId::BeiDou, 3U, 0U, &words[0], 10U));
+    UBLOX_TEST_ASSERT(decoder.stats().m_unsupported == 1U);
+    UBLOX_TEST_ASSERT(decoder.stats().m_subframes == 6U);
+}
+
+// GLONASS parameters (raw broadcast values)
+static const unsigned GloSlot = 5U;
+static const unsigned GloFreqId = 8U;
+static const std::int64_t GloVx = -1234567;
+static const std::int64_t GloAx = -3;
+static const std::int64_t GloX = 12345678;
+static const std::int64_t GloVy = 2345678;
+static const std::int64_t GloAy = 4;
+static const std::int64_t GloY = -23456789;
+static const std::int64_t GloGamma = -5;
+static const std::int64_t GloVz = -3456789;
+static const std::int64_t GloAz = 15;
+static const std::int64_t GloZ = 34567890;
+static const std::int64_t GloTauN = -12345;
+static const std::int64_t GloDeltaTauN = 3;
+
+NavBits gloString(unsigned string, std::int64_t tauC = -123456789)
+{
+    NavBits bits;
+    bits.append(0U, 1U).append(string, 4U);
+    switch (string) {
+    case 1U:
+        bits.append(0U, 2U).append(2U, 2U).append(13U, 5U).append(47U, 6U).append(1U, 1U);
+        bits.append(signMag(GloVx, 24U), 24U).append(signMag(GloAx, 5U), 5U).append(signMag(GloX, 27U), 27U);
+        break;
+    case 2U:
+        bits.append(4U, 3U).append(1U, 1U).append(44U, 7U).append(0U, 5U);
+        bits.append(signMag(GloVy, 24U), 24U).append(signMag(GloAy, 5U), 5U).append(signMag(GloY, 27U), 27U);
+        break;
+    case 3U:
+        bits.append(1U, 1U).append(signMag(GloGamma, 11U), 11U).append(0U, 1U).append(3U, 2U).append(0U, 1U);
+        bits.append(signMag(GloVz, 24U), 24U).append(signMag(GloAz, 5U), 5U).append(signMag(GloZ, 27U), 27U);
+        break;
+    case 4U:
+        bits.append(signMag(GloTauN, 22U), 22U).append(signMag(GloDeltaTauN, 5U), 5U).append(2U, 5U);
+        bits.append(0U, 14U).append(1U, 1U).append(6U, 4U).append(0U, 3U).append(1234U, 11U);
+        bits.append(GloSlot, 5U).append(1U, 2U);
+        break;
+    case 5U:
+        bits.append(1234U, 11U).append(signMag(tauC, 32U), 32U).append(0U, 1U).append(7U, 5U);
+        bits.append(signMag(4321, 22U), 22U).append(0U, 1U);
+        break;
+    default:
+        break;
+    }
+
+    bits.padTo(77U);
+    return bits;
+}
+
+bool decodeGlonass(Decoder& decoder, const NavBits& string)
+{
+    std::uint32_t words[4];
+    ublox::test::glonassWords(string, words);
+    return decoder.decode(GnssId::Glonass, GloSlot, GloFreqId, &words[0], 4U);
+}
+
+void testGlonass()
+{
+    Recorder recorder;
+    Decoder decoder(recorder);
+    for (unsigned string = 1U; string <= 4U; ++string) {
+        UBLOX_TEST_ASSERT(recorder.m_glonass.empty());
+        UBLOX_TEST_ASSERT(decodeGlonass(decoder, gloString(string)));
+    }
+
+    static const double PosScale = p2(1000, -11);
+    static const double VelScale = p2(1000, -20);
+    static const double AccScale = p2(1000, -30);
+
+    UBLOX_TEST_ASSERT(recorder.m_glonass.size() == 1U);
+    auto& eph = recorder.m_glonass[0];
+    UBLOX_TEST_ASSERT(eph.m_svId == GloSlot);
+    UBLOX_TEST_ASSERT(eph.m_freqNum == 1);
+    UBLOX_TEST_ASSERT(eph.m_health == 1U);
+    UBLOX_TEST_ASSERT(eph.m_age == 2U);
+    UBLOX_TEST_ASSERT(eph.m_ft == 6U);
+    UBLOX_TEST_ASSERT(eph.m_nt == 1234U);
+    UBLOX_TEST_ASSERT(eph.m_m == 1U);
+    UBLOX_TEST_ASSERT(eph.m_flags == (3U | (2U << 2) | (1U << 4) | (1U << 5) | (1U << 6)));
+    UBLOX_TEST_ASSERT(eph.m_tk == ((13.0 * 3600.0) + (47.0 * 60.0) + 30.0));
+    UBLOX_TEST_ASSERT(eph.m_tb == (44.0 * 900.0));
+    UBLOX_TEST_NEAR(eph.m_x, GloX * PosScale, tol(eph.m_x));
+    UBLOX_TEST_NEAR(eph.m_y, GloY * PosScale, tol(eph.m_y));
+    UBLOX_TEST_NEAR(eph.m_z, GloZ * PosScale, tol(eph.m_z));
+    UBLOX_TEST_NEAR(eph.m_vx, GloVx * VelScale, tol(eph.m_vx));
+    UBLOX_TEST_NEAR(eph.m_vy, GloVy * VelScale, tol(eph.m_vy));
+    UBLOX_TEST_NEAR(eph.m_vz, GloVz * VelScale, tol(eph.m_vz));
+    UBLOX_TEST_NEAR(eph.m_ax, GloAx * AccScale, tol(eph.m_ax));
+    UBLOX_TEST_NEAR(eph.m_ay, GloAy * AccScale, tol(eph.m_ay));
+    UBLOX_TEST_NEAR(eph.m_az, GloAz * AccScale, tol(eph.m_az));
+    UBLOX_TEST_NEAR(eph.m_gammaN, p2(GloGamma, -40), tol(eph.m_gammaN));
+    UBLOX_TEST_NEAR(eph.m_tauN, p2(GloTauN, -30), tol(eph.m_tauN));
+    UBLOX_TEST_NEAR(eph.m_deltaTauN, p2(GloDeltaTauN, -30), tol(eph.m_deltaTauN));
+
+    // String 4 without the preceding strings of the same frame
+    UBLOX_TEST_ASSERT(decodeGlonass(decoder, gloString(1U)));
+    UBLOX_TEST_ASSERT(decodeGlonass(decoder, gloString(4U)));
+    UBLOX_TEST_ASSERT(recorder.m_glonass.size() == 1U);
+
+    UBLOX_TEST_ASSERT(decodeGlonass(decoder, gloString(5U)));
+    UBLOX_TEST_ASSERT(recorder.m_glonassTime.size() == 1U);
+    auto& params = recorder.m_glonassTime[0];
+    UBLOX_TEST_ASSERT(params.m_na == 1234U);
+    UBLOX_TEST_ASSERT(params.m_n4 == 7U);
+    UBLOX_TEST_ASSERT(params.m_tauC == p2(-123456789, -31));
+    UBLOX_TEST_ASSERT(params.m_tauGps == p2(4321, -30));
+
+    // Unchanged parameters are not reported again
+    UBLOX_TEST_ASSERT(decodeGlonass(decoder, gloString(5U)));
+    UBLOX_TEST_ASSERT(recorder.m_glonassTime.size() == 1U);
+    UBLOX_TEST_ASSERT(decodeGlonass(decoder, gloString(5U, 123456789)));
+    UBLOX_TEST_ASSERT(recorder.m_glonassTime.size() == 2U);
+    UBLOX_TEST_ASSERT(recorder.m_glonassTime[1].m_tauC == p2(123456789, -31));
+
+    // Single errors in the data bits and in the overall parity bit are
+    // detected, single error in the check bits C1 - C7 leaves the data intact
+    std::uint32_t words[4];
+    ublox::test::glonassWords(gloString(2U), words);
+    for (unsigned bit = 1U; bit < 85U; ++bit) {
+        words[bit / 32U] ^= (1U << (31U - (bit % 32U)));
+        auto checkBit = (78U <= bit);
+        UBLOX_TEST_ASSERT(decoder.decode(GnssId::Glonass, GloSlot, GloFreqId, &words[0], 4U) == checkBit);
+        words[bit / 32U] ^= (1U << (31U - (bit % 32U)));
+    }
+    UBLOX_TEST_ASSERT(decoder.stats().m_parityErrors == 77U);
+    UBLOX_TEST_ASSERT(decoder.stats().m_subframes == 16U);
+}
+
+}  // namespace
+
+int main()
+{
+    testGpsEphemeris();
+    testGpsParity();
+    testGpsIonoUtc();
+    testGpsAlmanac();
+    testRxmSfrbx();
+    testCrc24q();
+    testGalileo();
+    testBeiDou();
+    testGlonass();
+    return 0;
+}
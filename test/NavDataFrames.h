@@ -0,0 +1,271 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+/// @file
+/// @brief Encoders of the navigation data words in the layout reported by
+///     RXM-SFRBX, used by the tests and benchmarks of the navigation data
+///     decoder. Implemented directly from the interface control documents,
+///     independently of the decoder.
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <initializer_list>
+
+namespace ublox
+{
+
+namespace test
+{
+
+/// @brief MSB first sequence of bits.
+class NavBits
+{
+public:
+    /// @brief Append @b len least significant bits of the value.
+    NavBits& append(std::uint64_t value, unsigned len)
+    {
+        for (unsigned idx = len; 0U < idx; --idx) {
+            m_bits.push_back(((value >> (idx - 1U)) & 0x1U) != 0U);
+        }
+        return *this;
+    }
+
+    /// @brief Append the bits of other sequence.
+    NavBits& append(const NavBits& other, std::size_t pos, std::size_t len)
+    {
+        for (std::size_t idx = 0U; idx < len; ++idx) {
+            m_bits.push_back(other.bit(pos + idx));
+        }
+        return *this;
+    }
+
+    /// @brief Append zero bits up to specified length.
+    NavBits& padTo(std::size_t len)
+    {
+        m_bits.resize(len, false);
+        return *this;
+    }
+
+    /// @brief Value of the bit.
+    bool bit(std::size_t pos) const
+    {
+        return (pos < m_bits.size()) && m_bits[pos];
+    }
+
+    /// @brief Invert the bit.
+    void flip(std::size_t pos)
+    {
+        m_bits[pos] = !m_bits[pos];
+    }
+
+    /// @brief Read up to 32 bits.
+    std::uint32_t get(std::size_t pos, unsigned len) const
+    {
+        std::uint32_t value = 0U;
+        for (unsigned idx = 0U; idx < len; ++idx) {
+            value = (value << 1) | (bit(pos + idx) ? 1U : 0U);
+        }
+        return value;
+    }
+
+    /// @brief Number of bits.
+    std::size_t size() const
+    {
+        return m_bits.size();
+    }
+
+    /// @brief Split into 32 bit words, MSB first.
+    void toWords(std::uint32_t* words, std::size_t count) const
+    {
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            words[idx] = get(idx * 32U, 32U);
+        }
+    }
+
+private:
+    std::vector<bool> m_bits;
+};
+
+/// @brief Parity of the bits listed by their (1 based) numbers.
+inline unsigned navParityOf(const NavBits& bits, std::size_t base, std::initializer_list<unsigned> numbers)
+{
+    unsigned parity = 0U;
+    for (auto num : numbers) {
+        parity ^= bits.bit(base + num - 1U) ? 1U : 0U;
+    }
+    return parity;
+}
+
+/// @brief Encode GPS / QZSS LNAV subframe (IS-GPS-200, table 20-XIV).
+/// @param[in] data 240 source data bits (10 words of 24 bits).
+/// @param[out] words 10 words, bits D1 - D30 in bits 29 - 0.
+/// @param[in] transmitted Report the data bits as transmitted (inverted
+///     when D30* is set) instead of the source ones.
+/// @details D29* and D30* of the word preceding the subframe are 0.
+inline void gpsLnavWords(const NavBits& data, std::uint32_t* words, bool transmitted = false)
+{
+    unsigned d29 = 0U;
+    unsigned d30 = 0U;
+    for (std::size_t wordIdx = 0U; wordIdx < 10U; ++wordIdx) {
+        auto base = wordIdx * 24U;
+        unsigned parity[6] = {
+            d29 ^ navParityOf(data, base, {1, 2, 3, 5, 6, 10, 11, 12, 13, 14, 17, 18, 20, 23}),
+            d30 ^ navParityOf(data, base, {2, 3, 4, 6, 7, 11, 12, 13, 14, 15, 18, 19, 21, 24}),
+            d29 ^ navParityOf(data, base, {1, 3, 4, 5, 7, 8, 12, 13, 14, 15, 16, 19, 20, 22}),
+            d30 ^ navParityOf(data, base, {2, 4, 5, 6, 8, 9, 13, 14, 15, 16, 17, 20, 21, 23}),
+            d30 ^ navParityOf(data, base, {1, 3, 5, 6, 7, 9, 10, 14, 15, 16, 17, 18, 21, 22, 24}),
+            d29 ^ navParityOf(data, base, {3, 5, 6, 8, 9, 10, 11, 13, 15, 19, 22, 23, 24}),
+        };
+
+        auto invert = transmitted ? d30 : 0U;
+        std::uint32_t word = 0U;
+        for (unsigned idx = 0U; idx < 24U; ++idx) {
+            word = (word << 1) | ((data.bit(base + idx) ? 1U : 0U) ^ invert);
+        }
+
+        for (auto bit : parity) {
+            word = (word << 1) | bit;
+        }
+
+        words[wordIdx] = word;
+        d29 = parity[4];
+        d30 = parity[5];
+    }
+}
+
+/// @brief Bitwise CRC-24Q (generator 0x1864CFB, zero initial value).
+inline std::uint32_t navCrc24q(const NavBits& bits)
+{
+    std::uint32_t crc = 0U;
+    for (std::size_t idx = 0U; idx < bits.size(); ++idx) {
+        auto feedback = ((crc >> 23) & 0x1U) ^ (bits.bit(idx) ? 1U : 0U);
+        crc = (crc << 1) & 0xffffffU;
+        if (feedback != 0U) {
+            crc ^= 0x864cfbU;
+        }
+    }
+    return crc;
+}
+
+/// @brief Encode Galileo E1-B I/NAV nominal page pair (Galileo OS SIS ICD,
+///     4.3.2).
+/// @param[in] data 128 bits of the word (including its type).
+/// @param[out] words 8 words: even page part in the first four, odd in
+///     the last four, MSB first.
+inline void galileoInavWords(const NavBits& data, std::uint32_t* words)
+{
+    NavBits even;
+    even.append(0U, 1U).append(0U, 1U).append(data, 0U, 112U);
+
+    NavBits odd;
+    odd.append(1U, 1U).append(0U, 1U).append(data, 112U, 16U);
+    odd.append(0U, 40U).append(0U, 22U).append(0U, 2U); // Reserved 1, SAR, spare
+
+    NavBits crcBits;
+    crcBits.append(even, 0U, even.size()).append(odd, 0U, odd.size());
+    auto crc = navCrc24q(crcBits);
+
+    even.append(0U, 6U).padTo(128U); // Tail
+    odd.append(crc, 24U).append(0U, 8U).append(0U, 6U).padTo(128U); // CRC, SSP, tail
+
+    even.toWords(&words[0], 4U);
+    odd.toWords(&words[4], 4U);
+}
+
+/// @brief BCH(15,11) parity bits (generator x^4 + x + 1) of 11 information bits.
+inline std::uint32_t navBch1511(std::uint32_t info)
+{
+    std::uint32_t reg = info << 4;
+    for (int bit = 14; 4 <= bit; --bit) {
+        if ((reg & (1U << bit)) != 0U) {
+            reg ^= (0x13U << (bit - 4));
+        }
+    }
+    return reg & 0xfU;
+}
+
+/// @brief Encode BeiDou D1 subframe (BeiDou SIS ICD, 5.1.3).
+/// @param[in] data 224 information bits of the subframe (26 of the first
+///     word, 22 of the others).
+/// @param[out] words 10 words, 30 bits each in bits 29 - 0, the two code
+///     words of the words 2 - 10 deinterleaved (11 + 11 information bits
+///     followed by 4 + 4 parity bits).
+inline void beiDouD1Words(const NavBits& data, std::uint32_t* words)
+{
+    auto first = data.get(0U, 26U);
+    words[0] = (first << 4) | navBch1511(first & 0x7ffU);
+    for (std::size_t idx = 1U; idx < 10U; ++idx) {
+        auto pos = 26U + ((idx - 1U) * 22U);
+        auto info1 = data.get(pos, 11U);
+        auto info2 = data.get(pos + 11U, 11U);
+        words[idx] = (info1 << 19) | (info2 << 8) | (navBch1511(info1) << 4) | navBch1511(info2);
+    }
+}
+
+/// @brief Encode GLONASS L1OF string (GLONASS ICD, 4.7).
+/// @param[in] data 77 bits b85 - b9 of the string (idle bit, string number, data).
+/// @param[out] words 4 words, the string MSB first with b85 being the
+///     most significant bit of the first word.
+inline void glonassWords(const NavBits& data, std::uint32_t* words)
+{
+    // Bit b_k of the string
+    auto stringBit =
+        [&data](unsigned num) -> unsigned
+        {
+            return data.bit(85U - num) ? 1U : 0U;
+        };
+
+    // Data bits b9 - b85 occupy the positions of the Hamming code which
+    // are not powers of two, check bit C_k covers the positions with bit
+    // (k - 1) set.
+    unsigned checks[7] = {0U};
+    unsigned position = 2U;
+    unsigned dataParity = 0U;
+    for (unsigned num = 9U; num <= 85U; ++num) {
+        do {
+            ++position;
+        } while ((position & (position - 1U)) == 0U);
+
+        dataParity ^= stringBit(num);
+        for (unsigned check = 0U; check < 7U; ++check) {
+            if ((position & (1U << check)) != 0U) {
+                checks[check] ^= stringBit(num);
+            }
+        }
+    }
+
+    auto overall = dataParity;
+    for (auto check : checks) {
+        overall ^= check;
+    }
+
+    NavBits string;
+    string.append(data, 0U, 77U).append(overall, 1U);
+    for (unsigned check = 7U; 0U < check; --check) {
+        string.append(checks[check - 1U], 1U);
+    }
+    string.padTo(128U);
+    string.toWords(words, 4U);
+}
+
+}  // namespace test
+
+}  // namespace ublox
@@ -0,0 +1,224 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures throughput of the orbit propagation and the look angles
+// evaluation and compares it with the same algorithm evaluated satellite
+// by satellite using the library functions.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <memory>
+#include <iostream>
+
+#include "ublox/util/OrbitPropagator.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+
+typedef ublox::field::common::GnssId GnssId;
+
+static const std::size_t OrbitsCount = 32U;
+static const std::size_t SitesCount = 1000U;
+static const std::size_t EpochsCount = 60U;
+static const unsigned Iterations = 10000U;
+static const double Mu = 3.986005e14;
+static const double EarthRate = 7.2921151467e-5;
+static const double Pi = 3.14159265358979323846;
+
+// Same algorithm as OrbitPropagator::positions() (GPS only) using the
+// library functions
+void libmPositions(const std::vector<util::KeplerEphemeris>& ephs, double gpsTow, double* x, double* y, double* z)
+{
+    for (std::size_t idx = 0U; idx < ephs.size(); ++idx) {
+        auto& eph = ephs[idx];
+        auto tk = gpsTow - eph.m_toe;
+        tk -= 604800.0 * std::round(tk / 604800.0);
+        auto a = eph.m_sqrtA * eph.m_sqrtA;
+        auto mk = eph.m_m0 + ((std::sqrt(Mu / (a * a * a)) + eph.m_deltaN) * tk);
+        auto ek = mk + (eph.m_e * std::sin(mk));
+        for (unsigned iter = 0U; iter < util::OrbitPropagator::KeplerIterations; ++iter) {
+            ek -= (ek - (eph.m_e * std::sin(ek)) - mk) / (1.0 - (eph.m_e * std::cos(ek)));
+        }
+
+        auto phi = std::atan2(std::sqrt(1.0 - (eph.m_e * eph.m_e)) * std::sin(ek), std::cos(ek) - eph.m_e) + eph.m_omega;
+        auto sin2Phi = std::sin(2.0 * phi);
+        auto cos2Phi = std::cos(2.0 * phi);
+        auto uk = phi + (eph.m_cus * sin2Phi) + (eph.m_cuc * cos2Phi);
+        auto rk = (a * (1.0 - (eph.m_e * std::cos(ek)))) + (eph.m_crs * sin2Phi) + (eph.m_crc * cos2Phi);
+        auto ik = eph.m_i0 + (eph.m_iDot * tk) + (eph.m_cis * sin2Phi) + (eph.m_cic * cos2Phi);
+        auto omegaK = eph.m_omega0 + ((eph.m_omegaDot - EarthRate) * tk) - (EarthRate * eph.m_toe);
+        auto xp = rk * std::cos(uk);
+        auto yp = rk * std::sin(uk);
+        x[idx] = (xp * std::cos(omegaK)) - (yp * std::cos(ik) * std::sin(omegaK));
+        y[idx] = (xp * std::sin(omegaK)) + (yp * std::cos(ik) * std::cos(omegaK));
+        z[idx] = yp * std::sin(ik);
+    }
+}
+
+// Same algorithm as OrbitPropagator::lookAngles() using the library functions
+void libmLookAngles(
+    double lat,
+    double lon,
+    double sx,
+    double sy,
+    double sz,
+    const double* x,
+    const double* y,
+    const double* z,
+    float* azDeg,
+    float* elDeg)
+{
+    auto sinLat = std::sin(lat * Pi / 180.0);
+    auto cosLat = std::cos(lat * Pi / 180.0);
+    auto sinLon = std::sin(lon * Pi / 180.0);
+    auto cosLon = std::cos(lon * Pi / 180.0);
+    for (std::size_t idx = 0U; idx < OrbitsCount; ++idx) {
+        auto dx = x[idx] - sx;
+        auto dy = y[idx] - sy;
+        auto dz = z[idx] - sz;
+        auto east = (dy * cosLon) - (dx * sinLon);
+        auto along = (dx * cosLon) + (dy * sinLon);
+        auto north = (dz * cosLat) - (along * sinLat);
+        auto up = (dz * sinLat) + (along * cosLat);
+        azDeg[idx] = static_cast<float>(180.0 + (std::atan2(-east, -north) * 180.0 / Pi));
+        elDeg[idx] = static_cast<float>(std::atan2(up, std::sqrt((east * east) + (north * north))) * 180.0 / Pi);
+    }
+}
+
+template <typename TFunc>
+void report(const char* name, std::size_t itemsCount, const char* unit, TFunc&& func)
+{
+    auto ns = ublox::test::measureNs(std::forward<TFunc>(func));
+    std::cout << name << ": " << ns / static_cast<double>(itemsCount) << " ns/" << unit << std::endl;
+}
+
+}  // namespace
+
+int main()
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<util::KeplerEphemeris> ephs;
+    std::unique_ptr<util::OrbitPropagator> prop(new util::OrbitPropagator);
+    for (std::size_t idx = 0U; idx < OrbitsCount; ++idx) {
+        util::KeplerEphemeris eph = util::KeplerEphemeris();
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::Gps);
+        eph.m_svId = static_cast<std::uint8_t>(idx + 1U);
+        eph.m_toe = 345600.0 + (7200.0 * dist(gen));
+        eph.m_sqrtA = 5153.6;
+        eph.m_e = 0.02 * std::abs(dist(gen));
+        eph.m_i0 = 0.96 + (0.05 * dist(gen));
+        eph.m_omega0 = 3.0 * dist(gen);
+        eph.m_omega = 3.0 * dist(gen);
+        eph.m_m0 = 3.0 * dist(gen);
+        eph.m_omegaDot = -8e-9;
+        eph.m_crc = 300.0 * dist(gen);
+        eph.m_crs = 100.0 * dist(gen);
+        ephs.push_back(eph);
+        UBLOX_TEST_ASSERT(prop->add(eph));
+    }
+
+    std::vector<double> lat(SitesCount);
+    std::vector<double> lon(SitesCount);
+    std::vector<double> height(SitesCount);
+    for (std::size_t idx = 0U; idx < SitesCount; ++idx) {
+        lat[idx] = 89.0 * dist(gen);
+        lon[idx] = 180.0 * dist(gen);
+        height[idx] = 1000.0 * std::abs(dist(gen));
+    }
+    prop->setSites(&lat[0], &lon[0], &height[0], SitesCount);
+
+    std::vector<double> x(OrbitsCount);
+    std::vector<double> y(OrbitsCount);
+    std::vector<double> z(OrbitsCount);
+    report("positions (libm)", Iterations * OrbitsCount, "orbit",
+        [&]()
+        {
+            for (auto iter = 0U; iter < Iterations; ++iter) {
+                libmPositions(ephs, 345600.0 + iter, &x[0], &y[0], &z[0]);
+                ublox::test::doNotOptimise(x);
+            }
+        });
+
+    std::vector<double> libmX(x);
+    report("positions", Iterations * OrbitsCount, "orbit",
+        [&]()
+        {
+            for (auto iter = 0U; iter < Iterations; ++iter) {
+                prop->positions(345600.0 + iter, &x[0], &y[0], &z[0]);
+                ublox::test::doNotOptimise(x);
+            }
+        });
+
+    for (std::size_t idx = 0U; idx < OrbitsCount; ++idx) {
+        UBLOX_TEST_NEAR(x[idx], libmX[idx], 1e-4);
+    }
+
+    std::vector<double> siteX(SitesCount);
+    std::vector<double> siteY(SitesCount);
+    std::vector<double> siteZ(SitesCount);
+    util::geodesy::geodeticToEcef(&lat[0], &lon[0], &height[0], SitesCount, &siteX[0], &siteY[0], &siteZ[0]);
+    std::vector<float> az(SitesCount * OrbitsCount);
+    std::vector<float> el(az.size());
+    report("lookAngles (libm)", SitesCount * OrbitsCount, "look angle",
+        [&]()
+        {
+            for (std::size_t site = 0U; site < SitesCount; ++site) {
+                libmLookAngles(
+                    lat[site], lon[site], siteX[site], siteY[site], siteZ[site], &x[0], &y[0], &z[0],
+                    &az[site * OrbitsCount], &el[site * OrbitsCount]);
+            }
+            ublox::test::doNotOptimise(az);
+        });
+
+    std::vector<float> libmEl(el);
+    report("lookAngles", SitesCount * OrbitsCount, "look angle",
+        [&]()
+        {
+            for (std::size_t site = 0U; site < SitesCount; ++site) {
+                prop->lookAngles(
+                    site, &x[0], &y[0], &z[0], OrbitsCount, &az[site * OrbitsCount], &el[site * OrbitsCount]);
+            }
+            ublox::test::doNotOptimise(az);
+        });
+
+    for (std::size_t idx = 0U; idx < el.size(); ++idx) {
+        UBLOX_TEST_NEAR(el[idx], libmEl[idx], 1e-4f);
+    }
+
+    std::vector<double> epochs(EpochsCount);
+    for (std::size_t idx = 0U; idx < EpochsCount; ++idx) {
+        epochs[idx] = 345600.0 + (60.0 * idx);
+    }
+
+    std::vector<float> allAz(EpochsCount * SitesCount * OrbitsCount);
+    std::vector<float> allEl(allAz.size());
+    report("propagate", allAz.size(), "look angle",
+        [&]()
+        {
+            prop->propagate(&epochs[0], EpochsCount, &allAz[0], &allEl[0]);
+            ublox::test::doNotOptimise(allAz);
+        });
+    return 0;
+}
@@ -0,0 +1,335 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the error bounds of the vectorisable approximations of the
+// mathematical functions and of the orbit propagation using them against
+// the reference computed by the library functions in extended precision.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <memory>
+
+#include "ublox/util/OrbitPropagator.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace geodesy = ublox::util::geodesy;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef long double Real;
+typedef std::unique_ptr<util::OrbitPropagator> OrbitPropagatorPtr;
+
+static const Real Pi = 3.141592653589793238462643383279502884L;
+static const std::size_t SitesCount = 100U;
+
+void testSqrt()
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> exponentDist(-250.0, 250.0);
+    for (std::size_t idx = 0U; idx < 100000U; ++idx) {
+        auto value = std::pow(10.0, exponentDist(gen));
+        auto expected = std::sqrt(static_cast<Real>(value));
+        auto relErr = (util::details::vecSqrt(value) - expected) / expected;
+        UBLOX_TEST_NEAR(relErr, 0.0L, 2.3e-16L); // 1 ulp
+    }
+
+    UBLOX_TEST_NEAR(util::details::vecSqrt(0.0), 0.0, 1e-149);
+    UBLOX_TEST_ASSERT(util::details::vecSqrt(4.0) == 2.0);
+}
+
+void testSinCos()
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> smallDist(-10.0, 10.0);
+    std::uniform_real_distribution<double> largeDist(-util::details::VecMaxAngle, util::details::VecMaxAngle);
+    for (std::size_t idx = 0U; idx < 200000U; ++idx) {
+        auto angle = ((idx & 1U) == 0U) ? smallDist(gen) : largeDist(gen);
+        double sinValue = 0.0;
+        double cosValue = 0.0;
+        util::details::vecSinCos(angle, sinValue, cosValue);
+        UBLOX_TEST_NEAR(sinValue, std::sin(static_cast<Real>(angle)), 1e-15L);
+        UBLOX_TEST_NEAR(cosValue, std::cos(static_cast<Real>(angle)), 1e-15L);
+    }
+
+    // Quadrant boundaries
+    for (int quadrant = -8; quadrant <= 8; ++quadrant) {
+        auto angle = quadrant * static_cast<double>(Pi / 2);
+        double sinValue = 0.0;
+        double cosValue = 0.0;
+        util::details::vecSinCos(angle, sinValue, cosValue);
+        UBLOX_TEST_NEAR(sinValue, std::sin(static_cast<Real>(angle)), 1e-15L);
+        UBLOX_TEST_NEAR(cosValue, std::cos(static_cast<Real>(angle)), 1e-15L);
+    }
+}
+
+void testAtan2()
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::uniform_real_distribution<double> exponentDist(-12.0, 12.0);
+    for (std::size_t idx = 0U; idx < 200000U; ++idx) {
+        auto y = dist(gen) * std::pow(10.0, exponentDist(gen));
+        auto x = dist(gen) * std::pow(10.0, exponentDist(gen));
+        UBLOX_TEST_NEAR(util::details::vecAtan2(y, x), std::atan2(static_cast<Real>(y), static_cast<Real>(x)), 1e-15L);
+    }
+
+    // Axes and diagonals
+    static const double Special[][2] = {
+        {0.0, 1.0},
+        {1.0, 0.0},
+        {0.0, -1.0},
+        {-1.0, 0.0},
+        {1.0, 1.0},
+        {-1.0, -1.0},
+        {1.0, -1.0},
+        {-1.0, 1.0},
+        {0.0, 0.0}
+    };
+
+    for (auto& point : Special) {
+        UBLOX_TEST_NEAR(
+            util::details::vecAtan2(point[0], point[1]),
+            std::atan2(static_cast<Real>(point[0]), static_cast<Real>(point[1])), 1e-15L);
+    }
+}
+
+bool isBdsGeo(const util::KeplerEphemeris& eph)
+{
+    return (eph.m_gnssId == static_cast<std::uint8_t>(GnssId::BeiDou)) &&
+           ((eph.m_svId <= 5U) || (59U <= eph.m_svId));
+}
+
+// Straightforward evaluation of IS-GPS-200 / BDS-SIS-ICD algorithm
+void referencePosition(const util::KeplerEphemeris& eph, Real gpsTow, Real& x, Real& y, Real& z)
+{
+    auto bds = (eph.m_gnssId == static_cast<std::uint8_t>(GnssId::BeiDou));
+    auto gps =
+        (eph.m_gnssId == static_cast<std::uint8_t>(GnssId::Gps)) ||
+        (eph.m_gnssId == static_cast<std::uint8_t>(GnssId::Qzss));
+    Real mu = gps ? 3.986005e14L : 3.986004418e14L;
+    Real earthRate = bds ? 7.292115e-5L : 7.2921151467e-5L;
+    Real toe = eph.m_toe + (bds ? 14 : 0);
+    auto tk = gpsTow - toe;
+    if (302400 < tk) {
+        tk -= 604800;
+    }
+    if (tk < -302400) {
+        tk += 604800;
+    }
+
+    Real a = static_cast<Real>(eph.m_sqrtA) * eph.m_sqrtA;
+    auto n = std::sqrt(mu / (a * a * a)) + eph.m_deltaN;
+    auto mk = eph.m_m0 + (n * tk);
+    auto ek = mk;
+    for (unsigned iter = 0U; iter < 50U; ++iter) {
+        ek = mk + (eph.m_e * std::sin(ek));
+    }
+
+    Real e = eph.m_e;
+    auto nu = std::atan2(std::sqrt(1 - (e * e)) * std::sin(ek), std::cos(ek) - e);
+    auto phi = nu + eph.m_omega;
+    auto uk = phi + (eph.m_cus * std::sin(2 * phi)) + (eph.m_cuc * std::cos(2 * phi));
+    auto rk = (a * (1 - (e * std::cos(ek)))) + (eph.m_crs * std::sin(2 * phi)) + (eph.m_crc * std::cos(2 * phi));
+    auto ik = eph.m_i0 + (eph.m_iDot * tk) + (eph.m_cis * std::sin(2 * phi)) + (eph.m_cic * std::cos(2 * phi));
+    auto xp = rk * std::cos(uk);
+    auto yp = rk * std::sin(uk);
+
+    auto geo = isBdsGeo(eph);
+    auto omegaK = eph.m_omega0 + ((eph.m_omegaDot - (geo ? 0 : earthRate)) * tk) - (earthRate * eph.m_toe);
+    auto xk = (xp * std::cos(omegaK)) - (yp * std::cos(ik) * std::sin(omegaK));
+    auto yk = (xp * std::sin(omegaK)) + (yp * std::cos(ik) * std::cos(omegaK));
+    auto zk = yp * std::sin(ik);
+    if (!geo) {
+        x = xk;
+        y = yk;
+        z = zk;
+        return;
+    }
+
+    auto f = -5 * Pi / 180;
+    auto theta = earthRate * tk;
+    auto yg = (yk * std::cos(f)) + (zk * std::sin(f));
+    auto zg = (zk * std::cos(f)) - (yk * std::sin(f));
+    x = (xk * std::cos(theta)) + (yg * std::sin(theta));
+    y = (yg * std::cos(theta)) - (xk * std::sin(theta));
+    z = zg;
+}
+
+std::vector<util::KeplerEphemeris> makeEphemerides()
+{
+    struct System
+    {
+        GnssId m_gnssId;
+        unsigned m_count;
+        double m_sqrtA;
+        double m_maxE;
+    };
+
+    static const System Systems[] = {
+        {GnssId::Gps, 32U, 5153.6, 0.03},
+        {GnssId::Galileo, 36U, 5440.6, 0.001},
+        {GnssId::BeiDou, 63U, 5282.6, 0.01},
+        {GnssId::Qzss, 7U, 6493.0, 0.08}
+    };
+
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<util::KeplerEphemeris> ephs;
+    for (auto& system : Systems) {
+        for (unsigned svId = 1U; svId <= system.m_count; ++svId) {
+            util::KeplerEphemeris eph = util::KeplerEphemeris();
+            eph.m_gnssId = static_cast<std::uint8_t>(system.m_gnssId);
+            eph.m_svId = static_cast<std::uint8_t>(svId);
+            eph.m_toe = 345600.0 + (7200.0 * dist(gen));
+            eph.m_sqrtA = system.m_sqrtA;
+            eph.m_e = system.m_maxE * std::abs(dist(gen));
+            eph.m_i0 = 0.96 + (0.05 * dist(gen));
+            if (isBdsGeo(eph)) {
+                eph.m_sqrtA = 6493.4;
+                eph.m_i0 = 0.1 * dist(gen);
+            }
+            eph.m_omega0 = 3.0 * dist(gen);
+            eph.m_omega = 3.0 * dist(gen);
+            eph.m_m0 = 3.0 * dist(gen);
+            eph.m_deltaN = 5e-9 * dist(gen);
+            eph.m_omegaDot = -8e-9 + (1e-10 * dist(gen));
+            eph.m_iDot = 1e-10 * dist(gen);
+            eph.m_cuc = 1e-5 * dist(gen);
+            eph.m_cus = 1e-5 * dist(gen);
+            eph.m_crc = 300.0 * dist(gen);
+            eph.m_crs = 100.0 * dist(gen);
+            eph.m_cic = 1e-7 * dist(gen);
+            eph.m_cis = 1e-7 * dist(gen);
+            ephs.push_back(eph);
+        }
+    }
+    return ephs;
+}
+
+void testPositions(const OrbitPropagatorPtr& prop, const std::vector<util::KeplerEphemeris>& ephs)
+{
+    // Including the epochs more than half a week away from the references
+    static const double Epochs[] = {345600.0, 352800.0, 604799.0, 0.0, 43200.0};
+    auto count = prop->count();
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    for (auto gpsTow : Epochs) {
+        prop->positions(gpsTow, &x[0], &y[0], &z[0]);
+        for (std::size_t idx = 0U; idx < count; ++idx) {
+            Real refX = 0;
+            Real refY = 0;
+            Real refZ = 0;
+            referencePosition(ephs[idx], gpsTow, refX, refY, refZ);
+
+            static const Real Tolerance = 1e-4; // m
+            UBLOX_TEST_NEAR(x[idx], refX, Tolerance);
+            UBLOX_TEST_NEAR(y[idx], refY, Tolerance);
+            UBLOX_TEST_NEAR(z[idx], refZ, Tolerance);
+        }
+    }
+}
+
+void testLookAngles(const OrbitPropagatorPtr& prop, const std::vector<util::KeplerEphemeris>& ephs)
+{
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> latDist(-89.0, 89.0);
+    std::uniform_real_distribution<double> lonDist(-180.0, 180.0);
+    std::uniform_real_distribution<double> heightDist(-100.0, 5000.0);
+    std::vector<double> lat;
+    std::vector<double> lon;
+    std::vector<double> height;
+    for (std::size_t idx = 0U; idx < SitesCount; ++idx) {
+        lat.push_back(latDist(gen));
+        lon.push_back(lonDist(gen));
+        height.push_back(heightDist(gen));
+    }
+    prop->setSites(&lat[0], &lon[0], &height[0], SitesCount);
+
+    static const double Epochs[] = {345600.0, 346500.0, 400000.0};
+    static const std::size_t EpochsCount = sizeof(Epochs) / sizeof(Epochs[0]);
+    auto count = prop->count();
+    std::vector<float> az(EpochsCount * SitesCount * count);
+    std::vector<float> el(az.size());
+    prop->propagate(&Epochs[0], EpochsCount, &az[0], &el[0]);
+
+    std::size_t visible = 0U;
+    for (std::size_t epoch = 0U; epoch < EpochsCount; ++epoch) {
+        for (std::size_t site = 0U; site < SitesCount; ++site) {
+            double sx = 0.0;
+            double sy = 0.0;
+            double sz = 0.0;
+            geodesy::geodeticToEcef(&lat[site], &lon[site], &height[site], 1U, &sx, &sy, &sz);
+            auto latRad = lat[site] * Pi / 180;
+            auto lonRad = lon[site] * Pi / 180;
+            for (std::size_t idx = 0U; idx < count; ++idx) {
+                Real x = 0;
+                Real y = 0;
+                Real z = 0;
+                referencePosition(ephs[idx], Epochs[epoch], x, y, z);
+                auto dx = x - sx;
+                auto dy = y - sy;
+                auto dz = z - sz;
+                auto east = (dy * std::cos(lonRad)) - (dx * std::sin(lonRad));
+                auto along = (dx * std::cos(lonRad)) + (dy * std::sin(lonRad));
+                auto north = (dz * std::cos(latRad)) - (along * std::sin(latRad));
+                auto up = (dz * std::sin(latRad)) + (along * std::cos(latRad));
+                auto refAz = std::atan2(east, north) * 180 / Pi;
+                auto refEl = std::atan2(up, std::sqrt((east * east) + (north * north))) * 180 / Pi;
+
+                // Single precision output dominates
+                static const Real Tolerance = 1e-4; // deg
+                auto outIdx = ((epoch * SitesCount) + site) * count + idx;
+                UBLOX_TEST_NEAR(el[outIdx], refEl, Tolerance);
+                UBLOX_TEST_ASSERT((0.0f <= az[outIdx]) && (az[outIdx] <= 360.0f));
+                auto azDiff = az[outIdx] - refAz;
+                azDiff -= 360 * std::round(azDiff / 360);
+                UBLOX_TEST_NEAR(azDiff * std::cos(refEl * Pi / 180), 0.0L, Tolerance);
+                if (0 < refEl) {
+                    ++visible;
+                }
+            }
+        }
+    }
+    UBLOX_TEST_ASSERT(0U < visible);
+}
+
+}  // namespace
+
+int main()
+{
+    testSqrt();
+    testSinCos();
+    testAtan2();
+
+    auto ephs = makeEphemerides();
+    OrbitPropagatorPtr prop(new util::OrbitPropagator);
+    for (auto& eph : ephs) {
+        UBLOX_TEST_ASSERT(prop->add(eph));
+    }
+    UBLOX_TEST_ASSERT(prop->count() == ephs.size());
+    testPositions(prop, ephs);
+    testLookAngles(prop, ephs);
+    return 0;
+}
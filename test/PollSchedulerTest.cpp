@@ -0,0 +1,229 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the periodic poll scheduler: coalescing of the due polls into
+// single write, phase of the schedule, skipped and lost polls, and the
+// latency statistics.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "ublox/util/PollScheduler.h"
+#include "ublox/message/CfgRate.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+struct Output
+{
+    void operator()(const std::uint8_t* data, std::size_t len)
+    {
+        m_writes->push_back(std::vector<std::uint8_t>(data, data + len));
+    }
+
+    std::vector<std::vector<std::uint8_t> >* m_writes;
+};
+
+typedef util::PollScheduler<Output> Scheduler;
+
+std::vector<std::uint8_t> pollFrame(ublox::MsgId id)
+{
+    std::vector<std::uint8_t> frame;
+    util::details::appendFrame(id, nullptr, 0U, frame);
+    return frame;
+}
+
+void testCoalescing()
+{
+    std::vector<std::vector<std::uint8_t> > writes;
+    Scheduler scheduler(Output{&writes});
+    UBLOX_TEST_ASSERT(scheduler.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 1000) == 0U);
+    UBLOX_TEST_ASSERT(scheduler.addRaw(ublox::MsgId_NAV_CLOCK, nullptr, 0U, 1000) == 1U);
+    UBLOX_TEST_ASSERT(scheduler.add(message::CfgRate<>(), 500) == 2U);
+    UBLOX_TEST_ASSERT(scheduler.addRaw(ublox::MsgId_MON_RXBUF, nullptr, 0U, 1000, 300) == 3U);
+    UBLOX_TEST_ASSERT(scheduler.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 0) == Scheduler::InvalidPoll);
+    UBLOX_TEST_ASSERT(scheduler.count() == 4U);
+    UBLOX_TEST_ASSERT(scheduler.id(2U) == ublox::MsgId_CFG_RATE);
+
+    // All the due polls in single write, in order of addition
+    scheduler.tick(10000);
+    UBLOX_TEST_ASSERT(writes.size() == 1U);
+    UBLOX_TEST_ASSERT(scheduler.writes() == 1U);
+    auto expected = pollFrame(ublox::MsgId_MON_HW);
+    auto frame = pollFrame(ublox::MsgId_NAV_CLOCK);
+    expected.insert(expected.end(), frame.begin(), frame.end());
+    std::vector<std::uint8_t> payload;
+    UBLOX_TEST_ASSERT(util::details::writePayload(message::CfgRate<>(), payload));
+    util::details::appendFrame(ublox::MsgId_CFG_RATE, payload.data(), payload.size(), expected);
+    UBLOX_TEST_ASSERT(writes[0] == expected);
+    UBLOX_TEST_ASSERT(scheduler.nextDueMs() == 10300);
+
+    // Nothing due, no write
+    scheduler.tick(10200);
+    UBLOX_TEST_ASSERT(writes.size() == 1U);
+
+    scheduler.tick(10300);
+    UBLOX_TEST_ASSERT(writes.size() == 2U);
+    UBLOX_TEST_ASSERT(writes[1] == pollFrame(ublox::MsgId_MON_RXBUF));
+    UBLOX_TEST_ASSERT(scheduler.nextDueMs() == 10500);
+
+    // Message handled at the time of the last tick
+    scheduler.handle(message::CfgRate<>());
+    UBLOX_TEST_ASSERT(!scheduler.pending(2U));
+    UBLOX_TEST_ASSERT(scheduler.stats(2U).m_responses == 1U);
+    UBLOX_TEST_ASSERT(scheduler.stats(2U).m_lastLatencyMs == 300);
+
+    // Poll added later is scheduled since the last tick
+    for (std::size_t idx = 0U; idx < scheduler.count(); ++idx) {
+        if (idx == 2U) {
+            continue;
+        }
+
+        UBLOX_TEST_ASSERT(scheduler.received(scheduler.id(idx), 10400));
+    }
+    UBLOX_TEST_ASSERT(scheduler.addRaw(ublox::MsgId_NAV_CLOCK, nullptr, 0U, 1000, 700) == 4U);
+    scheduler.tick(11000);
+    UBLOX_TEST_ASSERT(writes.size() == 3U);
+
+    // In order of the due time, the late occurrence first
+    expected.clear();
+    util::details::appendFrame(ublox::MsgId_CFG_RATE, payload.data(), payload.size(), expected);
+    for (auto id : {ublox::MsgId_MON_HW, ublox::MsgId_NAV_CLOCK, ublox::MsgId_NAV_CLOCK}) {
+        frame = pollFrame(id);
+        expected.insert(expected.end(), frame.begin(), frame.end());
+    }
+    UBLOX_TEST_ASSERT(writes[2] == expected);
+    UBLOX_TEST_ASSERT(scheduler.stats(4U).m_sent == 1U);
+    UBLOX_TEST_ASSERT(scheduler.stats(2U).m_sent == 2U);
+    UBLOX_TEST_ASSERT(scheduler.nextDueMs() == 11300);
+}
+
+void testPhase()
+{
+    std::vector<std::vector<std::uint8_t> > writes;
+    Scheduler scheduler(Output{&writes});
+    scheduler.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 100, 50);
+    scheduler.tick(0);
+    UBLOX_TEST_ASSERT(writes.empty());
+    UBLOX_TEST_ASSERT(scheduler.nextDueMs() == 50);
+
+    scheduler.tick(50);
+    UBLOX_TEST_ASSERT(writes.size() == 1U);
+    scheduler.received(ublox::MsgId_MON_HW, 60);
+
+    // Late tick sends once, the missed occurrences are not caught up
+    scheduler.tick(370);
+    UBLOX_TEST_ASSERT(writes.size() == 2U);
+    UBLOX_TEST_ASSERT(scheduler.nextDueMs() == 450);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_sent == 2U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_skipped == 0U);
+}
+
+void testSkipAndLost()
+{
+    static const std::int64_t TimeoutMs = 1000;
+
+    std::vector<std::vector<std::uint8_t> > writes;
+    Scheduler scheduler(Output{&writes}, TimeoutMs);
+    scheduler.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 100);
+
+    // Pending poll isn't repeated until the timeout
+    for (std::int64_t nowMs = 0; nowMs < TimeoutMs; nowMs += 100) {
+        scheduler.tick(nowMs);
+    }
+    UBLOX_TEST_ASSERT(writes.size() == 1U);
+    UBLOX_TEST_ASSERT(scheduler.pending(0U));
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_sent == 1U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_skipped == 9U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_lost == 0U);
+
+    scheduler.tick(TimeoutMs);
+    UBLOX_TEST_ASSERT(writes.size() == 2U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_sent == 2U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_lost == 1U);
+
+    // Response to the repeated request
+    UBLOX_TEST_ASSERT(scheduler.received(ublox::MsgId_MON_HW, TimeoutMs + 40));
+    UBLOX_TEST_ASSERT(!scheduler.pending(0U));
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_lastLatencyMs == 40);
+    UBLOX_TEST_ASSERT(!scheduler.received(ublox::MsgId_MON_HW, TimeoutMs + 50));
+
+    scheduler.tick(TimeoutMs + 100);
+    UBLOX_TEST_ASSERT(writes.size() == 3U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_skipped == 9U);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).m_lost == 1U);
+}
+
+void testLatency()
+{
+    std::vector<std::vector<std::uint8_t> > writes;
+    Scheduler scheduler(Output{&writes});
+    scheduler.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 1000);
+    UBLOX_TEST_ASSERT(scheduler.stats(0U).meanLatencyMs() == 0.0);
+
+    static const std::int64_t Latencies[] = {20, 50, 30};
+    std::int64_t startMs = 0;
+    for (auto latencyMs : Latencies) {
+        scheduler.tick(startMs);
+        UBLOX_TEST_ASSERT(scheduler.received(ublox::MsgId_MON_HW, startMs + latencyMs));
+        startMs += 1000;
+    }
+
+    auto& stats = scheduler.stats(0U);
+    UBLOX_TEST_ASSERT(stats.m_responses == 3U);
+    UBLOX_TEST_ASSERT(stats.m_minLatencyMs == 20);
+    UBLOX_TEST_ASSERT(stats.m_maxLatencyMs == 50);
+    UBLOX_TEST_ASSERT(stats.m_lastLatencyMs == 30);
+    UBLOX_TEST_ASSERT(stats.m_totalLatencyMs == 100);
+    UBLOX_TEST_NEAR(stats.meanLatencyMs(), 100.0 / 3.0, 1e-9);
+
+    scheduler.tick(3000);
+    UBLOX_TEST_ASSERT(!scheduler.received(ublox::MsgId_NAV_CLOCK, 3010));
+    UBLOX_TEST_ASSERT(scheduler.pending(0U));
+
+    // Responses of the same ID complete the oldest pending poll first
+    std::vector<std::vector<std::uint8_t> > sameWrites;
+    Scheduler same(Output{&sameWrites});
+    same.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 1000, 100);
+    same.addRaw(ublox::MsgId_MON_HW, nullptr, 0U, 1000);
+    same.tick(0);
+    same.tick(100);
+    UBLOX_TEST_ASSERT(same.received(ublox::MsgId_MON_HW, 150));
+    UBLOX_TEST_ASSERT(same.pending(0U));
+    UBLOX_TEST_ASSERT(!same.pending(1U));
+    UBLOX_TEST_ASSERT(same.stats(1U).m_lastLatencyMs == 150);
+    UBLOX_TEST_ASSERT(same.received(ublox::MsgId_MON_HW, 160));
+    UBLOX_TEST_ASSERT(!same.pending(0U));
+    UBLOX_TEST_ASSERT(same.stats(0U).m_lastLatencyMs == 60);
+}
+
+}  // namespace
+
+int main()
+{
+    testCoalescing();
+    testPhase();
+    testSkipAndLost();
+    testLatency();
+    return 0;
+}
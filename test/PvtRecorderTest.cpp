@@ -0,0 +1,230 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the NAV-PVT recording into compressed columnar blocks: round trip
+// of all the columns and compression ratio of typical 1 Hz drive.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <iostream>
+
+#include "ublox/util/PvtRecorder.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+
+typedef ublox::message::NavPvt<> NavPvt;
+typedef ublox::field::nav::GpsFix GpsFix;
+
+static const std::size_t ColumnsCount = static_cast<std::size_t>(util::PvtColumn::NumOfValues);
+static const std::size_t NavPvtPayloadLen = 92U;
+
+typedef std::vector<std::vector<std::int64_t> > Columns;
+
+// Vehicle driving along the circle, reporting every second
+NavPvt makeRow(std::size_t row)
+{
+    static const double Pi = 3.14159265358979323846;
+    auto angle = static_cast<double>(row) * 2.0 * Pi / 600.0;
+
+    NavPvt msg;
+    msg.field_iTOW().value() = static_cast<std::uint32_t>(345600000U + (row * 1000U));
+    msg.field_year().value() = 2017U;
+    msg.field_month().value() = 6U;
+    msg.field_day().value() = 15U;
+    msg.field_hour().value() = static_cast<std::uint8_t>(23U + ((row + 3000U) / 3600U)) % 24U;
+    msg.field_min().value() = static_cast<std::uint8_t>(((row + 3000U) / 60U) % 60U);
+    msg.field_sec().value() = static_cast<std::uint8_t>(row % 60U);
+    msg.field_valid().value() = 0x7U;
+    msg.field_tAcc().value() = static_cast<std::uint32_t>(20U + (row % 7U));
+    msg.field_nano().value() = static_cast<std::int32_t>(row % 5U) - 2;
+    msg.field_fixType().value() = GpsFix::Fix_3D;
+    msg.field_flags2().value() = 0xeU;
+    msg.field_numSV().value() = static_cast<std::uint8_t>(14U + ((row / 50U) % 3U));
+    msg.field_lon().value() = 1512093450 + static_cast<std::int32_t>(std::lround(std::cos(angle) * 90000.0));
+    msg.field_lat().value() = -338688170 + static_cast<std::int32_t>(std::lround(std::sin(angle) * 90000.0));
+    msg.field_height().value() = 58230 + static_cast<std::int32_t>(row % 13U);
+    msg.field_hMSL().value() = 36120 + static_cast<std::int32_t>(row % 13U);
+    msg.field_hAcc().value() = 1530U + static_cast<std::uint32_t>(row % 11U);
+    msg.field_vAcc().value() = 2410U + static_cast<std::uint32_t>(row % 11U);
+    msg.field_velN().value() = static_cast<std::int32_t>(std::lround(std::cos(angle) * 1571.0));
+    msg.field_velE().value() = static_cast<std::int32_t>(std::lround(-std::sin(angle) * 1571.0));
+    msg.field_velD().value() = static_cast<std::int32_t>(row % 3U) - 1;
+    msg.field_gSpeed().value() = 1571;
+    msg.field_headMot().value() = static_cast<std::int32_t>((row * 60000U) % 36000000U);
+    msg.field_sAcc().value() = 300U;
+    msg.field_headAcc().value() = 500000U;
+    msg.field_pDOP().value() = static_cast<std::uint16_t>(132U + ((row / 30U) % 4U));
+    if ((row % 2U) == 0U) {
+        msg.field_headVeh().setMode(comms::field::OptionalMode::Exists);
+        msg.field_headVeh().field().value() = static_cast<std::int32_t>(row * 100U);
+    }
+    return msg;
+}
+
+// Expected values of the columns, taken from the messages the same way
+// the recorder does
+void appendExpected(const NavPvt& msg, Columns& columns)
+{
+    std::int64_t headVeh = 0;
+    if (msg.field_headVeh().getMode() == comms::field::OptionalMode::Exists) {
+        headVeh = msg.field_headVeh().field().value();
+    }
+
+    const std::int64_t values[] = {
+        msg.field_iTOW().value(),
+        msg.field_year().value(),
+        msg.field_month().value(),
+        msg.field_day().value(),
+        msg.field_hour().value(),
+        msg.field_min().value(),
+        msg.field_sec().value(),
+        msg.field_valid().value(),
+        msg.field_tAcc().value(),
+        msg.field_nano().value(),
+        static_cast<std::int64_t>(msg.field_fixType().value()),
+        util::details::packedValue(msg.field_flags()),
+        msg.field_flags2().value(),
+        msg.field_numSV().value(),
+        msg.field_lon().value(),
+        msg.field_lat().value(),
+        msg.field_height().value(),
+        msg.field_hMSL().value(),
+        msg.field_hAcc().value(),
+        msg.field_vAcc().value(),
+        msg.field_velN().value(),
+        msg.field_velE().value(),
+        msg.field_velD().value(),
+        msg.field_gSpeed().value(),
+        msg.field_headMot().value(),
+        msg.field_sAcc().value(),
+        msg.field_headAcc().value(),
+        msg.field_pDOP().value(),
+        headVeh
+    };
+    static_assert(sizeof(values) / sizeof(values[0]) == ColumnsCount, "Columns are missing");
+
+    columns.resize(ColumnsCount);
+    for (std::size_t col = 0U; col < ColumnsCount; ++col) {
+        columns[col].push_back(values[col]);
+    }
+}
+
+void checkBlock(const std::uint8_t* data, std::size_t len, const Columns& expected)
+{
+    util::PvtBlockReader reader(data, len);
+    UBLOX_TEST_ASSERT(reader.valid());
+    UBLOX_TEST_ASSERT(reader.length() == len);
+    UBLOX_TEST_ASSERT(reader.rows() == expected[0].size());
+
+    std::vector<std::int64_t> values(reader.rows() + 1U);
+    for (std::size_t col = 0U; col < ColumnsCount; ++col) {
+        auto count = reader.decode(static_cast<util::PvtColumn>(col), &values[0], values.size());
+        UBLOX_TEST_ASSERT(count == reader.rows());
+        values.resize(count);
+        UBLOX_TEST_ASSERT(values == expected[col]);
+        values.resize(reader.rows() + 1U);
+    }
+}
+
+void testRoundTrip()
+{
+    static const std::size_t Rows = 256U;
+    static util::PvtRecorder<Rows> recorder;
+    Columns expected;
+    for (std::size_t row = 0U; row < Rows; ++row) {
+        auto msg = makeRow(row);
+        appendExpected(msg, expected);
+        auto complete = recorder.append(msg);
+        UBLOX_TEST_ASSERT(complete == (row == (Rows - 1U)));
+    }
+
+    UBLOX_TEST_ASSERT(recorder.pendingRows() == 0U);
+    checkBlock(recorder.blockData(), recorder.blockLength(), expected);
+
+    auto ratio =
+        static_cast<double>(Rows * NavPvtPayloadLen) / static_cast<double>(recorder.blockLength());
+    std::cout << "Compression ratio: " << ratio << " (" << recorder.blockLength() << " bytes)" << std::endl;
+    UBLOX_TEST_ASSERT(8.0 <= ratio);
+
+    // Partial block
+    Columns partial;
+    for (std::size_t row = 0U; row < 10U; ++row) {
+        auto msg = makeRow(Rows + row);
+        appendExpected(msg, partial);
+        UBLOX_TEST_ASSERT(!recorder.append(msg));
+    }
+    UBLOX_TEST_ASSERT(recorder.pendingRows() == 10U);
+    UBLOX_TEST_ASSERT(recorder.flush());
+    UBLOX_TEST_ASSERT(!recorder.flush());
+    checkBlock(recorder.blockData(), recorder.blockLength(), partial);
+}
+
+void testExtremeValues()
+{
+    static util::PvtRecorder<4U> recorder;
+    static const std::int32_t Lon[] = {
+        std::numeric_limits<std::int32_t>::max(),
+        std::numeric_limits<std::int32_t>::min(),
+        std::numeric_limits<std::int32_t>::max(),
+        0
+    };
+
+    Columns expected;
+    for (std::size_t row = 0U; row < 4U; ++row) {
+        auto msg = makeRow(row);
+        msg.field_lon().value() = Lon[row];
+        msg.field_hAcc().value() = (row % 2U) == 0U ? std::numeric_limits<std::uint32_t>::max() : 0U;
+        appendExpected(msg, expected);
+        recorder.append(msg);
+    }
+
+    checkBlock(recorder.blockData(), recorder.blockLength(), expected);
+}
+
+void testInvalidBlock()
+{
+    static util::PvtRecorder<2U> recorder;
+    recorder.append(makeRow(0U));
+    UBLOX_TEST_ASSERT(recorder.append(makeRow(1U)));
+    std::vector<std::uint8_t> block(recorder.blockData(), recorder.blockData() + recorder.blockLength());
+
+    UBLOX_TEST_ASSERT(!util::PvtBlockReader(&block[0], block.size() - 1U).valid());
+
+    block[0] = 'X';
+    util::PvtBlockReader reader(&block[0], block.size());
+    UBLOX_TEST_ASSERT(!reader.valid());
+    std::int64_t value = 0;
+    UBLOX_TEST_ASSERT(!reader.column(util::PvtColumn::lat).next(value));
+}
+
+}  // namespace
+
+int main()
+{
+    testRoundTrip();
+    testExtremeValues();
+    testInvalidBlock();
+    return 0;
+}
@@ -0,0 +1,201 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the raw frame retention when reading messages from contiguous
+// buffer. The protocol stack is replaced by minimal UBX frame parser, which
+// advances the read iterator the same way ublox::Stack does.
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "ublox/protocol/RawFrame.h"
+#include "ublox/protocol/Frame.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace protocol = ublox::protocol;
+
+class TestMessageBase
+{
+public:
+    virtual ~TestMessageBase() = default;
+
+    ublox::MsgId getId() const
+    {
+        return m_id;
+    }
+
+    void setId(ublox::MsgId id)
+    {
+        m_id = id;
+    }
+
+private:
+    ublox::MsgId m_id = static_cast<ublox::MsgId>(0);
+};
+
+typedef protocol::RawFrameRetaining<TestMessageBase> TestMessage;
+typedef std::unique_ptr<TestMessage> TestMsgPtr;
+
+class TestStack
+{
+public:
+    comms::ErrorStatus read(
+        TestMsgPtr& msgPtr,
+        const std::uint8_t*& iter,
+        std::size_t len,
+        std::size_t* missingSize)
+    {
+        msgPtr.reset();
+        if (len < protocol::FrameHeaderLen) {
+            reportMissing(missingSize, protocol::FrameHeaderLen - len);
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        if ((iter[0] != protocol::FrameSyncChar1) || (iter[1] != protocol::FrameSyncChar2)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        auto payloadLen = protocol::framePayloadLength(iter);
+        auto frameLen = protocol::frameLength(payloadLen);
+        if (len < frameLen) {
+            reportMissing(missingSize, frameLen - len);
+            return comms::ErrorStatus::NotEnoughData;
+        }
+
+        if (!protocol::frameChecksumValid(iter, payloadLen)) {
+            return comms::ErrorStatus::ProtocolError;
+        }
+
+        msgPtr.reset(new TestMessage);
+        msgPtr->setId(protocol::frameMsgId(iter));
+        iter += frameLen;
+        return comms::ErrorStatus::Success;
+    }
+
+private:
+    static void reportMissing(std::size_t* missingSize, std::size_t value)
+    {
+        if (missingSize != nullptr) {
+            *missingSize = value;
+        }
+    }
+};
+
+std::vector<std::uint8_t> makeFrame(ublox::MsgId id, std::size_t payloadLen)
+{
+    std::vector<std::uint8_t> payload(payloadLen);
+    for (std::size_t idx = 0U; idx < payloadLen; ++idx) {
+        payload[idx] = static_cast<std::uint8_t>(idx + 1U);
+    }
+
+    std::vector<std::uint8_t> frame(protocol::frameLength(payloadLen));
+    protocol::writeFrame(id, payload.data(), payload.size(), frame.data());
+    return frame;
+}
+
+void testView()
+{
+    protocol::RawFrame empty;
+    UBLOX_TEST_ASSERT(empty.empty());
+    UBLOX_TEST_ASSERT(empty.size() == 0U);
+    UBLOX_TEST_ASSERT(empty.begin() == empty.end());
+
+    static const std::uint8_t Data[] = {0xb5, 0x62, 0x01, 0x07};
+    protocol::RawFrame view(Data, sizeof(Data));
+    UBLOX_TEST_ASSERT(!view.empty());
+    UBLOX_TEST_ASSERT(view.data() == &Data[0]);
+    UBLOX_TEST_ASSERT(view.size() == sizeof(Data));
+    UBLOX_TEST_ASSERT(view.end() - view.begin() == static_cast<std::ptrdiff_t>(sizeof(Data)));
+
+    view.clear();
+    UBLOX_TEST_ASSERT(view.empty());
+    UBLOX_TEST_ASSERT(view.data() == nullptr);
+
+    TestMessage msg;
+    UBLOX_TEST_ASSERT(msg.rawFrame().empty());
+}
+
+void testConsecutiveFrames()
+{
+    auto first = makeFrame(ublox::MsgId_NAV_PVT, 92U);
+    auto second = makeFrame(ublox::MsgId_ACK_ACK, 2U);
+    std::vector<std::uint8_t> buf(first);
+    buf.insert(buf.end(), second.begin(), second.end());
+
+    TestStack stack;
+    TestMsgPtr msgPtr;
+    const std::uint8_t* iter = buf.data();
+    auto es = protocol::readRetainingFrame(stack, msgPtr, iter, buf.size());
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_ASSERT(msgPtr);
+    UBLOX_TEST_ASSERT(msgPtr->getId() == ublox::MsgId_NAV_PVT);
+    UBLOX_TEST_ASSERT(msgPtr->rawFrame().data() == buf.data());
+    UBLOX_TEST_ASSERT(msgPtr->rawFrame().size() == first.size());
+    UBLOX_TEST_ASSERT(iter == buf.data() + first.size());
+
+    auto remaining = buf.size() - first.size();
+    es = protocol::readRetainingFrame(stack, msgPtr, iter, remaining);
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+    UBLOX_TEST_ASSERT(msgPtr->getId() == ublox::MsgId_ACK_ACK);
+    UBLOX_TEST_ASSERT(msgPtr->rawFrame().data() == buf.data() + first.size());
+    UBLOX_TEST_ASSERT(std::vector<std::uint8_t>(msgPtr->rawFrame().begin(), msgPtr->rawFrame().end()) == second);
+    UBLOX_TEST_ASSERT(iter == buf.data() + buf.size());
+}
+
+void testIncompleteFrame()
+{
+    auto frame = makeFrame(ublox::MsgId_NAV_PVT, 92U);
+    TestStack stack;
+    TestMsgPtr msgPtr;
+    const std::uint8_t* iter = frame.data();
+    std::size_t missing = 0U;
+    auto es = protocol::readRetainingFrame(stack, msgPtr, iter, frame.size() - 10U, &missing);
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::NotEnoughData);
+    UBLOX_TEST_ASSERT(!msgPtr);
+    UBLOX_TEST_ASSERT(missing == 10U);
+    UBLOX_TEST_ASSERT(iter == frame.data());
+}
+
+void testCorruptedFrame()
+{
+    auto frame = makeFrame(ublox::MsgId_NAV_PVT, 92U);
+    frame[protocol::FrameHeaderLen] ^= 0xffU;
+    TestStack stack;
+    TestMsgPtr msgPtr;
+    const std::uint8_t* iter = frame.data();
+    auto es = protocol::readRetainingFrame(stack, msgPtr, iter, frame.size());
+    UBLOX_TEST_ASSERT(es == comms::ErrorStatus::ProtocolError);
+    UBLOX_TEST_ASSERT(!msgPtr);
+    UBLOX_TEST_ASSERT(iter == frame.data());
+}
+
+}  // namespace
+
+int main()
+{
+    testView();
+    testConsecutiveFrames();
+    testIncompleteFrame();
+    testCorruptedFrame();
+    return 0;
+}
@@ -0,0 +1,240 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures compression ratio and encoding / decoding throughput of the
+// RXM-RAWX archive codec on the simulated one hour session at 1 Hz and
+// verifies that the decoded payloads are bit exact copies of the encoded ones.
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <iostream>
+
+#include "ublox/util/RawxCodec.h"
+
+#include "common.h"
+
+namespace
+{
+
+typedef std::vector<std::uint8_t> Payload;
+typedef ublox::field::common::GnssId GnssId;
+
+static const std::size_t EpochsCount = 3600U;
+static const unsigned Iterations = 5U;
+
+struct Signal
+{
+    GnssId m_gnssId;
+    std::uint8_t m_svId;
+    std::uint8_t m_freqId;
+    double m_range; // m
+    double m_rate; // m/s
+    double m_accel; // m/s^2
+    double m_ambiguity; // cycles
+    std::uint16_t m_locktime; // ms
+    std::uint8_t m_cno;
+};
+
+template <typename T>
+void store(Payload& payload, std::size_t offset, T value)
+{
+    std::uint8_t bytes[sizeof(T)];
+    std::memcpy(&bytes[0], &value, sizeof(T));
+    for (std::size_t idx = 0U; idx < sizeof(T); ++idx) {
+        payload[offset + idx] = bytes[idx]; // little endian host is assumed
+    }
+}
+
+std::vector<Payload> makeSession()
+{
+    std::mt19937 gen(2017U);
+    std::normal_distribution<double> prNoise(0.0, 0.5);
+    std::normal_distribution<double> cpNoise(0.0, 0.01);
+    std::normal_distribution<double> dopplerNoise(0.0, 0.05);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    std::vector<Signal> signals;
+    auto addSignals =
+        [&signals, &uniform, &gen](GnssId gnssId, unsigned count, bool glonass)
+        {
+            for (unsigned idx = 0U; idx < count; ++idx) {
+                Signal sig;
+                sig.m_gnssId = gnssId;
+                sig.m_svId = static_cast<std::uint8_t>(idx + 1U);
+                sig.m_freqId = static_cast<std::uint8_t>(glonass ? (idx % 14U) : 0U);
+                sig.m_range = 2.0e7 + (uniform(gen) * 5.0e6);
+                sig.m_rate = (uniform(gen) - 0.5) * 1600.0;
+                sig.m_accel = (uniform(gen) - 0.5) * 0.3;
+                sig.m_ambiguity = std::round(uniform(gen) * 1.0e6);
+                sig.m_locktime = 0U;
+                sig.m_cno = static_cast<std::uint8_t>(25U + (idx * 3U) % 25U);
+                signals.push_back(sig);
+            }
+        };
+
+    addSignals(GnssId::Gps, 10U, false);
+    addSignals(GnssId::Glonass, 8U, true);
+    addSignals(GnssId::Galileo, 8U, false);
+    addSignals(GnssId::BeiDou, 6U, false);
+
+    std::vector<Payload> session;
+    for (std::size_t epoch = 0U; epoch < EpochsCount; ++epoch) {
+        auto numMeas = signals.size();
+        Payload payload(ublox::util::details::RawxHeaderLen + (numMeas * ublox::util::details::RawxMeasLen), 0U);
+        store(payload, 0U, 345600.0 + static_cast<double>(epoch) + 0.0005);
+        store(payload, 8U, static_cast<std::uint16_t>(2300U));
+        store(payload, 10U, static_cast<std::int8_t>(18));
+        store(payload, 11U, static_cast<std::uint8_t>(numMeas));
+        store(payload, 12U, static_cast<std::uint8_t>(0x1));
+        store(payload, 13U, static_cast<std::uint8_t>(0x1));
+
+        for (std::size_t idx = 0U; idx < numMeas; ++idx) {
+            auto& sig = signals[idx];
+            auto freq = ublox::util::details::rtcmCarrierFreq(sig.m_gnssId, sig.m_freqId);
+            auto wavelength = ublox::util::details::RtcmSpeedOfLight / freq;
+
+            // Occasional cycle slip
+            if (uniform(gen) < 0.001) {
+                sig.m_ambiguity += std::round((uniform(gen) - 0.5) * 100.0);
+                sig.m_locktime = 0U;
+            }
+
+            if (uniform(gen) < 0.02) {
+                sig.m_cno = static_cast<std::uint8_t>(sig.m_cno + ((uniform(gen) < 0.5) ? 1 : -1));
+            }
+
+            auto offset = ublox::util::details::RawxHeaderLen + (idx * ublox::util::details::RawxMeasLen);
+            store(payload, offset, sig.m_range + prNoise(gen));
+            store(payload, offset + 8U, (sig.m_range / wavelength) + sig.m_ambiguity + cpNoise(gen));
+            store(payload, offset + 16U, static_cast<float>((-sig.m_rate / wavelength) + dopplerNoise(gen)));
+            payload[offset + 20U] = static_cast<std::uint8_t>(sig.m_gnssId);
+            payload[offset + 21U] = sig.m_svId;
+            payload[offset + 23U] = sig.m_freqId;
+            store(payload, offset + 24U, sig.m_locktime);
+            payload[offset + 26U] = sig.m_cno;
+            payload[offset + 27U] = 5U; // prStdev
+            payload[offset + 28U] = 2U; // cpStdev
+            payload[offset + 29U] = 4U; // doStdev
+            payload[offset + 30U] = 0x7; // trkStat
+
+            sig.m_range += sig.m_rate + (0.5 * sig.m_accel);
+            sig.m_rate += sig.m_accel;
+            sig.m_locktime = static_cast<std::uint16_t>(std::min(sig.m_locktime + 1000U, 64500U));
+        }
+
+        session.push_back(payload);
+    }
+    return session;
+}
+
+struct RecordCollector
+{
+    explicit RecordCollector(std::vector<std::uint8_t>& out) : m_out(&out) {}
+
+    void operator()(const std::uint8_t* data, std::size_t len)
+    {
+        m_out->insert(m_out->end(), data, data + len);
+    }
+
+    std::vector<std::uint8_t>* m_out;
+};
+
+struct NullOutput
+{
+    void operator()(const std::uint8_t* data, std::size_t len)
+    {
+        ublox::test::doNotOptimise(data);
+        ublox::test::doNotOptimise(len);
+    }
+};
+
+}  // namespace
+
+int main()
+{
+    auto session = makeSession();
+    std::size_t inputBytes = 0U;
+    for (auto& payload : session) {
+        inputBytes += payload.size();
+    }
+
+    // Compression ratio and round trip
+    std::vector<std::uint8_t> archive;
+    ublox::util::RawxArchiveEncoder<RecordCollector> encoder((RecordCollector(archive)));
+    for (auto& payload : session) {
+        encoder.encode(&payload[0], payload.size());
+    }
+
+    UBLOX_TEST_ASSERT(encoder.stats().m_rawRecords == 0U);
+    UBLOX_TEST_ASSERT(encoder.stats().m_outputBytes == archive.size());
+
+    ublox::util::RawxArchiveDecoder decoder;
+    const std::uint8_t* iter = &archive[0];
+    for (auto& payload : session) {
+        auto remaining = static_cast<std::size_t>(&archive[0] + archive.size() - iter);
+        UBLOX_TEST_ASSERT(decoder.decode(iter, remaining) == comms::ErrorStatus::Success);
+        UBLOX_TEST_ASSERT(decoder.payloadLength() == payload.size());
+        UBLOX_TEST_ASSERT(std::memcmp(decoder.payload(), &payload[0], payload.size()) == 0);
+    }
+    UBLOX_TEST_ASSERT(iter == (&archive[0] + archive.size()));
+
+    auto ratio = static_cast<double>(inputBytes) / static_cast<double>(archive.size());
+    std::cout << "RXM-RAWX archive: " << session.size() << " epochs, "
+              << inputBytes << " -> " << archive.size() << " bytes, ratio " << ratio << std::endl;
+    UBLOX_TEST_ASSERT(2.0 < ratio);
+
+    // Throughput
+    auto encodeNs =
+        ublox::test::measureNs(
+            [&session]()
+            {
+                for (auto iteration = 0U; iteration < Iterations; ++iteration) {
+                    ublox::util::RawxArchiveEncoder<NullOutput> nullEncoder((NullOutput()));
+                    for (auto& payload : session) {
+                        nullEncoder.encode(&payload[0], payload.size());
+                    }
+                }
+            });
+
+    auto decodeNs =
+        ublox::test::measureNs(
+            [&archive]()
+            {
+                for (auto iteration = 0U; iteration < Iterations; ++iteration) {
+                    ublox::util::RawxArchiveDecoder iterDecoder;
+                    const std::uint8_t* recordIter = &archive[0];
+                    auto end = recordIter + archive.size();
+                    while (recordIter != end) {
+                        auto es = iterDecoder.decode(recordIter, static_cast<std::size_t>(end - recordIter));
+                        UBLOX_TEST_ASSERT(es == comms::ErrorStatus::Success);
+                    }
+                    ublox::test::doNotOptimise(iterDecoder);
+                }
+            });
+
+    auto totalBytes = static_cast<double>(inputBytes) * Iterations;
+    std::cout << "encode: " << (totalBytes * 1.0e3) / encodeNs << " MB/s, "
+              << encodeNs / (static_cast<double>(session.size()) * Iterations) << " ns/epoch" << std::endl;
+    std::cout << "decode: " << (totalBytes * 1.0e3) / decodeNs << " MB/s, "
+              << decodeNs / (static_cast<double>(session.size()) * Iterations) << " ns/epoch" << std::endl;
+    return 0;
+}
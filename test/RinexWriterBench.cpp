@@ -0,0 +1,110 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures conversion of a day of 1 Hz multi-GNSS RXM-RAWX epochs into the
+// RINEX observation file, formatted by the caller and by the worker thread.
+
+#include <cstdint>
+#include <cstddef>
+#include <random>
+#include <iostream>
+
+#include "ublox/util/RinexWriter.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef message::RxmRawx<> RxmRawx;
+
+static const unsigned EpochsCount = 86400U;
+static const unsigned SatellitesCount = 32U;
+
+// Counts the written bytes only, the file system is not measured
+struct Output
+{
+    void operator()(const char* data, std::size_t len)
+    {
+        ublox::test::doNotOptimise(data[0]);
+        *m_bytes += len;
+    }
+
+    std::size_t* m_bytes;
+};
+
+RxmRawx makeEpoch()
+{
+    static const GnssId Systems[] = {GnssId::Gps, GnssId::Galileo, GnssId::BeiDou, GnssId::Glonass};
+
+    std::mt19937 gen(12345U);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    RxmRawx msg;
+    msg.field_week().value() = 1950U;
+    auto& list = msg.field_data().value();
+    list.resize(SatellitesCount);
+    for (std::size_t idx = 0U; idx < list.size(); ++idx) {
+        auto& block = list[idx];
+        block.field_gnssId().value() = Systems[idx % 4U];
+        block.field_svId().value() = static_cast<std::uint8_t>(1U + (idx / 4U));
+        block.field_freqId().value() = 7U;
+        block.field_prMes().value() = 20000000.0 + (5000000.0 * dist(gen));
+        block.field_cpMes().value() = 100000000.0 + (30000000.0 * dist(gen));
+        block.field_doMes().value() = static_cast<float>(8000.0 * (dist(gen) - 0.5));
+        block.field_cno().value() = static_cast<std::uint8_t>(25.0 + (25.0 * dist(gen)));
+        block.field_locktime().value() = 64000U;
+        block.field_trkStat().value() = 0x7U;
+    }
+    return msg;
+}
+
+void convertDay(const char* name, bool worker)
+{
+    std::size_t bytes = 0U;
+    auto msg = makeEpoch();
+    auto ns = ublox::test::measureNs(
+        [&]()
+        {
+            util::RinexObsWriter<Output> writer(Output{&bytes}, util::RinexHeaderInfo());
+            if (worker) {
+                writer.startWorker();
+            }
+
+            for (unsigned epoch = 0U; epoch < EpochsCount; ++epoch) {
+                msg.field_rcvTow().value() = 345600.0 + epoch;
+                writer.handle(msg);
+            }
+        });
+
+    auto seconds = ns / 1e9;
+    std::cout << name << ": " << seconds << " s/day, " <<
+        (static_cast<double>(bytes) / (1024.0 * 1024.0)) / seconds << " MB/s, " <<
+        ns / (static_cast<double>(EpochsCount) * SatellitesCount) << " ns/observation" << std::endl;
+}
+
+}  // namespace
+
+int main()
+{
+    convertDay("caller", false);
+    convertDay("worker", true);
+    return 0;
+}
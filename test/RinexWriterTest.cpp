@@ -0,0 +1,320 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the RINEX writers: RINEX 3.03 observation and navigation files
+// compared with the expected text, output of the worker thread and output
+// in multiple blocks.
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+#include "ublox/util/RinexWriter.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef message::RxmRawx<> RxmRawx;
+
+struct Output
+{
+    void operator()(const char* data, std::size_t len)
+    {
+        m_text->append(data, len);
+        ++(*m_blocks);
+    }
+
+    std::string* m_text;
+    std::size_t* m_blocks;
+};
+
+static const char* ExpectedObs =
+    "     3.03           OBSERVATION DATA    M                   RINEX VERSION / TYPE\n"
+    "ublox               TEST                20170524 000000 UTC PGM / RUN BY / DATE\n"
+    "BASE                                                        MARKER NAME\n"
+    "NON_GEODETIC                                                MARKER TYPE\n"
+    "OBSERVER            AGENCY                                  OBSERVER / AGENCY\n"
+    "123                 UBLOX               HPG 1.00            REC # / TYPE / VERS\n"
+    "456                 ANT                                     ANT # / TYPE\n"
+    "  4027881.3282   307045.6005  4919475.2335                  APPROX POSITION XYZ\n"
+    "        0.1000        0.0000        0.0000                  ANTENNA: DELTA H/E/N\n"
+    "G    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES\n"
+    "R    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES\n"
+    "E    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES\n"
+    "C    4 C2I L2I D2I S2I                                      SYS / # / OBS TYPES\n"
+    "J    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES\n"
+    "S    4 C1C L1C D1C S1C                                      SYS / # / OBS TYPES\n"
+    "     1.000                                                  INTERVAL\n"
+    "  2017     5    25     0     0    0.0000000     GPS         TIME OF FIRST OBS\n"
+    "G L1C  0.00000                                              SYS / PHASE SHIFT\n"
+    "R L1C  0.00000                                              SYS / PHASE SHIFT\n"
+    "E L1C  0.00000                                              SYS / PHASE SHIFT\n"
+    "C L2I  0.00000                                              SYS / PHASE SHIFT\n"
+    "J L1C  0.00000                                              SYS / PHASE SHIFT\n"
+    "S L1C  0.00000                                              SYS / PHASE SHIFT\n"
+    "  1 R03  1                                                  GLONASS SLOT / FRQ #\n"
+    " C1C    0.000 C1P    0.000 C2C    0.000 C2P    0.000        GLONASS COD/PHS/BIS\n"
+    "                                                            END OF HEADER\n"
+    "> 2017 05 25 00 00  0.0000000  0  5\n"
+    "G05  21000000.123 7 110356741.456 7     -1234.500 7        45.000  \n"
+    "R03  19500000.500 6 104400000.25026      2000.250 6        38.000  \n"
+    "E11  24000000.750 8                       100.000 8        52.000  \n"
+    "C19  22000000.000 1 114556000.000 1      -300.125 1         4.000  \n"
+    "S20  37000000.000 6 194000000.000 6         1.500 6        40.000  \n"
+    "> 2017 05 25 00 00  1.5000000  0  1\n"
+    "G05  21000000.123 7 110356741.45617     -1234.500 7        45.000  \n";
+
+static const char* ExpectedNav =
+    "     3.03           N: GNSS NAV DATA    M                   RINEX VERSION / TYPE\n"
+    "ublox               TEST                20170524 000000 UTC PGM / RUN BY / DATE\n"
+    "GPSA   1.1176E-08  7.4506E-09 -5.9605E-08 -5.9605E-08       IONOSPHERIC CORR\n"
+    "GPSB   9.0112E+04  0.0000E+00 -1.9661E+05 -6.5536E+04       IONOSPHERIC CORR\n"
+    "GPUT -9.3132257462E-10-8.881784197E-16 405504 1950          TIME SYSTEM CORR\n"
+    "    18    18  1929     7                                    LEAP SECONDS\n"
+    "                                                            END OF HEADER\n"
+    "G05 2017 05 25 00 00 00-5.748000000000E-04-1.398400000000E-11 0.000000000000E+00\n"
+    "     8.500000000000E+01-3.856250000000E+01 4.500000000000E-09-1.800000000000E+00\n"
+    "    -1.200000000000E-06 9.800000000000E-03 6.400000000000E-06 5.153640000000E+03\n"
+    "     3.456000000000E+05-4.284000000000E-08-1.500000000000E+00 8.380000000000E-08\n"
+    "     9.655000000000E-01 2.391875000000E+02 7.500000000000E-01-8.100000000000E-09\n"
+    "     1.200000000000E-10 0.000000000000E+00 1.950000000000E+03 0.000000000000E+00\n"
+    "     2.400000000000E+00 0.000000000000E+00-5.587935447693E-09 3.410000000000E+02\n"
+    "     9.999000000000E+08 0.000000000000E+00\n"
+    "R03 2017 05 25 00 15 00-1.200000000000E-05 9.094947017729E-13 3.464700000000E+05\n"
+    "     1.234567800000E+04-1.234500000000E+00 9.300000000000E-10 0.000000000000E+00\n"
+    "    -2.345678950000E+04 2.345250000000E+00 0.000000000000E+00 1.000000000000E+00\n"
+    "     5.000000000000E+03 3.000000000000E+00 0.000000000000E+00 2.000000000000E+00\n";
+
+util::RinexHeaderInfo headerInfo()
+{
+    util::RinexHeaderInfo info;
+    info.m_runBy = "TEST";
+    info.m_date = "20170524 000000 UTC";
+    info.m_markerName = "BASE";
+    info.m_observer = "OBSERVER";
+    info.m_agency = "AGENCY";
+    info.m_receiverNumber = "123";
+    info.m_receiverVersion = "HPG 1.00";
+    info.m_antennaNumber = "456";
+    info.m_antennaType = "ANT";
+    info.m_approxPos[0] = 4027881.3282;
+    info.m_approxPos[1] = 307045.6005;
+    info.m_approxPos[2] = 4919475.2335;
+    info.m_antennaDelta[0] = 0.1;
+    info.m_interval = 1.0;
+    return info;
+}
+
+void addMeas(
+    RxmRawx& msg,
+    GnssId gnssId,
+    unsigned svId,
+    unsigned freqId,
+    double pr,
+    double cp,
+    float doppler,
+    unsigned cno,
+    unsigned locktime,
+    unsigned trkStat)
+{
+    auto& list = msg.field_data().value();
+    list.resize(list.size() + 1U);
+    auto& block = list.back();
+    block.field_gnssId().value() = gnssId;
+    block.field_svId().value() = static_cast<std::uint8_t>(svId);
+    block.field_freqId().value() = static_cast<std::uint8_t>(freqId);
+    block.field_prMes().value() = pr;
+    block.field_cpMes().value() = cp;
+    block.field_doMes().value() = doppler;
+    block.field_cno().value() = static_cast<std::uint8_t>(cno);
+    block.field_locktime().value() = static_cast<std::uint16_t>(locktime);
+    block.field_trkStat().value() = static_cast<std::uint8_t>(trkStat);
+}
+
+// Epoch of all the systems: second signal of the satellite, GLONASS
+// satellite with unknown slot and unsupported system are not written
+RxmRawx firstEpoch()
+{
+    RxmRawx msg;
+    msg.field_week().value() = 1950U;
+    msg.field_rcvTow().value() = 345600.0;
+    addMeas(msg, GnssId::Gps, 5U, 0U, 21000000.123, 110356741.456, -1234.5f, 45U, 1000U, 0x7U);
+    addMeas(msg, GnssId::Gps, 5U, 0U, 21000001.0, 0.0, 0.0f, 30U, 1000U, 0x7U);
+    addMeas(msg, GnssId::Glonass, 3U, 8U, 19500000.5, 104400000.25, 2000.25f, 38U, 2000U, 0x3U);
+    addMeas(msg, GnssId::Glonass, 255U, 2U, 1.0, 1.0, 1.0f, 20U, 0U, 0x7U);
+    addMeas(msg, GnssId::Galileo, 11U, 0U, 24000000.75, -5.5, 100.0f, 52U, 0U, 0x1U);
+    addMeas(msg, GnssId::BeiDou, 19U, 0U, 22000000.0, 114556000.0, -300.125f, 4U, 64000U, 0x7U);
+    addMeas(msg, GnssId::Sbas, 120U, 0U, 37000000.0, 194000000.0, 1.5f, 40U, 100U, 0x7U);
+    addMeas(msg, GnssId::Imes, 1U, 0U, 1.0, 1.0, 1.0f, 40U, 100U, 0x7U);
+    return msg;
+}
+
+void testObservations()
+{
+    std::string text;
+    std::size_t blocks = 0U;
+    {
+        util::RinexObsWriter<Output> writer(Output{&text, &blocks}, headerInfo());
+        auto msg = firstEpoch();
+        writer.handle(msg);
+
+        // Lock time decreased, loss of lock is reported
+        msg.field_rcvTow().value() = 345601.5;
+        msg.field_data().value().resize(1U);
+        msg.field_data().value()[0].field_locktime().value() = 500U;
+        writer.handle(msg);
+        UBLOX_TEST_ASSERT(writer.epochs() == 2U);
+        UBLOX_TEST_ASSERT(blocks == 0U);
+    }
+
+    UBLOX_TEST_ASSERT(blocks == 1U);
+    UBLOX_TEST_ASSERT(text == ExpectedObs);
+}
+
+void testNavigation()
+{
+    std::string text;
+    std::size_t blocks = 0U;
+    {
+        util::RinexNavWriter<Output> writer(Output{&text, &blocks}, headerInfo());
+
+        // Galileo week is not known yet
+        util::KeplerEphemeris eph = util::KeplerEphemeris();
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::Galileo);
+        eph.m_svId = 11U;
+        writer.handle(eph);
+        UBLOX_TEST_ASSERT(writer.skipped() == 1U);
+
+        writer.setReferenceTime(1950U, 345600.0, 18);
+        util::KlobucharIono iono = {0U, 1.1176e-08, 7.4506e-09, -5.9605e-08, -5.9605e-08, 90112.0, 0.0, -196608.0, -65536.0};
+        writer.handle(iono);
+
+        util::GnssUtcParams utc = util::GnssUtcParams();
+        utc.m_gnssId = static_cast<std::uint8_t>(GnssId::Gps);
+        utc.m_dtLs = 18;
+        utc.m_dtLsf = 18;
+        utc.m_wnt = 1950U % 256U;
+        utc.m_wnLsf = 1929U % 256U;
+        utc.m_dn = 7U;
+        utc.m_a0 = -9.313225746155e-10;
+        utc.m_a1 = -8.881784197001e-16;
+        utc.m_tot = 405504.0;
+        writer.handle(utc);
+
+        eph.m_gnssId = static_cast<std::uint8_t>(GnssId::Gps);
+        eph.m_svId = 5U;
+        eph.m_week = 1950U % 1024U;
+        eph.m_iode = 85U;
+        eph.m_iodc = 341U;
+        eph.m_toe = 345600.0;
+        eph.m_toc = 345600.0;
+        eph.m_sqrtA = 5153.64;
+        eph.m_e = 0.0098;
+        eph.m_i0 = 0.9655;
+        eph.m_omega0 = -1.5;
+        eph.m_omega = 0.75;
+        eph.m_m0 = -1.8;
+        eph.m_deltaN = 4.5e-9;
+        eph.m_omegaDot = -8.1e-9;
+        eph.m_iDot = 1.2e-10;
+        eph.m_cuc = -1.2e-6;
+        eph.m_cus = 6.4e-6;
+        eph.m_crc = 239.1875;
+        eph.m_crs = -38.5625;
+        eph.m_cic = -4.284e-8;
+        eph.m_cis = 8.38e-8;
+        eph.m_af0 = -5.748e-4;
+        eph.m_af1 = -1.3984e-11;
+        eph.m_tgd = -5.587935447693e-9;
+        writer.handle(eph);
+
+        // Frame time and reference time in Moscow time
+        util::GlonassEphemeris glo = util::GlonassEphemeris();
+        glo.m_svId = 3U;
+        glo.m_freqNum = 1;
+        glo.m_tb = 11700.0;
+        glo.m_tk = 11670.0;
+        glo.m_x = 12345678.0;
+        glo.m_vx = -1234.5;
+        glo.m_ax = 9.3e-7;
+        glo.m_y = -23456789.5;
+        glo.m_vy = 2345.25;
+        glo.m_z = 5000000.0;
+        glo.m_vz = 3000.0;
+        glo.m_tauN = 1.2e-5;
+        glo.m_gammaN = 9.094947017729e-13;
+        glo.m_age = 2U;
+        writer.handle(glo);
+        UBLOX_TEST_ASSERT(writer.records() == 2U);
+    }
+
+    UBLOX_TEST_ASSERT(text == ExpectedNav);
+}
+
+// Long output in multiple blocks, formatted by the caller and by the worker thread
+std::string writeEpochs(bool worker, std::size_t& blocks)
+{
+    static const unsigned EpochsCount = 3000U;
+
+    std::string text;
+    blocks = 0U;
+    {
+        util::RinexObsWriter<Output> writer(Output{&text, &blocks}, headerInfo(), 0U);
+        if (worker) {
+            writer.startWorker(4U);
+        }
+
+        auto msg = firstEpoch();
+        for (unsigned epoch = 0U; epoch < EpochsCount; ++epoch) {
+            msg.field_rcvTow().value() = 345600.0 + epoch;
+            msg.field_data().value()[0].field_prMes().value() = 21000000.0 + (epoch * 0.125);
+            writer.handle(msg);
+        }
+
+        writer.flush();
+        UBLOX_TEST_ASSERT(writer.epochs() == EpochsCount);
+    }
+    return text;
+}
+
+void testBlocksAndWorker()
+{
+    std::size_t blocks = 0U;
+    auto text = writeEpochs(false, blocks);
+    UBLOX_TEST_ASSERT(1U < blocks);
+    UBLOX_TEST_ASSERT(text.compare(0U, std::string(ExpectedObs).find("> "), ExpectedObs, std::string(ExpectedObs).find("> ")) == 0);
+
+    std::size_t workerBlocks = 0U;
+    UBLOX_TEST_ASSERT(writeEpochs(true, workerBlocks) == text);
+    UBLOX_TEST_ASSERT(workerBlocks == blocks);
+}
+
+}  // namespace
+
+int main()
+{
+    testObservations();
+    testNavigation();
+    testBlocksAndWorker();
+    return 0;
+}
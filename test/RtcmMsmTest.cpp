@@ -0,0 +1,173 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Round trip tests of the RXM-RAWX epochs encoded by RtcmMsmEncoder and
+// decoded back by RtcmMsmDecoder.
+
+#include <cstdint>
+#include <cstddef>
+#include <cmath>
+#include <vector>
+
+#include "ublox/message/RxmRawx.h"
+#include "ublox/util/RtcmMsm.h"
+
+#include "common.h"
+
+namespace
+{
+
+typedef ublox::message::RxmRawx<> RxmRawx;
+typedef ublox::field::common::GnssId GnssId;
+typedef std::vector<std::vector<std::uint8_t> > Frames;
+
+struct FrameCollector
+{
+    explicit FrameCollector(Frames& frames) : m_frames(&frames) {}
+
+    void operator()(const std::uint8_t* data, std::size_t len)
+    {
+        m_frames->emplace_back(data, data + len);
+    }
+
+    Frames* m_frames;
+};
+
+struct Sat
+{
+    GnssId m_gnssId;
+    unsigned m_svId;
+};
+
+RxmRawx makeEpoch(const std::vector<Sat>& sats)
+{
+    RxmRawx msg;
+    msg.field_rcvTow().value() = 345600.0;
+    msg.field_week().value() = 2300U;
+    msg.field_leapS().value() = 18;
+
+    auto& blocks = msg.field_data().value();
+    blocks.resize(sats.size());
+    for (std::size_t idx = 0U; idx < sats.size(); ++idx) {
+        auto& block = blocks[idx];
+        auto freq = ublox::util::details::rtcmCarrierFreq(sats[idx].m_gnssId, 0U);
+        auto pr = 20000000.0 + (static_cast<double>(idx) * 123456.789);
+        block.field_prMes().value() = pr;
+        block.field_cpMes().value() = ((pr * freq) / ublox::util::details::RtcmSpeedOfLight) + 0.3;
+        block.field_doMes().value() = -1234.5f + static_cast<float>(idx);
+        block.field_gnssId().value() = sats[idx].m_gnssId;
+        block.field_svId().value() = static_cast<std::uint8_t>(sats[idx].m_svId);
+        block.field_locktime().value() = 5000U;
+        block.field_cno().value() = static_cast<std::uint8_t>(20U + (idx % 40U));
+        block.field_trkStat().value() = ((idx % 2U) == 0U) ? 0x7 : 0x3;
+    }
+    return msg;
+}
+
+void checkRoundTrip(const std::vector<Sat>& sats, ublox::util::RtcmMsmType type, std::size_t expFrames)
+{
+    auto msm7 = (type == ublox::util::RtcmMsmType::Msm7);
+    Frames frames;
+    ublox::util::RtcmStationInfo info;
+    info.m_stationId = 1234U;
+    info.m_msmType = type;
+    ublox::util::RtcmMsmEncoder<FrameCollector> encoder(FrameCollector(frames), info);
+
+    auto msg = makeEpoch(sats);
+    encoder.handle(msg);
+    UBLOX_TEST_ASSERT(frames.size() == expFrames);
+
+    std::size_t decoded = 0U;
+    for (std::size_t frameIdx = 0U; frameIdx < frames.size(); ++frameIdx) {
+        auto& frame = frames[frameIdx];
+        UBLOX_TEST_ASSERT(ublox::util::RtcmMsmDecoder::frameLength(&frame[0], frame.size()) == frame.size());
+
+        ublox::util::RtcmMsmData data;
+        UBLOX_TEST_ASSERT(ublox::util::RtcmMsmDecoder::decode(&frame[0], frame.size(), data));
+        UBLOX_TEST_ASSERT(data.m_stationId == info.m_stationId);
+        UBLOX_TEST_ASSERT(data.m_multipleMessage == ((frameIdx + 1U) < frames.size()));
+
+        for (std::size_t obsIdx = 0U; obsIdx < data.m_count; ++obsIdx) {
+            auto& obs = data.m_obs[obsIdx];
+            for (auto& block : msg.field_data().value()) {
+                if ((static_cast<unsigned>(block.field_gnssId().value()) != obs.m_gnssId) ||
+                    (block.field_svId().value() != obs.m_svId)) {
+                    continue;
+                }
+
+                ++decoded;
+                UBLOX_TEST_ASSERT((obs.m_flags & ublox::util::RtcmMsmObs::PrValid) != 0U);
+                UBLOX_TEST_NEAR(obs.m_pr, block.field_prMes().value(), 0.02);
+
+                // Carrier phase is reported only for the satellites having
+                // the slot in the satellite table (phase alignment state)
+                auto hasSlot =
+                    ublox::util::SatelliteTable::indexOf(block.field_gnssId().value(), obs.m_svId) <
+                    ublox::util::SatelliteTable::Capacity;
+                UBLOX_TEST_ASSERT(((obs.m_flags & ublox::util::RtcmMsmObs::CpValid) != 0U) == hasSlot);
+                if (hasSlot) {
+                    UBLOX_TEST_NEAR(obs.m_cp, block.field_cpMes().value(), 0.01);
+                }
+
+                auto halfCycle = ((block.field_trkStat().value() & 0x4) == 0U);
+                UBLOX_TEST_ASSERT(((obs.m_flags & ublox::util::RtcmMsmObs::HalfCycle) != 0U) == halfCycle);
+                UBLOX_TEST_NEAR(obs.m_cno, static_cast<double>(block.field_cno().value()), 1e-9);
+                UBLOX_TEST_ASSERT(obs.m_locktime <= block.field_locktime().value());
+
+                if (msm7) {
+                    UBLOX_TEST_ASSERT((obs.m_flags & ublox::util::RtcmMsmObs::DopplerValid) != 0U);
+                    UBLOX_TEST_NEAR(obs.m_doppler, block.field_doMes().value(), 0.01);
+                }
+            }
+        }
+    }
+    UBLOX_TEST_ASSERT(decoded == sats.size());
+}
+
+void testMixedSystems()
+{
+    std::vector<Sat> sats;
+    for (unsigned svId = 1U; svId <= 10U; ++svId) {
+        sats.push_back(Sat{GnssId::Gps, svId});
+        sats.push_back(Sat{GnssId::Galileo, svId + 20U});
+        sats.push_back(Sat{GnssId::BeiDou, svId + 30U});
+    }
+
+    checkRoundTrip(sats, ublox::util::RtcmMsmType::Msm4, 3U);
+    checkRoundTrip(sats, ublox::util::RtcmMsmType::Msm7, 3U);
+}
+
+void testAllSatellites()
+{
+    // All 64 bits of the satellite mask and cell mask are set
+    std::vector<Sat> sats;
+    for (unsigned svId = 1U; svId <= 64U; ++svId) {
+        sats.push_back(Sat{GnssId::Galileo, svId});
+    }
+
+    checkRoundTrip(sats, ublox::util::RtcmMsmType::Msm4, 1U);
+    checkRoundTrip(sats, ublox::util::RtcmMsmType::Msm7, 1U);
+}
+
+}  // namespace
+
+int main()
+{
+    testMixedSystems();
+    testAllSatellites();
+    return 0;
+}
@@ -0,0 +1,231 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the satellites table: indexing, legacy satellite numbering,
+// change tracking by dirty bits and by the consumers' cursors.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#include "ublox/util/SatelliteTable.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+typedef ublox::field::common::GnssId GnssId;
+typedef util::SatelliteTable Table;
+
+struct SatInfo
+{
+    GnssId m_gnssId;
+    std::uint8_t m_svId;
+    std::uint8_t m_cno;
+};
+
+message::NavSat<> makeNavSat(std::uint32_t iTOW, const std::vector<SatInfo>& sats)
+{
+    message::NavSat<> msg;
+    msg.field_iTOW().value() = iTOW;
+    msg.field_numSvs().value() = static_cast<std::uint8_t>(sats.size());
+    auto& list = msg.field_data().value();
+    list.resize(sats.size());
+    for (std::size_t idx = 0U; idx < sats.size(); ++idx) {
+        list[idx].field_gnssId().value() = sats[idx].m_gnssId;
+        list[idx].field_svId().value() = sats[idx].m_svId;
+        list[idx].field_cno().value() = sats[idx].m_cno;
+        list[idx].field_elev().value() = 45;
+        list[idx].field_azim().value() = 120;
+        list[idx].field_prRes().value() = -7;
+    }
+    return msg;
+}
+
+std::vector<std::size_t> dirtyOf(Table& table)
+{
+    std::vector<std::size_t> result;
+    table.forEachDirty(
+        [&result](std::size_t idx, const util::SatelliteState&)
+        {
+            result.push_back(idx);
+        });
+    return result;
+}
+
+std::vector<std::size_t> changedSince(const Table& table, std::uint32_t& cursor)
+{
+    std::vector<std::size_t> result;
+    table.forEachChangedSince(
+        cursor,
+        [&result](std::size_t idx, const util::SatelliteState&)
+        {
+            result.push_back(idx);
+        });
+    return result;
+}
+
+void testIndexing()
+{
+    static Table table;
+    std::vector<bool> used(Table::Capacity, false);
+    for (std::size_t idx = 0U; idx < Table::Capacity; ++idx) {
+        auto& entry = table.entry(idx);
+        auto found = Table::indexOf(static_cast<GnssId>(entry.gnssId), entry.svId);
+        UBLOX_TEST_ASSERT(found == idx);
+        UBLOX_TEST_ASSERT(!used[found]);
+        used[found] = true;
+    }
+
+    UBLOX_TEST_ASSERT(Table::indexOf(GnssId::Gps, 0U) == Table::Capacity);
+    UBLOX_TEST_ASSERT(Table::indexOf(GnssId::Gps, 33U) == Table::Capacity);
+    UBLOX_TEST_ASSERT(Table::indexOf(GnssId::Sbas, 1U) == Table::Capacity);
+    UBLOX_TEST_ASSERT(Table::indexOf(GnssId::NumOfValues, 1U) == Table::Capacity);
+    UBLOX_TEST_ASSERT(table.find(GnssId::Galileo, 0U) == nullptr);
+
+    auto* entry = table.find(GnssId::Galileo, 36U);
+    UBLOX_TEST_ASSERT(entry != nullptr);
+    UBLOX_TEST_ASSERT(entry->gnssId == static_cast<std::uint8_t>(GnssId::Galileo));
+    UBLOX_TEST_ASSERT(entry->svId == 36U);
+}
+
+void testLegacySvid()
+{
+    struct Expected
+    {
+        unsigned m_svid;
+        GnssId m_gnssId;
+        unsigned m_svId;
+    };
+
+    static const Expected Values[] = {
+        {1U, GnssId::Gps, 1U},
+        {32U, GnssId::Gps, 32U},
+        {33U, GnssId::BeiDou, 6U},
+        {65U, GnssId::Glonass, 1U},
+        {96U, GnssId::Glonass, 32U},
+        {120U, GnssId::Sbas, 120U},
+        {159U, GnssId::BeiDou, 1U},
+        {173U, GnssId::Imes, 1U},
+        {193U, GnssId::Qzss, 1U},
+        {211U, GnssId::Galileo, 1U},
+        {246U, GnssId::Galileo, 36U}
+    };
+
+    for (auto& value : Values) {
+        GnssId gnssId = GnssId::NumOfValues;
+        unsigned svId = 0U;
+        UBLOX_TEST_ASSERT(Table::fromLegacySvid(value.m_svid, gnssId, svId));
+        UBLOX_TEST_ASSERT(gnssId == value.m_gnssId);
+        UBLOX_TEST_ASSERT(svId == value.m_svId);
+    }
+
+    for (auto svid : {0U, 97U, 164U, 200U, 255U}) {
+        GnssId gnssId = GnssId::NumOfValues;
+        unsigned svId = 0U;
+        UBLOX_TEST_ASSERT(!Table::fromLegacySvid(svid, gnssId, svId));
+    }
+}
+
+void testChanges()
+{
+    static Table table;
+    auto gps5 = Table::indexOf(GnssId::Gps, 5U);
+    auto gal11 = Table::indexOf(GnssId::Galileo, 11U);
+    auto glo3 = Table::indexOf(GnssId::Glonass, 3U);
+
+    std::uint32_t fastCursor = 0U;
+    std::uint32_t slowCursor = 0U;
+
+    table.handle(
+        makeNavSat(1000U, {{GnssId::Gps, 5U, 40U}, {GnssId::Galileo, 11U, 35U}, {GnssId::Gps, 40U, 20U}}));
+    UBLOX_TEST_ASSERT(table.changesCount() == 2U);
+    UBLOX_TEST_ASSERT(table.isDirty(gps5));
+    UBLOX_TEST_ASSERT(!table.isDirty(glo3));
+    UBLOX_TEST_ASSERT((changedSince(table, fastCursor) == std::vector<std::size_t>{gps5, gal11}));
+
+    auto& entry = table.entry(gps5);
+    UBLOX_TEST_ASSERT(entry.sources == util::SatelliteSource_NavSat);
+    UBLOX_TEST_ASSERT(entry.cno == 40U);
+    UBLOX_TEST_ASSERT(entry.elev == 45);
+    UBLOX_TEST_ASSERT(entry.azim == 120);
+    UBLOX_TEST_ASSERT(entry.prRes == -70);
+    UBLOX_TEST_ASSERT(entry.iTOW == 1000U);
+
+    UBLOX_TEST_ASSERT((dirtyOf(table) == std::vector<std::size_t>{gps5, gal11}));
+    UBLOX_TEST_ASSERT(dirtyOf(table).empty());
+
+    // Only the time of the update changes, it is not reported as change
+    table.handle(makeNavSat(2000U, {{GnssId::Gps, 5U, 40U}, {GnssId::Galileo, 11U, 35U}}));
+    UBLOX_TEST_ASSERT(table.changesCount() == 2U);
+    UBLOX_TEST_ASSERT(table.entry(gps5).iTOW == 2000U);
+    UBLOX_TEST_ASSERT(dirtyOf(table).empty());
+    UBLOX_TEST_ASSERT(changedSince(table, fastCursor).empty());
+
+    table.handle(makeNavSat(3000U, {{GnssId::Gps, 5U, 40U}, {GnssId::Galileo, 11U, 36U}}));
+    UBLOX_TEST_ASSERT(table.changesCount() == 3U);
+    UBLOX_TEST_ASSERT(table.version(gal11) == 3U);
+    UBLOX_TEST_ASSERT(table.version(gps5) == 1U);
+    UBLOX_TEST_ASSERT((dirtyOf(table) == std::vector<std::size_t>{gal11}));
+    UBLOX_TEST_ASSERT((changedSince(table, fastCursor) == std::vector<std::size_t>{gal11}));
+
+    // Independent consumer sees all the changes since its own cursor
+    UBLOX_TEST_ASSERT((changedSince(table, slowCursor) == std::vector<std::size_t>{gps5, gal11}));
+    UBLOX_TEST_ASSERT(slowCursor == fastCursor);
+
+    table.clear();
+    UBLOX_TEST_ASSERT(table.entry(gps5).sources == 0U);
+    UBLOX_TEST_ASSERT(table.entry(gps5).svId == 5U);
+}
+
+void testNavSvinfo()
+{
+    message::NavSvinfo<> msg;
+    msg.field_iTOW().value() = 5000U;
+    auto& list = msg.field_data().value();
+    list.resize(2U);
+    list[0].field_svid().value() = 65U;
+    list[0].field_cno().value() = 33U;
+    list[0].field_prRes().value() = 125;
+    list[1].field_svid().value() = 250U;
+
+    static Table table;
+    table.handle(msg);
+    UBLOX_TEST_ASSERT(table.changesCount() == 1U);
+
+    auto* entry = table.find(GnssId::Glonass, 1U);
+    UBLOX_TEST_ASSERT(entry != nullptr);
+    UBLOX_TEST_ASSERT(entry->sources == util::SatelliteSource_NavSvinfo);
+    UBLOX_TEST_ASSERT(entry->cno == 33U);
+    UBLOX_TEST_ASSERT(entry->prRes == 125);
+    UBLOX_TEST_ASSERT(entry->iTOW == 5000U);
+}
+
+}  // namespace
+
+int main()
+{
+    testIndexing();
+    testLegacySvid();
+    testChanges();
+    testNavSvinfo();
+    return 0;
+}
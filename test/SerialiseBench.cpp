@@ -0,0 +1,153 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Measures throughput of the JSON and CSV serialisation of the message
+// fields and of the floating point formatting used by them.
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include "ublox/message/NavPvt.h"
+#include "ublox/message/NavSat.h"
+#include "ublox/util/json.h"
+#include "ublox/util/csv.h"
+
+#include "common.h"
+
+namespace
+{
+
+static const unsigned Iterations = 100000U;
+static const std::size_t SatellitesCount = 32U;
+
+typedef ublox::message::NavPvt<> NavPvt;
+typedef ublox::message::NavSat<> NavSat;
+
+template <typename TFunc>
+void report(const char* name, TFunc&& func)
+{
+    std::size_t bytes = 0U;
+    auto ns =
+        ublox::test::measureNs(
+            [&bytes, &func]()
+            {
+                bytes = 0U;
+                for (auto idx = 0U; idx < Iterations; ++idx) {
+                    bytes += func(idx);
+                }
+            });
+
+    std::cout << name << ": " << ns / Iterations << " ns/msg, "
+              << (static_cast<double>(bytes) * 1e3) / ns << " MB/s" << std::endl;
+}
+
+NavPvt makeNavPvt()
+{
+    NavPvt msg;
+    msg.field_iTOW().value() = 345600000U;
+    msg.field_year().value() = 2017U;
+    msg.field_month().value() = 6U;
+    msg.field_day().value() = 15U;
+    msg.field_numSV().value() = 14U;
+    msg.field_lon().value() = 1512093450;
+    msg.field_lat().value() = -338688170;
+    msg.field_height().value() = 58230;
+    msg.field_hMSL().value() = 36120;
+    msg.field_hAcc().value() = 1530U;
+    msg.field_vAcc().value() = 2410U;
+    msg.field_gSpeed().value() = 12;
+    msg.field_pDOP().value() = 132U;
+    return msg;
+}
+
+NavSat makeNavSat()
+{
+    NavSat msg;
+    msg.field_iTOW().value() = 345600000U;
+    auto& list = msg.field_data().value();
+    list.resize(SatellitesCount);
+    for (std::size_t idx = 0U; idx < list.size(); ++idx) {
+        auto& block = list[idx];
+        block.field_svId().value() = static_cast<std::uint8_t>(idx + 1U);
+        block.field_cno().value() = static_cast<std::uint8_t>(20U + idx);
+        block.field_elev().value() = static_cast<std::int8_t>(idx * 2U);
+        block.field_azim().value() = static_cast<std::int16_t>(idx * 11U);
+    }
+    msg.doRefresh();
+    return msg;
+}
+
+}  // namespace
+
+int main()
+{
+    std::vector<char> data(64U * 1024U);
+    ublox::util::TextBuffer buf(&data[0], data.size());
+
+    auto pvt = makeNavPvt();
+    report("NAV-PVT json",
+        [&buf, &pvt](unsigned idx) -> std::size_t
+        {
+            pvt.field_iTOW().value() = idx;
+            buf.clear();
+            UBLOX_TEST_ASSERT(ublox::util::writeJson(pvt, buf));
+            return buf.size();
+        });
+
+    report("NAV-PVT csv",
+        [&buf, &pvt](unsigned idx) -> std::size_t
+        {
+            pvt.field_iTOW().value() = idx;
+            buf.clear();
+            UBLOX_TEST_ASSERT(ublox::util::writeCsv(pvt, buf));
+            return buf.size();
+        });
+
+    auto sat = makeNavSat();
+    report("NAV-SAT (32 satellites) json",
+        [&buf, &sat](unsigned idx) -> std::size_t
+        {
+            sat.field_iTOW().value() = idx;
+            buf.clear();
+            UBLOX_TEST_ASSERT(ublox::util::writeJson(sat, buf));
+            return buf.size();
+        });
+
+    report("NAV-SAT (32 satellites) csv",
+        [&buf, &sat](unsigned idx) -> std::size_t
+        {
+            sat.field_iTOW().value() = idx;
+            buf.clear();
+            UBLOX_TEST_ASSERT(ublox::util::writeCsv(sat, buf));
+            return buf.size();
+        });
+
+    for (auto precision : {10U, 17U}) {
+        std::string name = "appendDouble precision " + std::to_string(precision);
+        report(name.c_str(),
+            [&buf, precision](unsigned idx) -> std::size_t
+            {
+                buf.clear();
+                buf.appendDouble(-33.8688170123 + (idx * 1e-9), precision);
+                return buf.size();
+            });
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the JSON and CSV serialisation of the message fields.
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <initializer_list>
+#include <string>
+#include <tuple>
+
+#include "ublox/message/NavPvt.h"
+#include "ublox/util/json.h"
+#include "ublox/util/csv.h"
+
+#include "common.h"
+
+namespace
+{
+
+typedef ublox::message::NavPvt<> NavPvt;
+
+std::string toString(const ublox::util::TextBuffer& buf)
+{
+    return std::string(buf.data(), buf.size());
+}
+
+std::size_t columnsOf(const std::string& line)
+{
+    std::size_t result = 1U;
+    for (auto ch : line) {
+        if (ch == ',') {
+            ++result;
+        }
+    }
+    return result;
+}
+
+void testExplicitBitIndices()
+{
+    ublox::util::details::NamesTable names("confirmedAvai=5, confirmedDate, confirmedTime");
+    char data[64];
+    ublox::util::TextBuffer buf(data, sizeof(data));
+    names.write(buf, 7U, "bit");
+    UBLOX_TEST_ASSERT(toString(buf) == "confirmedTime");
+
+    buf.clear();
+    names.write(buf, 0U, "bit");
+    UBLOX_TEST_ASSERT(toString(buf) == "bit0");
+
+    NavPvt msg;
+    msg.field_flags2().value() = (1U << 5) | (1U << 7);
+
+    char jsonData[2048];
+    ublox::util::TextBuffer json(jsonData, sizeof(jsonData));
+    UBLOX_TEST_ASSERT(ublox::util::writeJson(msg, json));
+    UBLOX_TEST_ASSERT(toString(json).find("\"flags2\":[\"confirmedAvai\",\"confirmedTime\"]") != std::string::npos);
+
+    char csvData[2048];
+    ublox::util::TextBuffer csv(csvData, sizeof(csvData));
+    UBLOX_TEST_ASSERT(ublox::util::writeCsv(msg, csv));
+    UBLOX_TEST_ASSERT(toString(csv).find("confirmedAvai|confirmedTime") != std::string::npos);
+}
+
+void testCsvColumns()
+{
+    char headerData[2048];
+    ublox::util::TextBuffer header(headerData, sizeof(headerData));
+    UBLOX_TEST_ASSERT(ublox::util::writeCsvHeader<NavPvt>(header));
+    auto headerStr = toString(header);
+    UBLOX_TEST_ASSERT(headerStr.find("reserved") == std::string::npos);
+    UBLOX_TEST_ASSERT(headerStr.find("headVeh") != std::string::npos);
+
+    NavPvt msg;
+    for (auto mode : {comms::field::OptionalMode::Missing, comms::field::OptionalMode::Exists}) {
+        msg.field_headVeh().setMode(mode);
+        msg.field_reserved3().setMode(mode);
+
+        char rowData[2048];
+        ublox::util::TextBuffer row(rowData, sizeof(rowData));
+        UBLOX_TEST_ASSERT(ublox::util::writeCsv(msg, row));
+        UBLOX_TEST_ASSERT(columnsOf(toString(row)) == columnsOf(headerStr));
+    }
+}
+
+void testDenormals()
+{
+    static const double Values[] = {
+        std::numeric_limits<double>::denorm_min(),
+        -std::numeric_limits<double>::denorm_min(),
+        std::numeric_limits<double>::min(),
+        1e-310,
+        3.5e-320,
+        std::numeric_limits<double>::max(),
+        0.1,
+        123456.789
+    };
+
+    for (auto value : Values) {
+        char data[64];
+        ublox::util::TextBuffer buf(data, sizeof(data));
+        buf.appendDouble(value, 17U);
+        auto str = toString(buf);
+        UBLOX_TEST_ASSERT(std::strtod(str.c_str(), nullptr) == value);
+    }
+}
+
+void testIntegralLists()
+{
+    typedef ublox::field::common::FieldBase FieldBase;
+    typedef comms::field::ArrayList<FieldBase, std::uint8_t> Bytes;
+    typedef comms::field::ArrayList<FieldBase, std::uint16_t> Words;
+    typedef comms::field::ArrayList<FieldBase, std::int32_t> Ints;
+
+    std::tuple<Bytes, Words, Ints> members;
+    std::get<0>(members).value() = {0x01, 0xab};
+    std::get<1>(members).value() = {0x1234, 0xffff};
+    std::get<2>(members).value() = {-5, 7};
+    ublox::util::details::NamesTable names("bytes, words, ints");
+
+    char jsonData[256];
+    ublox::util::TextBuffer json(jsonData, sizeof(jsonData));
+    ublox::util::details::JsonFieldWriter jsonWriter(json);
+    jsonWriter.writeMembers(members, names);
+    UBLOX_TEST_ASSERT(toString(json) == "\"bytes\":\"01ab\",\"words\":[4660,65535],\"ints\":[-5,7]");
+
+    char csvData[256];
+    ublox::util::TextBuffer csv(csvData, sizeof(csvData));
+    ublox::util::details::CsvRowWriter csvWriter(csv, ',');
+    csvWriter.writeMembers(members, names);
+    UBLOX_TEST_ASSERT(toString(csv) == "01ab,4660;65535,-5;7");
+}
+
+}  // namespace
+
+int main()
+{
+    testExplicitBitIndices();
+    testCsvColumns();
+    testDenormals();
+    testIntegralLists();
+    return 0;
+}
@@ -0,0 +1,89 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+// Tests of the floating point formatting of the text buffer.
+
+#include <cstdint>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "ublox/util/TextBuffer.h"
+
+#include "common.h"
+
+namespace
+{
+
+std::string format(double value, unsigned precision)
+{
+    char data[64];
+    ublox::util::TextBuffer buf(data, sizeof(data));
+    buf.appendDouble(value, precision);
+    UBLOX_TEST_ASSERT(!buf.overflow());
+    return std::string(buf.data(), buf.size());
+}
+
+void testRoundTrip()
+{
+    std::mt19937_64 gen(12345U);
+    for (unsigned idx = 0U; idx < 200000U; ++idx) {
+        // Random bit patterns cover all the exponents and denormals
+        auto bits = gen();
+        double value = 0.0;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value)) {
+            continue;
+        }
+
+        auto str = format(value, 17U);
+        UBLOX_TEST_ASSERT(std::strtod(str.c_str(), nullptr) == value);
+    }
+
+    std::uniform_real_distribution<double> dist(-1e7, 1e7);
+    for (unsigned idx = 0U; idx < 200000U; ++idx) {
+        auto value = dist(gen);
+        auto str = format(value, 17U);
+        UBLOX_TEST_ASSERT(std::strtod(str.c_str(), nullptr) == value);
+    }
+}
+
+void testLayout()
+{
+    UBLOX_TEST_ASSERT(format(0.0, 17U) == "0");
+    UBLOX_TEST_ASSERT(format(0.1, 17U) == "0.10000000000000001");
+    UBLOX_TEST_ASSERT(format(0.1, 10U) == "0.1");
+    UBLOX_TEST_ASSERT(format(-2.5, 17U) == "-2.5");
+    UBLOX_TEST_ASSERT(format(123456.789, 10U) == "123456.789");
+    UBLOX_TEST_ASSERT(format(1e20, 17U) == "1e20");
+    UBLOX_TEST_ASSERT(format(1.5e-7, 17U) == "1.4999999999999999e-7");
+    UBLOX_TEST_ASSERT(format(0.3, 16U) == "0.3");
+    UBLOX_TEST_ASSERT(format(0.3, 17U) == "0.29999999999999999");
+    UBLOX_TEST_ASSERT(format(12345678.0, 17U) == "12345678");
+    UBLOX_TEST_ASSERT(format(0.000123, 3U) == "0.000123");
+}
+
+}  // namespace
+
+int main()
+{
+    testRoundTrip();
+    testLayout();
+    return 0;
+}
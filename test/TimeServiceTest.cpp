@@ -0,0 +1,200 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+// Tests of the time service around the leap second event at the end of
+// 2016-12-31 (GPS - UTC changed from 17 to 18 seconds), with and without
+// NAV-TIMEGPS reporting the new number of leap seconds after the event.
+
+#include <cstdint>
+#include <cstddef>
+
+#include "ublox/util/TimeService.h"
+
+#include "common.h"
+
+namespace
+{
+
+namespace util = ublox::util;
+namespace message = ublox::message;
+
+static const std::int64_t EventWeek = 1930;
+static const std::int64_t NsPerMs = 1000000LL;
+
+// GPS time of the start of the inserted second (2016-12-31 23:59:60 UTC)
+static const std::int64_t EventGpsNs = ((EventWeek * util::SecPerWeek) + 17) * util::NsPerSec;
+
+std::int64_t lastSecondUtcNs()
+{
+    return util::fromUtcDateTime(2016, 12, 31, 23, 59, 59);
+}
+
+std::int64_t newYearUtcNs()
+{
+    return util::fromUtcDateTime(2017, 1, 1, 0, 0, 0);
+}
+
+void handleTimels(util::TimeService& service, std::int8_t currLs, std::int8_t lsChange)
+{
+    message::NavTimels<> msg;
+    msg.field_iTOW().value() = 100000U;
+    msg.field_currLs().value() = currLs;
+    msg.field_lsChange().value() = lsChange;
+    msg.field_timeToLsEvent().value() = 3600;
+    msg.field_dateOfLsGpsWn().value() = static_cast<std::uint16_t>(EventWeek - 1);
+    msg.field_dateOfLsGpsDn().value() = 7U;
+    msg.field_valid().value() = 0x3;
+    service.handle(msg);
+}
+
+void handleTimegps(util::TimeService& service, std::int64_t gpsNs, std::int8_t leapS)
+{
+    auto weekNs = util::SecPerWeek * util::NsPerSec;
+    message::NavTimegps<> msg;
+    msg.field_week().value() = static_cast<std::int16_t>(gpsNs / weekNs);
+    msg.field_iTOW().value() = static_cast<std::uint32_t>((gpsNs % weekNs) / NsPerMs);
+    msg.field_leapS().value() = leapS;
+    msg.field_valid().value() = 0x7;
+    service.handle(msg);
+}
+
+std::int64_t toUtc(const util::TimeService& service, std::int64_t gpsNs)
+{
+    std::int64_t utcNs = 0;
+    UBLOX_TEST_ASSERT(service.gpsToUtc(gpsNs, utcNs));
+    return utcNs;
+}
+
+std::int64_t toGps(const util::TimeService& service, std::int64_t utcNs)
+{
+    std::int64_t gpsNs = 0;
+    UBLOX_TEST_ASSERT(service.utcToGps(utcNs, gpsNs));
+    return gpsNs;
+}
+
+void checkAroundEvent(const util::TimeService& service)
+{
+    auto conversion = service.conversion();
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs - util::NsPerSec) == 17);
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs - 1) == 17);
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs) == 18);
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs + (3600 * util::NsPerSec)) == 18);
+
+    // Before the event
+    UBLOX_TEST_ASSERT(toUtc(service, EventGpsNs - util::NsPerSec) == lastSecondUtcNs());
+    UBLOX_TEST_ASSERT(toGps(service, lastSecondUtcNs()) == (EventGpsNs - util::NsPerSec));
+
+    // The inserted second repeats the last second of the day
+    UBLOX_TEST_ASSERT(toUtc(service, EventGpsNs) == lastSecondUtcNs());
+    UBLOX_TEST_ASSERT(toUtc(service, EventGpsNs + (util::NsPerSec / 2)) == (lastSecondUtcNs() + (util::NsPerSec / 2)));
+    UBLOX_TEST_ASSERT(toGps(service, lastSecondUtcNs() + (util::NsPerSec / 2)) == (EventGpsNs - (util::NsPerSec / 2)));
+
+    // After the event
+    UBLOX_TEST_ASSERT(toUtc(service, EventGpsNs + util::NsPerSec) == newYearUtcNs());
+    UBLOX_TEST_ASSERT(toGps(service, newYearUtcNs()) == (EventGpsNs + util::NsPerSec));
+    auto laterUtcNs = newYearUtcNs() + (3600 * util::NsPerSec);
+    UBLOX_TEST_ASSERT(toUtc(service, toGps(service, laterUtcNs)) == laterUtcNs);
+    UBLOX_TEST_ASSERT(toGps(service, laterUtcNs) == (EventGpsNs + (3601 * util::NsPerSec)));
+
+    // GLONASS time follows UTC + 3h
+    std::int64_t gloNs = 0;
+    UBLOX_TEST_ASSERT(service.convert(util::TimeSystem::Gps, EventGpsNs + util::NsPerSec, util::TimeSystem::Glonass, gloNs));
+    UBLOX_TEST_ASSERT(gloNs == (newYearUtcNs() + ((util::GlonassUtcOffsetSec - util::GlonassEpochUnixSec) * util::NsPerSec)));
+}
+
+void testUnknownLeapSeconds()
+{
+    util::TimeService service;
+    std::int64_t utcNs = 0;
+    UBLOX_TEST_ASSERT(!service.gpsToUtc(EventGpsNs, utcNs));
+
+    std::int64_t galNs = 0;
+    UBLOX_TEST_ASSERT(service.convert(util::TimeSystem::Gps, EventGpsNs, util::TimeSystem::Galileo, galNs));
+    UBLOX_TEST_ASSERT(galNs == (EventGpsNs - (util::GalileoEpochGpsWeek * util::SecPerWeek * util::NsPerSec)));
+}
+
+void testEventWithoutTimegps()
+{
+    util::TimeService service;
+    handleTimels(service, 17, 1);
+    checkAroundEvent(service);
+}
+
+void testTimegpsBeforeEvent()
+{
+    util::TimeService service;
+    handleTimels(service, 17, 1);
+    handleTimegps(service, EventGpsNs - (60 * util::NsPerSec), 17);
+    checkAroundEvent(service);
+}
+
+void testTimegpsAtAndAfterEvent()
+{
+    util::TimeService service;
+    handleTimels(service, 17, 1);
+    handleTimegps(service, EventGpsNs - (60 * util::NsPerSec), 17);
+
+    // Reported number of leap seconds already includes the change
+    handleTimegps(service, EventGpsNs, 18);
+    checkAroundEvent(service);
+
+    handleTimegps(service, EventGpsNs + (60 * util::NsPerSec), 18);
+    checkAroundEvent(service);
+    UBLOX_TEST_ASSERT(toUtc(service, EventGpsNs + (61 * util::NsPerSec)) == (newYearUtcNs() + (60 * util::NsPerSec)));
+}
+
+void testTimelsAfterEvent()
+{
+    util::TimeService service;
+    handleTimels(service, 17, 1);
+    handleTimegps(service, EventGpsNs + (60 * util::NsPerSec), 18);
+
+    // No more scheduled events
+    handleTimels(service, 18, 0);
+    auto conversion = service.conversion();
+    UBLOX_TEST_ASSERT(!conversion.isValid(util::TimeConversion::ValidBit_lsEvent));
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs + util::NsPerSec) == 18);
+    UBLOX_TEST_ASSERT(toUtc(service, EventGpsNs + util::NsPerSec) == newYearUtcNs());
+    UBLOX_TEST_ASSERT(toGps(service, newYearUtcNs()) == (EventGpsNs + util::NsPerSec));
+}
+
+void testInconsistentTimegps()
+{
+    util::TimeService service;
+    handleTimels(service, 17, 1);
+
+    // Number of leap seconds unrelated to the scheduled event overrides it
+    handleTimegps(service, EventGpsNs + (60 * util::NsPerSec), 16);
+    auto conversion = service.conversion();
+    UBLOX_TEST_ASSERT(!conversion.isValid(util::TimeConversion::ValidBit_lsEvent));
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs - util::NsPerSec) == 16);
+    UBLOX_TEST_ASSERT(conversion.leapSeconds(EventGpsNs + util::NsPerSec) == 16);
+}
+
+}  // namespace
+
+int main()
+{
+    testUnknownLeapSeconds();
+    testEventWithoutTimegps();
+    testTimegpsBeforeEvent();
+    testTimegpsAtAndAfterEvent();
+    testTimelsAfterEvent();
+    testInconsistentTimegps();
+    return 0;
+}
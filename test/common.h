@@ -0,0 +1,78 @@
+//
+// Copyright 2017 (C). Alex Robenko. All rights reserved.
+//
+
+// This file is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+/// @file
+/// @brief Common definitions of the unit tests and benchmarks.
+
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+#include <chrono>
+#include <iostream>
+
+/// @brief Abort the test when the condition doesn't hold.
+#define UBLOX_TEST_ASSERT(cond_) \
+    do { \
+        if (!(cond_)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": Assertion failed: " #cond_ << std::endl; \
+            std::exit(1); \
+        } \
+    } while (false)
+
+/// @brief Abort the test when the values differ more than the tolerance.
+#define UBLOX_TEST_NEAR(val_, exp_, tol_) \
+    do { \
+        if (!(std::abs((val_) - (exp_)) <= (tol_))) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": " #val_ " = " << (val_) << \
+                ", expected " << (exp_) << " +/- " << (tol_) << std::endl; \
+            std::exit(1); \
+        } \
+    } while (false)
+
+namespace ublox
+{
+
+namespace test
+{
+
+/// @brief Measure duration of the function execution.
+/// @return Duration in nanoseconds.
+template <typename TFunc>
+double measureNs(TFunc&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+/// @brief Prevent the compiler from optimising out the computed value.
+template <typename T>
+void doNotOptimise(const T& value)
+{
+    static const void* volatile Sink = nullptr;
+    Sink = &value;
+    static_cast<void>(Sink);
+}
+
+}  // namespace test
+
+}  // namespace ublox
+